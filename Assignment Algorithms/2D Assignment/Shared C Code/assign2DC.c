@@ -5,9 +5,10 @@
  *          below) can perform cost maximization or minimization with cost
  *          matrices having positive and/or negative elements whereas the
  *          function assign2DCBasic assumes that all elements of C are
- *          positive and that only minimization is performed. See the
- *          comments to the Matlab implementation of assign2D for more
- *          details on the algorithm.
+ *          positive and that only minimization is performed. The function
+ *          assign2DCWarm performs minimization starting from the dual
+ *          variables of a related problem. See the comments to the Matlab
+ *          implementation of assign2D for more details on the algorithm.
  *
  *January 2018 David F. Crouse, Naval Research Laboratory, Washington D.C.
  */
@@ -30,6 +31,8 @@ const uint64_t infVal=0x7ff0000000000000;
 #define INFINITY (*(double*)&infVal)
 #endif
 
+static bool shortestPathAssign2DC(const double *C, ptrdiff_t *restrict col4row, ptrdiff_t * restrict row4col, void *tempBuffer, double * restrict u, double * restrict v, const size_t numRow, const size_t numCol);
+
 size_t assign2DCBufferSize(const size_t numRow, const size_t numCol) {
 /**ASSIGN2DCBUFFERSIZE Given the dimensions of the assignment matrix,
  *      return the minimum size of the input tempBuffer needed (in bytes)
@@ -187,6 +190,131 @@ double assign2DCBasic(const double *C, ptrdiff_t *restrict col4row, ptrdiff_t *
  *         indicates that the assignment problem is not feasible.
  *
  *December 2017 David F. Crouse, Naval Research Laboratory, Washington D.C.
+ **/
+    size_t curCol;
+
+    //Make sure that the u and v buffers are all zeros.
+    memset(u,0,sizeof(double)*numCol);
+    memset(v,0,sizeof(double)*numRow);
+
+    if(shortestPathAssign2DC(C, col4row, row4col, tempBuffer, u, v, numRow, numCol)) {
+        return -1;
+    }
+
+    //Determine the gain to return
+    {
+        double gain=0;
+        for(curCol=0;curCol<numCol;curCol++){
+            gain+=C[curCol*numRow+(size_t)row4col[curCol]];
+        }
+        
+        return gain;
+    }
+}
+
+bool assign2DCWarm(const double *C, double * restrict gain, ptrdiff_t * restrict col4row, ptrdiff_t * restrict row4col, void *tempBuffer, double * restrict u, double * restrict v, const size_t numRow, const size_t numCol) {
+/**ASSIGN2DCWARM Solve the same minimization problem as assign2DCBasic,
+ *      but starting from the row dual variables of a related problem, such
+ *      as the previous iteration of a Lagrangian relaxation. C can have
+ *      elements of any sign and is not modified. When the costs change
+ *      little between calls, starting from the old duals means that most
+ *      columns are assigned with short augmenting paths.
+ *
+ *INPUTS: C, col4row, row4col, tempBuffer, numRow, numCol These are the
+ *          same as in assign2DCBasic except C need not be non-negative.
+ *          tempBuffer must be at least assign2DCBufferSize(numRow,numCol)
+ *          bytes in size.
+ *     gain A pointer to a double that will hold the cost of the
+ *          assignment.
+ *     u, v Pointers to arrays of the numCol column and numRow row dual
+ *          variables. On input, v holds the row dual variables of the
+ *          related problem. u need not be initialized. On output, these
+ *          hold the dual variables for this problem, so they can be passed
+ *          to the next call.
+ *
+ *OUTPUTS: The return value is true if the problem is infeasible and false
+ *         otherwise. If infeasible, the other outputs do not mean
+ *         anything.
+ *
+ *The row constraints are inequalities when numRow>numCol, so the row duals
+ *must be <=0 and must be 0 for unassigned rows for the assignment to be
+ *optimal. Thus, positive row duals are clipped to zero and if a row having
+ *a negative initial dual is left unassigned, the problem is solved again
+ *from zero row duals. The column duals are always initialized with the
+ *largest values making all of the reduced costs non-negative, which for
+ *zero row duals is the column reduction step of the Jonker-Volgenant
+ *algorithm.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+    size_t curRow, curCol, numPasses;
+
+    for(curRow=0;curRow<numRow;curRow++) {
+        if(!(v[curRow]<0)) {
+            v[curRow]=0;
+        }
+    }
+
+    for(numPasses=0;numPasses<2;numPasses++) {
+        bool isOptimal=true;
+
+        //u(j)=min_i(C(i,j)-v(i)) so all reduced costs are non-negative.
+        for(curCol=0;curCol<numCol;curCol++) {
+            const double *CCol=C+curCol*numRow;
+            double minVal=(double)INFINITY;
+
+            for(curRow=0;curRow<numRow;curRow++) {
+                const double curVal=CCol[curRow]-v[curRow];
+                if(curVal<minVal) {
+                    minVal=curVal;
+                }
+            }
+
+            if(minVal==(double)INFINITY) {
+                //A column with no finite costs cannot be assigned.
+                return true;
+            }
+
+            u[curCol]=minVal;
+        }
+
+        if(shortestPathAssign2DC(C, col4row, row4col, tempBuffer, u, v, numRow, numCol)) {
+            return true;
+        }
+
+        //Unassigned rows keep their initial duals.
+        for(curRow=0;curRow<numRow;curRow++) {
+            if(col4row[curRow]==-1&&v[curRow]!=0) {
+                isOptimal=false;
+                break;
+            }
+        }
+
+        if(isOptimal) {
+            break;
+        }
+
+        //Start over with zero row duals, which is always valid.
+        memset(v,0,sizeof(double)*numRow);
+    }
+
+    *gain=0;
+    for(curCol=0;curCol<numCol;curCol++){
+        *gain+=C[curCol*numRow+(size_t)row4col[curCol]];
+    }
+
+    return false;
+}
+
+static bool shortestPathAssign2DC(const double *C, ptrdiff_t *restrict col4row, ptrdiff_t * restrict row4col, void *tempBuffer, double * restrict u, double * restrict v, const size_t numRow, const size_t numCol) {
+/**SHORTESTPATHASSIGN2DC The shortest augmenting path iterations shared by
+ *      assign2DCBasic and assign2DCWarm. The inputs are the same as those
+ *      of assign2DCBasic, except on input u and v must hold dual variables
+ *      such that all of the reduced costs C(i,j)-u(j)-v(i) are >=0. No
+ *      assignment is made on input. The return value is true if the
+ *      problem is infeasible and false otherwise.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
  **/
     size_t curRow,curCol,curUnassignedCol;
     
@@ -198,10 +326,6 @@ double assign2DCBasic(const double *C, ptrdiff_t *restrict col4row, ptrdiff_t *
     for(curRow=0;curRow<numRow;curRow++){
         col4row[curRow]=-1;
     }
- 
-    //Make sure that the u and v buffers are all zeros.
-    memset(u,0,sizeof(double)*numCol);
-    memset(v,0,sizeof(double)*numRow);
 
     /* Assign the memory in tempBuffer to the temporary arrays that are
      * needed. We assume that assigning the boolean variables as the last
@@ -287,7 +411,7 @@ double assign2DCBasic(const double *C, ptrdiff_t *restrict col4row, ptrdiff_t *
             if(minVal==(double)INFINITY) {
                /* If the minimum cost row is not finite, then the
                 * problem is not feasible.*/
-                return -1;
+                return true;
             }
 
             /* Change the index from the relative row index to the
@@ -343,16 +467,8 @@ double assign2DCBasic(const double *C, ptrdiff_t *restrict col4row, ptrdiff_t *
             curRow=(size_t)h;
         } while(curCol!=curUnassignedCol);
     }
-
-    //Determine the gain to return
-    {
-        double gain=0;
-        for(curCol=0;curCol<numCol;curCol++){
-            gain+=C[curCol*numRow+(size_t)row4col[curCol]];
-        }
-        
-        return gain;
-    }
+    
+    return false;
 }
 
 /*LICENSE:
@@ -0,0 +1,393 @@
+/**ASSIGN2DSPARSEC This file contains C language functions implementing a
+ *          generalized Jonker-Volgenant shortest path assignment algorithm
+ *          to solve the two-dimensional assignment problem when the cost
+ *          matrix C is sparse. Only the elements of C that are allowed
+ *          (gated) are stored; all other elements are implicitly +Inf
+ *          when minimizing and -Inf when maximizing. This is the same
+ *          algorithm as in assign2DC.c, but the scanning of the rows in
+ *          each column only visits the stored elements and the list of
+ *          rows that have been reached is kept explicitly so that the
+ *          cost of finding each augmenting path scales with the number of
+ *          rows touched rather than with the total number of rows.
+ *
+ *The sparse matrix is stored by column. The elements of column j are at
+ *indices colStart[j] to colStart[j+1]-1 of the arrays C and rowIdx, where
+ *rowIdx holds the row of each element. Each row should appear at most once
+ *in a given column.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "assignAlgs2D.h"
+
+/* string.h is needed for the memset function.*/
+#include <string.h>
+
+/*We need this for INFINITY to be defined, but if a compiler does not
+ *support C99, then it must be explicitly defined.*/
+#include <math.h>
+
+//For uint8_t and other types.
+#include <stdint.h>
+
+#ifndef INFINITY
+static const uint64_t infVal=0x7ff0000000000000;
+#define INFINITY (*(double*)&infVal)
+#endif
+
+size_t assign2DSparseCBufferSize(const size_t numRow, const size_t numCol) {
+/**ASSIGN2DSPARSECBUFFERSIZE Given the dimensions of the sparse assignment
+ *      matrix, return the minimum size of the input tempBuffer needed (in
+ *      bytes) for the assign2DSparseC and assign2DSparseCBasic algorithms.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+
+    return (numCol+4*numRow)*sizeof(size_t)+numRow*sizeof(double)+2*numRow*sizeof(bool);
+}
+
+bool assign2DSparseC(const bool maximize, double * restrict C, const size_t * restrict rowIdx, const size_t * restrict colStart, double * restrict gain, ptrdiff_t * restrict col4row, ptrdiff_t * restrict row4col, void *tempBuffer, double * restrict u, double * restrict v, const size_t numRow, const size_t numCol) {
+/**ASSIGN2DSPARSEC Solve the optimization problem
+ *      min (or max) sum_{i=0}^{numRow-1}sum_{j=0}^{numCol-1}C_{i,j}*x_{i,j}
+ *      subject to
+ *      sum_{j=0}^{numCol-1}x_{i,j}<=1 for i=0:(numRow-1)
+ *      sum_{i=0}^{numRow-1}x_{i,j}=1 for j=0:(numCol-1)
+ *      x_{i,j}=0 or 1.
+ *      where numCol<=numRow and C is sparse, so x_{i,j} can only be 1 for
+ *      elements of C that are stored. This function can handle C with
+ *      positive and negative entries. The values in C might be modified.
+ *
+ *INPUTS: maximize A boolean value indicating whether maximization is
+ *                 performed. False indicates that a minimization problem
+ *                 is to be solved.
+ *               C A pointer to the colStart[numCol] stored elements of the
+ *                 cost matrix, ordered by column. These values might be
+ *                 modified.
+ *          rowIdx A pointer to the colStart[numCol] row indices of the
+ *                 elements in C.
+ *        colStart A pointer to a length numCol+1 array such that the
+ *                 elements of column j of C are found at indices
+ *                 colStart[j] to colStart[j+1]-1 of C and rowIdx.
+ *                 colStart[0]=0.
+ *            gain A pointer to the double variable that will hold the gain
+ *                 (the cost of the assignment) returned by this function.
+ *         col4row A pointer to a length-numRow vector of type ptrdiff_t,
+ *                 in which the result of the assignment is placed. The
+ *                 entry in each element is an assignment of the element in
+ *                 that row to a column. -1 entries signify unassigned
+ *                 rows.
+ *         row4col A pointer to a length-numCol vector of type ptrdiff_t,
+ *                 in which the result of the assignment is placed. The
+ *                 entry in each element is an assignment of the element in
+ *                 that column to a row.
+ *      tempBuffer A pointer to a buffer of memory that is at least
+ *                 assign2DSparseCBufferSize(numRow,numCol) in size.
+ *            u, v Pointers to arrays of doubles that hold the dual
+ *                 variables. u must be at least numCol in size and v at
+ *                 least numRow in size.
+ *  numRow, numCol The number of rows and columns in the matrix C.
+ *
+ *OUTPUTS: The result of the assignment is placed in col4row, row4col and
+ *         the dual variables u and v if the problem is feasible. The
+ *         return value of the function is 0 if the problem is feasible and
+ *         1 if the problem is infeasible. If infeasible, the other return
+ *         values do not mean anything.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+
+    double CDelta;
+    size_t i;
+    const size_t totalNumElsInC=colStart[numCol];
+
+    /* The cost matrix must have all non-negative elements for the
+     * assignment algorithm to work. This forces all of the elements to be
+     * positive. The delta is added back in when computing the gain in the
+     * end.*/
+    if(maximize==false) {
+        CDelta=(double)INFINITY;
+        for(i=0;i<totalNumElsInC;i++) {
+            if(C[i]<CDelta)
+                CDelta=C[i];
+        }
+
+        //If C is all positive, do not shift.
+        if(CDelta>0) {
+            CDelta=0;
+        }
+
+        for(i=0;i<totalNumElsInC;i++) {
+            C[i]=C[i]-CDelta;
+        }
+    } else {
+        CDelta=-(double)INFINITY;
+        for(i=0;i<totalNumElsInC;i++) {
+            if(C[i]>CDelta)
+                CDelta=C[i];
+        }
+
+        //If C is all negative, do not shift.
+        if(CDelta<0) {
+            CDelta=0;
+        }
+
+        for(i=0;i<totalNumElsInC;i++) {
+            C[i]=-C[i]+CDelta;
+        }
+    }
+
+    CDelta=CDelta*numCol;
+
+    (*gain)=assign2DSparseCBasic(C, rowIdx, colStart, col4row, row4col, tempBuffer, u, v, numRow, numCol);
+
+    if((*gain)==-1) {
+        //If the problem is infeasible.
+        return true;
+    } else {
+        //The problem is feasible. Adjust for the shifting of the elements
+        //in C.
+        if(maximize==false) {
+            (*gain)+=CDelta;
+        } else {
+            for(i=0;i<numCol;i++){
+                u[i]=-u[i];
+            }
+            for(i=0;i<numRow;i++){
+                v[i]=-v[i];
+            }
+
+            (*gain)=-(*gain)+CDelta;
+        }
+
+        return false;
+    }
+}
+
+double assign2DSparseCBasic(const double *C, const size_t * restrict rowIdx, const size_t * restrict colStart, ptrdiff_t *restrict col4row, ptrdiff_t * restrict row4col, void *tempBuffer, double * restrict u, double * restrict v, const size_t numRow, const size_t numCol) {
+/**ASSIGN2DSPARSECBASIC Solve the optimization problem
+ *      min sum_{i=0}^{numRow-1}sum_{j=0}^{numCol-1}C_{i,j}*x_{i,j}
+ *      subject to
+ *      sum_{j=0}^{numCol-1}x_{i,j}<=1 for i=0:(numRow-1)
+ *      sum_{i=0}^{numRow-1}x_{i,j}=1 for j=0:(numCol-1)
+ *      x_{i,j}=0 or 1.
+ *      where numCol<=numRow, C is stored sparsely and all stored elements
+ *      of C are >=0. This function will not modify C.
+ *
+ *INPUTS: C, rowIdx, colStart The sparse cost matrix, stored as described
+ *          for assign2DSparseC. The entries in C must all be >=0.
+ *  col4row A pointer to a length-numRow vector of type ptrdiff_t, in which
+ *          the result of the assignment is placed. -1 entries signify
+ *          unassigned rows.
+ *  row4col A pointer to a length-numCol vector of type ptrdiff_t, in which
+ *          the result of the assignment is placed.
+ * tempBuffer A pointer to a buffer of memory that is at least
+ *          assign2DSparseCBufferSize(numRow,numCol) in size.
+ *     u, v Pointers to arrays of doubles that hold the dual variables. u
+ *          must be at least numCol in size and v at least numRow in size.
+ *  numRow, numCol The number of rows and columns in the matrix C.
+ *
+ *OUTPUTS: The assignemnt is placed in col4row and row4col. The dual
+ *         variables are in u and v. The return variable is the gain, that
+ *         is the cost of the assignment. If a gain of -1 is returned, that
+ *         indicates that the assignment problem is not feasible.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+    size_t curRow,curCol,curUnassignedCol;
+
+    for(curRow=0;curRow<numRow;curRow++){
+        col4row[curRow]=-1;
+    }
+
+    //Make sure that the u and v buffers are all zeros.
+    memset(u,0,sizeof(double)*numCol);
+    memset(v,0,sizeof(double)*numRow);
+
+    //This holds the INDICES of the scanned columns.
+    size_t * restrict ScannedColIdx=(size_t*)tempBuffer;//Length numCol
+    tempBuffer=(void*)((uint8_t*)tempBuffer+numCol*sizeof(size_t));
+
+    size_t * restrict pred=(size_t*)tempBuffer;//Length numRow
+    tempBuffer=(void*)((uint8_t*)tempBuffer+numRow*sizeof(size_t));
+
+    //The rows that have been reached, but not yet scanned.
+    size_t *restrict Row2Scan=(size_t*)tempBuffer;//Length numRow
+    tempBuffer=(void*)((uint8_t*)tempBuffer+numRow*sizeof(size_t));
+
+    //The rows that have been scanned.
+    size_t *restrict ScannedRowIdx=(size_t*)tempBuffer;//Length numRow
+    tempBuffer=(void*)((uint8_t*)tempBuffer+numRow*sizeof(size_t));
+
+    //All rows reached during the current search. This is used to reset
+    //the flags below without touching every row.
+    size_t *restrict TouchedRowIdx=(size_t*)tempBuffer;//Length numRow
+    tempBuffer=(void*)((uint8_t*)tempBuffer+numRow*sizeof(size_t));
+
+    double * restrict shortestPathCost=(double*)(tempBuffer);//Length numRow
+    tempBuffer=(void*)((uint8_t*)tempBuffer+numRow*sizeof(double));
+
+    bool * restrict ScannedRows=(bool*)(tempBuffer);//Length numRow
+    tempBuffer=(void*)((uint8_t*)tempBuffer+numRow*sizeof(bool));
+
+    bool * restrict TouchedRows=(bool*)(tempBuffer);//Length numRow
+
+    memset(ScannedRows,0,sizeof(bool)*numRow);
+    memset(TouchedRows,0,sizeof(bool)*numRow);
+
+    for(curUnassignedCol=0;curUnassignedCol<numCol;curUnassignedCol++){
+        size_t numRow2Scan,numColsScanned,numRowsScanned,numRowsTouched;
+        ptrdiff_t sink;
+        double delta;
+
+        numColsScanned=0;
+        numRowsScanned=0;
+        numRowsTouched=0;
+        numRow2Scan=0;
+        sink=-1;
+        delta=0;
+        curCol=curUnassignedCol;
+
+        do {
+            double minVal;
+            size_t curEl,curRowScan,closestRow,closestRowScan=0;
+            /*Mark the current column as having been visited.*/
+            ScannedColIdx[numColsScanned]=curCol;
+            numColsScanned++;
+
+            /*Only the stored elements in the column can lower the cost of
+             *a path.*/
+            for(curEl=colStart[curCol];curEl<colStart[curCol+1];curEl++) {
+                double reducedCost;
+
+                curRow=rowIdx[curEl];
+                if(ScannedRows[curRow]==true) {
+                    continue;
+                }
+
+                if(TouchedRows[curRow]==false) {
+                    TouchedRows[curRow]=true;
+                    TouchedRowIdx[numRowsTouched]=curRow;
+                    numRowsTouched++;
+                    Row2Scan[numRow2Scan]=curRow;
+                    numRow2Scan++;
+                    shortestPathCost[curRow]=(double)INFINITY;
+                }
+
+                reducedCost=delta+C[curEl]-u[curCol]-v[curRow];
+                if(reducedCost<shortestPathCost[curRow]){
+                    pred[curRow]=curCol;
+                    shortestPathCost[curRow]=reducedCost;
+                }
+            }
+
+            //Find the minimum unassigned row that was reached.
+            minVal=(double)INFINITY;
+            for(curRowScan=0;curRowScan<numRow2Scan;curRowScan++) {
+                curRow=Row2Scan[curRowScan];
+
+                if(shortestPathCost[curRow]<minVal){
+                    minVal=shortestPathCost[curRow];
+                    closestRowScan=curRowScan;
+                }
+            }
+
+            if(minVal==(double)INFINITY) {
+               /* If no reachable row remains, then the problem is not
+                * feasible.*/
+                return -1;
+            }
+
+            closestRow=Row2Scan[closestRowScan];
+
+            /* Add the closest row to the list of scanned rows and delete
+             * it from the list of rows to scan. The order of the rows to
+             * scan does not matter, so the last one is moved into its
+             * place.*/
+            ScannedRows[closestRow]=true;
+            ScannedRowIdx[numRowsScanned]=closestRow;
+            numRowsScanned++;
+            numRow2Scan--;
+            Row2Scan[closestRowScan]=Row2Scan[numRow2Scan];
+
+            delta=shortestPathCost[closestRow];
+            //If we have reached an unassigned column.
+            if(col4row[closestRow]==-1) {
+                sink=(ptrdiff_t)closestRow;
+            } else{
+                curCol=(size_t)col4row[closestRow];
+            }
+        } while(sink==-1);
+
+/* Next, update the dual variables.*/
+        //Update the first column in the augmenting path.
+        u[curUnassignedCol]+=delta;
+
+        //Update the rest of the columns in the augmenting path.
+        for(curCol=1;curCol<numColsScanned;curCol++) {
+            size_t curScannedIdx=ScannedColIdx[curCol];
+            u[curScannedIdx]+=delta-shortestPathCost[row4col[curScannedIdx]];
+        }
+
+        //Update the rows in the augmenting path.
+        for(curRow=0;curRow<numRowsScanned;curRow++){
+            const size_t curScannedRow=ScannedRowIdx[curRow];
+            v[curScannedRow]+=-delta+shortestPathCost[curScannedRow];
+        }
+
+        //Reset the flags of the rows that were reached.
+        for(curRow=0;curRow<numRowsTouched;curRow++) {
+            const size_t curTouchedRow=TouchedRowIdx[curRow];
+            ScannedRows[curTouchedRow]=false;
+            TouchedRows[curTouchedRow]=false;
+        }
+
+//Remove the current node from those that must be assigned.
+        curRow=(size_t)sink;
+        do{
+            ptrdiff_t h;
+            curCol=pred[curRow];
+            col4row[curRow]=(ptrdiff_t)curCol;
+            h=row4col[curCol];
+            row4col[curCol]=(ptrdiff_t)curRow;
+            curRow=(size_t)h;
+        } while(curCol!=curUnassignedCol);
+    }
+
+    //Determine the gain to return. The stored element of each column
+    //that is in the assigned row has to be found.
+    {
+        double gain=0;
+        for(curCol=0;curCol<numCol;curCol++){
+            size_t curEl;
+            const size_t assignedRow=(size_t)row4col[curCol];
+
+            for(curEl=colStart[curCol];curEl<colStart[curCol+1];curEl++) {
+                if(rowIdx[curEl]==assignedRow) {
+                    gain+=C[curEl];
+                    break;
+                }
+            }
+        }
+
+        return gain;
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -1,12 +1,13 @@
 /**ASSIGNALGS2D This is a header for C language functions to solve variants
  *              of the 2D assignment problem. The inputs of the specific
  *              functions are described in their implementation files,
- *              which are assign2DMissedDetectC.c, assign2DFullC.c, and
- *              assign2DC.c. Additionally, functions describing the amount
- *              of memory needed for the aforementioned functions are
- *              implemented and commented inline in this header as
- *              assign2DCBufferSize, assign2DMissedDetectCBufferSize,
- *              assign2DFullCBufferSize, and assign2DFullCAltBufferSize.
+ *              which are assign2DMissedDetectC.c, assign2DFullC.c,
+ *              assign2DSparseC.c, and assign2DC.c. Additionally,
+ *              functions describing the amount of memory needed for the
+ *              aforementioned functions are implemented and commented
+ *              inline in this header as assign2DCBufferSize,
+ *              assign2DMissedDetectCBufferSize, assign2DFullCBufferSize,
+ *              and assign2DFullCAltBufferSize.
  * 
  *Better understanding of the algorithms can usually be obtained from
  *looking at the Matlab implementations.
@@ -47,6 +48,11 @@
 size_t assign2DCBufferSize(const size_t numRow, const size_t numCol);
 bool assign2DC(const bool maximize, double *restrict C, double * restrict gain, ptrdiff_t * restrict col4row, ptrdiff_t * restrict row4col, void *tempBuffer, double * restrict u, double * restrict v, const size_t numRow, const size_t numCol);
 double assign2DCBasic(const double *C, ptrdiff_t * restrict col4row, ptrdiff_t * restrict row4col, void *tempBuffer, double *restrict u, double * restrict v, const size_t numRow, const size_t numCol);
+bool assign2DCWarm(const double *C, double * restrict gain, ptrdiff_t * restrict col4row, ptrdiff_t * restrict row4col, void *tempBuffer, double * restrict u, double * restrict v, const size_t numRow, const size_t numCol);
+
+size_t assign2DSparseCBufferSize(const size_t numRow, const size_t numCol);
+bool assign2DSparseC(const bool maximize, double * restrict C, const size_t * restrict rowIdx, const size_t * restrict colStart, double * restrict gain, ptrdiff_t * restrict col4row, ptrdiff_t * restrict row4col, void *tempBuffer, double * restrict u, double * restrict v, const size_t numRow, const size_t numCol);
+double assign2DSparseCBasic(const double *C, const size_t * restrict rowIdx, const size_t * restrict colStart, ptrdiff_t * restrict col4row, ptrdiff_t * restrict row4col, void *tempBuffer, double * restrict u, double * restrict v, const size_t numRow, const size_t numCol);
 
 size_t assign2DMissedDetectCBufferSize(const size_t numRowsTrue, const size_t numCol);
 bool assign2DMissedDetectC(const bool maximize, double * restrict C, double * restrict gain, ptrdiff_t * restrict tuples, void * restrict tempBuffer, double * restrict u, double * restrict v, const size_t numRowsTrue, const size_t numCol);
@@ -27,6 +27,9 @@
 //For memset.
 #include <string.h>
 
+//For clock, which is used for the per-iteration timing.
+#include <time.h>
+
 /*If a compiler does not support INFINITY in C99, then it must be
  * explicitly defined.*/
 #ifndef INFINITY
@@ -52,9 +55,13 @@ static const uint64_t infVal=0x7ff0000000000000;
 #define isFinite(x)_finite(x)
 #endif
 
-static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fStar, double *qStar,double *u, void *tempSpace,const size_t *nDims,const double *C,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3);
+static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fStar, double *qStar,double *u, void *tempSpace,const size_t *nDims,const double *C,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3,double *iterTimes);
+static size_t dualStateSize3DC(const size_t n2,const size_t n3,const int subgradMethod);
+static void dualCostMatrix3DC(double * restrict d2,ptrdiff_t * restrict gamma2,double * restrict dMin,const double * restrict C,const double * restrict u,const size_t n1,const size_t n2,const size_t n3);
+static void recordIterTime3DC(double *iterTimes,const size_t k,const size_t phase,clock_t *tPrev);
 static size_t updateBestFeasSol3DCBufferSize(const size_t *nDims);
 static ptrdiff_t updateBestFeasSol3DC(ptrdiff_t * restrict tuples, double * restrict fStar,void *tempBuffer2DAssign,const size_t *nDims, const double *C, const ptrdiff_t *gamma1, const double qStar, const double AbsTol, const double RelTol);
+static bool updateDuals3DC(double * restrict u, const double * restrict g, const double gNorm2, const double q, const double fStar, const double qStar, const size_t k, const int subgradMethod, const double param1, const double param2, const size_t param3, double *beta, double *alphaPrev, double *gNormPrev, double *dilationBuffer, const double rho, const ptrdiff_t n3, const bool unconstU);
 
 static size_t updateBestFeasSol3DCBufferSize(const size_t *nDims) {
  /**UPDATEBESTFEASSOL3DCBUFFERSIZE Given the dimensions of the assignment
@@ -69,6 +76,27 @@ static size_t updateBestFeasSol3DCBufferSize(const size_t *nDims) {
     return assign2DCBufferSize(n3,n1)+(n1+n3)*sizeof(ptrdiff_t)+(n1+n3+n1*n3)*sizeof(double);
 }
 
+static size_t dualStateSize3DC(const size_t n2,const size_t n3,const int subgradMethod) {
+/**DUALSTATESIZE3DC The number of doubles needed to hold the state of the
+ *     subgradient method between iterations in the 3D assignment
+ *     algorithms. This is 3*n3+3*n3*n3 for the space dilation methods and
+ *     n3+n2 for the deflected subgradient method, where the last n2
+ *     values are the row duals used to warm start the relaxed 2D
+ *     problems.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    switch(subgradMethod) {
+        case 3:
+        case 4:
+            return 3*n3+3*n3*n3;
+        case 5:
+            return n3+n2;
+        default:
+            return 0;
+    }
+}
+
 size_t assign3DCBufferSize(const size_t *nDims,const int subgradMethod) {
 /**ASSIGN3DCBUFFERSIZE Given the dimensions of the assignment matrix,
  *      return the minimum size of the input tempBuffer needed (in bytes)
@@ -79,16 +107,11 @@ size_t assign3DCBufferSize(const size_t *nDims,const int subgradMethod) {
     const size_t n1=nDims[0];
     const size_t n2=nDims[1];
     const size_t n3=nDims[2];
-    size_t buffSize=sizeof(ptrdiff_t)*(n1*n2+n1)+sizeof(double)*(n3+n1*n2)+updateBestFeasSol3DCBufferSize(nDims);
-
-    if(subgradMethod>=3) {//If it is using space dilation.
-        buffSize+=sizeof(double)*(3*n3+3*n3*n3);
-    }
 
-    return buffSize;
+    return sizeof(ptrdiff_t)*(n1*n2+n1)+sizeof(double)*(n3+n1*n2+dualStateSize3DC(n2,n3,subgradMethod))+updateBestFeasSol3DCBufferSize(nDims);
 }
 
-ptrdiff_t assign3DC(ptrdiff_t * restrict tuples,double * restrict fStar, double * restrict qStar,double * restrict u,void *tempSpace,const size_t *nDims,double * restrict C,bool maximize,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3) {
+ptrdiff_t assign3DC(ptrdiff_t * restrict tuples,double * restrict fStar, double * restrict qStar,double * restrict u,void *tempSpace,const size_t *nDims,double * restrict C,bool maximize,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3,double *iterTimes) {
 /**ASSIGN3DC Approximate the solution to the operations research axial 3D
  *         assignment problem using a dual-primal Lagrangian relaxation
  *         algorithm. This function is the same as assign3DCBasic except
@@ -113,6 +136,11 @@ if(numEls==1) {
     *fStar=C[0];
     *qStar=C[0];
     u[0]=0;
+    if(iterTimes!=NULL) {
+        iterTimes[0]=0;
+        iterTimes[1]=0;
+        iterTimes[2]=0;
+    }
     return 0;
 }
 
@@ -124,7 +152,7 @@ if(maximize==true) {
         C[i]=-C[i];
     }
     
-    retVal=assign3DCBasic(tuples,fStar,qStar,u,tempSpace,nDims,C,subgradMethod,maxIter,AbsTol,RelTol,param1,param2,param3);
+    retVal=assign3DCBasic(tuples,fStar,qStar,u,tempSpace,nDims,C,subgradMethod,maxIter,AbsTol,RelTol,param1,param2,param3,iterTimes);
     
     //Account for the difference between the minimization and maximization
     //problems.
@@ -137,11 +165,11 @@ if(maximize==true) {
     
     return retVal;
 } else {
-    return assign3DCBasic(tuples,fStar,qStar,u,tempSpace,nDims,C,subgradMethod,maxIter,AbsTol,RelTol,param1,param2,param3);
+    return assign3DCBasic(tuples,fStar,qStar,u,tempSpace,nDims,C,subgradMethod,maxIter,AbsTol,RelTol,param1,param2,param3,iterTimes);
 }
 }
 
-static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fStar, double * restrict qStar,double * restrict u, void *tempSpace,const size_t *nDims,const double *C,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3) {
+static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fStar, double * restrict qStar,double * restrict u, void *tempSpace,const size_t *nDims,const double *C,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3,double *iterTimes) {
 /**ASSIGN3DBASIC Approximate the solution to the minimization-only
  *        operations research axial 3D assignment problem using a dual-
  *        primal Lagrangian relaxation  technique. The optimization problem
@@ -203,6 +231,13 @@ static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fS
  *         4 The r Space Dilation Algorithm from [5]. This is the same as 3
  *           except d=g-gPrev except for the first iteration and if
  *           g=gPrev, in which case d=g.
+ *         5 Polyak's method with the deflected subgradient direction of
+ *           [6], which aggregates the previous directions like a bundle
+ *           method. The update is uNew=u+gamma*(fStar-q)/norm(d)^2*d,
+ *           where d=g+theta*dPrev and
+ *           theta=max(0,-eta*g'*dPrev/norm(dPrev)^2). Additionally, each
+ *           relaxed 2D assignment problem is warm-started from the dual
+ *           variables of the previous iteration using assign2DCWarm.
  * maxIter The maximum number of iterations to perform. This should be
  *         >=1.
  *  AbsTol The absolute duality gap to use for convergence determiniation.
@@ -218,6 +253,15 @@ static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fS
  *                    eps(). normBound is such that if norm(B.'*d) in the
  *                    computation of the matrix H is <= normBound, then B
  *                    is reset to the identity matrix.
+ *         Method 5: 'gamma' and 'eta' with defaults 1 and 1.5.
+ * iterTimes If not NULL, this is a pointer to an array of 3*maxIter
+ *         doubles. The processor time in seconds spent in iteration k on
+ *         computing the relaxed 2D cost matrix (the minimization over the
+ *         third index), on solving the relaxed 2D assignment problem, and
+ *         on the rest of the iteration (the feasible solution heuristic
+ *         and the dual update) is put in iterTimes[3*k], iterTimes[3*k+1]
+ *         and iterTimes[3*k+2]. If the algorithm converges, the entries
+ *         for iterations that were not run are not modified.
  *
  *OUTPUTS: The outputs are put in tuples, fStar, qStar and u. The return
  *         value is an exitCode, which takes the following values:
@@ -256,20 +300,18 @@ static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fS
  *[5] N. Z. Shor, "Utilization of the operation of space dilation in the
  *   minimization of convex functions," Cybernetics, vol. 6, no. 1, pp. 7-
  *   15, Dec. 1972.
+ *[6] P. M. Camerini, L. Fratta, and F. Maffioli, "On improving relaxation
+ *   methods by modified gradient techniques," Mathematical Programming
+ *   Study, vol. 3, pp. 26-34, 1975.
  *
  *February 2018 David F. Crouse, Naval Research Laboratory, Washington D.C.
  */
     const ptrdiff_t n1=(ptrdiff_t)nDims[0];
     const ptrdiff_t n2=(ptrdiff_t)nDims[1];
     const ptrdiff_t n3=(ptrdiff_t)nDims[2];
-    const ptrdiff_t n1n2=(ptrdiff_t)n1*n2;
-    //These typed constant values are needed for the input to some BLAS
+    //This typed constant value is needed for the input to some BLAS
     //functions, because the functions take everything as pointers.
     const ptrdiff_t onePtrDiff=1;
-    const char TChar='T';
-    const char NChar='N';
-    const double oneDouble=1;
-    const double zeroDouble=0;
     const bool unconstU=(n1==n2)&&(n2==n3);
     //beta is used if Bertsekas' Heuristic Method is selected as the
     //subgradient method.
@@ -283,14 +325,17 @@ static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fS
     //These are needed if Bragin's method is used.
     double alphaPrev=0;
     double gNormPrev=0;
-    //These are needed if a space dilation algorithm is selected.
-    double *gPrev=NULL;
-    double *B=NULL;
-    double *H=NULL;
-    double *d=NULL;
-    double *dPrev=NULL;
-    double *R=NULL;
+    //This is the buffer for gPrev, B, H, d, dPrev, and R, which are needed
+    //if a space dilation algorithm is selected, or for dPrev if the
+    //deflected subgradient method is selected.
+    double *dilationBuffer=NULL;
+    //If the deflected subgradient method is selected, this holds the row
+    //dual variables of the relaxed 2D problem for warm starting the next
+    //iteration.
+    double *rowDual2D=NULL;
     double rho=0;
+    //For the per-iteration timing.
+    clock_t tPrev=0;
     void *curBuffPos=tempSpace;
     //Divide the buffer tempSpace among the variables used in this
     //function. We are using the restrict keyword for most of the entries,
@@ -314,17 +359,20 @@ static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fS
     //assign2D and its inputs. updateBestFeasSol3DC needs
     //least assign2DCBufferSize(n3,n1)+(n1+n3)*sizeof(ptrdiff_t)+
     //(n1+n3+n1*n3)*sizeof(double) bytes.
-    if(subgradMethod>2) {//If a space dilation algorithm is used.
-        gPrev=(double*)curBuffPos;//gPrev is length n3.
-        B=gPrev+n3;//B is an n3Xn3 matrix.
-        H=B+n3*n3;//H is an n3Xn3 matrix.
-        d=H+n3*n3;//d is a length n3X1 vector.
-        dPrev=d+n3;//dPrev is a length n3X1 vector.
-        R=dPrev+n3;//R is an n3*n3 matrix.
-        tempBuffer2DAssignFeas=(void*)(R+n3*n3);
+    if(subgradMethod>2) {//If the subgradient method has a state.
+        //The buffer is dualStateSize3DC(n2,n3,subgradMethod) doubles in
+        //size. It is split up in updateDuals3DC, except for the row duals
+        //for the warm start.
+        dilationBuffer=(double*)curBuffPos;
+        tempBuffer2DAssignFeas=(void*)(dilationBuffer+dualStateSize3DC((size_t)n2,(size_t)n3,subgradMethod));
         
         //Initialize.
-        rho=(param1-1)/(param1+1);//param1 is M with space dilation.
+        if(subgradMethod==5) {
+            rowDual2D=dilationBuffer+n3;
+            memset(rowDual2D,0,(size_t)n2*sizeof(double));
+        } else {
+            rho=(param1-1)/(param1+1);//param1 is M with space dilation.
+        }
     } else {
         tempBuffer2DAssignFeas=curBuffPos;
     }
@@ -348,55 +396,47 @@ static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fS
     //Initialize the dual variables to zero.
     memset(u,0,(size_t)n3*sizeof(double));
     
+    if(iterTimes!=NULL) {
+        tPrev=clock();
+    }
+
     for(k=0;k<maxIter;k++) {
         ptrdiff_t i1,i2,i3;
         double gNorm2;
 //////
 //DUAL COST AND SUBGRADIENT UPDATE.
 //////
-        //These loops essentially do:
+        //This essentially does:
         //[d2,gamma2]=min(bsxfun(@plus,C,reshape(u,[1,1,n3])),[],3);
         //d2=d2';
         //The transpose on d2 is necessary, because assign2DC requires that
         //the number of rows of the input be >= the number of columns and
-        //we know that n2>=n1.
-        {
-            ptrdiff_t *curGamma2=gamma2;
+        //we know that n2>=n1. tempBuffer2DAssignFeas is not in use yet
+        //during the iteration and holds at least n1*n2 doubles, so it is
+        //used as scratch space.
+        dualCostMatrix3DC(d2,gamma2,(double*)tempBuffer2DAssignFeas,C,u,(size_t)n1,(size_t)n2,(size_t)n3);
+        recordIterTime3DC(iterTimes,k,0,&tPrev);
 
-            for(i2=0;i2<n2;i2++) {
-                for(i1=0;i1<n1;i1++) {
-                    double minVal=C[i1+n1*i2]+u[0];
-                    ptrdiff_t minIdx=0;
-
-                    for(i3=1;i3<n3;i3++) {
-                        double curVal=C[i1+n1*i2+n1n2*i3]+u[i3];
-
-                        if(curVal<minVal) {
-                            minVal=curVal;
-                            minIdx=i3;
-                        }
-                    }
-
-                    //Store in a transposed order.
-                    d2[i2+n2*i1]=minVal;
+        {
+            double minVal;
+            bool isInfeasible;
 
-                    *curGamma2=minIdx;
-                    curGamma2++;
-                }
+            if(subgradMethod==5) {
+                isInfeasible=assign2DCWarm(d2, &minVal, row4col, gamma1, tempBuffer2DAssign, v2D, rowDual2D, (size_t)n2, (size_t)n1);
+            } else {
+                //This function modifies (the transposed) d2, but it does
+                //not matter, because it isn't used again in this loop.
+                isInfeasible=assign2DC(false, d2, &minVal, row4col,gamma1, tempBuffer2DAssign, v2D, u2D, (size_t)n2, (size_t)n1);
             }
-        }
 
-        {
-            double minVal;
-            //This function modifies (the transposed) d2, but it does not
-            //matter, because it isn't used again in this loop.
-            if(assign2DC(false, d2, &minVal, row4col,gamma1, tempBuffer2DAssign, v2D, u2D, (size_t)n2, (size_t)n1)) {
+            if(isInfeasible) {
                 //If the 2D assignment problem is infeasible.
                 return -1;
             }
             
             q=minVal-sumVectorD(u,(size_t)n3);//The dual cost.
         }
+        recordIterTime3DC(iterTimes,k,1,&tPrev);
 
         //Keep track of the maximum q value. This is used for testing
         //convergence.
@@ -409,6 +449,7 @@ static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fS
             //The correctness of this on the first iterations requires
             //proper handling of NaNs.
             if(costGap<=AbsTol||(costGap<fabs(*qStar)*RelTol)) {
+                recordIterTime3DC(iterTimes,k,2,&tPrev);
                 return (ptrdiff_t)(k+1);//The algorithm converged.
             }
         }
@@ -453,6 +494,7 @@ static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fS
                 }
             }
             
+            recordIterTime3DC(iterTimes,k,2,&tPrev);
             return (ptrdiff_t)(k+1);//The algorithm converged.
         }
 
@@ -460,6 +502,7 @@ static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fS
             const ptrdiff_t retVal=updateBestFeasSol3DC(tuples, fStar, tempBuffer2DAssignFeas, nDims, C, gamma1, *qStar, AbsTol, RelTol);
             //If the primal converged.
             if(retVal==0) {
+                recordIterTime3DC(iterTimes,k,2,&tPrev);
                 return (ptrdiff_t)(k+1);
             }
             
@@ -470,185 +513,11 @@ static ptrdiff_t assign3DCBasic(ptrdiff_t * restrict tuples,double * restrict fS
         }
 
         //Perform the subgradient update.
-        switch(subgradMethod) {
-            case 0://Polyak's method
-            {//param1 is gammaVal
-                const double alpha=param1*((*fStar-q)/gNorm2);
-                
-                //u=u+alpha*g
-                daxpy(&n3,&alpha,g,&onePtrDiff,u,&onePtrDiff);
-            }
-            break;
-            case 1://Bragin's Method
-            {
-                const double gNorm=sqrt(gNorm2);
-                double alpha;
-                
-                if(k==0) {
-                    alpha=((*fStar-q)/gNorm2);
-                } else {
-                    double kD=(double)k;
-                    //param1 is M.
-                    //param2 is r.
-                    
-                    alpha=(1-1/(param1*pow(kD,1-pow(kD,-param2))))*alphaPrev*(gNormPrev/gNorm);
-                }
-                //u=u+alpha*g
-                daxpy(&n3,&alpha,g,&onePtrDiff,u,&onePtrDiff);
-                
-                alphaPrev=alpha;
-                gNormPrev=gNorm;
-            }
-            break;
-            case 2://Bertsekas' Heuristic Method
-            {
-                double alpha;
-                if(q<*qStar) {
-                    beta++;
-                } else if(beta-1<1) {
-                    beta=1;
-                } else {
-                    beta--;
-                }
-                //param1 is a and param2 is b
-                alpha=fabs(((1+param1)/(pow(beta,param2)))*(*qStar)-q)/gNorm2;
-                
-                //u=u+alpha*g
-                daxpy(&n3,&alpha,g,&onePtrDiff,u,&onePtrDiff);
-            }
-            break;
-            default://Shor's Space Dilation Algorithm or the r Space
-                    //Dilation Algorithm.
-            {
-                double normVal;
-                double alpha;
-
-                if(subgradMethod==3||k==0) {//Shor's algorithm
-                    //d=g;
-                    dcopy(&n3,g,&onePtrDiff,d,&onePtrDiff);
-                } else {
-                    bool allEqual=true;
-                    //Check if g==gPrev
-                    for(i3=0;i3<n3;i3++) {
-                        if(g[i3]!=gPrev[i3]) {
-                            allEqual=false;
-                            break;
-                        }
-                    }
-                    
-                    //d=g;
-                    dcopy(&n3,g,&onePtrDiff,d,&onePtrDiff);
-                    
-                    if(allEqual==false) {
-                        const double negOne=-1;
-                        //d=-gPrev+d;
-                        
-                        daxpy(&n3,&negOne,gPrev,&onePtrDiff,d,&onePtrDiff);
-                    }
-                }
-                
-                //param3 is NR
-                if(k%param3==0) {
-                    //B=eye(n3,n3);
-                    identMatD((size_t)n3,B);
-
-                    normVal=dnrm2(&n3,d,&onePtrDiff);
-                    //We set H to zero. otherwise, if the unitialized H
-                    //happened to contain NaNs or Inf terms, then the dgemm
-                    //functon setting it would propagate NaNs (because
-                    //there is a zero time H).
-                    memset(H,0,(size_t)(n3*n3)*sizeof(double));
-                } else {
-
-                    //H(:,1)=B'*dPrev; -- we are just using part of the H matrix
-                    //to store this temporary result. We can't store it
-                    //back into dPrev -- the dgemv function does not
-                    //support that.
-                    dgemv(&TChar,&n3,&n3,&oneDouble,B,&n3,dPrev,&onePtrDiff,&zeroDouble,H,&onePtrDiff);
-
-                    //normVal=norm(H(:,1)); --H(:,1) holds B'*dPrev
-                    normVal=dnrm2(&n3,H,&onePtrDiff);
-
-                    //We overwrite H(:,1) with zeta. zeta=B'*dPrev/normVal;
-                    {
-                        const double temp=1/normVal;
-                        dscal(&n3,&temp,H,&onePtrDiff);
-                    }
-
-                    //Store zeta in dPrev.
-                    dcopy(&n3,H,&onePtrDiff,dPrev,&onePtrDiff);
-
-                    //H=eye(n3,n3);
-                    identMatD((size_t)n3,H);
-                    //H=H+(rho-1)*(zeta*zeta.');
-                    {
-                        const double temp=rho-1;
-                        dger(&n3,&n3,&temp,dPrev,&onePtrDiff,dPrev,&onePtrDiff,H,&n3);
-                    }
-
-                    //R=B*H;
-                    dgemm(&NChar,&NChar,&n3,&n3,&n3,&oneDouble,B,&n3,H,&n3,&zeroDouble,R,&n3);
-                    //B=R;
-                    {
-                        const ptrdiff_t n3n3=n3*n3;
-                        dcopy(&n3n3,R,&onePtrDiff,B,&onePtrDiff);
-                    }
-
-                    //dPrev=B'*d
-                    dgemv(&TChar,&n3,&n3,&oneDouble,B,&n3,d,&onePtrDiff,&zeroDouble,dPrev,&onePtrDiff);
-
-                    //normVal=norm(dPrev)
-                    normVal=dnrm2(&n3,dPrev,&onePtrDiff);
-                    if(normVal<=param2) {//param2 is normBound
-                        //B=eye(n3,n3);
-                        identMatD((size_t)n3,B);
-                        normVal=dnrm2(&n3,d,&onePtrDiff);
-                    }
-                }
-                //normVal now holds norm(B.'*d).
-
-                //H=(B*B.')/norm(B.'*d);
-                {
-                    const double temp=1/normVal;
-                    
-                    dgemm(&NChar,&TChar,&n3,&n3,&n3,&temp,B,&n3,B,&n3,&zeroDouble,H,&n3);
-                }
-
-                //normVal=norm(d);
-                normVal=dnrm2(&n3,d,&onePtrDiff);
-
-                //alpha=(2*M/(M+1))*((fStar-q)/norm(d));
-                alpha=(2*param1/(param1+1))*((*fStar-q)/normVal);
-
-                //u=u+alpha*H*d;
-                dgemv(&NChar,&n3,&n3,&alpha,H,&n3,d,&onePtrDiff,&oneDouble,u,&onePtrDiff);
-
-                //dPrev=d;
-                dcopy(&n3,d,&onePtrDiff,dPrev,&onePtrDiff);
-                
-                if(subgradMethod!=3) {
-                    //gPrev=g
-                    dcopy(&n3,g,&onePtrDiff,gPrev,&onePtrDiff);
-                }
-            }
-        }
-        
-        //if(any(~isfinite(u)))
-        for(i3=0;i3<n3;i3++) {
-            if(!isFinite(u[i3])) {
-                //This can sometimes occur with big problems and poor stepsizes.
-                return -3;
-            }
-        }
-        //Unless the constraints are equality constraints, the dual
-        //variables have to be clipped.
-        if(unconstU==false) {
-            for(i3=0;i3<n3;i3++) {
-                if(u[i3]<0) {
-                    u[i3]=0;
-                }
-            }
+        if(updateDuals3DC(u,g,gNorm2,q,*fStar,*qStar,k,subgradMethod,param1,param2,param3,&beta,&alphaPrev,&gNormPrev,dilationBuffer,rho,n3,unconstU)) {
+            //This can sometimes occur with big problems and poor stepsizes.
+            return -3;
         }
+        recordIterTime3DC(iterTimes,k,2,&tPrev);
     }
     //The maximum number of iterations was hit.  
     return -2;
@@ -758,6 +627,821 @@ static ptrdiff_t updateBestFeasSol3DC(ptrdiff_t * restrict tuples, double * rest
     }
 }
 
+static void dualCostMatrix3DC(double * restrict d2,ptrdiff_t * restrict gamma2,double * restrict dMin,const double * restrict C,const double * restrict u,const size_t n1,const size_t n2,const size_t n3) {
+/**DUALCOSTMATRIX3DC Compute the cost matrix of the relaxed 2D assignment
+ *     problem in assign3DCBasic. This does
+ *     [dMin,gamma2]=min(bsxfun(@plus,C,reshape(u,[1,1,n3])),[],3);
+ *     d2=dMin';
+ *     where the indices in gamma2 start from 0.
+ *
+ *INPUTS: d2 A pointer to space for the n2Xn1 (transposed) output matrix.
+ *    gamma2 A pointer to space for the n1Xn2 matrix of minimizing third
+ *           indices.
+ *      dMin A pointer to n1*n2 doubles of scratch space.
+ *         C The n1Xn2Xn3 cost matrix.
+ *         u The length n3 vector of dual variables.
+ *  n1,n2,n3 The dimensions of C.
+ *
+ *C is traversed one n1Xn2 slab at a time, which is contiguous in memory,
+ *keeping a running minimum over blocks of elements that fit in the cache.
+ *The inner loop is free of branches, so that compilers can vectorize it
+ *with SIMD instructions. The result, including the choice of the lowest
+ *index in the case of ties, is the same as that of a direct minimization
+ *over the third index for each element.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    //The number of elements processed at once. The running minimum and
+    //the indices of a block take 32KB.
+    const size_t blockSize=2048;
+    const size_t n1n2=n1*n2;
+    size_t blockStart, i1, i2, i3;
+
+    for(blockStart=0;blockStart<n1n2;blockStart+=blockSize) {
+        const size_t blockEnd=(blockStart+blockSize<n1n2)?blockStart+blockSize:n1n2;
+        size_t curEl;
+        {
+            const double uCur=u[0];
+
+            for(curEl=blockStart;curEl<blockEnd;curEl++) {
+                dMin[curEl]=C[curEl]+uCur;
+                gamma2[curEl]=0;
+            }
+        }
+
+        for(i3=1;i3<n3;i3++) {
+            const double * restrict CSlab=C+n1n2*i3;
+            const double uCur=u[i3];
+            const ptrdiff_t i3Idx=(ptrdiff_t)i3;
+
+            for(curEl=blockStart;curEl<blockEnd;curEl++) {
+                const double curVal=CSlab[curEl]+uCur;
+                const bool isLess=curVal<dMin[curEl];
+
+                dMin[curEl]=isLess?curVal:dMin[curEl];
+                gamma2[curEl]=isLess?i3Idx:gamma2[curEl];
+            }
+        }
+    }
+
+    //Store in a transposed order.
+    for(i2=0;i2<n2;i2++) {
+        for(i1=0;i1<n1;i1++) {
+            d2[i2+n2*i1]=dMin[i1+n1*i2];
+        }
+    }
+}
+
+static void recordIterTime3DC(double *iterTimes,const size_t k,const size_t phase,clock_t *tPrev) {
+/**RECORDITERTIME3DC If iterTimes is not NULL, store the processor time in
+ *     seconds since *tPrev in iterTimes[3*k+phase] and set *tPrev to the
+ *     current time.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    if(iterTimes!=NULL) {
+        const clock_t tCur=clock();
+
+        iterTimes[3*k+phase]=(double)(tCur-*tPrev)/(double)CLOCKS_PER_SEC;
+        *tPrev=tCur;
+    }
+}
+
+size_t assign3DSparseCBufferSize(const size_t *nDims,const size_t numTuples,const int subgradMethod) {
+/**ASSIGN3DSPARSECBUFFERSIZE Given the dimensions of the assignment
+ *      hypermatrix and the number of tuples that are stored, return the
+ *      minimum size of the input tempBuffer needed (in bytes) for the
+ *      assign3DSparseC and assign3DSparseCBasic algorithms.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    const size_t n1=nDims[0];
+    const size_t n2=nDims[1];
+    const size_t n3=nDims[2];
+    //The doubles are tupCost, d2, CFeas, g, u2D, v2D, uFeas, and vFeas.
+    //The size_t values are tupI3, pairI2, tupStart, gamma2, rowFeas,
+    //pairStart, colStartFeas, pairSel, permScratch and countScratch. The
+    //ptrdiff_t values are gamma1, col4row2D, gammaTilde3 and col4rowFeas.
+    size_t buffSize=sizeof(double)*(3*numTuples+n3+2*n1+n2+n3)+sizeof(size_t)*(7*numTuples+1+2*(n1+1)+n1+n2+1)+sizeof(ptrdiff_t)*(2*n1+n2+n3);
+
+    //The state of the subgradient method.
+    buffSize+=sizeof(double)*dualStateSize3DC(n2,n3,subgradMethod);
+
+    //The buffer for the 2D assignment algorithm is last, because it ends
+    //with boolean values. It is shared by the relaxed and the feasible
+    //problems and n3>=n2.
+    buffSize+=assign2DSparseCBufferSize(n3,n1);
+
+    return buffSize;
+}
+
+ptrdiff_t assign3DSparseC(ptrdiff_t * restrict tuples,double * restrict fStar, double * restrict qStar,double * restrict u,void *tempSpace,const size_t *nDims,const size_t numTuples,const size_t * restrict tupleIdx,double * restrict C,bool maximize,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3) {
+/**ASSIGN3DSPARSEC Approximate the solution to the operations research
+ *         axial 3D assignment problem using a dual-primal Lagrangian
+ *         relaxation algorithm when the cost hypermatrix is sparse. This
+ *         function is the same as assign3DSparseCBasic except it has a
+ *         maximize input and the C vector is modified if maximize=true.
+ *
+ *See assign3DSparseCBasic for more comments as to the inputs of this
+ *function.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+
+if(maximize==true) {
+    size_t i;
+    ptrdiff_t retVal;
+
+    for(i=0;i<numTuples;i++) {
+        C[i]=-C[i];
+    }
+
+    retVal=assign3DSparseCBasic(tuples,fStar,qStar,u,tempSpace,nDims,numTuples,tupleIdx,C,subgradMethod,maxIter,AbsTol,RelTol,param1,param2,param3);
+
+    //Account for the difference between the minimization and maximization
+    //problems.
+    *fStar=-*fStar;
+    *qStar=-*qStar;
+
+    for(i=0;i<nDims[2];i++) {
+        u[i]=-u[i];
+    }
+
+    return retVal;
+} else {
+    return assign3DSparseCBasic(tuples,fStar,qStar,u,tempSpace,nDims,numTuples,tupleIdx,C,subgradMethod,maxIter,AbsTol,RelTol,param1,param2,param3);
+}
+}
+
+ptrdiff_t assign3DSparseCBasic(ptrdiff_t * restrict tuples,double * restrict fStar, double * restrict qStar,double * restrict u, void *tempSpace,const size_t *nDims,const size_t numTuples,const size_t * restrict tupleIdx,const double *C,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3) {
+/**ASSIGN3DSPARSECBASIC Approximate the solution to the minimization-only
+ *        operations research axial 3D assignment problem using a dual-
+ *        primal Lagrangian relaxation technique when only a subset of the
+ *        tuples in the n1Xn2Xn3 cost hypermatrix are allowed. The
+ *        optimization problem is the same as in assign3DCBasic, except
+ *        rho_{i,j,k} is forced to zero for all tuples that are not
+ *        provided. The relaxed problem in each iteration only minimizes
+ *        over the provided tuples and both of the 2D assignment
+ *        subproblems are solved using the sparse algorithm in
+ *        assign2DSparseC, so the memory and the computation per iteration
+ *        scale with the number of provided tuples rather than with
+ *        n1*n2*n3.
+ *
+ *INPUTS: tuples A pointer to an array of ptrdiff_t values to hold the 3Xn1
+ *         matrix of assigned tuples.
+ *   fStar A pointer to a double that will hold the best (lowest) primal
+ *         solution value found by this function.
+ *   qStar A pointer to a double that will hold the best (highest)
+ *         dual solution value found by this function.
+ *       u A pointer to an array of n3 doubles to hold the dual values.
+ * tempSpace A pointer to a buffer that is used as temporary space by
+ *         this function. The buffer must be at least
+ *         assign3DSparseCBufferSize(nDims,numTuples,subgradMethod) bytes
+ *         in size.
+ *   nDims A length 3 vector of size_t values holding the dimensions of
+ *         the implied cost hypermatrix with n1<=n2<=n3.
+ * numTuples The number of tuples provided. 
+ * tupleIdx A 3XnumTuples matrix of size_t values, stored by column, such
+ *         that tupleIdx(:,k) holds the zero-based (i1,i2,i3) indices of
+ *         the kth provided tuple. 
+ *       C A length numTuples array of doubles where C[k] is the cost of
+ *         the kth tuple.
+ * subgradMethod, maxIter, AbsTol, RelTol, param1, param2, param3 These are
+ *         the same as in assign3DCBasic. With subgradMethod=5, the
+ *         deflected subgradient step is used, but the relaxed 2D problems
+ *         are not warm-started, because they are solved by the sparse 2D
+ *         assignment algorithm.
+ *
+ *OUTPUTS: The outputs are put in tuples, fStar, qStar and u. The return
+ *         value is an exitCode, which takes the same values as in
+ *         assign3DCBasic. However, the heuristic for obtaining a feasible
+ *         solution failing in a single iteration is not considered an
+ *         error, because that is common when the tuples are sparse; -1
+ *         is returned if the relaxed problem is infeasible (which means
+ *         that the 3D problem is infeasible) or if no feasible solution
+ *         was found in any of the iterations.
+ *
+ *Until a feasible solution has been found, the step size computations use
+ *the sum over i1 of the largest cost of the tuples having that i1 value in
+ *place of fStar. That is an upper bound on the cost of any feasible
+ *solution.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    const ptrdiff_t n1=(ptrdiff_t)nDims[0];
+    const ptrdiff_t n2=(ptrdiff_t)nDims[1];
+    const ptrdiff_t n3=(ptrdiff_t)nDims[2];
+    //This typed constant value is needed for the input to some BLAS
+    //functions, because the functions take everything as pointers.
+    const ptrdiff_t onePtrDiff=1;
+    const bool unconstU=(n1==n2)&&(n2==n3);
+    double beta=1;
+    double alphaPrev=0;
+    double gNormPrev=0;
+    double *dilationBuffer=NULL;
+    double rho=0;
+    double fUpper;
+    size_t k, numPairs;
+    ptrdiff_t i1;
+    void *curBuffPos=tempSpace;
+    //Divide the buffer tempSpace among the variables used in this
+    //function.
+    
+    //The costs of the tuples sorted by (i1,i2).
+    double * restrict tupCost=(double*)curBuffPos;//Length numTuples
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(double));
+
+    //The costs of the (i1,i2) pairs in the relaxed problem.
+    double * restrict d2=(double*)curBuffPos;//Length numTuples
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(double));
+
+    //The costs in the sparse problem to find a feasible solution.
+    double * restrict CFeas=(double*)curBuffPos;//Length numTuples
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(double));
+
+    double * restrict g=(double*)curBuffPos;//Length n3
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nDims[2]*sizeof(double));
+
+    double * restrict u2D=(double*)curBuffPos;//Length n1
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nDims[0]*sizeof(double));
+
+    double * restrict v2D=(double*)curBuffPos;//Length n2
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nDims[1]*sizeof(double));
+
+    double * restrict uFeas=(double*)curBuffPos;//Length n1
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nDims[0]*sizeof(double));
+
+    double * restrict vFeas=(double*)curBuffPos;//Length n3
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nDims[2]*sizeof(double));
+
+    //The i3 indices of the tuples sorted by (i1,i2).
+    size_t * restrict tupI3=(size_t*)curBuffPos;//Length numTuples
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+
+    //The i2 index of each distinct (i1,i2) pair. This is the row index of
+    //the sparse relaxed 2D assignment problem.
+    size_t * restrict pairI2=(size_t*)curBuffPos;//Length numTuples
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+
+    //The tuples of pair p are tupStart[p] to tupStart[p+1]-1.
+    size_t * restrict tupStart=(size_t*)curBuffPos;//Length numTuples+1
+    curBuffPos=(void*)((uint8_t*)curBuffPos+(numTuples+1)*sizeof(size_t));
+
+    //The index of the tuple that minimizes the cost of each pair in the
+    //relaxed problem.
+    size_t * restrict gamma2=(size_t*)curBuffPos;//Length numTuples
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+
+    size_t * restrict rowFeas=(size_t*)curBuffPos;//Length numTuples
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+
+    //The pairs having i1 as their first index are pairStart[i1] to
+    //pairStart[i1+1]-1.
+    size_t * restrict pairStart=(size_t*)curBuffPos;//Length n1+1
+    curBuffPos=(void*)((uint8_t*)curBuffPos+(nDims[0]+1)*sizeof(size_t));
+
+    size_t * restrict colStartFeas=(size_t*)curBuffPos;//Length n1+1
+    curBuffPos=(void*)((uint8_t*)curBuffPos+(nDims[0]+1)*sizeof(size_t));
+
+    //The index of the pair chosen for each i1 in the relaxed problem.
+    size_t * restrict pairSel=(size_t*)curBuffPos;//Length n1
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nDims[0]*sizeof(size_t));
+
+    //These two are only used when sorting the tuples.
+    size_t * restrict permScratch=(size_t*)curBuffPos;//Length numTuples
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+
+    size_t * restrict countScratch=(size_t*)curBuffPos;//Length n2+1
+    curBuffPos=(void*)((uint8_t*)curBuffPos+(nDims[1]+1)*sizeof(size_t));
+
+    ptrdiff_t * restrict gamma1=(ptrdiff_t*)curBuffPos;//Length n1
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nDims[0]*sizeof(ptrdiff_t));
+
+    ptrdiff_t * restrict col4row2D=(ptrdiff_t*)curBuffPos;//Length n2
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nDims[1]*sizeof(ptrdiff_t));
+
+    ptrdiff_t * restrict gammaTilde3=(ptrdiff_t*)curBuffPos;//Length n1
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nDims[0]*sizeof(ptrdiff_t));
+
+    ptrdiff_t * restrict col4rowFeas=(ptrdiff_t*)curBuffPos;//Length n3
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nDims[2]*sizeof(ptrdiff_t));
+
+    if(subgradMethod>2) {//If the subgradient method has a state.
+        //The buffer is dualStateSize3DC(n2,n3,subgradMethod) doubles in
+        //size. It is split up in updateDuals3DC.
+        dilationBuffer=(double*)curBuffPos;
+        curBuffPos=(void*)(dilationBuffer+dualStateSize3DC(nDims[1],nDims[2],subgradMethod));
+
+        //Initialize.
+        rho=(param1-1)/(param1+1);//param1 is M with space dilation.
+    }
+
+    //tempBuffer2DAssign is at least size assign2DSparseCBufferSize(n3,n1).
+    void *tempBuffer2DAssign=curBuffPos;
+
+    *qStar=-(double)INFINITY;
+    *fStar=(double)INFINITY;
+
+//////
+//SORT THE TUPLES BY (i1,i2)
+//////
+    //A stable counting sort by i2 into permScratch followed by a stable
+    //counting sort by i1 into gamma2, which is not otherwise used until
+    //the iterations begin.
+    {
+        size_t i, curTuple;
+
+        memset(countScratch,0,(nDims[1]+1)*sizeof(size_t));
+        for(curTuple=0;curTuple<numTuples;curTuple++) {
+            countScratch[tupleIdx[3*curTuple+1]+1]++;
+        }
+        for(i=0;i<nDims[1];i++) {
+            countScratch[i+1]+=countScratch[i];
+        }
+        for(curTuple=0;curTuple<numTuples;curTuple++) {
+            permScratch[countScratch[tupleIdx[3*curTuple+1]]++]=curTuple;
+        }
+
+        //pairStart is used to count the number of tuples for each i1.
+        memset(pairStart,0,(nDims[0]+1)*sizeof(size_t));
+        for(curTuple=0;curTuple<numTuples;curTuple++) {
+            pairStart[tupleIdx[3*curTuple]+1]++;
+        }
+        for(i=0;i<nDims[0];i++) {
+            pairStart[i+1]+=pairStart[i];
+        }
+        for(i=0;i<numTuples;i++) {
+            curTuple=permScratch[i];
+            gamma2[pairStart[tupleIdx[3*curTuple]]++]=curTuple;
+        }
+
+        //Copy the sorted tuples and find the distinct (i1,i2) pairs.
+        numPairs=0;
+        memset(pairStart,0,(nDims[0]+1)*sizeof(size_t));
+        for(i=0;i<numTuples;i++) {
+            const size_t curI1=tupleIdx[3*gamma2[i]];
+            const size_t curI2=tupleIdx[3*gamma2[i]+1];
+
+            tupI3[i]=tupleIdx[3*gamma2[i]+2];
+            tupCost[i]=C[gamma2[i]];
+
+            if(i==0||curI1!=tupleIdx[3*gamma2[i-1]]||curI2!=pairI2[numPairs-1]) {
+                pairI2[numPairs]=curI2;
+                tupStart[numPairs]=i;
+                numPairs++;
+                pairStart[curI1+1]++;
+            }
+        }
+        tupStart[numPairs]=numTuples;
+        for(i=0;i<nDims[0];i++) {
+            pairStart[i+1]+=pairStart[i];
+        }
+    }
+
+    //Find the upper bound on the cost of any feasible solution. If an i1
+    //value has no tuples, then the problem is infeasible.
+    fUpper=0;
+    for(i1=0;i1<n1;i1++) {
+        size_t curPair;
+        double maxVal=-(double)INFINITY;
+
+        for(curPair=pairStart[i1];curPair<pairStart[i1+1];curPair++) {
+            size_t curTuple;
+            for(curTuple=tupStart[curPair];curTuple<tupStart[curPair+1];curTuple++) {
+                if(tupCost[curTuple]>maxVal) {
+                    maxVal=tupCost[curTuple];
+                }
+            }
+        }
+
+        if(maxVal==-(double)INFINITY) {
+            return -1;
+        }
+        fUpper+=maxVal;
+    }
+
+    //Initialize the dual variables to zero.
+    memset(u,0,(size_t)n3*sizeof(double));
+
+    for(k=0;k<maxIter;k++) {
+        double q, gNorm2;
+        ptrdiff_t i3;
+//////
+//DUAL COST AND SUBGRADIENT UPDATE.
+//////
+        //For each (i1,i2) pair, find the minimum of C+u over the i3 values
+        //that are present.
+        {
+            size_t curPair;
+            for(curPair=0;curPair<numPairs;curPair++) {
+                size_t curTuple=tupStart[curPair];
+                double minVal=tupCost[curTuple]+u[tupI3[curTuple]];
+                size_t minIdx=curTuple;
+
+                for(curTuple++;curTuple<tupStart[curPair+1];curTuple++) {
+                    const double curVal=tupCost[curTuple]+u[tupI3[curTuple]];
+
+                    if(curVal<minVal) {
+                        minVal=curVal;
+                        minIdx=curTuple;
+                    }
+                }
+
+                d2[curPair]=minVal;
+                gamma2[curPair]=minIdx;
+            }
+        }
+
+        {
+            double minVal;
+            //This function modifies d2, but it does not matter, because it
+            //isn't used again in this loop. The columns are i1 and the rows
+            //are i2.
+            if(assign2DSparseC(false, d2, pairI2, pairStart, &minVal, col4row2D, gamma1, tempBuffer2DAssign, u2D, v2D, (size_t)n2, (size_t)n1)) {
+                //If the relaxed problem is infeasible, then so is the 3D
+                //problem.
+                return -1;
+            }
+
+            q=minVal-sumVectorD(u,(size_t)n3);//The dual cost.
+        }
+
+        //Find the pair that was chosen for each i1.
+        for(i1=0;i1<n1;i1++) {
+            size_t curPair=pairStart[i1];
+            while(pairI2[curPair]!=(size_t)gamma1[i1]) {
+                curPair++;
+            }
+            pairSel[i1]=curPair;
+        }
+
+        //Keep track of the maximum q value. This is used for testing
+        //convergence.
+        if(q>*qStar) {
+            double costGap;
+            *qStar=q;
+
+            costGap=*fStar-*qStar;//The duality gap.
+
+            if(costGap<=AbsTol||(costGap<fabs(*qStar)*RelTol)) {
+                return (ptrdiff_t)(k+1);//The algorithm converged.
+            }
+        }
+
+        //Compute the subgradient.
+        for (i3=0;i3<n3;i3++) {
+            g[i3]=-1;
+        }
+        for(i1=0;i1<n1;i1++) {
+            g[tupI3[gamma2[pairSel[i1]]]]+=1;
+        }
+
+//////
+//TEST THE GRADIENT AND FINISH THE LOOP.
+//////
+        gNorm2=ddot(&n3,g,&onePtrDiff,g,&onePtrDiff);
+
+        //If no constraints are violated, then we have a feasible solution
+        //and the algorithm has converged to a local or global minimum
+        //point.
+        if(gNorm2==0) {
+            if(q<*fStar) {
+                *fStar=q;
+
+                for(i1=0;i1<n1;i1++) {
+                    tuples[3*i1]=i1;
+                    tuples[3*i1+1]=gamma1[i1];
+                    tuples[3*i1+2]=(ptrdiff_t)tupI3[gamma2[pairSel[i1]]];
+                }
+            }
+
+            return (ptrdiff_t)(k+1);//The algorithm converged.
+        }
+
+        //Try to obtain a feasible solution by keeping the (i1,i2) pairs of
+        //the relaxed solution and assigning the i3 values sparsely.
+        {
+            double minVal;
+
+            colStartFeas[0]=0;
+            for(i1=0;i1<n1;i1++) {
+                const size_t curPair=pairSel[i1];
+                size_t curTuple, curEl=colStartFeas[i1];
+
+                for(curTuple=tupStart[curPair];curTuple<tupStart[curPair+1];curTuple++) {
+                    CFeas[curEl]=tupCost[curTuple];
+                    rowFeas[curEl]=tupI3[curTuple];
+                    curEl++;
+                }
+                colStartFeas[i1+1]=curEl;
+            }
+
+            //If this subproblem is infeasible, then no primal solution is
+            //found in this iteration, but the algorithm continues.
+            if(!assign2DSparseC(false, CFeas, rowFeas, colStartFeas, &minVal, col4rowFeas, gammaTilde3, tempBuffer2DAssign, uFeas, vFeas, (size_t)n3, (size_t)n1)&&minVal<*fStar) {
+                double costGap;
+
+                *fStar=minVal;
+
+                for(i1=0;i1<n1;i1++) {
+                    tuples[3*i1]=i1;
+                    tuples[3*i1+1]=gamma1[i1];
+                    tuples[3*i1+2]=gammaTilde3[i1];
+                }
+
+                costGap=*fStar-*qStar;
+                if(costGap<=AbsTol||costGap<fabs(*qStar)*RelTol) {
+                    return (ptrdiff_t)(k+1);//The algorithm converged.
+                }
+            }
+        }
+
+        //Perform the subgradient update.
+        if(updateDuals3DC(u,g,gNorm2,q,isFinite(*fStar)?*fStar:fUpper,*qStar,k,subgradMethod,param1,param2,param3,&beta,&alphaPrev,&gNormPrev,dilationBuffer,rho,n3,unconstU)) {
+            //This can sometimes occur with big problems and poor stepsizes.
+            return -3;
+        }
+    }
+
+    if(!isFinite(*fStar)) {
+        //No feasible solution was found.
+        return -1;
+    }
+
+    //The maximum number of iterations was hit.
+    return -2;
+}
+
+static bool updateDuals3DC(double * restrict u, const double * restrict g, const double gNorm2, const double q, const double fStar, const double qStar, const size_t k, const int subgradMethod, const double param1, const double param2, const size_t param3, double *beta, double *alphaPrev, double *gNormPrev, double *dilationBuffer, const double rho, const ptrdiff_t n3, const bool unconstU) {
+/**UPDATEDUALS3DC Perform one step of the subgradient update of the dual
+ *        variables u in the 3D assignment algorithms. This is shared
+ *        by assign3DCBasic and assign3DSparseCBasic.
+ *
+ *INPUTS: u The length n3 vector of dual variables. This gets updated.
+ *        g The length n3 subgradient vector.
+ *   gNorm2 The squared norm of g. This is nonzero.
+ *        q The current dual cost.
+ *    fStar The best primal cost found (or an upper bound on it) as a
+ *          double.
+ *    qStar The best dual cost found.
+ *        k The index of the current iteration, starting from 0.
+ * subgradMethod, param1, param2, param3 The subgradient method and its
+ *          parameters. These are the same as in assign3DCBasic.
+ * beta, alphaPrev, gNormPrev Pointers to the state variables used with
+ *          Bertsekas' and Bragin's methods. These get updated. beta
+ *          starts at 1 and the others at 0.
+ * dilationBuffer If subgradMethod>2, this is a pointer to a buffer of
+ *          dualStateSize3DC(n2,n3,subgradMethod) doubles that holds the
+ *          state of the space dilation algorithms or the previous
+ *          direction of the deflected subgradient method between calls.
+ *          Otherwise, it is not used.
+ *      rho The constant (M-1)/(M+1) used in the space dilation methods.
+ *       n3 The number of dual variables.
+ * unconstU True if the constraints that u relaxes are equality
+ *          constraints, in which case u is not clipped to be positive.
+ *
+ *OUTPUTS: The return value is true if a non-finite value arose in u and
+ *         false otherwise.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    //These typed constant values are needed for the input to some BLAS
+    //functions, because the functions take everything as pointers.
+    const ptrdiff_t onePtrDiff=1;
+    const char TChar='T';
+    const char NChar='N';
+    const double oneDouble=1;
+    const double zeroDouble=0;
+    ptrdiff_t i3;
+
+    switch(subgradMethod) {
+        case 0://Polyak's method
+        {//param1 is gammaVal
+            const double alpha=param1*((fStar-q)/gNorm2);
+
+            //u=u+alpha*g
+            daxpy(&n3,&alpha,g,&onePtrDiff,u,&onePtrDiff);
+        }
+        break;
+        case 1://Bragin's Method
+        {
+            const double gNorm=sqrt(gNorm2);
+            double alpha;
+
+            if(k==0) {
+                alpha=((fStar-q)/gNorm2);
+            } else {
+                double kD=(double)k;
+                //param1 is M.
+                //param2 is r.
+
+                alpha=(1-1/(param1*pow(kD,1-pow(kD,-param2))))*(*alphaPrev)*((*gNormPrev)/gNorm);
+            }
+            //u=u+alpha*g
+            daxpy(&n3,&alpha,g,&onePtrDiff,u,&onePtrDiff);
+
+            *alphaPrev=alpha;
+            *gNormPrev=gNorm;
+        }
+        break;
+        case 2://Bertsekas' Heuristic Method
+        {
+            double alpha;
+            if(q<qStar) {
+                (*beta)++;
+            } else if(*beta-1<1) {
+                *beta=1;
+            } else {
+                (*beta)--;
+            }
+            //param1 is a and param2 is b
+            alpha=fabs(((1+param1)/(pow(*beta,param2)))*qStar-q)/gNorm2;
+
+            //u=u+alpha*g
+            daxpy(&n3,&alpha,g,&onePtrDiff,u,&onePtrDiff);
+        }
+        break;
+        case 5://Polyak's method with a deflected subgradient.
+        {//param1 is gammaVal and param2 is eta.
+            //d is stored in dPrev and replaces it.
+            double * restrict d=dilationBuffer;
+            double alpha, dNorm2;
+
+            if(k==0) {
+                //d=g;
+                dcopy(&n3,g,&onePtrDiff,d,&onePtrDiff);
+            } else {
+                const double dPrevNorm2=ddot(&n3,d,&onePtrDiff,d,&onePtrDiff);
+                double theta=0;
+
+                if(dPrevNorm2>0) {
+                    //theta=max(0,-eta*g'*dPrev/norm(dPrev)^2);
+                    theta=-param2*ddot(&n3,g,&onePtrDiff,d,&onePtrDiff)/dPrevNorm2;
+                    if(theta<0) {
+                        theta=0;
+                    }
+                }
+
+                //d=g+theta*dPrev;
+                dscal(&n3,&theta,d,&onePtrDiff);
+                daxpy(&n3,&oneDouble,g,&onePtrDiff,d,&onePtrDiff);
+            }
+
+            dNorm2=ddot(&n3,d,&onePtrDiff,d,&onePtrDiff);
+            if(dNorm2==0) {
+                //The deflection cancelled the subgradient, so the plain
+                //subgradient is used.
+                dcopy(&n3,g,&onePtrDiff,d,&onePtrDiff);
+                dNorm2=gNorm2;
+            }
+
+            alpha=param1*((fStar-q)/dNorm2);
+
+            //u=u+alpha*d
+            daxpy(&n3,&alpha,d,&onePtrDiff,u,&onePtrDiff);
+        }
+        break;
+        default://Shor's Space Dilation Algorithm or the r Space
+                //Dilation Algorithm.
+        {
+            double * restrict gPrev=dilationBuffer;//gPrev is length n3.
+            double * restrict B=gPrev+n3;//B is an n3Xn3 matrix.
+            double * restrict H=B+n3*n3;//H is an n3Xn3 matrix.
+            double * restrict d=H+n3*n3;//d is a length n3X1 vector.
+            double * restrict dPrev=d+n3;//dPrev is a length n3X1 vector.
+            double * restrict R=dPrev+n3;//R is an n3*n3 matrix.
+            double normVal;
+            double alpha;
+
+            if(subgradMethod==3||k==0) {//Shor's algorithm
+                //d=g;
+                dcopy(&n3,g,&onePtrDiff,d,&onePtrDiff);
+            } else {
+                bool allEqual=true;
+                //Check if g==gPrev
+                for(i3=0;i3<n3;i3++) {
+                    if(g[i3]!=gPrev[i3]) {
+                        allEqual=false;
+                        break;
+                    }
+                }
+
+                //d=g;
+                dcopy(&n3,g,&onePtrDiff,d,&onePtrDiff);
+
+                if(allEqual==false) {
+                    const double negOne=-1;
+                    //d=-gPrev+d;
+
+                    daxpy(&n3,&negOne,gPrev,&onePtrDiff,d,&onePtrDiff);
+                }
+            }
+
+            //param3 is NR
+            if(k%param3==0) {
+                //B=eye(n3,n3);
+                identMatD((size_t)n3,B);
+
+                normVal=dnrm2(&n3,d,&onePtrDiff);
+                //We set H to zero. otherwise, if the unitialized H
+                //happened to contain NaNs or Inf terms, then the dgemm
+                //functon setting it would propagate NaNs (because
+                //there is a zero time H).
+                memset(H,0,(size_t)(n3*n3)*sizeof(double));
+            } else {
+
+                //H(:,1)=B'*dPrev; -- we are just using part of the H matrix
+                //to store this temporary result. We can't store it
+                //back into dPrev -- the dgemv function does not
+                //support that.
+                dgemv(&TChar,&n3,&n3,&oneDouble,B,&n3,dPrev,&onePtrDiff,&zeroDouble,H,&onePtrDiff);
+
+                //normVal=norm(H(:,1)); --H(:,1) holds B'*dPrev
+                normVal=dnrm2(&n3,H,&onePtrDiff);
+
+                //We overwrite H(:,1) with zeta. zeta=B'*dPrev/normVal;
+                {
+                    const double temp=1/normVal;
+                    dscal(&n3,&temp,H,&onePtrDiff);
+                }
+
+                //Store zeta in dPrev.
+                dcopy(&n3,H,&onePtrDiff,dPrev,&onePtrDiff);
+
+                //H=eye(n3,n3);
+                identMatD((size_t)n3,H);
+                //H=H+(rho-1)*(zeta*zeta.');
+                {
+                    const double temp=rho-1;
+                    dger(&n3,&n3,&temp,dPrev,&onePtrDiff,dPrev,&onePtrDiff,H,&n3);
+                }
+
+                //R=B*H;
+                dgemm(&NChar,&NChar,&n3,&n3,&n3,&oneDouble,B,&n3,H,&n3,&zeroDouble,R,&n3);
+                //B=R;
+                {
+                    const ptrdiff_t n3n3=n3*n3;
+                    dcopy(&n3n3,R,&onePtrDiff,B,&onePtrDiff);
+                }
+
+                //dPrev=B'*d
+                dgemv(&TChar,&n3,&n3,&oneDouble,B,&n3,d,&onePtrDiff,&zeroDouble,dPrev,&onePtrDiff);
+
+                //normVal=norm(dPrev)
+                normVal=dnrm2(&n3,dPrev,&onePtrDiff);
+                if(normVal<=param2) {//param2 is normBound
+                    //B=eye(n3,n3);
+                    identMatD((size_t)n3,B);
+                    normVal=dnrm2(&n3,d,&onePtrDiff);
+                }
+            }
+            //normVal now holds norm(B.'*d).
+
+            //H=(B*B.')/norm(B.'*d);
+            {
+                const double temp=1/normVal;
+
+                dgemm(&NChar,&TChar,&n3,&n3,&n3,&temp,B,&n3,B,&n3,&zeroDouble,H,&n3);
+            }
+
+            //normVal=norm(d);
+            normVal=dnrm2(&n3,d,&onePtrDiff);
+
+            //alpha=(2*M/(M+1))*((fStar-q)/norm(d));
+            alpha=(2*param1/(param1+1))*((fStar-q)/normVal);
+
+            //u=u+alpha*H*d;
+            dgemv(&NChar,&n3,&n3,&alpha,H,&n3,d,&onePtrDiff,&oneDouble,u,&onePtrDiff);
+
+            //dPrev=d;
+            dcopy(&n3,d,&onePtrDiff,dPrev,&onePtrDiff);
+
+            if(subgradMethod!=3) {
+                //gPrev=g
+                dcopy(&n3,g,&onePtrDiff,gPrev,&onePtrDiff);
+            }
+        }
+    }
+
+    //if(any(~isfinite(u)))
+    for(i3=0;i3<n3;i3++) {
+        if(!isFinite(u[i3])) {
+            return true;
+        }
+    }
+    //Unless the constraints are equality constraints, the dual
+    //variables have to be clipped.
+    if(unconstU==false) {
+        for(i3=0;i3<n3;i3++) {
+            if(u[i3]<0) {
+                u[i3]=0;
+            }
+        }
+    }
+
+    return false;
+}
+
 /*LICENSE:
 %
 %The source code is in the public domain and not licensed or under
@@ -2,7 +2,9 @@
  *              axial operations research 3D assignment problem. The inputs
  *              of the specific functions are described in their
  *              implementation files, which are assign3DC.c and
- *              assign3DLBC.c.
+ *              assign3DLBC.c. The header can also be included from C++
+ *              code, such as the branch-and-bound solver in
+ *              assign3DBBCPP.cpp.
  * 
  *Better understanding of the algorithms can usually be obtained from
  *looking at the Matlab implementations.
@@ -17,7 +19,13 @@
 //Defines the size_t and ptrdiff_t types
 #include <stddef.h>
 
-#if __STDC_VERSION__>=199901L
+#ifdef __cplusplus
+//bool is a built-in type in C++ and restrict is not a keyword, so the
+//compiler-specific equivalent is used.
+#ifndef restrict
+#define restrict __restrict
+#endif
+#elif __STDC_VERSION__>=199901L
 #include <stdbool.h>
 #else
 #ifndef _bool_T
@@ -37,9 +45,16 @@
 #endif
 #endif
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 //Function prototypes.
 size_t assign3DCBufferSize(const size_t *nDims,const int subgradMethod);
-ptrdiff_t assign3DC(ptrdiff_t * restrict tuples,double *restrict fStar, double * restrict qStar,double * restrict u,void *tempSpace,const size_t *nDims,double * restrict C,bool maximize,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3);
+ptrdiff_t assign3DC(ptrdiff_t * restrict tuples,double *restrict fStar, double * restrict qStar,double * restrict u,void *tempSpace,const size_t *nDims,double * restrict C,bool maximize,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3,double *iterTimes);
+size_t assign3DSparseCBufferSize(const size_t *nDims,const size_t numTuples,const int subgradMethod);
+ptrdiff_t assign3DSparseC(ptrdiff_t * restrict tuples,double * restrict fStar, double * restrict qStar,double * restrict u,void *tempSpace,const size_t *nDims,const size_t numTuples,const size_t * restrict tupleIdx,double * restrict C,bool maximize,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3);
+ptrdiff_t assign3DSparseCBasic(ptrdiff_t * restrict tuples,double * restrict fStar, double * restrict qStar,double * restrict u, void *tempSpace,const size_t *nDims,const size_t numTuples,const size_t * restrict tupleIdx,const double *C,const int subgradMethod,const size_t maxIter,const double AbsTol,const double RelTol,const double param1,const double param2,const size_t param3);
 
 //Bounds
 size_t assign3DLBHungarianBufferSize(const size_t *nVals);
@@ -48,6 +63,10 @@ size_t assign3DLBDual0BufferSize(const size_t *nVals);
 double assign3DLBDual0(const size_t *nVals,const double *C, void *tempSpace);
 double assign3DLBCPierskalla(const size_t *nVals,const double *C);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif
 
 /*LICENSE:
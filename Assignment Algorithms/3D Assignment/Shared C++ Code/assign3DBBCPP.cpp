@@ -0,0 +1,518 @@
+/**ASSIGN3DBBCPP A C++ implementation of a parallel branch-and-bound
+ *           algorithm for solving the axial operations research 3D
+ *           assignment problem exactly. The branching is the same as in
+ *           the Matlab implementation assign3DBB: the nodes at level l of
+ *           the tree have assigned tuples for the first l values of the
+ *           first index of C and the children of a node are all of the
+ *           (j,k) pairs that can be assigned to the next value of the
+ *           first index. Nodes are pruned using the lower bounds in
+ *           assign3DLBC.c applied to the cost submatrix that remains after
+ *           the assignments in the node have been made.
+ *
+ *The tree is explored by a pool of threads. Each thread has its own double
+ *ended queue of nodes. A thread expands the most recent node in its own
+ *queue, so each thread performs a depth-first search with the children
+ *having the lowest bounds visited first. When a thread's queue is empty,
+ *it steals the oldest node from another thread's queue, which is the
+ *shallowest node and thus the one most likely to represent a large amount
+ *of work. The cost of the best solution found so far is shared by all
+ *threads, so a solution found by one thread immediately tightens the
+ *pruning done by all of the others.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "assign3DBBCPP.hpp"
+//For assign3DC and the lower bounds.
+#include "assignAlgs3D.h"
+
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <limits>
+#include <cmath>
+
+namespace {
+
+/**BBNODE A partial assignment in the branch-and-bound tree. jk holds the
+ *        indices (j,k) assigned to the first level values of the first
+ *        index of C as jk[2*i] and jk[2*i+1].
+ **/
+struct BBNode {
+    size_t level;
+    double cumCost;
+    double bound;
+    std::vector<size_t> jk;
+};
+
+class WorkQueue {
+public:
+    std::mutex lock;
+    std::deque<BBNode> nodes;
+};
+
+class BBSharedData {
+public:
+    const double *C;
+    size_t n1, n2, n3;
+    int boundType;
+
+    //The cost of the best solution found so far. It is only changed while
+    //holding bestLock, but it can be read at any time.
+    std::atomic<double> bestCost;
+    std::mutex bestLock;
+    std::vector<size_t> bestJK;
+
+    std::vector<WorkQueue> queues;
+    //The number of nodes that have been queued, but whose expansion has
+    //not been completed. When this is zero, the search is done.
+    std::atomic<size_t> numPending;
+
+    BBSharedData(const size_t numThreads) : queues(numThreads) {}
+
+    void pushNodes(const size_t threadIdx,std::vector<BBNode> &newNodes) {
+        if(newNodes.empty()) {
+            return;
+        }
+
+        numPending.fetch_add(newNodes.size());
+        std::lock_guard<std::mutex> guard(queues[threadIdx].lock);
+        for(size_t curNode=0;curNode<newNodes.size();curNode++) {
+            queues[threadIdx].nodes.push_back(std::move(newNodes[curNode]));
+        }
+    }
+
+    bool getNode(const size_t threadIdx,BBNode &node) {
+        const size_t numThreads=queues.size();
+
+        //Take the most recent node from this thread's own queue.
+        {
+            std::lock_guard<std::mutex> guard(queues[threadIdx].lock);
+            if(!queues[threadIdx].nodes.empty()) {
+                node=std::move(queues[threadIdx].nodes.back());
+                queues[threadIdx].nodes.pop_back();
+                return true;
+            }
+        }
+
+        //Steal the oldest node from another thread's queue.
+        for(size_t offset=1;offset<numThreads;offset++) {
+            const size_t victim=(threadIdx+offset)%numThreads;
+            std::lock_guard<std::mutex> guard(queues[victim].lock);
+            if(!queues[victim].nodes.empty()) {
+                node=std::move(queues[victim].nodes.front());
+                queues[victim].nodes.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void offerSolution(const double cost,const std::vector<size_t> &jk) {
+        std::lock_guard<std::mutex> guard(bestLock);
+        if(cost<bestCost.load()) {
+            bestJK=jk;
+            bestCost.store(cost);
+        }
+    }
+};
+
+size_t lowerBound3DBufferSize(const size_t *nVals,const int boundType) {
+    switch(boundType) {
+        case 0:
+            //The dual bound is used in place of the projection bound when
+            //forbidden assignments are present.
+            return std::max(assign3DLBHungarianBufferSize(nVals),assign3DLBDual0BufferSize(nVals));
+        case 1:
+            return 0;
+        default://Case 2
+            return assign3DLBDual0BufferSize(nVals);
+    }
+}
+
+double lowerBound3D(const size_t *nVals,const double *C,const int boundType,void *lbBuffer) {
+    double bound;
+
+    switch(boundType) {
+        case 0:
+        {
+            //The projection-Hungarian bound can exceed the optimal cost
+            //when some assignments are forbidden, so the dual bound is
+            //used for submatrices having non-finite elements.
+            const size_t numEls=nVals[0]*nVals[1]*nVals[2];
+            size_t curEl;
+
+            for(curEl=0;curEl<numEls;curEl++) {
+                if(!std::isfinite(C[curEl])) {
+                    break;
+                }
+            }
+
+            if(curEl==numEls) {
+                bound=assign3DLBHungarian(nVals,C,lbBuffer);
+            } else {
+                bound=assign3DLBDual0(nVals,C,lbBuffer);
+            }
+        }
+            break;
+        case 1:
+            bound=assign3DLBCPierskalla(nVals,C);
+            break;
+        default://Case 2
+            bound=assign3DLBDual0(nVals,C,lbBuffer);
+    }
+
+    //Forbidden assignments can make the more sophisticated bounds NaN
+    //(Inf-Inf). The simple bound is always valid.
+    if(std::isnan(bound)) {
+        bound=assign3DLBCPierskalla(nVals,C);
+    }
+
+    return bound;
+}
+
+/**BBWORKSPACE The per-thread memory used for computing lower bounds on the
+ *        cost submatrices, so that no allocation is done when bounding.
+ **/
+class BBWorkspace {
+public:
+    std::vector<double> CSub;
+    std::vector<double> lbBuffer;
+    std::vector<char> usedJ, usedK;
+    std::vector<size_t> freeJ, freeK;
+
+    BBWorkspace(const BBSharedData &data) : usedJ(data.n2), usedK(data.n3) {
+        if(data.n1>1) {
+            size_t nSub[3];
+
+            nSub[0]=data.n1-1;
+            nSub[1]=data.n2-1;
+            nSub[2]=data.n3-1;
+
+            CSub.resize(nSub[0]*nSub[1]*nSub[2]);
+            //The buffer sizes grow with the size of the matrix, so the
+            //buffer for the largest submatrix suffices for all levels.
+            lbBuffer.resize(lowerBound3DBufferSize(nSub,data.boundType)/sizeof(double)+1);
+        }
+        freeJ.reserve(data.n2);
+        freeK.reserve(data.n3);
+    }
+};
+
+void expandNode(BBSharedData &data,BBWorkspace &workspace,const size_t threadIdx,const BBNode &node,std::vector<BBNode> &children) {
+    const size_t n1=data.n1;
+    const size_t n2=data.n2;
+    const size_t n3=data.n3;
+    const size_t n1n2=n1*n2;
+    const double *C=data.C;
+    const size_t i=node.level;
+    size_t curIdx;
+
+    std::fill(workspace.usedJ.begin(),workspace.usedJ.end(),0);
+    std::fill(workspace.usedK.begin(),workspace.usedK.end(),0);
+    for(curIdx=0;curIdx<node.level;curIdx++) {
+        workspace.usedJ[node.jk[2*curIdx]]=1;
+        workspace.usedK[node.jk[2*curIdx+1]]=1;
+    }
+    workspace.freeJ.clear();
+    for(curIdx=0;curIdx<n2;curIdx++) {
+        if(!workspace.usedJ[curIdx]) {
+            workspace.freeJ.push_back(curIdx);
+        }
+    }
+    workspace.freeK.clear();
+    for(curIdx=0;curIdx<n3;curIdx++) {
+        if(!workspace.usedK[curIdx]) {
+            workspace.freeK.push_back(curIdx);
+        }
+    }
+    const size_t numFreeJ=workspace.freeJ.size();
+    const size_t numFreeK=workspace.freeK.size();
+
+    if(i==n1-1) {
+        //The last level; the best completion is just the cheapest free
+        //tuple.
+        double minVal=std::numeric_limits<double>::infinity();
+        size_t minJ=0, minK=0;
+
+        for(size_t curK=0;curK<numFreeK;curK++) {
+            const size_t k=workspace.freeK[curK];
+            for(size_t curJ=0;curJ<numFreeJ;curJ++) {
+                const size_t j=workspace.freeJ[curJ];
+                const double curVal=C[i+j*n1+k*n1n2];
+                if(curVal<minVal) {
+                    minVal=curVal;
+                    minJ=j;
+                    minK=k;
+                }
+            }
+        }
+
+        const double totalCost=node.cumCost+minVal;
+        if(totalCost<data.bestCost.load()) {
+            std::vector<size_t> jk(node.jk);
+            jk.push_back(minJ);
+            jk.push_back(minK);
+            data.offerSolution(totalCost,jk);
+        }
+        return;
+    }
+
+    //The dimensions of the cost submatrix left after assigning a child.
+    size_t nSub[3];
+    nSub[0]=n1-i-1;
+    nSub[1]=numFreeJ-1;
+    nSub[2]=numFreeK-1;
+    double *CSub=workspace.CSub.data();
+
+    children.clear();
+    for(size_t curK=0;curK<numFreeK;curK++) {
+        const size_t k=workspace.freeK[curK];
+        for(size_t curJ=0;curJ<numFreeJ;curJ++) {
+            const size_t j=workspace.freeJ[curJ];
+            const double partialCost=node.cumCost+C[i+j*n1+k*n1n2];
+
+            if(!(partialCost<data.bestCost.load())) {
+                //This also skips forbidden assignments.
+                continue;
+            }
+
+            //Extract the cost submatrix of the unassigned indices.
+            size_t subIdx=0;
+            for(size_t curK2=0;curK2<numFreeK;curK2++) {
+                if(curK2==curK) {
+                    continue;
+                }
+                const size_t kOffset=workspace.freeK[curK2]*n1n2;
+                for(size_t curJ2=0;curJ2<numFreeJ;curJ2++) {
+                    if(curJ2==curJ) {
+                        continue;
+                    }
+                    const double *CCol=C+workspace.freeJ[curJ2]*n1+kOffset;
+                    for(size_t i2=i+1;i2<n1;i2++) {
+                        CSub[subIdx]=CCol[i2];
+                        subIdx++;
+                    }
+                }
+            }
+
+            const double bound=partialCost+lowerBound3D(nSub,CSub,data.boundType,workspace.lbBuffer.data());
+            if(bound<data.bestCost.load()) {
+                BBNode child;
+                child.level=i+1;
+                child.cumCost=partialCost;
+                child.bound=bound;
+                child.jk=node.jk;
+                child.jk.push_back(j);
+                child.jk.push_back(k);
+                children.push_back(std::move(child));
+            }
+        }
+    }
+
+    //Sort by decreasing bound so that the child with the smallest bound is
+    //at the back of the queue and is visited next.
+    std::sort(children.begin(),children.end(),[](const BBNode &a,const BBNode &b) {return a.bound>b.bound;});
+    data.pushNodes(threadIdx,children);
+}
+
+void BBWorker(BBSharedData *data,const size_t threadIdx) {
+    BBWorkspace workspace(*data);
+    std::vector<BBNode> children;
+    BBNode node;
+
+    for(;;) {
+        if(!data->getNode(threadIdx,node)) {
+            if(data->numPending.load()==0) {
+                return;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+
+        //The incumbent might have improved since the node was queued.
+        if(node.bound<data->bestCost.load()) {
+            expandNode(*data,workspace,threadIdx,node,children);
+        }
+        data->numPending.fetch_sub(1);
+    }
+}
+
+}
+
+bool assign3DBBCPP(ptrdiff_t *tuples,double &gain,const size_t *nVals,const double *COrig,const bool maximize,const int boundType,const bool useInitEst,const size_t maxIter,const double epsVal,size_t numThreads) {
+/**ASSIGN3DBBCPP Solve the axial operations research 3D assignment problem
+ *           exactly using a parallel branch-and-bound algorithm. See the
+ *           comments to the Matlab implementation of assign3DBB for a
+ *           description of the problem.
+ *
+ *INPUTS: tuples A buffer to hold 3*nVals[0] values. If a feasible
+ *               solution is found, tuples[3*i+0], tuples[3*i+1] and
+ *               tuples[3*i+2] are the indices (starting from 0) of the ith
+ *               assigned tuple in C.
+ *          gain This is set to the cost of the optimal assignment. If no
+ *               feasible assignment exists, this is Inf (-Inf when
+ *               maximizing).
+ *         nVals A length 3 array giving the size of each dimension of C.
+ *               It is required that 1<=nVals[0]<=nVals[1]<=nVals[2].
+ *         COrig The nVals[0]XnVals[1]XnVals[2] cost hypermatrix stored by
+ *               column as in Matlab. It is not modified.
+ *      maximize If true, the maximization problem is solved.
+ *     boundType The lower bound used for pruning. This is the same as the
+ *               method input of assign3DLB: 0 is the projection-Hungarian
+ *               bound, 1 is the Pierskalla bound and 2 is the dual cost
+ *               with zero dual variables.
+ *    useInitEst If true, the best solution found by assign3DC (using
+ *               subgradient method 0) is used as the initial incumbent.
+ *       maxIter The maximum number of iterations of assign3DC if
+ *               useInitEst is true.
+ *        epsVal The relative duality gap of assign3DC below which its
+ *               solution is deemed optimal and no search is performed.
+ *    numThreads The number of threads to use. If this is 0, the number of
+ *               hardware threads is used.
+ *
+ *OUTPUTS: The return value is true if a feasible solution was found and
+ *         false otherwise.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+    const size_t n1=nVals[0];
+    const size_t n2=nVals[1];
+    const size_t n3=nVals[2];
+    const size_t numEls=n1*n2*n3;
+    const double infVal=std::numeric_limits<double>::infinity();
+    std::vector<double> C(numEls);
+    double CDelta;
+    size_t curEl;
+
+    //Shift the costs to make them all non-negative, which some of the
+    //bounds require, and turn maximization into minimization. Only finite
+    //elements are used to determine the shift, so that forbidden
+    //assignments remain forbidden.
+    CDelta=maximize?-infVal:infVal;
+    for(curEl=0;curEl<numEls;curEl++) {
+        const double curVal=COrig[curEl];
+        if(std::isfinite(curVal)) {
+            if(maximize) {
+                CDelta=std::max(CDelta,curVal);
+            } else {
+                CDelta=std::min(CDelta,curVal);
+            }
+        }
+    }
+
+    if(!std::isfinite(CDelta)) {
+        //All assignments are forbidden.
+        gain=maximize?-infVal:infVal;
+        return false;
+    }
+
+    for(curEl=0;curEl<numEls;curEl++) {
+        C[curEl]=maximize?CDelta-COrig[curEl]:COrig[curEl]-CDelta;
+    }
+
+    if(numThreads==0) {
+        numThreads=std::max<size_t>(1,std::thread::hardware_concurrency());
+    }
+
+    BBSharedData data(numThreads);
+    data.C=C.data();
+    data.n1=n1;
+    data.n2=n2;
+    data.n3=n3;
+    data.boundType=boundType;
+    data.bestCost.store(infVal);
+    data.numPending.store(0);
+
+    double rootBound;
+    {
+        std::vector<double> lbBuffer(lowerBound3DBufferSize(nVals,boundType)/sizeof(double)+1);
+        rootBound=lowerBound3D(nVals,C.data(),boundType,lbBuffer.data());
+    }
+
+    if(useInitEst) {
+        std::vector<double> CCopy(C);
+        std::vector<ptrdiff_t> initTuples(3*n1);
+        std::vector<double> u(n3);
+        std::vector<double> initBuffer(assign3DCBufferSize(nVals,0)/sizeof(double)+1);
+        double fStar, qStar;
+
+        const ptrdiff_t exitCode=assign3DC(initTuples.data(),&fStar,&qStar,u.data(),initBuffer.data(),nVals,CCopy.data(),false,0,maxIter,0,epsVal,1,0,0,NULL);
+        if(exitCode!=-1&&exitCode!=-3&&std::isfinite(fStar)) {
+            std::vector<size_t> jk(2*n1);
+            for(curEl=0;curEl<n1;curEl++) {
+                const size_t i=static_cast<size_t>(initTuples[3*curEl]);
+                jk[2*i]=static_cast<size_t>(initTuples[3*curEl+1]);
+                jk[2*i+1]=static_cast<size_t>(initTuples[3*curEl+2]);
+            }
+            data.offerSolution(fStar,jk);
+            rootBound=std::max(rootBound,qStar);
+        }
+    }
+
+    //Only search if the initial estimate is not already known to be
+    //optimal.
+    if(!(data.bestCost.load()-rootBound<epsVal*data.bestCost.load())) {
+        std::vector<BBNode> rootNode(1);
+        rootNode[0].level=0;
+        rootNode[0].cumCost=0;
+        rootNode[0].bound=rootBound;
+        data.pushNodes(0,rootNode);
+
+        if(numThreads==1) {
+            BBWorker(&data,0);
+        } else {
+            std::vector<std::thread> threads;
+            threads.reserve(numThreads);
+            for(size_t curThread=0;curThread<numThreads;curThread++) {
+                threads.push_back(std::thread(BBWorker,&data,curThread));
+            }
+            for(size_t curThread=0;curThread<numThreads;curThread++) {
+                threads[curThread].join();
+            }
+        }
+    }
+
+    const double bestCost=data.bestCost.load();
+    if(!std::isfinite(bestCost)) {
+        gain=maximize?-infVal:infVal;
+        return false;
+    }
+
+    for(curEl=0;curEl<n1;curEl++) {
+        tuples[3*curEl]=static_cast<ptrdiff_t>(curEl);
+        tuples[3*curEl+1]=static_cast<ptrdiff_t>(data.bestJK[2*curEl]);
+        tuples[3*curEl+2]=static_cast<ptrdiff_t>(data.bestJK[2*curEl+1]);
+    }
+
+    //Undo the shift of the costs.
+    if(maximize) {
+        gain=CDelta*static_cast<double>(n1)-bestCost;
+    } else {
+        gain=bestCost+CDelta*static_cast<double>(n1);
+    }
+
+    return true;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
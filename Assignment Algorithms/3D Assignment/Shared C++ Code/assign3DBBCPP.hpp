@@ -0,0 +1,38 @@
+/**ASSIGN3DBBCPP A header file for the C++ implementation of a parallel
+ *           branch-and-bound algorithm for solving the axial operations
+ *           research 3D assignment problem exactly. See the comments in
+ *           assign3DBBCPP.cpp and in the Matlab implementation assign3DBB
+ *           for more details.
+ *
+ *This file needs to be compiled with assign3DBBCPP.cpp as well as with
+ *assign3DC.c and assign3DLBC.c and the files on which those depend.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef ASSIGN3DBBCPP
+#define ASSIGN3DBBCPP
+#include <stddef.h>
+
+bool assign3DBBCPP(ptrdiff_t *tuples,double &gain,const size_t *nVals,const double *C,const bool maximize,const int boundType,const bool useInitEst,const size_t maxIter,const double epsVal,size_t numThreads);
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
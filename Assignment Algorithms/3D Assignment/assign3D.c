@@ -10,7 +10,7 @@
  * CompileCLibraries function.
  *
  * The algorithm is run in Matlab using the command format
- * [tuples,fStar,qStar,u,exitCode]=assign3D(C,maximize,subgradMethod,subgradParams,maxIter,AbsTol,RelTol);
+ * [tuples,fStar,qStar,u,exitCode,iterTimes]=assign3D(C,maximize,subgradMethod,subgradParams,maxIter,AbsTol,RelTol);
  *
  *February 2018 David F. Crouse, Naval Research Laboratory, Washington D.C.
  */
@@ -40,6 +40,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     mxArray *uMATLAB;
     ptrdiff_t *tuples;
     double *u;
+    double *iterTimes=NULL;
     void *tempSpace;
     double fStar, qStar;
     ptrdiff_t exitCode;
@@ -49,7 +50,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         return;
     }
 
-    if(nlhs>5) {
+    if(nlhs>6) {
         mexErrMsgTxt("Invalid number of outputs.");
         return;
     }
@@ -80,6 +81,10 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
                     
                     if(nlhs>4) {
                         plhs[4]=mxCreateDoubleScalar(0);//exitCode=0
+                        
+                        if(nlhs>5) {
+                            plhs[5]=mxCreateDoubleMatrix(3,0,mxREAL);//iterTimes
+                        }
                     }
                 }
             }
@@ -109,6 +114,10 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
                     
                     if(nlhs>4) {
                         plhs[4]=mxCreateDoubleScalar(0);//exitCode=0;
+                        
+                        if(nlhs>5) {
+                            plhs[5]=mxCreateDoubleMatrix(3,0,mxREAL);//iterTimes
+                        }
                     }
                 }
             }
@@ -140,7 +149,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     if(nrhs>2&&!mxIsEmpty(prhs[2])) {
         subgradMethod=getIntFromMatlab(prhs[2]);
         
-        if(subgradMethod<0||subgradMethod>4) {
+        if(subgradMethod<0||subgradMethod>5) {
             mexErrMsgTxt("Invalid subgradMethod specified.");
             return;
         }
@@ -159,6 +168,10 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
             param1=0.3;//a
             param2=1.5;//b
             break;
+        case 5:
+            param1=1;//gammaParam
+            param2=1.5;//eta
+            break;
         case 3:
         default://subgradMethod==4
             param1=2;//M=2
@@ -205,6 +218,18 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
                     param2=getDoubleFromMatlab(curField);
                 }
 
+                break;
+            case 5:
+                curField=mxGetField(prhs[3],0,"gamma");
+                if(curField!=NULL) {
+                    param1=getDoubleFromMatlab(curField);
+                }
+
+                curField=mxGetField(prhs[3],0,"eta");
+                if(curField!=NULL) {
+                    param2=getDoubleFromMatlab(curField);
+                }
+
                 break;
             case 3:
             default:
@@ -274,15 +299,23 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     tempSpace=mxMalloc(assign3DCBufferSize(nDims,subgradMethod)+3*(size_t)nDims[0]*sizeof(ptrdiff_t));
     tuples=(ptrdiff_t*)tempSpace;
     
+    //The timing of the iterations is only recorded if it is requested.
+    if(nlhs>5) {
+        iterTimes=(double*)mxMalloc(3*maxIter*sizeof(double));
+    }
+    
     {
         void *bufferStart=(void*)(tuples+3*nDims[0]);
-        exitCode=assign3DC(tuples,&fStar,&qStar,u,bufferStart,nDims,CCopy,maximize,subgradMethod,maxIter,AbsTol,RelTol,param1,param2,param3);
+        exitCode=assign3DC(tuples,&fStar,&qStar,u,bufferStart,nDims,CCopy,maximize,subgradMethod,maxIter,AbsTol,RelTol,param1,param2,param3,iterTimes);
         mxFree(CCopy);
     }
     
     if(exitCode==-3||exitCode==-1) {
         // If no valid assignment was found.   
         mxFree(tempSpace);
+        if(iterTimes!=NULL) {
+            mxFree(iterTimes);
+        }
         mxDestroyArray(uMATLAB);
         
         plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);//tuples=[];
@@ -298,6 +331,10 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
                     
                     if(nlhs>4) {
                         plhs[4]=mxCreateDoubleScalar(exitCode);//exitCode
+                        
+                        if(nlhs>5) {
+                            plhs[5]=mxCreateDoubleMatrix(0,0,mxREAL);//iterTimes=[]
+                        }
                     }
                 }
             }
@@ -325,6 +362,16 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
                     
                     if(nlhs>4) {
                         plhs[4]=mxCreateDoubleScalar(exitCode);
+                        
+                        if(nlhs>5) {
+                            //If the maximum number of iterations was
+                            //hit, then all of them were run.
+                            const size_t numIter=exitCode>=0?(size_t)exitCode:maxIter;
+                            mxArray *iterTimesMATLAB=mxCreateDoubleMatrix(3,numIter,mxREAL);
+                            
+                            memcpy(mxGetPr(iterTimesMATLAB),iterTimes,3*numIter*sizeof(double));
+                            plhs[5]=iterTimesMATLAB;
+                        }
                     }
                 } else {
                     mxDestroyArray(uMATLAB);
@@ -335,6 +382,10 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         } else {
             mxDestroyArray(uMATLAB);
         }
+        
+        if(iterTimes!=NULL) {
+            mxFree(iterTimes);
+        }
     }
 }
 
@@ -1,4 +1,4 @@
-function [tuples,fStar,qStar,u,exitCode]=assign3D(C,maximize,subgradMethod,subgradParams,maxIter,AbsTol,RelTol)
+function [tuples,fStar,qStar,u,exitCode,iterTimes]=assign3D(C,maximize,subgradMethod,subgradParams,maxIter,AbsTol,RelTol)
 %%ASSIGN3D Approximate the solution to the operations research axial 3D
 %         assignment problem using a dual-primal Lagrangian relaxation 
 %         technique. Such problems are NP-hard. The optimization problem
@@ -61,6 +61,15 @@ function [tuples,fStar,qStar,u,exitCode]=assign3D(C,maximize,subgradMethod,subgr
 %          4 The r Space Dilation Algorithm from [5]. This is the same as 3
 %            except d=g-gPrev except for the first iteration and if
 %            g=gPrev, in which case d=g.
+%          5 Polyak's method with the deflected subgradient direction of
+%            [6], which aggregates the previous directions like a bundle
+%            method. The update is uNew=u+gamma*(fStar-q)/norm(d)^2*d,
+%            where d=g+theta*dPrev, theta=max(0,-eta*g'*dPrev/norm(dPrev)^2)
+%            and gamma and eta are design parameters. In the compiled
+%            version of this function, the relaxed 2D assignment problem in
+%            each iteration is also warm-started from the dual variables of
+%            the previous iteration, which tends to reduce the time spent
+%            solving it.
 % subgradParams This is a structure that takes the design parameters for
 %          the selected cubgradient algorithm. Possible fields of the
 %          structure as well as default values depend on the selected
@@ -72,7 +81,8 @@ function [tuples,fStar,qStar,u,exitCode]=assign3D(C,maximize,subgradMethod,subgr
 %                     eps(). normBound is such that if norm(B.'*d) in the
 %                     computation of the matrix H is <= normBound, then B
 %                     is reset to the identity matrix.
-%  maxIter The maximum number of iterations to perform. The default value
+%          Method 5: 'gamma' and 'eta' with defaults 1 and 1.5.
+% maxIter The maximum number of iterations to perform. The default value
 %          if this parameter is omitted or an empty matrix is passed is 20.
 %   AbsTol The absolute duality gap to use for convergence determiniation.
 %          Convergence is declared if (fStar-qStar)<=AbsTol, where if
@@ -107,6 +117,16 @@ function [tuples,fStar,qStar,u,exitCode]=assign3D(C,maximize,subgradMethod,subgr
 %                >=0 Values that are zero or positive indicate the
 %                   convergence was obtained and the returned value is the
 %                   number of iterations.
+%      iterTimes A 3XnumIter matrix where numIter is the number of
+%                iterations performed. iterTimes(:,k) holds the time in
+%                seconds spent in the kth iteration computing the relaxed
+%                2D cost matrix (the minimization over the third index),
+%                solving the relaxed 2D assignment problem and doing
+%                everything else (the feasible solution heuristic and the
+%                dual update). This is useful for choosing maxIter when
+%                latency matters. The compiled version of this function
+%                measures processor time rather than wall-clock time. If
+%                exitCode is -1 or -3, this is an empty matrix.
 %
 %This function implements the algorithm of [1], but modified so that it
 %does not have any unconstrained indices and offering different subgradient
@@ -139,6 +159,9 @@ function [tuples,fStar,qStar,u,exitCode]=assign3D(C,maximize,subgradMethod,subgr
 %[5] N. Z. Shor, "Utilization of the operation of space dilation in the
 %    minimization of convex functions," Cybernetics, vol. 6, no. 1, pp. 7-
 %    15, Dec. 1972.
+%[6] P. M. Camerini, L. Fratta, and F. Maffioli, "On improving relaxation
+%    methods by modified gradient techniques," Mathematical Programming
+%    Study, vol. 3, pp. 26-34, 1975.
 %
 %February 2018 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
@@ -176,6 +199,7 @@ if(isscalar(C))
     qStar=fStar;
     u=0;
     exitCode=0;
+    iterTimes=zeros(3,0);
     return;
 end
 
@@ -185,6 +209,7 @@ if(isempty(C))%The empty matrix special case.
     qStar=0;
     u=[];
     exitCode=0;
+    iterTimes=zeros(3,0);
     return;
 end
 
@@ -290,6 +315,20 @@ switch(subgradMethod)
                 normBound=subgradParams.normBound;
             end
         end
+    case 5%Polyak's method with a deflected subgradient.
+        gammaParam=1;
+        eta=1.5;
+        dPrev=[];
+        
+        if(nargin>3&&~isempty(subgradParams))
+            if(isfield(subgradParams,'gamma'))
+                gammaParam=subgradParams.gamma;
+            end
+            
+            if(isfield(subgradParams,'eta'))
+                eta=subgradParams.eta;
+            end
+        end
     otherwise
         error('Invalid subgradient method specified.')
 end
@@ -306,16 +345,22 @@ qStar=-Inf;
 fStar=Inf;
 %If the loop exits without convergence, then exitCode is not modified.
 exitCode=-2;
+iterTimes=zeros(3,maxIter);
 for k=0:(maxIter-1)
+    tStart=tic();
 %%%%%%
 %DUAL COST AND SUBGRADIENT UPDATE. SEE FIG. 3 IN [1].
 %%%%%%
     %Note that d3=C;
     [d2,gamma2]=min(bsxfun(@plus,C,reshape(u,[1,1,n3])),[],3);
-   
+    iterTimes(1,k+1)=toc(tStart);
+    tStart=tic();
+    
     %gamma1 is the columns for rows (nonzero elements in omega).
     [gamma1, ~, minVal]=assign2D(d2,false);
-    
+    iterTimes(2,k+1)=toc(tStart);
+    tStart=tic();
+
     %If the subproblem is infeasible.
     if(isempty(gamma1))
         tuples=[];
@@ -323,6 +368,7 @@ for k=0:(maxIter-1)
         qStar=[];
         u=[];
         exitCode=-1;
+        iterTimes=[];
         return
     end
 
@@ -340,7 +386,8 @@ for k=0:(maxIter-1)
         %handling of NaNs.
         if(costGap<=AbsTol||(costGap<abs(qStar)*RelTol))
             exitCode=k+1;%The algorithm converged.
-            break; 
+            iterTimes(3,k+1)=toc(tStart);
+            break;
         end
     end
 
@@ -375,6 +422,7 @@ for k=0:(maxIter-1)
         end
 
         exitCode=k+1;%The algorithm converged.
+        iterTimes(3,k+1)=toc(tStart);
         break;
     end
 
@@ -383,7 +431,8 @@ for k=0:(maxIter-1)
     %If the primal converged.
     if(retVal==0)
         exitCode=k+1;
-        break; 
+        iterTimes(3,k+1)=toc(tStart);
+        break;
     end
 
     %If an error occurred obtaining a feasible solution.
@@ -393,6 +442,7 @@ for k=0:(maxIter-1)
         qStar=[];
         u=[];
         exitCode=retVal;
+        iterTimes=[];
         return;
     end
 
@@ -482,6 +532,30 @@ for k=0:(maxIter-1)
             u=u+alpha*H*d;
 
             gPrev=g;
+            dPrev=d;
+        case 5%Polyak's method with a deflected subgradient.
+            if(k==0)
+                d=g;
+            else
+                dPrevNorm2=dot(dPrev,dPrev);
+                theta=0;
+                if(dPrevNorm2>0)
+                    theta=max(0,-eta*dot(g,dPrev)/dPrevNorm2);
+                end
+                d=g+theta*dPrev;
+            end
+            
+            dNorm2=dot(d,d);
+            if(dNorm2==0)
+                %The deflection cancelled the subgradient, so the plain
+                %subgradient is used.
+                d=g;
+                dNorm2=gNorm2;
+            end
+            
+            alpha=gammaParam*((fStar-q)/dNorm2);
+            u=u+alpha*d;
+            
             dPrev=d;
         otherwise
             error('Invalid subgradient method specified.')
@@ -490,6 +564,7 @@ for k=0:(maxIter-1)
     if(any(~isfinite(u)))
         %This can sometimes occur with big problems and poor stepsizes.
         exitCode=-3;
+        iterTimes=[];
         break;
     end
 
@@ -498,6 +573,12 @@ for k=0:(maxIter-1)
     if(unconstU==false)
         u(u<0)=0;
     end
+    iterTimes(3,k+1)=toc(tStart);
+end
+
+if(exitCode>=0)
+    %Remove the entries for the iterations that were not run.
+    iterTimes=iterTimes(:,1:exitCode);
 end
 
 %Adjust the gains for the case where the initial cost matrix is transformed
@@ -0,0 +1,206 @@
+/**ASSIGN3DBB Solve the data fusion axial 3D assignment problem exactly
+ *         using a parallel branch-and-bound algorithm. Such problems are
+ *         NP-hard and thus cannot be solved in polynomial time, so this
+ *         function can only solve problems of a moderate size. The
+ *         optimization problem being solved is minimize (or maximize)
+ *         \sum_{i=1}^{n1}\sum_{j=1}^{n2}\sum_{k=1}^{n3}C_{i,j,k}*\rho_{i,j,k}
+ *         subject to
+ *         \sum_{i=1}^{n1}\sum_{j=1}^{n2}\rho_{i,j,k}<=1 for all k
+ *         \sum_{i=1}^{n1}\sum_{k=1}^{n3}\rho_{i,j,k}<=1 for all j
+ *         \sum_{j=1}^{n2}\sum_{k=1}^{n3}\rho_{i,j,k} =1 for all i
+ *         \rho_{i,j,k} = 0 or 1
+ *         assuming that n1<=n2<=n3, and C is and n1Xn2Xn3 cost matrix.
+ *         Additional comments are given in the Matlab implementation of
+ *         the function.
+ *
+ *INPUTS: C An n1Xn2Xn3 cost hypermatrix with n1<=n2<=n3. C cannot contain
+ *          any NaNs. Forbidden assignments can be given costs of +Inf for
+ *          minimization and -Inf for maximization.
+ * maximize If true, the minimization problem is transformed into a
+ *          maximization problem. The default if this parameter is omitted
+ *          or an empty matrix is passed is false.
+ * boundType This selects the bound to use for pruning. These correspond
+ *          to the method input of the assign3DLB function. The default if
+ *          this parameter is omitted or an empty matrix is passed is 2.
+ * initMethod A parameter indicating how the branch-and-bound algorithm
+ *          should be initialized. Possible values are:
+ *          0 (The default if omitted or an empty matrix is passed) Do not
+ *            use an initial estimate.
+ *          1 Use the solution and dual cost of the assign3D function with
+ *            subgradient method 0 as the initial incumbent and lower
+ *            bound.
+ *  maxIter If initMethod=1, then this is the maximum number of iterations
+ *          to allow assign3D. The default if omitted or an empty matrix is
+ *          passed is 10.
+ *   epsVal If initMethod=1 and the relative duality gap of the solution
+ *          of assign3D is below epsVal, then the solution is taken to be
+ *          optimal and no search is performed. The default if omitted or
+ *          an empty matrix is passed is eps(1).
+ * numThreads The number of threads to use for the search. The default if
+ *          omitted or an empty matrix is passed is the number of hardware
+ *          threads available.
+ *
+ *OUTPUTS: tuples A 3Xn1 matrix where tuples(:,i) is the ith assigned tuple
+ *                in C. If no feasible assignment exists, an empty matrix
+ *                is returned.
+ *           gain The cost value of the optimal assignment found. This is
+ *                Inf (-Inf if maximizing) if no feasible assignment
+ *                exists.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[tuples,gain]=assign3DBB(C,maximize,boundType,initMethod,maxIter,epsVal,numThreads);
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "matrix.h"
+#include "mex.h"
+/* This header validates inputs and includes a header needed to handle
+ * Matlab matrices.*/
+#include "MexValidation.h"
+#include "assign3DBBCPP.hpp"
+#include <limits>
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t nVals[3];
+    bool maximize=false;
+    int boundType=2;
+    int initMethod=0;
+    size_t maxIter=10;
+    double epsVal=std::numeric_limits<double>::epsilon();
+    size_t numThreads=0;
+    const double *C;
+    ptrdiff_t *tuples;
+    double gain;
+    bool isFeasible;
+
+    if(nrhs<1||nrhs>7) {
+        mexErrMsgTxt("Incorrect number of inputs.");
+        return;
+    }
+
+    if(nlhs>2) {
+        mexErrMsgTxt("Invalid number of outputs.");
+        return;
+    }
+
+    //The empty matrix special case.
+    if(mxIsEmpty(prhs[0])) {
+        plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleScalar(0);
+        }
+        return;
+    }
+
+    checkRealDoubleHypermatrix(prhs[0]);
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[0]);
+        const mwSize *theDims=mxGetDimensions(prhs[0]);
+
+        if(numDims>3) {
+            mexErrMsgTxt("C has too many dimensions.");
+            return;
+        }
+
+        nVals[0]=theDims[0];
+        nVals[1]=theDims[1];
+        //numDims will never be <2 due to how Matlab parameterizes things.
+        if(numDims==2) {
+            nVals[2]=1;
+        } else {
+            nVals[2]=theDims[2];
+        }
+    }
+
+    if(!(nVals[0]<=nVals[1]&&nVals[1]<=nVals[2])) {
+        mexErrMsgTxt("It is required that size(C,1)<=size(C,2)<=size(C,3)");
+        return;
+    }
+
+    C=reinterpret_cast<const double*>(mxGetData(prhs[0]));
+
+    if(nrhs>1&&!mxIsEmpty(prhs[1])) {
+        maximize=getBoolFromMatlab(prhs[1]);
+    }
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        boundType=getIntFromMatlab(prhs[2]);
+
+        if(boundType<0||boundType>2) {
+            mexErrMsgTxt("Invalid boundType specified.");
+            return;
+        }
+    }
+
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        initMethod=getIntFromMatlab(prhs[3]);
+
+        if(initMethod!=0&&initMethod!=1) {
+            mexErrMsgTxt("Invalid initMethod specified.");
+            return;
+        }
+    }
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        maxIter=getSizeTFromMatlab(prhs[4]);
+
+        if(maxIter<1) {
+            mexErrMsgTxt("maxIter must be >=1.");
+            return;
+        }
+    }
+
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        epsVal=getDoubleFromMatlab(prhs[5]);
+
+        if(epsVal<0) {
+            mexErrMsgTxt("epsVal should be non-negative.");
+            return;
+        }
+    }
+
+    if(nrhs>6&&!mxIsEmpty(prhs[6])) {
+        numThreads=getSizeTFromMatlab(prhs[6]);
+    }
+
+    tuples=reinterpret_cast<ptrdiff_t*>(mxMalloc(3*nVals[0]*sizeof(ptrdiff_t)));
+    isFeasible=assign3DBBCPP(tuples,gain,nVals,C,maximize,boundType,initMethod==1,maxIter,epsVal,numThreads);
+
+    if(isFeasible) {
+        const size_t numEls=3*nVals[0];
+
+        //Convert the C indices into indices for Matlab.
+        for(size_t i=0;i<numEls;i++) {
+            tuples[i]++;
+        }
+
+        plhs[0]=ptrDiffTMat2MatlabDoubles(tuples,3,nVals[0]);
+    } else {
+        plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);
+    }
+    mxFree(tuples);
+
+    if(nlhs>1) {
+        plhs[1]=mxCreateDoubleScalar(gain);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -1,4 +1,4 @@
-function [minCostTuples,gain]=assign3DBB(C,maximize,boundType,initMethod,maxIter,epsVal)
+function [minCostTuples,gain]=assign3DBB(C,maximize,boundType,initMethod,maxIter,epsVal,numThreads)
 %%ASSIGN3DBB Solve the data fusion axial 3D assignment problem using a
 %         branch-and-bound algorithm. Such problems are NP-hard and thus
 %         cannot be solved in polynomial time, so this function can only
@@ -52,6 +52,10 @@ function [minCostTuples,gain]=assign3DBB(C,maximize,boundType,initMethod,maxIter
 %          relative duality gap. If initMethod~=1, then this parameter is
 %          ignored. The default if omitted or an empty matrix is passed is
 %          eps(1).
+% numThreads The number of threads to use in the compiled implementation
+%          of this function. This parameter is ignored by the Matlab
+%          implementation. The default if omitted or an empty matrix is
+%          passed is the number of hardware threads available.
 %
 %OUTPUTS: tuples A 3Xn1 matrix where tuples(:,i) is the ith assigned tuple
 %                in C as described above.
@@ -80,6 +84,11 @@ function [minCostTuples,gain]=assign3DBB(C,maximize,boundType,initMethod,maxIter
 %    Research, Statistics and Computer Science, vol. 32, no. 1-3, pp.
 %    85-98, 1993.
 %
+%This function can be compiled for use in Matlab using the
+%CompileCLibraries function. The compiled version explores the tree using
+%multiple threads, with each thread performing a depth-first search and
+%idle threads stealing unexplored nodes from the other threads.
+%
 %September 2017 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
@@ -142,7 +151,7 @@ switch(initMethod)
         minCostTuples=[];
     case 1
         initAlgorithm=0;
-        [minCostTuples,gain,q]=assign3D(C,false,initAlgorithm,[],[],maxIter,epsVal);
+        [minCostTuples,gain,q]=assign3D(C,false,initAlgorithm,[],maxIter,[],epsVal);
     otherwise
         error('Invalid initMethod specified.');
 end
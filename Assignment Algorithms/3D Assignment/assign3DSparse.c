@@ -0,0 +1,423 @@
+/**ASSIGN3DSPARSE A C-code (for Matlab) implementation of a dual-primal
+ *          Lagrangian relaxation algorithm for approximating the solution
+ *          to the operations research axial 3D assignment problem when
+ *          only a sparse set of tuples of the cost hypermatrix is allowed.
+ *          See the comments to the Matlab file assign3DSparse.m for more
+ *          details.
+ *
+ *It is assumed that all matrices are sufficiently small that it does not
+ *matter whether lengths are held in size_t or ptrdiff_t variables.
+ *
+ * The algorithm can be compiled for use in Matlab  using the 
+ * CompileCLibraries function.
+ *
+ * The algorithm is run in Matlab using the command format
+ * [tuples,fStar,qStar,u,exitCode]=assign3DSparse(tupleIdx,C,nDims,maximize,subgradMethod,subgradParams,maxIter,AbsTol,RelTol);
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mex.h"
+/* This header validates inputs and includes a header needed to handle
+ * Matlab matrices.*/
+#include "MexValidation.h"
+
+//Prototypes for the actual assignment functions.
+#include "assignAlgs3D.h"
+//For qsort
+#include <stdlib.h>
+
+/*Lexicographically compare two tuples of three indices. This is used with
+ *qsort to find repeated tuples.*/
+static int compareTuples(const void *a, const void *b) {
+    const size_t *tupleA=(const size_t*)a;
+    const size_t *tupleB=(const size_t*)b;
+    size_t i;
+
+    for(i=0;i<3;i++) {
+        if(tupleA[i]<tupleB[i]) {
+            return -1;
+        } else if(tupleA[i]>tupleB[i]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t nDims[3];
+    size_t numTuples;
+    double AbsTol=1e-10;
+    double RelTol=0.05;
+    double *C, *CCopy;
+    size_t maxIter=20;
+    bool maximize=false;
+    int subgradMethod=0;
+    //These are the parameters for the subgradient algorithm. Their
+    //specific definitions vary depending on the subgradient algorithm that
+    //has been selected.
+    double param1, param2=0;
+    size_t param3=0;
+    mxArray *uMATLAB, *tupleIdxMat;
+    size_t *tupleIdx;
+    ptrdiff_t *tuples;
+    double *u;
+    void *tempSpace;
+    double fStar, qStar;
+    ptrdiff_t exitCode;
+    
+    if(nrhs>9||nrhs<3){
+        mexErrMsgTxt("Incorrect number of inputs.");
+        return;
+    }
+
+    if(nlhs>5) {
+        mexErrMsgTxt("Invalid number of outputs.");
+        return;
+    }
+
+    ////////
+    //Check the dimensions
+    ///////
+    {
+        size_t arrayLen;
+        size_t *nDimsMat=copySizeTArrayFromMatlab(prhs[2],&arrayLen);
+        
+        if(arrayLen!=3) {
+            mxFree(nDimsMat);
+            mexErrMsgTxt("nDims must have three elements.");
+            return;
+        }
+        nDims[0]=nDimsMat[0];
+        nDims[1]=nDimsMat[1];
+        nDims[2]=nDimsMat[2];
+        mxFree(nDimsMat);
+    }
+
+    if(!(nDims[0]<=nDims[1]&&nDims[1]<=nDims[2])) {
+        mexErrMsgTxt("It is required that nDims(1)<=nDims(2)<=nDims(3)");
+        return;
+    }
+
+    if(nDims[0]==0) {//The empty matrix special case.
+        plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);//tuples=[];
+        
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleScalar(0);//fStar=0
+            
+            if(nlhs>2) {
+                plhs[2]=mxCreateDoubleScalar(0);//qStar=0
+            
+                if(nlhs>3) {
+                    plhs[3]=mxCreateDoubleMatrix(nDims[2],1,mxREAL);//u=zeros(n3,1)
+                    
+                    if(nlhs>4) {
+                        plhs[4]=mxCreateDoubleScalar(0);//exitCode=0
+                    }
+                }
+            }
+        }
+        return;
+    }
+
+    ////////
+    //Check the tuples and costs
+    ///////
+    checkRealDoubleArray(prhs[1]);
+    numTuples=mxGetNumberOfElements(prhs[1]);
+    C=mxGetPr(prhs[1]);
+    
+    if(numTuples==0||mxGetM(prhs[0])!=3||mxGetN(prhs[0])!=numTuples) {
+        mexErrMsgTxt("tupleIdx must be a 3XnumTuples matrix, where numTuples is the number of elements in C.");
+        return;
+    }
+
+    {
+        size_t i;
+        for(i=0;i<numTuples;i++) {
+            if(!mxIsFinite(C[i])) {
+                mexErrMsgTxt("The costs in C must be finite.");
+                return;
+            }
+        }
+    }
+
+    tupleIdxMat=convert2DReal2UnsignedSizeMat(prhs[0]);
+    tupleIdx=(size_t*)mxGetData(tupleIdxMat);
+    
+    //Convert the Matlab indices into indices for C and make sure that
+    //they are all valid.
+    {
+        size_t i;
+        for(i=0;i<3*numTuples;i++) {
+            if(tupleIdx[i]<1||tupleIdx[i]>nDims[i%3]) {
+                mxDestroyArray(tupleIdxMat);
+                mexErrMsgTxt("Invalid index in tupleIdx.");
+                return;
+            }
+            tupleIdx[i]--;
+        }
+    }
+
+    //Make sure that no tuple is given more than once by sorting a copy of
+    //the tuples and comparing adjacent ones.
+    {
+        size_t *sortedTuples=(size_t*)mxMalloc(3*numTuples*sizeof(size_t));
+        size_t i;
+
+        memcpy(sortedTuples,tupleIdx,3*numTuples*sizeof(size_t));
+        qsort(sortedTuples,numTuples,3*sizeof(size_t),compareTuples);
+        for(i=1;i<numTuples;i++) {
+            if(compareTuples(sortedTuples+3*(i-1),sortedTuples+3*i)==0) {
+                mxFree(sortedTuples);
+                mxDestroyArray(tupleIdxMat);
+                mexErrMsgTxt("Each tuple in tupleIdx must be unique.");
+                return;
+            }
+        }
+        mxFree(sortedTuples);
+    }
+
+    ////////
+    //Check the other inputs
+    ///////
+    
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        maximize=getBoolFromMatlab(prhs[3]);
+    }
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        subgradMethod=getIntFromMatlab(prhs[4]);
+        
+        if(subgradMethod<0||subgradMethod>5) {
+            mxDestroyArray(tupleIdxMat);
+            mexErrMsgTxt("Invalid subgradMethod specified.");
+            return;
+        }
+    }
+    
+    //Set the default parameters for the selected subgradient method.
+    switch(subgradMethod) {
+        case 0:
+            param1=1;//gammaParam
+            break;
+        case 1:
+            param1=2.8;//M
+            param2=0.06;//r
+            break;
+        case 2:
+            param1=0.3;//a
+            param2=1.5;//b
+            break;
+        case 5:
+            param1=1;//gammaParam
+            param2=1.5;//eta
+            break;
+        case 3:
+        default://subgradMethod==4
+            param1=2;//M=2
+            param2=2.220446049250313e-16;//normBound=eps();
+            param3=nDims[2];//NR=n3;
+    }
+
+    //Get any provided subgradient parameters.
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        mxArray *curField;
+        if(!mxIsStruct(prhs[5])) {
+            mxDestroyArray(tupleIdxMat);
+            mexErrMsgTxt("subgradParams must be a structure.");
+            return;
+        }
+        
+        switch(subgradMethod) {
+            case 0:
+                curField=mxGetField(prhs[5],0,"gamma");
+                if(curField!=NULL) {
+                    param1=getDoubleFromMatlab(curField);
+                }
+
+                break;
+            case 1:
+                curField=mxGetField(prhs[5],0,"M");
+                if(curField!=NULL) {
+                    param1=getDoubleFromMatlab(curField);
+                }
+                
+                curField=mxGetField(prhs[5],0,"r");
+                if(curField!=NULL) {
+                    param2=getDoubleFromMatlab(curField);
+                }
+
+                break;
+            case 2:
+                curField=mxGetField(prhs[5],0,"a");
+                if(curField!=NULL) {
+                    param1=getDoubleFromMatlab(curField);
+                }
+                
+                curField=mxGetField(prhs[5],0,"b");
+                if(curField!=NULL) {
+                    param2=getDoubleFromMatlab(curField);
+                }
+
+                break;
+            case 5:
+                curField=mxGetField(prhs[5],0,"gamma");
+                if(curField!=NULL) {
+                    param1=getDoubleFromMatlab(curField);
+                }
+
+                curField=mxGetField(prhs[5],0,"eta");
+                if(curField!=NULL) {
+                    param2=getDoubleFromMatlab(curField);
+                }
+
+                break;
+            case 3:
+            default:
+                curField=mxGetField(prhs[5],0,"M");
+                if(curField!=NULL) {
+                    param1=getDoubleFromMatlab(curField);
+                }
+                
+                curField=mxGetField(prhs[5],0,"normBound");
+                if(curField!=NULL) {
+                    param2=getDoubleFromMatlab(curField);
+                }
+                
+                curField=mxGetField(prhs[5],0,"NR");
+                if(curField!=NULL) {
+                    param3=getSizeTFromMatlab(curField);
+                }
+        }
+    }
+        
+    if(nrhs>6&&!mxIsEmpty(prhs[6])) {
+        maxIter=getSizeTFromMatlab(prhs[6]);
+        
+        if(maxIter<1) {
+            mxDestroyArray(tupleIdxMat);
+            mexErrMsgTxt("maxIter must be >=1.");
+            return;
+        }
+    }
+    
+    if(nrhs>7&&!mxIsEmpty(prhs[7])) {
+        AbsTol=getDoubleFromMatlab(prhs[7]);
+        
+        if(AbsTol<0) {
+            mxDestroyArray(tupleIdxMat);
+            mexErrMsgTxt("AbsTol should be non-negative.");
+            return;
+        }
+    }
+    
+    if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+        RelTol=getDoubleFromMatlab(prhs[8]);
+        
+        if(RelTol<0) {
+            mxDestroyArray(tupleIdxMat);
+            mexErrMsgTxt("RelTol should be non-negative.");
+            return;
+        }
+    }
+    
+    ////////
+    //Allocate space for temporary parameters and return variables.
+    ///////
+    //Duplicate the input costs. If maximization is performed, the
+    //original ones will be overwritten.
+    CCopy=(double*)mxMalloc(numTuples*sizeof(double));
+    memcpy(CCopy,C,numTuples*sizeof(double));
+
+    uMATLAB=mxCreateNumericMatrix(nDims[2],1,mxDOUBLE_CLASS,mxREAL);
+    u=mxGetPr(uMATLAB);
+    
+    //Allocate space for an additional 3*n1 ptrdiff_t values to hold the
+    //tuples ahead of the buffer.
+    tempSpace=mxMalloc(assign3DSparseCBufferSize(nDims,numTuples,subgradMethod)+3*nDims[0]*sizeof(ptrdiff_t));
+    tuples=(ptrdiff_t*)tempSpace;
+    
+    {
+        void *bufferStart=(void*)(tuples+3*nDims[0]);
+        exitCode=assign3DSparseC(tuples,&fStar,&qStar,u,bufferStart,nDims,numTuples,tupleIdx,CCopy,maximize,subgradMethod,maxIter,AbsTol,RelTol,param1,param2,param3);
+        mxFree(CCopy);
+        mxDestroyArray(tupleIdxMat);
+    }
+    
+    if(exitCode==-3||exitCode==-1) {
+        // If no valid assignment was found.   
+        mxFree(tempSpace);
+        mxDestroyArray(uMATLAB);
+        
+        plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);//tuples=[];
+        
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleMatrix(0,0,mxREAL);//fStar=[]'
+            
+            if(nlhs>2) {
+                plhs[2]=mxCreateDoubleMatrix(0,0,mxREAL);//qStar=[]
+            
+                if(nlhs>3) {
+                    plhs[3]=mxCreateDoubleMatrix(0,0,mxREAL);//u=[]
+                    
+                    if(nlhs>4) {
+                        plhs[4]=mxCreateDoubleScalar((double)exitCode);//exitCode
+                    }
+                }
+            }
+        }
+        return;
+    } else {
+        const size_t numEls=3*nDims[0];
+        size_t i;
+        
+        /* Convert the C indices into indices for MATLAB.*/
+        for(i=0;i<numEls;i++) {
+            tuples[i]++;
+        }
+        
+        plhs[0]=ptrDiffTMat2MatlabDoubles(tuples,3,nDims[0]);
+        mxFree(tempSpace);
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleScalar(fStar);
+            
+            if(nlhs>2) {
+                plhs[2]=mxCreateDoubleScalar(qStar);
+                        
+                if(nlhs>3) {
+                    plhs[3]=uMATLAB;
+                    
+                    if(nlhs>4) {
+                        plhs[4]=mxCreateDoubleScalar((double)exitCode);
+                    }
+                } else {
+                    mxDestroyArray(uMATLAB);
+                }
+            } else {
+                mxDestroyArray(uMATLAB);
+            }
+        } else {
+            mxDestroyArray(uMATLAB);
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,83 @@
+function [tuples,fStar,qStar,u,exitCode]=assign3DSparse(tupleIdx,C,nDims,maximize,subgradMethod,subgradParams,maxIter,AbsTol,RelTol)
+%%ASSIGN3DSPARSE Approximate the solution to the operations research axial
+%         3D assignment problem using a dual-primal Lagrangian relaxation 
+%         technique when only a sparse set of tuples is allowed. This
+%         solves the same problem as assign3D, except rather than taking
+%         the full n1Xn2Xn3 cost hypermatrix, the allowed (gated) tuples
+%         are given as a list of indices and costs. All tuples that are not
+%         in the list are forbidden. The relaxed problem in each iteration
+%         only minimizes over the listed tuples and the 2D assignment
+%         subproblems are solved with a sparse shortest augmenting path
+%         algorithm, so memory and computation scale with the number of
+%         listed tuples rather than with n1*n2*n3.
+%
+%INPUTS: tupleIdx A 3XnumTuples matrix of indices such that tupleIdx(:,k)
+%          holds the [i1;i2;i3] indices of the kth allowed tuple. Each
+%          tuple must appear at most once.
+%        C A numTuplesX1 or 1XnumTuples vector of the costs of the tuples
+%          in tupleIdx. These must be finite.
+%    nDims A 3X1 or 1X3 vector of the dimensions [n1;n2;n3] of the
+%          implied cost hypermatrix. It is required that n1<=n2<=n3.
+% maximize, subgradMethod, subgradParams, maxIter, AbsTol, RelTol These are
+%          all the same as in assign3D and have the same defaults. With
+%          subgradMethod=5, the relaxed 2D problems are not warm-started.
+%
+%OUTPUTS: tuples, fStar, qStar, u, exitCode These are the same as in
+%                assign3D. However, the heuristic used to obtain a
+%                feasible solution from the relaxed problem frequently
+%                fails when the tuples are sparse. Such failures are not
+%                treated as an error; exitCode is -1 only if the relaxed
+%                problem is infeasible (so the 3D problem is infeasible)
+%                or if no feasible solution was found within maxIter
+%                iterations. Until a feasible solution is found, the
+%                subgradient step sizes use the sum over i1 of the largest
+%                cost of the tuples having that value of i1 in place of
+%                fStar, as that bounds the cost of any feasible solution.
+%
+%The algorithm is described in the comments to assign3D.
+%
+%The algorithm can be compiled for use in Matlab  using the 
+%CompileCLibraries function.
+%
+%The algorithm is run in Matlab using the command format
+%[tuples,fStar,qStar,u,exitCode]=assign3DSparse(tupleIdx,C,nDims,maximize,subgradMethod,subgradParams,maxIter,AbsTol,RelTol);
+%
+%EXAMPLE:
+%Here, a random problem where about 20% of the tuples are gated is solved.
+%The result is compared to assign3D with the forbidden tuples given
+%infinite costs.
+% n1=10;
+% n2=12;
+% n3=15;
+% CFull=Inf(n1,n2,n3);
+% sel=find(rand(n1,n2,n3)<0.2);
+% CFull(sel)=randn(length(sel),1);
+% [i1,i2,i3]=ind2sub([n1,n2,n3],sel);
+% tupleIdx=[i1(:).';i2(:).';i3(:).'];
+% [tuples,fStar,qStar]=assign3DSparse(tupleIdx,CFull(sel),[n1;n2;n3],false,[],[],100)
+% [tuplesDense,fStarDense,qStarDense]=assign3D(CFull,false,[],[],100)
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+error('This function is only implemented as a mexed C or C++ function. Please run CompileCLibraries.m to compile the function for use.')
+
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
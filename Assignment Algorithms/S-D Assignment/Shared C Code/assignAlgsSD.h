@@ -0,0 +1,59 @@
+/**ASSIGNALGSSD This is a header for C language functions to solve the
+ *              axial operations research S-dimensional assignment
+ *              problem. The inputs of the specific functions are
+ *              described in their implementation file, which is
+ *              assignSDC.c.
+ * 
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef ASSIGNALGSSD
+#define ASSIGNALGSSD
+
+//Defines the size_t and ptrdiff_t types
+#include <stddef.h>
+
+#if __STDC_VERSION__>=199901L
+#include <stdbool.h>
+#else
+#ifndef _bool_T
+#define false 0
+#define true 1
+#define bool int
+#define _bool_T
+#endif
+#endif
+
+//If using Microsoft Visual Studio
+#ifdef _MSC_VER
+#ifndef RESTRICT
+//Microsoft does not support the restrict keyword in C, but it does have
+//its own version.
+#define restrict __restrict
+#endif
+#endif
+
+//Function prototypes.
+size_t assignSDCBufferSize(const size_t numDims,const size_t *nDims,const size_t numTuples);
+ptrdiff_t assignSDC(size_t * restrict tupleSel,double * restrict fStar,double * restrict qStar,double * restrict u,double * restrict gapHist,size_t * restrict numIter,void *tempSpace,const size_t numDims,const size_t *nDims,const size_t numTuples,const size_t * restrict tupleIdx,double * restrict C,const bool maximize,const size_t maxIter,const double AbsTol,const double RelTol,const double gammaParam);
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
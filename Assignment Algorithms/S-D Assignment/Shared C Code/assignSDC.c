@@ -0,0 +1,699 @@
+/**ASSIGNSDC This file contains C language functions implementing a
+ *          Lagrangian relaxation-based approximate solution to the axial
+ *          operations research S-dimensional (S-D) assignment problem when
+ *          only a sparse set of tuples (hypotheses) is allowed. The
+ *          constraints on index sets 3 through S are relaxed so that the
+ *          dual cost is obtained from a sparse 2D assignment problem. A
+ *          feasible solution is recovered in each iteration by fixing the
+ *          (i1,i2) pairs of the relaxed solution, which leaves an
+ *          (S-1)-dimensional problem over the same kind of sparse tuples
+ *          that is solved by recursively applying the same algorithm. The
+ *          recursion ends with a 2D problem, which is solved exactly using
+ *          assign2DSparseC. See the comments to the Matlab file assignSD.m
+ *          for more details.
+ *
+ *All of the memory needed at all of the levels of the recursion is
+ *allocated once by the caller. The arrays that are only used between the
+ *start of an iteration and the recursive call (the relaxed costs, the
+ *sorting space and the workspace of the 2D assignment algorithm) are
+ *shared by all of the levels.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//The header for the implementations here.
+#include "assignAlgsSD.h"
+
+//The header for the 2D assignment algorithms in C.
+#include "assignAlgs2D.h"
+
+//For fabs, sqrt and INFINITY.
+#include <math.h>
+
+//For uint8_t and other types.
+#include <stdint.h>
+
+//For memset.
+#include <string.h>
+
+/*If a compiler does not support INFINITY in C99, then it must be
+ * explicitly defined.*/
+#ifndef INFINITY
+static const uint64_t infVal=0x7ff0000000000000;
+#define INFINITY (*(double*)(&infVal))
+#endif
+
+#if __STDC_VERSION__>=199901L
+#define isFinite(x) isfinite(x)
+#else
+//Microsoft does not declare isfinite (in the C99 standard), but it does
+//declare _finite in float.h.
+#include <float.h>
+#define isFinite(x)_finite(x)
+#endif
+
+//The arrays that are shared by all levels of the recursion. nMax is the
+//largest of the dimensions of the problem.
+typedef struct {
+    double *d2;//Length numTuples
+    double *u2D;//Length n1
+    double *v2D;//Length nMax
+    size_t *gamma2;//Length numTuples
+    size_t *sortScratch;//Length numTuples
+    size_t *countScratch;//Length nMax+1
+    ptrdiff_t *rowMark;//Length nMax
+    ptrdiff_t *col4row;//Length nMax
+    ptrdiff_t *row4col;//Length n1
+    void *buffer2D;//assign2DSparseCBufferSize(nMax,n1) bytes
+} SharedScratchSD;
+
+static size_t assignSDLevelBufferSize(const size_t numDims,const size_t n1,const size_t *restDims,const size_t numTuples);
+static ptrdiff_t assignSDLevel(size_t * restrict tupleSel,double * restrict fStar,double * restrict qStar,double * restrict u,double * restrict gapHist,size_t * restrict numIter,void *tempSpace,const size_t numDims,const size_t n1,const size_t *restDims,const size_t numTuples,const size_t * restrict tupleIdx,const double * restrict C,const size_t maxIter,const double AbsTol,const double RelTol,const double gammaParam,const SharedScratchSD *scratch);
+static void countSortTuples(size_t * restrict sortedIdx,const size_t * restrict inputIdx,const size_t numTuples,const size_t * restrict tupleIdx,const size_t numDims,const size_t dim,const size_t numVals,size_t * restrict counts);
+
+size_t assignSDCBufferSize(const size_t numDims,const size_t *nDims,const size_t numTuples) {
+/**ASSIGNSDCBUFFERSIZE Given the number of dimensions, the dimensions of the
+ *      assignment hypermatrix and the number of tuples, return the minimum
+ *      size of the input tempBuffer needed (in bytes) for the assignSDC
+ *      function.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    const size_t n1=nDims[0];
+    size_t nMax=0;
+    size_t i;
+
+    for(i=0;i<numDims;i++) {
+        if(nDims[i]>nMax) {
+            nMax=nDims[i];
+        }
+    }
+
+    //The shared arrays, the buffers for the levels of the recursion and
+    //then the buffer for the 2D assignment algorithm, which is put last,
+    //because it ends with boolean values.
+    return sizeof(double)*(numTuples+n1+nMax)+sizeof(size_t)*(2*numTuples+nMax+1)+sizeof(ptrdiff_t)*(2*nMax+n1)+assignSDLevelBufferSize(numDims,n1,nDims+1,numTuples)+assign2DSparseCBufferSize(nMax,n1);
+}
+
+ptrdiff_t assignSDC(size_t * restrict tupleSel,double * restrict fStar,double * restrict qStar,double * restrict u,double * restrict gapHist,size_t * restrict numIter,void *tempSpace,const size_t numDims,const size_t *nDims,const size_t numTuples,const size_t * restrict tupleIdx,double * restrict C,const bool maximize,const size_t maxIter,const double AbsTol,const double RelTol,const double gammaParam) {
+/**ASSIGNSDC Approximate the solution to the operations research axial
+ *         S-D assignment problem over a sparse set of tuples using a
+ *         recursive dual-primal Lagrangian relaxation algorithm. The
+ *         optimization problem being solved is
+ *         minimize (or maximize) sum_{k} C[k]*rho[k]
+ *         subject to
+ *         sum_{k: tupleIdx(1,k)=i} rho[k] =1 for all i in the first index
+ *                                            set
+ *         sum_{k: tupleIdx(s,k)=i} rho[k]<=1 for all i in the sth index
+ *                                            set, s>1
+ *         rho[k] = 0 or 1
+ *         where the sum is over the numTuples provided tuples and it is
+ *         required that nDims[0]<=nDims[s] for all s.
+ *
+ *INPUTS: tupleSel A pointer to an array of nDims[0] size_t values in which
+ *         the zero-based index of the tuple that is assigned to each
+ *         element of the first index set is placed.
+ *   fStar A pointer to a double that will hold the cost of the best
+ *         primal solution found.
+ *   qStar A pointer to a double that will hold the best dual cost found.
+ *       u A pointer to an array to hold the dual variables of index sets
+ *         3 to S, one after the other. The array has
+ *         sum(nDims[2:(numDims-1)]) elements.
+ * gapHist A pointer to an array of 2*maxIter doubles in which fStar and
+ *         qStar are recorded after each iteration, or NULL if this history
+ *         is not desired.
+ * numIter A pointer to a size_t value that will hold the number of
+ *         iterations performed.
+ * tempSpace A pointer to a buffer that is used as temporary space by
+ *         this function. The buffer must be at least
+ *         assignSDCBufferSize(numDims,nDims,numTuples) bytes in size.
+ * numDims The number of index sets, S>=2.
+ *   nDims A length numDims array of the sizes of the index sets.
+ * numTuples The number of provided tuples.
+ * tupleIdx A numDimsXnumTuples matrix of zero-based indices stored by
+ *         column, so the indices of tuple k are tupleIdx[numDims*k] to
+ *         tupleIdx[numDims*k+numDims-1].
+ *       C The length-numTuples array of the costs of the tuples. This is
+ *         modified if maximize is true.
+ * maximize If true, the cost is maximized rather than minimized.
+ * maxIter The maximum number of iterations to perform at each level of
+ *         the recursion. This should be >=1.
+ *  AbsTol The absolute duality gap to use for convergence determiniation.
+ *  RelTol The relative duality gap to use for convergence determiniation.
+ * gammaParam The parameter of Polyak's step size rule, which is used for
+ *         the subgradient updates. The dual update for minimization is
+ *         uNew=u+gammaParam*(fStar-q)/norm(g)^2*g.
+ *
+ *OUTPUTS: The outputs are put in tupleSel, fStar, qStar, u, gapHist and
+ *         numIter. The return value is an exitCode, which takes the
+ *         following values:
+ *               -3 A non-finite number arose in the dual variables, so the
+ *                  algorithm stopped.
+ *               -2 The algorithm did not converge within the alotted
+ *                  number of iterations. However, a valid feasible
+ *                  assignment was found.
+ *               -1 The problem is infeasible or no feasible assignment was
+ *                  found.
+ *               >=0 Values that are zero or positive indicate the
+ *                  convergence was obtained and the returned value is the
+ *                  number of iterations.
+ *
+ *The relaxation and recovery are those of [1], but only Polyak's step size
+ *rule [2] is used and all of the relaxed constraints are dualized at once,
+ *so the dual cost comes from a single 2D assignment problem.
+ *
+ *REFERENCES:
+ *[1] S. Deb, M. Yeddanapudi, K. Pattipati, and Y. Bar-Shalom, "A
+ *    generalized S-D assignment algorithm for multisensor-multitarget
+ *    state estimation," IEEE Transactions on Aerospace and Electronic
+ *    Systems, vol. 33, no. 2, pp. 523-538, Apr. 1997.
+ *[2] B. T. Polyak, "Minimization of unsmooth functionals," USSR
+ *    Computational Mathematics and Mathematical Physics, vol. 9, no. 3, pp.
+ *    14-29, 1969.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    const size_t n1=nDims[0];
+    size_t nMax=0, numDual=0;
+    size_t i;
+    ptrdiff_t retVal;
+    SharedScratchSD scratch;
+    void *curBuffPos=tempSpace;
+
+    for(i=0;i<numDims;i++) {
+        if(nDims[i]>nMax) {
+            nMax=nDims[i];
+        }
+    }
+    for(i=2;i<numDims;i++) {
+        numDual+=nDims[i];
+    }
+
+    //Divide the buffer among the shared arrays.
+    scratch.d2=(double*)curBuffPos;
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(double));
+    scratch.u2D=(double*)curBuffPos;
+    curBuffPos=(void*)((uint8_t*)curBuffPos+n1*sizeof(double));
+    scratch.v2D=(double*)curBuffPos;
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nMax*sizeof(double));
+    scratch.gamma2=(size_t*)curBuffPos;
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+    scratch.sortScratch=(size_t*)curBuffPos;
+    curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+    scratch.countScratch=(size_t*)curBuffPos;
+    curBuffPos=(void*)((uint8_t*)curBuffPos+(nMax+1)*sizeof(size_t));
+    scratch.rowMark=(ptrdiff_t*)curBuffPos;
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nMax*sizeof(ptrdiff_t));
+    scratch.col4row=(ptrdiff_t*)curBuffPos;
+    curBuffPos=(void*)((uint8_t*)curBuffPos+nMax*sizeof(ptrdiff_t));
+    scratch.row4col=(ptrdiff_t*)curBuffPos;
+    curBuffPos=(void*)((uint8_t*)curBuffPos+n1*sizeof(ptrdiff_t));
+    scratch.buffer2D=(void*)((uint8_t*)curBuffPos+assignSDLevelBufferSize(numDims,n1,nDims+1,numTuples));
+
+    if(maximize==true) {
+        for(i=0;i<numTuples;i++) {
+            C[i]=-C[i];
+        }
+    }
+
+    *numIter=0;
+    retVal=assignSDLevel(tupleSel,fStar,qStar,u,gapHist,numIter,curBuffPos,numDims,n1,nDims+1,numTuples,tupleIdx,C,maxIter,AbsTol,RelTol,gammaParam,&scratch);
+
+    if(maximize==true) {
+        //Account for the difference between the minimization and
+        //maximization problems.
+        *fStar=-*fStar;
+        *qStar=-*qStar;
+
+        for(i=0;i<numDual;i++) {
+            u[i]=-u[i];
+        }
+
+        if(gapHist!=NULL) {
+            for(i=0;i<2*(*numIter);i++) {
+                gapHist[i]=-gapHist[i];
+            }
+        }
+    }
+
+    return retVal;
+}
+
+static size_t assignSDLevelBufferSize(const size_t numDims,const size_t n1,const size_t *restDims,const size_t numTuples) {
+/**ASSIGNSDLEVELBUFFERSIZE Return the number of bytes of the buffer that
+ *       assignSDLevel needs for a numDims-dimensional problem and all of
+ *       the levels of recursion below it. The dimensions of the problem are
+ *       n1 followed by the numDims-1 values in restDims.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    if(numDims==2) {
+        //The costs, the row indices, the tuple of each element and the
+        //column starts of the sparse 2D problem.
+        return sizeof(double)*numTuples+sizeof(size_t)*(2*numTuples+n1+1);
+    } else {
+        size_t numDual=0, numDualSub=0;
+        size_t i;
+
+        for(i=1;i<numDims-1;i++) {
+            numDual+=restDims[i];
+        }
+        numDualSub=numDual-restDims[1];
+
+        //The doubles are g, the costs of the subproblem and the duals of
+        //the subproblem. The size_t values are hypOrder, pairI2, tupStart,
+        //pairStart, pairSel, the subproblem indices, subMap, and subSel.
+        return sizeof(double)*(numDual+numTuples+numDualSub)+sizeof(size_t)*(3*numTuples+1+n1+1+n1+(numDims-1)*numTuples+numTuples+n1)+assignSDLevelBufferSize(numDims-1,n1,restDims+1,numTuples);
+    }
+}
+
+static void countSortTuples(size_t * restrict sortedIdx,const size_t * restrict inputIdx,const size_t numTuples,const size_t * restrict tupleIdx,const size_t numDims,const size_t dim,const size_t numVals,size_t * restrict counts) {
+/**COUNTSORTTUPLES Stably sort the tuple indices in inputIdx (or 0 to
+ *       numTuples-1 if inputIdx is NULL) by their index in dimension dim
+ *       using a counting sort and put the result in sortedIdx. numVals is
+ *       the size of that dimension and counts is a buffer of numVals+1
+ *       size_t values.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    size_t i;
+
+    memset(counts,0,(numVals+1)*sizeof(size_t));
+    for(i=0;i<numTuples;i++) {
+        const size_t curTuple=(inputIdx==NULL)?i:inputIdx[i];
+        counts[tupleIdx[numDims*curTuple+dim]+1]++;
+    }
+    for(i=0;i<numVals;i++) {
+        counts[i+1]+=counts[i];
+    }
+    for(i=0;i<numTuples;i++) {
+        const size_t curTuple=(inputIdx==NULL)?i:inputIdx[i];
+        sortedIdx[counts[tupleIdx[numDims*curTuple+dim]]++]=curTuple;
+    }
+}
+
+static ptrdiff_t assignSDLevel(size_t * restrict tupleSel,double * restrict fStar,double * restrict qStar,double * restrict u,double * restrict gapHist,size_t * restrict numIter,void *tempSpace,const size_t numDims,const size_t n1,const size_t *restDims,const size_t numTuples,const size_t * restrict tupleIdx,const double * restrict C,const size_t maxIter,const double AbsTol,const double RelTol,const double gammaParam,const SharedScratchSD *scratch) {
+/**ASSIGNSDLEVEL Solve one level of the recursion of the S-D assignment
+ *       algorithm. The inputs and outputs are the same as those of
+ *       assignSDC, except the problem is always a minimization, the
+ *       dimensions are given as n1 and the numDims-1 values in restDims,
+ *       tempSpace must be at least
+ *       assignSDLevelBufferSize(numDims,n1,restDims,numTuples) bytes and
+ *       the shared arrays are given in scratch.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+    const size_t n2=restDims[0];
+    void *curBuffPos=tempSpace;
+    size_t i1, k;
+
+    *qStar=-(double)INFINITY;
+    *fStar=(double)INFINITY;
+
+    if(numTuples==0) {
+        return -1;
+    }
+
+    if(numDims==2) {
+        //The 2D problem is solved exactly.
+        double * restrict cost2D=(double*)curBuffPos;//Length numTuples
+        curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(double));
+        size_t * restrict rowIdx=(size_t*)curBuffPos;//Length numTuples
+        curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+        size_t * restrict tuple4El=(size_t*)curBuffPos;//Length numTuples
+        curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+        size_t * restrict colStart=(size_t*)curBuffPos;//Length n1+1
+        size_t i, numEls=0;
+        double gain;
+
+        //Sort the tuples by column (i1).
+        countSortTuples(scratch->sortScratch,NULL,numTuples,tupleIdx,2,0,n1,scratch->countScratch);
+
+        //Build the sparse cost matrix, keeping only the lowest cost tuple
+        //if an (i1,i2) pair is repeated.
+        for(i=0;i<n2;i++) {
+            scratch->rowMark[i]=-1;
+        }
+        colStart[0]=0;
+        i=0;
+        for(i1=0;i1<n1;i1++) {
+            while(i<numTuples&&tupleIdx[2*scratch->sortScratch[i]]==i1) {
+                const size_t curTuple=scratch->sortScratch[i];
+                const size_t curRow=tupleIdx[2*curTuple+1];
+
+                if(scratch->rowMark[curRow]<(ptrdiff_t)colStart[i1]) {
+                    scratch->rowMark[curRow]=(ptrdiff_t)numEls;
+                    rowIdx[numEls]=curRow;
+                    cost2D[numEls]=C[curTuple];
+                    tuple4El[numEls]=curTuple;
+                    numEls++;
+                } else if(C[curTuple]<cost2D[scratch->rowMark[curRow]]) {
+                    cost2D[scratch->rowMark[curRow]]=C[curTuple];
+                    tuple4El[scratch->rowMark[curRow]]=curTuple;
+                }
+                i++;
+            }
+            colStart[i1+1]=numEls;
+        }
+
+        if(assign2DSparseC(false,cost2D,rowIdx,colStart,&gain,scratch->col4row,scratch->row4col,scratch->buffer2D,scratch->u2D,scratch->v2D,n2,n1)) {
+            return -1;
+        }
+
+        for(i1=0;i1<n1;i1++) {
+            size_t curEl=colStart[i1];
+            while(rowIdx[curEl]!=(size_t)scratch->row4col[i1]) {
+                curEl++;
+            }
+            tupleSel[i1]=tuple4El[curEl];
+        }
+
+        *fStar=gain;
+        *qStar=gain;
+        *numIter=1;
+        if(gapHist!=NULL) {
+            gapHist[0]=gain;
+            gapHist[1]=gain;
+        }
+        return 1;
+    } else {
+        size_t numDual=0, numPairs;
+        size_t i;
+        double fUpper;
+        //The number of dimensions of the relaxed indices and of the
+        //recovery subproblem.
+        const size_t numRelaxed=numDims-2;
+        const size_t numDimsSub=numDims-1;
+
+        for(i=1;i<numDims-1;i++) {
+            numDual+=restDims[i];
+        }
+
+        //Divide the buffer among the variables of this level.
+        double * restrict g=(double*)curBuffPos;//Length numDual
+        curBuffPos=(void*)((uint8_t*)curBuffPos+numDual*sizeof(double));
+
+        double * restrict subCost=(double*)curBuffPos;//Length numTuples
+        curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(double));
+
+        double * restrict subU=(double*)curBuffPos;//Length numDual-restDims[1]
+        curBuffPos=(void*)((uint8_t*)curBuffPos+(numDual-restDims[1])*sizeof(double));
+
+        //The tuples sorted by (i1,i2).
+        size_t * restrict hypOrder=(size_t*)curBuffPos;//Length numTuples
+        curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+
+        //The i2 value of each distinct (i1,i2) pair.
+        size_t * restrict pairI2=(size_t*)curBuffPos;//Length numTuples
+        curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+
+        //The tuples of pair p are hypOrder[tupStart[p]] to
+        //hypOrder[tupStart[p+1]-1].
+        size_t * restrict tupStart=(size_t*)curBuffPos;//Length numTuples+1
+        curBuffPos=(void*)((uint8_t*)curBuffPos+(numTuples+1)*sizeof(size_t));
+
+        //The pairs of i1 are pairStart[i1] to pairStart[i1+1]-1.
+        size_t * restrict pairStart=(size_t*)curBuffPos;//Length n1+1
+        curBuffPos=(void*)((uint8_t*)curBuffPos+(n1+1)*sizeof(size_t));
+
+        size_t * restrict pairSel=(size_t*)curBuffPos;//Length n1
+        curBuffPos=(void*)((uint8_t*)curBuffPos+n1*sizeof(size_t));
+
+        size_t * restrict subIdx=(size_t*)curBuffPos;//Length numDimsSub*numTuples
+        curBuffPos=(void*)((uint8_t*)curBuffPos+numDimsSub*numTuples*sizeof(size_t));
+
+        //The tuple in this level for each tuple of the subproblem.
+        size_t * restrict subMap=(size_t*)curBuffPos;//Length numTuples
+        curBuffPos=(void*)((uint8_t*)curBuffPos+numTuples*sizeof(size_t));
+
+        size_t * restrict subSel=(size_t*)curBuffPos;//Length n1
+        curBuffPos=(void*)((uint8_t*)curBuffPos+n1*sizeof(size_t));
+
+        //The buffer for the next level of the recursion.
+        void *subTempSpace=curBuffPos;
+
+        //Sort the tuples by (i1,i2).
+        countSortTuples(scratch->sortScratch,NULL,numTuples,tupleIdx,numDims,1,n2,scratch->countScratch);
+        countSortTuples(hypOrder,scratch->sortScratch,numTuples,tupleIdx,numDims,0,n1,scratch->countScratch);
+
+        //Find the distinct (i1,i2) pairs.
+        numPairs=0;
+        memset(pairStart,0,(n1+1)*sizeof(size_t));
+        for(i=0;i<numTuples;i++) {
+            const size_t curI1=tupleIdx[numDims*hypOrder[i]];
+            const size_t curI2=tupleIdx[numDims*hypOrder[i]+1];
+
+            if(i==0||curI1!=tupleIdx[numDims*hypOrder[i-1]]||curI2!=pairI2[numPairs-1]) {
+                pairI2[numPairs]=curI2;
+                tupStart[numPairs]=i;
+                numPairs++;
+                pairStart[curI1+1]++;
+            }
+        }
+        tupStart[numPairs]=numTuples;
+        for(i1=0;i1<n1;i1++) {
+            pairStart[i1+1]+=pairStart[i1];
+        }
+
+        //The sum over i1 of the highest cost tuple is an upper bound on the
+        //cost of any feasible solution. It is used in place of fStar in the
+        //step size until a feasible solution is found. If an i1 has no
+        //tuples, then the problem is infeasible.
+        fUpper=0;
+        for(i1=0;i1<n1;i1++) {
+            double maxVal=-(double)INFINITY;
+
+            for(i=tupStart[pairStart[i1]];i<tupStart[pairStart[i1+1]];i++) {
+                if(C[hypOrder[i]]>maxVal) {
+                    maxVal=C[hypOrder[i]];
+                }
+            }
+
+            if(maxVal==-(double)INFINITY) {
+                return -1;
+            }
+            fUpper+=maxVal;
+        }
+
+        memset(u,0,numDual*sizeof(double));
+
+        for(k=0;k<maxIter;k++) {
+            double q, gNorm2, minVal;
+            size_t curPair;
+
+            *numIter=k+1;
+//////
+//DUAL COST AND SUBGRADIENT UPDATE.
+//////
+            //For each (i1,i2) pair, minimize the cost plus the dual
+            //variables of the relaxed indices over the tuples.
+            for(curPair=0;curPair<numPairs;curPair++) {
+                double minPairVal=(double)INFINITY;
+                size_t minIdx=tupStart[curPair];
+
+                for(i=tupStart[curPair];i<tupStart[curPair+1];i++) {
+                    const size_t *curIdx=tupleIdx+numDims*hypOrder[i]+2;
+                    const double *curU=u;
+                    double curVal=C[hypOrder[i]];
+                    size_t s;
+
+                    for(s=0;s<numRelaxed;s++) {
+                        curVal+=curU[curIdx[s]];
+                        curU+=restDims[s+1];
+                    }
+
+                    if(curVal<minPairVal) {
+                        minPairVal=curVal;
+                        minIdx=i;
+                    }
+                }
+
+                scratch->d2[curPair]=minPairVal;
+                scratch->gamma2[curPair]=minIdx;
+            }
+
+            //This function modifies d2, but it does not matter, because it
+            //isn't used again in this iteration.
+            if(assign2DSparseC(false,scratch->d2,pairI2,pairStart,&minVal,scratch->col4row,scratch->row4col,scratch->buffer2D,scratch->u2D,scratch->v2D,n2,n1)) {
+                //If the relaxed problem is infeasible, then so is this
+                //problem.
+                return -1;
+            }
+
+            q=minVal;
+            for(i=0;i<numDual;i++) {
+                q-=u[i];
+            }
+
+            for(i1=0;i1<n1;i1++) {
+                curPair=pairStart[i1];
+                while(pairI2[curPair]!=(size_t)scratch->row4col[i1]) {
+                    curPair++;
+                }
+                pairSel[i1]=curPair;
+            }
+
+            if(q>*qStar) {
+                const double costGap=*fStar-q;
+                *qStar=q;
+
+                if(costGap<=AbsTol||(costGap<fabs(*qStar)*RelTol)) {
+                    if(gapHist!=NULL) {
+                        gapHist[2*k]=*fStar;
+                        gapHist[2*k+1]=*qStar;
+                    }
+                    return (ptrdiff_t)(k+1);//The algorithm converged.
+                }
+            }
+
+            //Compute the subgradient.
+            for(i=0;i<numDual;i++) {
+                g[i]=-1;
+            }
+            for(i1=0;i1<n1;i1++) {
+                const size_t *curIdx=tupleIdx+numDims*hypOrder[scratch->gamma2[pairSel[i1]]]+2;
+                double *curG=g;
+                size_t s;
+
+                for(s=0;s<numRelaxed;s++) {
+                    curG[curIdx[s]]+=1;
+                    curG+=restDims[s+1];
+                }
+            }
+
+            gNorm2=0;
+            for(i=0;i<numDual;i++) {
+                gNorm2+=g[i]*g[i];
+            }
+
+            //If no constraints are violated, then the relaxed solution is
+            //feasible and optimal.
+            if(gNorm2==0) {
+                if(q<*fStar) {
+                    *fStar=q;
+                    for(i1=0;i1<n1;i1++) {
+                        tupleSel[i1]=hypOrder[scratch->gamma2[pairSel[i1]]];
+                    }
+                }
+
+                if(gapHist!=NULL) {
+                    gapHist[2*k]=*fStar;
+                    gapHist[2*k+1]=*qStar;
+                }
+                return (ptrdiff_t)(k+1);
+            }
+
+//////
+//FEASIBLE SOLUTION RECOVERY.
+//////
+            //Fixing the (i1,i2) pairs leaves a (numDims-1)-dimensional
+            //problem whose first index is i1 and whose other indices are
+            //the relaxed ones.
+            {
+                size_t numSubTuples=0;
+                size_t subIter;
+                double fSub, qSub;
+                ptrdiff_t subExitCode;
+
+                for(i1=0;i1<n1;i1++) {
+                    curPair=pairSel[i1];
+
+                    for(i=tupStart[curPair];i<tupStart[curPair+1];i++) {
+                        const size_t curTuple=hypOrder[i];
+                        size_t s;
+
+                        subIdx[numDimsSub*numSubTuples]=i1;
+                        for(s=0;s<numRelaxed;s++) {
+                            subIdx[numDimsSub*numSubTuples+1+s]=tupleIdx[numDims*curTuple+2+s];
+                        }
+                        subCost[numSubTuples]=C[curTuple];
+                        subMap[numSubTuples]=curTuple;
+                        numSubTuples++;
+                    }
+                }
+
+                subExitCode=assignSDLevel(subSel,&fSub,&qSub,subU,NULL,&subIter,subTempSpace,numDimsSub,n1,restDims+1,numSubTuples,subIdx,subCost,maxIter,AbsTol,RelTol,gammaParam,scratch);
+
+                //If the recovery failed, then there is just no primal
+                //solution in this iteration.
+                if(subExitCode!=-1&&subExitCode!=-3&&fSub<*fStar) {
+                    double costGap;
+
+                    *fStar=fSub;
+                    for(i1=0;i1<n1;i1++) {
+                        tupleSel[i1]=subMap[subSel[i1]];
+                    }
+
+                    costGap=*fStar-*qStar;
+                    if(costGap<=AbsTol||costGap<fabs(*qStar)*RelTol) {
+                        if(gapHist!=NULL) {
+                            gapHist[2*k]=*fStar;
+                            gapHist[2*k+1]=*qStar;
+                        }
+                        return (ptrdiff_t)(k+1);//The algorithm converged.
+                    }
+                }
+            }
+
+            if(gapHist!=NULL) {
+                gapHist[2*k]=*fStar;
+                gapHist[2*k+1]=*qStar;
+            }
+
+            //Polyak's subgradient update.
+            {
+                const double alpha=gammaParam*(((isFinite(*fStar)?*fStar:fUpper)-q)/gNorm2);
+                size_t s, curDual=0;
+
+                for(s=0;s<numRelaxed;s++) {
+                    const size_t nCur=restDims[s+1];
+                    //If the index set is the same size as the first one,
+                    //then the constraint is an equality constraint and the
+                    //dual variables are not clipped.
+                    const bool clipU=nCur>n1;
+                    size_t j;
+
+                    for(j=0;j<nCur;j++) {
+                        u[curDual]+=alpha*g[curDual];
+
+                        if(!isFinite(u[curDual])) {
+                            return -3;
+                        }
+
+                        if(clipU&&u[curDual]<0) {
+                            u[curDual]=0;
+                        }
+                        curDual++;
+                    }
+                }
+            }
+        }
+
+        if(!isFinite(*fStar)) {
+            //No feasible solution was found.
+            return -1;
+        }
+
+        //The maximum number of iterations was hit.
+        return -2;
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,288 @@
+/**ASSIGNSD A C-code (for Matlab) implementation of a recursive dual-primal
+ *          Lagrangian relaxation algorithm for approximating the solution
+ *          to the operations research axial S-D assignment problem over a
+ *          sparse set of tuples. See the comments to the Matlab file
+ *          assignSD.m for more details.
+ *
+ * The algorithm can be compiled for use in Matlab  using the 
+ * CompileCLibraries function.
+ *
+ * The algorithm is run in Matlab using the command format
+ * [tuples,fStar,qStar,u,exitCode,gapHist,tupleSel]=assignSD(tupleIdx,C,nDims,maximize,maxIter,AbsTol,RelTol,gammaParam);
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mex.h"
+/* This header validates inputs and includes a header needed to handle
+ * Matlab matrices.*/
+#include "MexValidation.h"
+
+//Prototypes for the actual assignment functions.
+#include "assignAlgsSD.h"
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t numDims, numTuples, numDual, numIter, i;
+    size_t *nDims;
+    double AbsTol=1e-10;
+    double RelTol=0.05;
+    double gammaParam=1;
+    size_t maxIter=20;
+    bool maximize=false;
+    double *C, *CCopy, *gapHist;
+    mxArray *tupleIdxMat;
+    size_t *tupleIdx, *tupleSel;
+    double *u;
+    void *tempSpace;
+    double fStar, qStar;
+    ptrdiff_t exitCode;
+    
+    if(nrhs>8||nrhs<3){
+        mexErrMsgTxt("Incorrect number of inputs.");
+        return;
+    }
+
+    if(nlhs>7) {
+        mexErrMsgTxt("Invalid number of outputs.");
+        return;
+    }
+
+    nDims=copySizeTArrayFromMatlab(prhs[2],&numDims);
+    if(numDims<2) {
+        mxFree(nDims);
+        mexErrMsgTxt("nDims must have at least two elements.");
+        return;
+    }
+    
+    for(i=1;i<numDims;i++) {
+        if(nDims[i]<nDims[0]) {
+            mxFree(nDims);
+            mexErrMsgTxt("It is required that nDims(1)<=nDims(s) for all s.");
+            return;
+        }
+    }
+    
+    numDual=0;
+    for(i=2;i<numDims;i++) {
+        numDual+=nDims[i];
+    }
+
+    checkRealDoubleArray(prhs[1]);
+    numTuples=mxGetNumberOfElements(prhs[1]);
+    C=mxGetPr(prhs[1]);
+
+    if(nDims[0]==0||numTuples==0) {
+        const bool isEmptyProb=(nDims[0]==0);
+        mxFree(nDims);
+
+        //Nothing has to be assigned or the problem is infeasible.
+        plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);//tuples=[];
+        if(nlhs>1) {
+            plhs[1]=isEmptyProb?mxCreateDoubleScalar(0):mxCreateDoubleMatrix(0,0,mxREAL);
+            if(nlhs>2) {
+                plhs[2]=isEmptyProb?mxCreateDoubleScalar(0):mxCreateDoubleMatrix(0,0,mxREAL);
+                if(nlhs>3) {
+                    plhs[3]=mxCreateDoubleMatrix(0,0,mxREAL);
+                    if(nlhs>4) {
+                        plhs[4]=mxCreateDoubleScalar(isEmptyProb?0:-1);
+                        if(nlhs>5) {
+                            plhs[5]=mxCreateDoubleMatrix(0,0,mxREAL);
+                            if(nlhs>6) {
+                                plhs[6]=mxCreateDoubleMatrix(0,0,mxREAL);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return;
+    }
+
+    if(mxGetM(prhs[0])!=numDims||mxGetN(prhs[0])!=numTuples) {
+        mxFree(nDims);
+        mexErrMsgTxt("tupleIdx must be a numDimsXnumTuples matrix.");
+        return;
+    }
+
+    for(i=0;i<numTuples;i++) {
+        if(!mxIsFinite(C[i])) {
+            mxFree(nDims);
+            mexErrMsgTxt("The costs in C must be finite.");
+            return;
+        }
+    }
+
+    tupleIdxMat=convert2DReal2UnsignedSizeMat(prhs[0]);
+    tupleIdx=(size_t*)mxGetData(tupleIdxMat);
+    
+    //Convert the Matlab indices into indices for C and make sure that
+    //they are all valid.
+    for(i=0;i<numDims*numTuples;i++) {
+        if(tupleIdx[i]<1||tupleIdx[i]>nDims[i%numDims]) {
+            mxDestroyArray(tupleIdxMat);
+            mxFree(nDims);
+            mexErrMsgTxt("Invalid index in tupleIdx.");
+            return;
+        }
+        tupleIdx[i]--;
+    }
+
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        maximize=getBoolFromMatlab(prhs[3]);
+    }
+    
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        maxIter=getSizeTFromMatlab(prhs[4]);
+        
+        if(maxIter<1) {
+            mxDestroyArray(tupleIdxMat);
+            mxFree(nDims);
+            mexErrMsgTxt("maxIter must be >=1.");
+            return;
+        }
+    }
+    
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        AbsTol=getDoubleFromMatlab(prhs[5]);
+        
+        if(AbsTol<0) {
+            mxDestroyArray(tupleIdxMat);
+            mxFree(nDims);
+            mexErrMsgTxt("AbsTol should be non-negative.");
+            return;
+        }
+    }
+    
+    if(nrhs>6&&!mxIsEmpty(prhs[6])) {
+        RelTol=getDoubleFromMatlab(prhs[6]);
+        
+        if(RelTol<0) {
+            mxDestroyArray(tupleIdxMat);
+            mxFree(nDims);
+            mexErrMsgTxt("RelTol should be non-negative.");
+            return;
+        }
+    }
+    
+    if(nrhs>7&&!mxIsEmpty(prhs[7])) {
+        gammaParam=getDoubleFromMatlab(prhs[7]);
+        
+        if(gammaParam<=0) {
+            mxDestroyArray(tupleIdxMat);
+            mxFree(nDims);
+            mexErrMsgTxt("gammaParam should be positive.");
+            return;
+        }
+    }
+    
+    //Duplicate the input costs. If maximization is performed, the
+    //original ones would be overwritten.
+    CCopy=(double*)mxMalloc(numTuples*sizeof(double));
+    memcpy(CCopy,C,numTuples*sizeof(double));
+    
+    u=(double*)mxMalloc((numDual+1)*sizeof(double));
+    gapHist=(double*)mxMalloc(2*maxIter*sizeof(double));
+    tupleSel=(size_t*)mxMalloc(nDims[0]*sizeof(size_t));
+    tempSpace=mxMalloc(assignSDCBufferSize(numDims,nDims,numTuples));
+    
+    exitCode=assignSDC(tupleSel,&fStar,&qStar,u,gapHist,&numIter,tempSpace,numDims,nDims,numTuples,tupleIdx,CCopy,maximize,maxIter,AbsTol,RelTol,gammaParam);
+    mxFree(tempSpace);
+    mxFree(CCopy);
+    
+    if(exitCode==-3||exitCode==-1) {
+        //If no valid assignment was found.
+        plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);//tuples=[];
+        
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleMatrix(0,0,mxREAL);//fStar=[]
+            
+            if(nlhs>2) {
+                plhs[2]=mxCreateDoubleMatrix(0,0,mxREAL);//qStar=[]
+            
+                if(nlhs>3) {
+                    plhs[3]=mxCreateDoubleMatrix(0,0,mxREAL);//u=[]
+                    
+                    if(nlhs>4) {
+                        plhs[4]=mxCreateDoubleScalar((double)exitCode);
+                        
+                        if(nlhs>5) {
+                            plhs[5]=mxCreateDoubleMatrix(0,0,mxREAL);
+                            
+                            if(nlhs>6) {
+                                plhs[6]=mxCreateDoubleMatrix(0,0,mxREAL);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    } else {
+        mxArray *tuplesMATLAB=mxCreateDoubleMatrix(numDims,nDims[0],mxREAL);
+        double *tuplesD=mxGetPr(tuplesMATLAB);
+        size_t i1;
+        
+        //Convert the selected tuples into Matlab indices.
+        for(i1=0;i1<nDims[0];i1++) {
+            size_t s;
+            for(s=0;s<numDims;s++) {
+                tuplesD[numDims*i1+s]=(double)(tupleIdx[numDims*tupleSel[i1]+s]+1);
+            }
+        }
+        plhs[0]=tuplesMATLAB;
+        
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleScalar(fStar);
+            
+            if(nlhs>2) {
+                plhs[2]=mxCreateDoubleScalar(qStar);
+                
+                if(nlhs>3) {
+                    plhs[3]=doubleMat2Matlab(u,numDual,1);
+                    
+                    if(nlhs>4) {
+                        plhs[4]=mxCreateDoubleScalar((double)exitCode);
+                        
+                        if(nlhs>5) {
+                            plhs[5]=doubleMat2Matlab(gapHist,2,numIter);
+                            
+                            if(nlhs>6) {
+                                mxArray *selMATLAB=mxCreateDoubleMatrix(nDims[0],1,mxREAL);
+                                double *selD=mxGetPr(selMATLAB);
+                                
+                                for(i1=0;i1<nDims[0];i1++) {
+                                    selD[i1]=(double)(tupleSel[i1]+1);
+                                }
+                                plhs[6]=selMATLAB;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    
+    mxFree(tupleSel);
+    mxFree(gapHist);
+    mxFree(u);
+    mxDestroyArray(tupleIdxMat);
+    mxFree(nDims);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,120 @@
+function [tuples,fStar,qStar,u,exitCode,gapHist,tupleSel]=assignSD(tupleIdx,C,nDims,maximize,maxIter,AbsTol,RelTol,gammaParam)
+%%ASSIGNSD Approximate the solution to the operations research axial S-D
+%          assignment problem over a sparse set of tuples (hypotheses)
+%          using a recursive dual-primal Lagrangian relaxation technique.
+%          Such problems are NP-hard. This arises in multiframe data
+%          association, such as N-scan multiple hypothesis tracking, where
+%          the S index sets are measurements (or tracks) over a sliding
+%          window of scans and only gated hypotheses are kept. The
+%          optimization problem being solved is
+%          minimize (or maximize) \sum_{k} C(k)*\rho_k
+%          subject to
+%          \sum_{k:tupleIdx(1,k)=i}\rho_k =1 for all i in the first set
+%          \sum_{k:tupleIdx(s,k)=i}\rho_k<=1 for all i in the sth set, s>1
+%          \rho_k = 0 or 1
+%          where the sums are over the provided tuples and it is required
+%          that the first index set is not larger than any of the others.
+%
+%INPUTS: tupleIdx An SXnumTuples matrix of indices such that tupleIdx(:,k)
+%          holds the indices of the kth allowed tuple in the S index sets.
+%        C A numTuplesX1 or 1XnumTuples vector of the finite costs of the
+%          tuples.
+%    nDims A length-S vector of the sizes of the S index sets, S>=2.
+%          It is required that nDims(1)<=nDims(s) for all s.
+% maximize If true, the cost is maximized instead of minimized. The default
+%          if this parameter is omitted or an empty matrix is passed is
+%          false.
+%  maxIter The maximum number of iterations to perform at each level of
+%          the recursion (described below). The default if omitted or an
+%          empty matrix is passed is 20.
+%   AbsTol The absolute duality gap to use for convergence determination.
+%          The default if omitted or an empty matrix is passed is 1e-10.
+%   RelTol The relative duality gap to use for convergence determination.
+%          The default if omitted or an empty matrix is passed is 0.05.
+% gammaParam The parameter of Polyak's step size rule for the subgradient
+%          updates, uNew=u+gammaParam*(fStar-q)/norm(g)^2*g for
+%          minimization. The default if omitted or an empty matrix is
+%          passed is 1.
+%
+%OUTPUTS: tuples An SXnDims(1) matrix where tuples(:,i) are the indices of
+%                the tuple assigned to the ith element of the first index
+%                set. An empty matrix is returned if no feasible
+%                assignment was found.
+%          fStar The cost of the assignment in tuples.
+%          qStar The value of the best dual solution found. This is a
+%                lower bound (upper bound if maximizing) on the optimal
+%                cost, so fStar-qStar bounds the suboptimality of tuples.
+%              u The dual variables of index sets 3 to S stacked into a
+%                sum(nDims(3:S))X1 vector.
+%       exitCode A parameter indicating how the algorithm terminated. The
+%                values are the same as in assign3D, except -1 is also
+%                returned if no feasible solution was found.
+%        gapHist A 2XnumIter matrix holding [fStar;qStar] after each
+%                iteration of the top level. This provides the duality gap
+%                that was available at any point, so one can choose maxIter
+%                to trade latency for optimality.
+%       tupleSel An nDims(1)X1 vector of the columns of tupleIdx that were
+%                selected, so tuples=tupleIdx(:,tupleSel).
+%
+%The constraints of index sets 3 through S are relaxed using Lagrange
+%multipliers so that the dual cost is found from a sparse 2D assignment
+%problem between the first two index sets, as in [1]. A feasible solution
+%is recovered in each iteration by fixing the pairs of the first two index
+%sets that were assigned in the relaxed problem. That leaves an (S-1)-D
+%assignment problem over the tuples having those pairs, which is solved
+%with this same algorithm. The recursion ends at a 2D problem, which is
+%solved exactly. When S=3, this is the same type of algorithm as
+%assign3DSparse with Polyak's step size rule.
+%
+%All of the memory needed at all levels of the recursion is allocated once
+%and temporary arrays are shared across the levels.
+%
+%The algorithm can be compiled for use in Matlab  using the 
+%CompileCLibraries function.
+%
+%The algorithm is run in Matlab using the command format
+%[tuples,fStar,qStar,u,exitCode,gapHist,tupleSel]=assignSD(tupleIdx,C,nDims,maximize,maxIter,AbsTol,RelTol,gammaParam);
+%
+%EXAMPLE:
+%A random 5D problem with 2000 gated tuples.
+% nDims=[10;12;12;14;15];
+% numTuples=2000;
+% tupleIdx=zeros(5,numTuples);
+% for s=1:5
+%     tupleIdx(s,:)=randi(nDims(s),1,numTuples);
+% end
+% C=randn(numTuples,1);
+% [tuples,fStar,qStar,u,exitCode,gapHist]=assignSD(tupleIdx,C,nDims,false,50);
+% figure()
+% plot(gapHist(1,:)-gapHist(2,:))
+%
+%REFERENCES:
+%[1] S. Deb, M. Yeddanapudi, K. Pattipati, and Y. Bar-Shalom, "A
+%    generalized S-D assignment algorithm for multisensor-multitarget
+%    state estimation," IEEE Transactions on Aerospace and Electronic
+%    Systems, vol. 33, no. 2, pp. 523-538, Apr. 1997.
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+error('This function is only implemented as a mexed C or C++ function. Please run CompileCLibraries.m to compile the function for use.')
+
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -92,7 +92,9 @@ public:
         char *basePtr;
     /*To minimize the number of calls to memory allocation and deallocation
      * routines, a big chunk of memory is allocated at once and pointers
-     * to parts of it for the different variables are saved.*/
+     * to parts of it for the different variables are saved. The bool
+     * arrays come last so that the cost matrix C stays aligned for
+     * doubles.*/
         buffer=new char[numCol*sizeof(size_t)+2*numRow*sizeof(ptrdiff_t)+numRow*sizeof(size_t)+numRow*(1+numCol)*sizeof(double)+2*numRow*sizeof(bool)];
         basePtr=buffer;
         ScannedColIdx=reinterpret_cast<size_t*>(basePtr);
@@ -105,12 +107,11 @@ public:
         basePtr+=sizeof(size_t)*numRow;
         shortestPathCost=reinterpret_cast<double*>(basePtr);
         basePtr+=sizeof(double)*numRow;
+        C=reinterpret_cast<double*>(basePtr);
+        basePtr+=sizeof(double)*numRow*numCol;
         ScannedRows=reinterpret_cast<bool*>(basePtr);
         basePtr+=sizeof(bool)*numRow;
         forbiddenActiveRows=reinterpret_cast<bool*>(basePtr);
-        basePtr+=sizeof(bool)*numRow;
-
-        C=reinterpret_cast<double*>(basePtr);
     }
     
     ~ScratchSpace(){
@@ -1,4 +1,4 @@
-function [accel,C,S]=EGM08EarthAccel(rVec,accelOptions,M,TT1,TT2,effectsToInclude,EOP,C,S)
+function [accel,C,S]=EGM08EarthAccel(rVec,accelOptions,M,TT1,TT2,effectsToInclude,EOP,C,S,gravCache)
 %%EGM08EARTHACCEL Get acceleration due to gravity from the Earth. This can
 %            be a simple J2 model in a generic (not rigorously defined)
 %            Earth-centered Earth-fixed (ECEF) or Earth-centered inertial
@@ -97,6 +97,15 @@ function [accel,C,S]=EGM08EarthAccel(rVec,accelOptions,M,TT1,TT2,effectsToInclud
 %                  the getEGMGravCoeffs function and speeds up multiple
 %                  calls to this function. These parameters are ignored if
 %                  accelOptions=0 or 1.
+%   gravCache Optionally, a gravAccelCache object built from the same
+%             tide-free C and S that are used (or that getEGMGravCoeffs
+%             would return for M) and covering the ranges of all of the
+%             points. If provided, the acceleration of the unmodified
+%             coefficients is interpolated from the cache, which is much
+%             faster for large M, and only the changes to the low-degree
+%             coefficients from the effects in effectsToInclude are
+%             evaluated directly with spherHarmonicEval. This is ignored if
+%             accelOptions=0 or 1.
 %
 %OUTPUTS: accel A 3XN matrix of the N accelerations due to gravity of the
 %               Earth in meters per second squared in the specified
@@ -289,6 +298,17 @@ end
 CSaved=C(1:numCoeffChanged);
 SSaved=S(1:numCoeffChanged);
 
+if(nargin>9&&~isempty(gravCache))
+    %The unmodified coefficients up to the degree of the largest change,
+    %which is at least 3 to include the changes due to polar motion. These
+    %are used to find the changes to the coefficients that are evaluated
+    %in addition to the acceleration from the cache.
+    MDiff=max(3,ceil((-3+sqrt(1+8*numCoeffChanged))/2));
+    numDiff=min((MDiff+1)*(MDiff+2)/2,length(C));
+    CUnmodified=C(1:numDiff);
+    SUnmodified=S(1:numDiff);
+end
+
 %Now, add in all of the effects, except the effects of polar motion on the
 %coefficients.
 for curDelta=1:numDelta
@@ -320,7 +340,12 @@ end
 r=rVec(1:3,:);%Positions
 rSpher=Cart2Sphere(r);
 
-[~,accel]=spherHarmonicEval(C,S,rSpher,a,GM);
+if(nargin>9&&~isempty(gravCache))
+    [~,accelDiff]=spherHarmonicEval(C(1:numDiff)-CUnmodified,S(1:numDiff)-SUnmodified,rSpher,a,GM);
+    accel=gravCache.accel(r)+accelDiff;
+else
+    [~,accel]=spherHarmonicEval(C,S,rSpher,a,GM);
+end
 
 %Now, if the acceleration is supposed to be in ITRS coordinates, then add
 %the Coriolis terms. Otherwise, rotate it into GCRS coordinates.
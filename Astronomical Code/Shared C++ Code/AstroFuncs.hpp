@@ -0,0 +1,35 @@
+/**ASTROFUNCS A header file for C++ implementations of astronomical
+ *           functions. See the files implementing each function for more
+ *           details on their usage.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef ASTROFUNCS
+#define ASTROFUNCS
+#include <stddef.h>
+
+//Observed directions of catalog stars at many epochs. See
+//starCat2ObsCPP.cpp. This requires the SOFA library.
+int starCat2ObsCPP(double *zSpher, double *uObs, const double *catData, const size_t numStars, const double *UTC1, const double *UTC2, const size_t numEpochs, const double *zObs, const size_t zObsStride, const double *deltaUTCUT1, const size_t deltaTStride, const double *xpyp, const size_t xpypStride, const double P, const double T, const double R, const double wl, const size_t numThreads);
+
+#endif
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
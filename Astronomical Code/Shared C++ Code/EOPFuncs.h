@@ -0,0 +1,45 @@
+/**EOPFUNCS A header file for the compiled loader and interpolator of Earth
+ *          orientation parameters (EOP). It can be included in both C and
+ *          C++ files. See getEOPCPP.cpp for more details on the usage of
+ *          the functions and the Matlab function getEOP for more details
+ *          on the parameters.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef EOPFUNCS
+#define EOPFUNCS
+
+#include <stddef.h>
+
+int getEOPCPP(double *xpyp, double *dXdY, double *deltaUTCUT1, double *deltaTTUT1, double *LOD, const double *JulUTC1, const double *JulUTC2, const size_t numTimes, const char *fileName);
+void getEOPMex(double *xpyp, double *dXdY, double *deltaUTCUT1, double *deltaTTUT1, double *LOD, const double *JulUTC1, const double *JulUTC2, const size_t numTimes);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
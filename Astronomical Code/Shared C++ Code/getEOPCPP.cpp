@@ -0,0 +1,656 @@
+/**GETEOPCPP Compiled functions to load a table of Earth orientation
+ *          parameters (EOP) and interpolate them to many dates given in
+ *          UTC. These give the same results as the Matlab function getEOP
+ *          called without the refreshFromSource input, so that compiled
+ *          functions do not have to call back into Matlab whenever the EOP
+ *          are needed. The outputs are as in getEOP: xpyp and dXdY are
+ *          2XnumTimes matrices in radians and deltaUTCUT1, deltaTTUT1 and
+ *          LOD are in seconds. Any of the outputs can be NULL if they are
+ *          not needed.
+ *
+ *The text file of EOP is parsed once and kept in memory as a table of
+ *the interpolated quantities and the slopes of their piecewise cubic
+ *Hermite interpolating polynomials, which are the same as those used by
+ *Matlab's interp1 function with the 'pchip' option. The file is parsed
+ *again only if its size or modification time change. getEOPCPP returns 0
+ *on success and -1 if the file could not be read or has no valid entries.
+ *
+ *getEOPMex is for use in MEX files. It finds the file data/EOP.txt in the
+ *folder holding getEOP.m and raises a Matlab error if it cannot be loaded.
+ *Data that getEOP downloads from an online source are not seen by the
+ *compiled functions unless getEOP is told to replace EOP.txt with them.
+ *
+ *The tidal and libration corrections are those of the PMUT1_OCEANS and
+ *PM_GRAVI subroutines of interp.f, which are discussed in Section 5.1 of
+ *the IERS 2010 Conventions.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "EOPFuncs.h"
+/*This header is for the SOFA library.*/
+#include "sofa.h"
+#include "mex.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <sys/stat.h>
+
+//The indices of the interpolated quantities in the table.
+enum {xpIdx=0,ypIdx,UT1UTCIdx,LODIdx,dXIdx,dYIdx,numEOPVals};
+
+namespace {
+struct EOPTable {
+    std::string fileName;
+    //These are used to notice when the file has been changed.
+    long long fileSize;
+    long long modTime;
+    //The modified Julian dates in UTC of the tabulated values.
+    std::vector<double> MJD;
+    //xp and yp are in arcseconds, UT1-UTC and LOD in seconds and dX and dY
+    //in milliarcseconds.
+    std::vector<double> vals[numEOPVals];
+    //The derivatives of the interpolating polynomials at the tabulated
+    //points.
+    std::vector<double> slopes[numEOPVals];
+};
+}
+
+static EOPTable EOPData;
+
+static const int oceanArgs[71][6]={
+    { 1,-1, 0,-2,-2,-2},
+    { 1,-2, 0,-2, 0,-1},
+    { 1,-2, 0,-2, 0,-2},
+    { 1, 0, 0,-2,-2,-1},
+    { 1, 0, 0,-2,-2,-2},
+    { 1,-1, 0,-2, 0,-1},
+    { 1,-1, 0,-2, 0,-2},
+    { 1, 1, 0,-2,-2,-1},
+    { 1, 1, 0,-2,-2,-2},
+    { 1, 0, 0,-2, 0, 0},
+    { 1, 0, 0,-2, 0,-1},
+    { 1, 0, 0,-2, 0,-2},
+    { 1,-2, 0, 0, 0, 0},
+    { 1, 0, 0, 0,-2, 0},
+    { 1,-1, 0,-2, 2,-2},
+    { 1, 1, 0,-2, 0,-1},
+    { 1, 1, 0,-2, 0,-2},
+    { 1,-1, 0, 0, 0, 0},
+    { 1,-1, 0, 0, 0,-1},
+    { 1, 1, 0, 0,-2, 0},
+    { 1, 0,-1,-2, 2,-2},
+    { 1, 0, 0,-2, 2,-1},
+    { 1, 0, 0,-2, 2,-2},
+    { 1, 0, 1,-2, 2,-2},
+    { 1, 0,-1, 0, 0, 0},
+    { 1, 0, 0, 0, 0, 1},
+    { 1, 0, 0, 0, 0, 0},
+    { 1, 0, 0, 0, 0,-1},
+    { 1, 0, 0, 0, 0,-2},
+    { 1, 0, 1, 0, 0, 0},
+    { 1, 0, 0, 2,-2, 2},
+    { 1,-1, 0, 0, 2, 0},
+    { 1, 1, 0, 0, 0, 0},
+    { 1, 1, 0, 0, 0,-1},
+    { 1, 0, 0, 0, 2, 0},
+    { 1, 2, 0, 0, 0, 0},
+    { 1, 0, 0, 2, 0, 2},
+    { 1, 0, 0, 2, 0, 1},
+    { 1, 0, 0, 2, 0, 0},
+    { 1, 1, 0, 2, 0, 2},
+    { 1, 1, 0, 2, 0, 1},
+    { 2,-3, 0,-2, 0,-2},
+    { 2,-1, 0,-2,-2,-2},
+    { 2,-2, 0,-2, 0,-2},
+    { 2, 0, 0,-2,-2,-2},
+    { 2, 0, 1,-2,-2,-2},
+    { 2,-1,-1,-2, 0,-2},
+    { 2,-1, 0,-2, 0,-1},
+    { 2,-1, 0,-2, 0,-2},
+    { 2,-1, 1,-2, 0,-2},
+    { 2, 1, 0,-2,-2,-2},
+    { 2, 1, 1,-2,-2,-2},
+    { 2,-2, 0,-2, 2,-2},
+    { 2, 0,-1,-2, 0,-2},
+    { 2, 0, 0,-2, 0,-1},
+    { 2, 0, 0,-2, 0,-2},
+    { 2, 0, 1,-2, 0,-2},
+    { 2,-1, 0,-2, 2,-2},
+    { 2, 1, 0,-2, 0,-2},
+    { 2,-1, 0, 0, 0, 0},
+    { 2,-1, 0, 0, 0,-1},
+    { 2, 0,-1,-2, 2,-2},
+    { 2, 0, 0,-2, 2,-2},
+    { 2, 0, 1,-2, 2,-2},
+    { 2, 0, 0, 0, 0, 1},
+    { 2, 0, 0, 0, 0, 0},
+    { 2, 0, 0, 0, 0,-1},
+    { 2, 0, 0, 0, 0,-2},
+    { 2, 1, 0, 0, 0, 0},
+    { 2, 1, 0, 0, 0,-1},
+    { 2, 0, 0, 2, 0, 2}};
+
+static const double oceanCoeffs[71][6]={
+    {  -0.05,   0.94,  -0.94,  -0.05,  0.396, -0.078},
+    {   0.06,   0.64,  -0.64,   0.06,  0.195, -0.059},
+    {   0.30,   3.42,  -3.42,   0.30,  1.034, -0.314},
+    {   0.08,   0.78,  -0.78,   0.08,  0.224, -0.073},
+    {   0.46,   4.15,  -4.15,   0.45,  1.187, -0.387},
+    {   1.19,   4.96,  -4.96,   1.19,  0.966, -0.474},
+    {   6.24,  26.31, -26.31,   6.23,  5.118, -2.499},
+    {   0.24,   0.94,  -0.94,   0.24,  0.172, -0.090},
+    {   1.28,   4.99,  -4.99,   1.28,  0.911, -0.475},
+    {  -0.28,  -0.77,   0.77,  -0.28, -0.093,  0.070},
+    {   9.22,  25.06, -25.06,   9.22,  3.025, -2.280},
+    {  48.82, 132.91,-132.90,  48.82, 16.020,-12.069},
+    {  -0.32,  -0.86,   0.86,  -0.32, -0.103,  0.078},
+    {  -0.66,  -1.72,   1.72,  -0.66, -0.194,  0.154},
+    {  -0.42,  -0.92,   0.92,  -0.42, -0.083,  0.074},
+    {  -0.30,  -0.64,   0.64,  -0.30, -0.057,  0.050},
+    {  -1.61,  -3.46,   3.46,  -1.61, -0.308,  0.271},
+    {  -4.48,  -9.61,   9.61,  -4.48, -0.856,  0.751},
+    {  -0.90,  -1.93,   1.93,  -0.90, -0.172,  0.151},
+    {  -0.86,  -1.81,   1.81,  -0.86, -0.161,  0.137},
+    {   1.54,   3.03,  -3.03,   1.54,  0.315, -0.189},
+    {  -0.29,  -0.58,   0.58,  -0.29, -0.062,  0.035},
+    {  26.13,  51.25, -51.25,  26.13,  5.512, -3.095},
+    {  -0.22,  -0.42,   0.42,  -0.22, -0.047,  0.025},
+    {  -0.61,  -1.20,   1.20,  -0.61, -0.134,  0.070},
+    {   1.54,   3.00,  -3.00,   1.54,  0.348, -0.171},
+    { -77.48,-151.74, 151.74, -77.48,-17.620,  8.548},
+    { -10.52, -20.56,  20.56, -10.52, -2.392,  1.159},
+    {   0.23,   0.44,  -0.44,   0.23,  0.052, -0.025},
+    {  -0.61,  -1.19,   1.19,  -0.61, -0.144,  0.065},
+    {  -1.09,  -2.11,   2.11,  -1.09, -0.267,  0.111},
+    {  -0.69,  -1.43,   1.43,  -0.69, -0.288,  0.043},
+    {  -3.46,  -7.28,   7.28,  -3.46, -1.610,  0.187},
+    {  -0.69,  -1.44,   1.44,  -0.69, -0.320,  0.037},
+    {  -0.37,  -1.06,   1.06,  -0.37, -0.407, -0.005},
+    {  -0.17,  -0.51,   0.51,  -0.17, -0.213, -0.005},
+    {  -1.10,  -3.42,   3.42,  -1.09, -1.436, -0.037},
+    {  -0.70,  -2.19,   2.19,  -0.70, -0.921, -0.023},
+    {  -0.15,  -0.46,   0.46,  -0.15, -0.193, -0.005},
+    {  -0.03,  -0.59,   0.59,  -0.03, -0.396, -0.024},
+    {  -0.02,  -0.38,   0.38,  -0.02, -0.253, -0.015},
+    {  -0.49,  -0.04,   0.63,   0.24, -0.089, -0.011},
+    {  -1.33,  -0.17,   1.53,   0.68, -0.224, -0.032},
+    {  -6.08,  -1.61,   3.13,   3.35, -0.637, -0.177},
+    {  -7.59,  -2.05,   3.44,   4.23, -0.745, -0.222},
+    {  -0.52,  -0.14,   0.22,   0.29, -0.049, -0.015},
+    {   0.47,   0.11,  -0.10,  -0.27,  0.033,  0.013},
+    {   2.12,   0.49,  -0.41,  -1.23,  0.141,  0.058},
+    { -56.87, -12.93,  11.15,  32.88, -3.795, -1.556},
+    {  -0.54,  -0.12,   0.10,   0.31, -0.035, -0.015},
+    { -11.01,  -2.40,   1.89,   6.41, -0.698, -0.298},
+    {  -0.51,  -0.11,   0.08,   0.30, -0.032, -0.014},
+    {   0.98,   0.11,  -0.11,  -0.58,  0.050,  0.022},
+    {   1.13,   0.11,  -0.13,  -0.67,  0.056,  0.025},
+    {  12.32,   1.00,  -1.41,  -7.31,  0.605,  0.266},
+    {-330.15, -26.96,  37.58, 195.92,-16.195, -7.140},
+    {  -1.01,  -0.07,   0.11,   0.60, -0.049, -0.021},
+    {   2.47,  -0.28,  -0.44,  -1.48,  0.111,  0.034},
+    {   9.40,  -1.44,  -1.88,  -5.65,  0.425,  0.117},
+    {  -2.35,   0.37,   0.47,   1.41, -0.106, -0.029},
+    {  -1.04,   0.17,   0.21,   0.62, -0.047, -0.013},
+    {  -8.51,   3.50,   3.29,   5.11, -0.437, -0.019},
+    {-144.13,  63.56,  59.23,  86.56, -7.547, -0.159},
+    {   1.19,  -0.56,  -0.52,  -0.72,  0.064,  0.000},
+    {   0.49,  -0.25,  -0.23,  -0.29,  0.027, -0.001},
+    { -38.48,  19.14,  17.72,  23.11, -2.104,  0.041},
+    { -11.44,   5.75,   5.32,   6.87, -0.627,  0.015},
+    {  -1.24,   0.63,   0.58,   0.75, -0.068,  0.002},
+    {  -1.77,   1.79,   1.71,   1.04, -0.146,  0.037},
+    {  -0.77,   0.78,   0.75,   0.45, -0.064,  0.017},
+    {  -0.33,   0.62,   0.65,   0.19, -0.049,  0.018}};
+
+static const int graviArgs[10][6]={
+    { 1,-1, 0,-2, 0,-1},
+    { 1,-1, 0,-2, 0,-2},
+    { 1, 1, 0,-2,-2,-2},
+    { 1, 0, 0,-2, 0,-1},
+    { 1, 0, 0,-2, 0,-2},
+    { 1,-1, 0, 0, 0, 0},
+    { 1, 0, 0,-2, 2,-2},
+    { 1, 0, 0, 0, 0, 0},
+    { 1, 0, 0, 0, 0,-1},
+    { 1, 1, 0, 0, 0, 0}};
+
+static const double graviCoeffs[10][4]={
+    {  -0.44,   0.25,  -0.25,  -0.44},
+    {  -2.31,   1.32,  -1.32,  -2.31},
+    {  -0.44,   0.25,  -0.25,  -0.44},
+    {  -2.14,   1.23,  -1.23,  -2.14},
+    { -11.36,   6.52,  -6.52, -11.36},
+    {   0.84,  -0.48,   0.48,   0.84},
+    {  -4.76,   2.73,  -2.73,  -4.76},
+    {  14.27,  -8.19,   8.19,  14.27},
+    {   1.93,  -1.11,   1.11,   1.93},
+    {   0.76,  -0.43,   0.43,   0.76}};
+
+/*Read the number in the 1-based columns startCol to endCol of a line of
+ *the file. The return value is false if the field is missing or blank.*/
+static bool readEOPField(double &val, const char *line, const size_t lineLength, const size_t startCol, const size_t endCol) {
+    char buffer[32];
+    char *endPtr;
+    size_t numChars;
+
+    if(lineLength<startCol) {
+        return false;
+    }
+
+    numChars=std::min(endCol,lineLength)-startCol+1;
+    memcpy(buffer,line+startCol-1,numChars);
+    buffer[numChars]='\0';
+
+    val=strtod(buffer,&endPtr);
+    return endPtr!=buffer;
+}
+
+/*Find the derivatives at the tabulated points of the shape-preserving
+ *piecewise cubic Hermite interpolating polynomial in the same manner as
+ *Matlab's pchip function.*/
+static void getPchipSlopes(std::vector<double> &d, const std::vector<double> &x, const std::vector<double> &y) {
+    const size_t n=x.size();
+    std::vector<double> h(n-1), delta(n-1);
+
+    d.resize(n);
+    for(size_t k=0;k<n-1;k++) {
+        h[k]=x[k+1]-x[k];
+        delta[k]=(y[k+1]-y[k])/h[k];
+    }
+
+    if(n==2) {
+        d[0]=delta[0];
+        d[1]=delta[0];
+        return;
+    }
+
+    //The slopes at the interior points are weighted harmonic means of the
+    //slopes of the adjacent intervals, or zero at local extrema.
+    for(size_t k=1;k<n-1;k++) {
+        if(delta[k-1]*delta[k]>0) {
+            const double w1=2.0*h[k]+h[k-1];
+            const double w2=h[k]+2.0*h[k-1];
+
+            d[k]=(w1+w2)/(w1/delta[k-1]+w2/delta[k]);
+        } else {
+            d[k]=0;
+        }
+    }
+
+    //The end slopes use a shape-preserving three-point formula.
+    for(size_t curEnd=0;curEnd<2;curEnd++) {
+        const size_t i1=(curEnd==0)?0:n-2;
+        const size_t i2=(curEnd==0)?1:n-3;
+        const double h1=h[i1];
+        const double h2=h[i2];
+        const double del1=delta[i1];
+        const double del2=delta[i2];
+        double dEnd=((2.0*h1+h2)*del1-h1*del2)/(h1+h2);
+
+        if((dEnd>0)-(dEnd<0)!=(del1>0)-(del1<0)) {
+            dEnd=0;
+        } else if((del1>0)-(del1<0)!=(del2>0)-(del2<0)&&fabs(dEnd)>fabs(3.0*del1)) {
+            dEnd=3.0*del1;
+        }
+        d[(curEnd==0)?0:n-1]=dEnd;
+    }
+}
+
+/*Evaluate the cubic of interval k at x. x can be outside of the interval
+ *for extrapolation.*/
+static double evalEOPPchip(const EOPTable &table, const size_t valIdx, const size_t k, const double x) {
+    const double h=table.MJD[k+1]-table.MJD[k];
+    const double t=(x-table.MJD[k])/h;
+    const double s=1.0-t;
+
+    return (1.0+2.0*t)*s*s*table.vals[valIdx][k]+t*s*s*h*table.slopes[valIdx][k]+t*t*(3.0-2.0*t)*table.vals[valIdx][k+1]-t*t*s*h*table.slopes[valIdx][k+1];
+}
+
+/*Load the table from the file if it has not been loaded or if the file
+ *changed. The return value is false if the file could not be read.*/
+static bool loadEOPTable(const char *fileName) {
+    EOPTable &table=EOPData;
+    struct stat fileInfo;
+    std::string rawText;
+
+    if(stat(fileName,&fileInfo)!=0) {
+        return false;
+    }
+
+    if(table.MJD.size()>1&&table.fileName==fileName&&table.fileSize==static_cast<long long>(fileInfo.st_size)&&table.modTime==static_cast<long long>(fileInfo.st_mtime)) {
+        return true;
+    }
+
+    {
+        FILE *fileID=fopen(fileName,"rb");
+        char buffer[65536];
+        size_t numRead;
+
+        if(fileID==NULL) {
+            return false;
+        }
+
+        while((numRead=fread(buffer,1,sizeof(buffer),fileID))>0) {
+            rawText.append(buffer,numRead);
+        }
+        fclose(fileID);
+    }
+
+    table.MJD.clear();
+    for(size_t i=0;i<numEOPVals;i++) {
+        table.vals[i].clear();
+    }
+
+    //As in getEOP, only lines ending in a newline are read and the values
+    //are in fixed columns as documented for the finals2000A files.
+    {
+        size_t lineStart=0;
+        size_t lineEnd;
+
+        while((lineEnd=rawText.find('\n',lineStart))!=std::string::npos) {
+            const char *line=rawText.c_str()+lineStart;
+            const size_t lineLength=lineEnd-lineStart;
+            double MJD, vals[numEOPVals]={0,0,0,0,0,0};
+
+            lineStart=lineEnd+1;
+
+            //The last entries of some files are just dates with no data.
+            if(!readEOPField(MJD,line,lineLength,8,15)||!readEOPField(vals[xpIdx],line,lineLength,19,27)) {
+                break;
+            }
+
+            readEOPField(vals[ypIdx],line,lineLength,38,46);
+            readEOPField(vals[UT1UTCIdx],line,lineLength,59,68);
+
+            //LOD, dX and dY are not always filled and are zero if missing.
+            if(lineLength>=80&&readEOPField(vals[LODIdx],line,lineLength,80,86)) {
+                //Convert from milliseconds.
+                vals[LODIdx]/=1000.0;
+            }
+            if(lineLength>=98&&readEOPField(vals[dXIdx],line,lineLength,98,106)) {
+                readEOPField(vals[dYIdx],line,lineLength,117,125);
+            }
+
+            table.MJD.push_back(MJD);
+            for(size_t i=0;i<numEOPVals;i++) {
+                table.vals[i].push_back(vals[i]);
+            }
+        }
+    }
+
+    if(table.MJD.size()<2) {
+        table.MJD.clear();
+        return false;
+    }
+
+    for(size_t i=0;i<numEOPVals;i++) {
+        getPchipSlopes(table.slopes[i],table.MJD,table.vals[i]);
+    }
+
+    table.fileName=fileName;
+    table.fileSize=static_cast<long long>(fileInfo.st_size);
+    table.modTime=static_cast<long long>(fileInfo.st_mtime);
+    return true;
+}
+
+/*The fundamental arguments chi=GMST+pi, l, lp, F, D and Omega of the tidal
+ *corrections in radians and their rates in radians per day at the
+ *modified Julian date rjd, as in interp.f.*/
+static void getTidalArgs(double *arg, double *dArg, const double rjd) {
+    const double secrad=3.14159265358979323846/(180.0*3600.0);
+    //Julian centuries.
+    const double T=(rjd-51544.5)/36525.0;
+    const double T2=T*T;
+    const double T3=T2*T;
+    const double T4=T3*T;
+
+    arg[0]=(67310.54841+(876600.0*3600.0+8640184.812866)*T+0.093104*T2-6.2e-6*T3)*15.0+648000.0;
+    arg[1]=-0.00024470*T4+0.051635*T3+31.8792*T2+1717915923.2178*T+485868.249036;
+    arg[2]=-0.00001149*T4-0.000136*T3-0.5532*T2+129596581.0481*T+1287104.79305;
+    arg[3]=0.00000417*T4-0.001037*T3-12.7512*T2+1739527262.8478*T+335779.526232;
+    arg[4]=-0.00003169*T4+0.006593*T3-6.3706*T2+1602961601.2090*T+1072260.70369;
+    arg[5]=-0.00005939*T4+0.007702*T3+7.4722*T2-6962890.2665*T+450160.398036;
+
+    for(size_t i=0;i<6;i++) {
+        arg[i]=fmod(arg[i],1296000.0)*secrad;
+    }
+
+    dArg[0]=(876600.0*3600.0+8640184.812866+2.0*0.093104*T-3.0*6.2e-6*T2)*15.0;
+    dArg[1]=-4.0*0.00024470*T3+3.0*0.051635*T2+2.0*31.8792*T+1717915923.2178;
+    dArg[2]=-4.0*0.00001149*T3-3.0*0.000136*T2-2.0*0.5532*T+129596581.0481;
+    dArg[3]=4.0*0.00000417*T3-3.0*0.001037*T2-2.0*12.7512*T+1739527262.8478;
+    dArg[4]=-4.0*0.00003169*T3+3.0*0.006593*T2-2.0*6.3706*T+1602961601.2090;
+    dArg[5]=-4.0*0.00005939*T3+3.0*0.007702*T2+2.0*7.4722*T-6962890.2665;
+
+    for(size_t i=0;i<6;i++) {
+        dArg[i]*=secrad/36525.0;
+    }
+}
+
+//The largest magnitude of the multipliers of the fundamental arguments in
+//the tidal terms.
+static const int maxArgMult=3;
+
+/*Find cos(ag) and sin(ag) for the argument ag of a tidal term from the
+ *powers of exp(1i*arg) of the fundamental arguments, which avoids
+ *evaluating sines and cosines for every term.*/
+static void getTidalTermCosSin(double &cosAg, double &sinAg, const int *mult, const double cosPow[6][2*maxArgMult+1], const double sinPow[6][2*maxArgMult+1]) {
+    cosAg=1;
+    sinAg=0;
+    for(size_t i=0;i<6;i++) {
+        const double c=cosPow[i][mult[i]+maxArgMult];
+        const double s=sinPow[i][mult[i]+maxArgMult];
+        const double cosPrev=cosAg;
+
+        cosAg=cosPrev*c-sinAg*s;
+        sinAg=cosPrev*s+sinAg*c;
+    }
+}
+
+/*Get the tidal corrections at the modified Julian date rjd. These are the
+ *diurnal and subdiurnal oceanic tidal corrections to polar motion in
+ *arcseconds and to UT1 and LOD in seconds from PMUT1_OCEANS in interp.f
+ *and, if corX2 is not NULL, the diurnal lunisolar corrections to polar
+ *motion in arcseconds from PM_GRAVI in interp.f.*/
+static void tidalCorr(double *corX, double *corY, double *corUT1, double *corLOD, double *corX2, double *corY2, const double rjd) {
+    double arg[6], dArg[6];
+    double cosPow[6][2*maxArgMult+1], sinPow[6][2*maxArgMult+1];
+
+    getTidalArgs(arg,dArg,rjd);
+
+    for(size_t i=0;i<6;i++) {
+        const double c=cos(arg[i]);
+        const double s=sin(arg[i]);
+
+        cosPow[i][maxArgMult]=1;
+        sinPow[i][maxArgMult]=0;
+        for(int n=1;n<=maxArgMult;n++) {
+            const double cPrev=cosPow[i][maxArgMult+n-1];
+            const double sPrev=sinPow[i][maxArgMult+n-1];
+
+            cosPow[i][maxArgMult+n]=cPrev*c-sPrev*s;
+            sinPow[i][maxArgMult+n]=cPrev*s+sPrev*c;
+            cosPow[i][maxArgMult-n]=cosPow[i][maxArgMult+n];
+            sinPow[i][maxArgMult-n]=-sinPow[i][maxArgMult+n];
+        }
+    }
+
+    *corX=0;
+    *corY=0;
+    *corUT1=0;
+    *corLOD=0;
+    for(size_t j=0;j<71;j++) {
+        const double *c=oceanCoeffs[j];
+        double cosAg, sinAg;
+        double dag=0;
+
+        getTidalTermCosSin(cosAg,sinAg,oceanArgs[j],cosPow,sinPow);
+        for(size_t i=0;i<6;i++) {
+            dag+=oceanArgs[j][i]*dArg[i];
+        }
+
+        *corX+=c[1]*cosAg+c[0]*sinAg;
+        *corY+=c[3]*cosAg+c[2]*sinAg;
+        *corUT1+=c[5]*cosAg+c[4]*sinAg;
+        *corLOD-=(-c[5]*sinAg+c[4]*cosAg)*dag;
+    }
+
+    //Convert from microarcseconds and microseconds.
+    *corX*=1e-6;
+    *corY*=1e-6;
+    *corUT1*=1e-6;
+    *corLOD*=1e-6;
+
+    if(corX2!=NULL) {
+        *corX2=0;
+        *corY2=0;
+        for(size_t j=0;j<10;j++) {
+            const double *c=graviCoeffs[j];
+            double cosAg, sinAg;
+
+            getTidalTermCosSin(cosAg,sinAg,graviArgs[j],cosPow,sinPow);
+            *corX2+=c[1]*cosAg+c[0]*sinAg;
+            *corY2+=c[3]*cosAg+c[2]*sinAg;
+        }
+
+        //Convert from microarcseconds.
+        *corX2*=1e-6;
+        *corY2*=1e-6;
+    }
+}
+
+int getEOPCPP(double *xpyp, double *dXdY, double *deltaUTCUT1, double *deltaTTUT1, double *LOD, const double *JulUTC1, const double *JulUTC2, const size_t numTimes, const char *fileName) {
+    //The coefficient to convert arcseconds to radians.
+    const double as2Rad=3.14159265358979323846/(180.0*3600.0);
+    const EOPTable &table=EOPData;
+    size_t numTab;
+
+    if(!loadEOPTable(fileName)) {
+        return -1;
+    }
+    numTab=table.MJD.size();
+
+    for(size_t curTime=0;curTime<numTimes;curTime++) {
+        //The date as a modified Julian date in one part.
+        const double JulDes=(JulUTC1[curTime]-2400000.5)+JulUTC2[curTime];
+        const bool inTable=JulDes>=table.MJD[0]&&JulDes<=table.MJD[numTab-1];
+        //The interval holding the date or the nearest one.
+        const size_t k=std::min<size_t>(numTab-2,static_cast<size_t>(std::max<std::ptrdiff_t>(0,std::upper_bound(table.MJD.begin(),table.MJD.end(),JulDes)-table.MJD.begin()-1)));
+        double UT1UTC=0;
+        double LODCur=evalEOPPchip(table,LODIdx,k,JulDes);
+
+        if(xpyp!=NULL||deltaUTCUT1!=NULL||deltaTTUT1!=NULL||LOD!=NULL) {
+            double corX, corY, corUT1, corLOD, corX2=0, corY2=0;
+
+            tidalCorr(&corX,&corY,&corUT1,&corLOD,(xpyp!=NULL&&inTable)?&corX2:NULL,&corY2,JulDes);
+            LODCur+=corLOD;
+
+            if(inTable) {
+                UT1UTC=evalEOPPchip(table,UT1UTCIdx,k,JulDes)+corUT1;
+
+                if(xpyp!=NULL) {
+                    xpyp[2*curTime]=(evalEOPPchip(table,xpIdx,k,JulDes)+corX+corX2)*as2Rad;
+                    xpyp[2*curTime+1]=(evalEOPPchip(table,ypIdx,k,JulDes)+corY+corY2)*as2Rad;
+                }
+            } else {
+                //Outside of the table, UT1-UTC is linearly extrapolated
+                //and polar motion is set to zero.
+                const double h=table.MJD[k+1]-table.MJD[k];
+
+                UT1UTC=table.vals[UT1UTCIdx][k]+(JulDes-table.MJD[k])*(table.vals[UT1UTCIdx][k+1]-table.vals[UT1UTCIdx][k])/h;
+                if(xpyp!=NULL) {
+                    xpyp[2*curTime]=0;
+                    xpyp[2*curTime+1]=0;
+                }
+            }
+        }
+
+        if(dXdY!=NULL) {
+            if(inTable) {
+                //Convert from milliarcseconds.
+                dXdY[2*curTime]=evalEOPPchip(table,dXIdx,k,JulDes)*as2Rad/1000.0;
+                dXdY[2*curTime+1]=evalEOPPchip(table,dYIdx,k,JulDes)*as2Rad/1000.0;
+            } else {
+                dXdY[2*curTime]=0;
+                dXdY[2*curTime+1]=0;
+            }
+        }
+
+        if(deltaUTCUT1!=NULL) {
+            deltaUTCUT1[curTime]=-UT1UTC;
+        }
+
+        if(deltaTTUT1!=NULL) {
+            int year, month, day;
+            double dayFrac, leapSeconds;
+
+            iauJd2cal(JulUTC1[curTime],JulUTC2[curTime],&year,&month,&day,&dayFrac);
+            iauDat(year,month,day,dayFrac,&leapSeconds);
+            //The 32.184 is the offset of the zero mark of TT versus UTC and
+            //UT1.
+            deltaTTUT1[curTime]=-UT1UTC+32.184+leapSeconds;
+        }
+
+        if(LOD!=NULL) {
+            LOD[curTime]=LODCur;
+        }
+    }
+
+    return 0;
+}
+
+void getEOPMex(double *xpyp, double *dXdY, double *deltaUTCUT1, double *deltaTTUT1, double *LOD, const double *JulUTC1, const double *JulUTC2, const size_t numTimes) {
+    //The full path to EOP.txt, which is found on the first call.
+    static std::string fileName;
+
+    if(fileName.empty()) {
+        mxArray *funcName=mxCreateString("getEOP");
+        mxArray *funcPath;
+        char *pathStr;
+
+        mexCallMATLAB(1,&funcPath,1,&funcName,"which");
+        mxDestroyArray(funcName);
+        pathStr=mxArrayToString(funcPath);
+        mxDestroyArray(funcPath);
+
+        if(pathStr==NULL||pathStr[0]=='\0') {
+            mxFree(pathStr);
+            mexErrMsgTxt("The function getEOP could not be found.");
+            return;
+        }
+
+        fileName=pathStr;
+        mxFree(pathStr);
+        //Replace getEOP.m with the path to the data in the same folder.
+        fileName=fileName.substr(0,fileName.find_last_of("/\\")+1)+"data/EOP.txt";
+    }
+
+    if(getEOPCPP(xpyp,dXdY,deltaUTCUT1,deltaTTUT1,LOD,JulUTC1,JulUTC2,numTimes,fileName.c_str())!=0) {
+        mexErrMsgTxt("Could not load the Earth orientation parameters from data/EOP.txt in the folder of getEOP.");
+    }
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,155 @@
+/**STARCAT2OBSCPP Functions to convert catalog data for many stars to
+ *   observed directions in the local East-North-Up (ENU) coordinate system
+ *   of an observer at one or more epochs. See the Matlab function
+ *   starCat2Obs for more details on the inputs and outputs.
+ *
+ *The function iauAtco13 in the International Astronomical Union's (IAU)
+ *Standard's of Fundamental Astronomy library finds the Earth orientation,
+ *ephemeris and refraction terms in iauApco13 and then applies them to one
+ *star with iauAtciq and iauAtioq. The first step does not depend on the
+ *star and costs far more than the other two. Here, iauApco13 is called
+ *once per epoch to fill an iauASTROM structure and only iauAtciq and
+ *iauAtioq are run per star, which gives the same results as calling
+ *iauAtco13 for every star.
+ *
+ *catData is numStarsX6 and stored by column as in Matlab. zSpher is
+ *2XnumStarsXnumEpochs and uObs, which can be NULL, is 3XnumStarsXnumEpochs.
+ *P is in millibars, T in degrees Centigrade, R between 0 and 1 and wl in
+ *micrometers, as in iauAtco13. zObs=[lat;lon;h] is 3X1 with zObsStride=0
+ *or 3XnumEpochs with zObsStride=3. deltaUTCUT1 and xpyp are handled the
+ *same way with strides of 0 or 1 and 0 or 2. The epochs and then the
+ *stars of all of the epochs are split into contiguous chunks over
+ *numThreads threads. numThreads=0 means that the number of hardware
+ *threads is used.
+ *
+ *The return value is -1 if iauApco13 could not be evaluated at an epoch,
+ *in which case the outputs are not set, 1 if an epoch is dubious and 0
+ *otherwise.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "AstroFuncs.hpp"
+/*This header is for the SOFA library.*/
+#include "sofa.h"
+#include "runChunksCPP.hpp"
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+//The minimum number of stars given to each thread.
+static const size_t minStarsPerThread=1024;
+
+int starCat2ObsCPP(double *zSpher, double *uObs, const double *catData, const size_t numStars, const double *UTC1, const double *UTC2, const size_t numEpochs, const double *zObs, const size_t zObsStride, const double *deltaUTCUT1, const size_t deltaTStride, const double *xpyp, const size_t xpypStride, const double P, const double T, const double R, const double wl, const size_t numThreads) {
+    const double halfPi=1.5707963267948966192313216916398;
+    //The constant to convert radians to arcseconds.
+    const double rad2as=(180.0/3.1415926535897932384626433832795)*60.0*60.0;
+    std::vector<iauASTROM> astrom(numEpochs);
+    std::vector<int> epochStatus(numEpochs);
+    int retVal=0;
+
+    if(numStars==0||numEpochs==0) {
+        return 0;
+    }
+
+    //Pointers to the columns of catData.
+    const double *RArad=catData;
+    const double *DErad=RArad+numStars;
+    const double *Plx=DErad+numStars;
+    const double *pmRA=Plx+numStars;
+    const double *pmDE=pmRA+numStars;
+    const double *vRad=pmDE+numStars;
+
+    //The star-independent terms at each epoch. An epoch costs about as
+    //much as tens of stars.
+    runChunksCPP(numEpochs,numThreads,1,[&](const size_t startIdx, const size_t endIdx) {
+        for(size_t curEpoch=startIdx;curEpoch<endIdx;curEpoch++) {
+            const double *zCur=zObs+zObsStride*curEpoch;
+            const double *xpypCur=xpyp+xpypStride*curEpoch;
+            //The equation of the origins is not used.
+            double eo;
+
+            epochStatus[curEpoch]=iauApco13(UTC1[curEpoch],UTC2[curEpoch],//Quasi-Julian UTC date.
+                                            -deltaUTCUT1[deltaTStride*curEpoch],//UT1-UTC in seconds.
+                                            zCur[1],//WGS-84 longitude, radians East.
+                                            zCur[0],//WGS-84 geodetic latitude (radians North).
+                                            zCur[2],//WGS-84 ellipsoidal height in meters.
+                                            xpypCur[0],xpypCur[1],//Polar motion coordinates (radians).
+                                            P,T,R,wl,
+                                            &astrom[curEpoch],&eo);
+        }
+    });
+
+    for(size_t curEpoch=0;curEpoch<numEpochs;curEpoch++) {
+        if(epochStatus[curEpoch]<0) {
+            return -1;
+        }
+        retVal=std::max(retVal,epochStatus[curEpoch]);
+    }
+
+    runChunksCPP(numStars*numEpochs,numThreads,minStarsPerThread,[&](const size_t startIdx, const size_t endIdx) {
+        size_t curEpoch=startIdx/numStars;
+        size_t curStar=startIdx-curEpoch*numStars;
+        //The SOFA functions do not take a const pointer, so each thread
+        //uses its own copy of the context of the current epoch.
+        iauASTROM astromCur=astrom[curEpoch];
+
+        for(size_t curIdx=startIdx;curIdx<endIdx;curIdx++) {
+            double ri, di, aob, zob, hob, dob, rob;
+
+            if(curStar==numStars) {
+                curStar=0;
+                curEpoch++;
+                astromCur=astrom[curEpoch];
+            }
+
+            //ICRS to CIRS.
+            iauAtciq(RArad[curStar],//ICRS right ascension at J2000.0, radians.
+                     DErad[curStar],//ICRS declination at J2000.0, radians.
+                     pmRA[curStar],//RA proper motion, radians/year (in the form dRA/dt and not cos(Dec)*dRA/dt).
+                     pmDE[curStar],//Dec proper motion (radians/year).
+                     Plx[curStar]*rad2as,//Parallax (arcseconds).
+                     vRad[curStar]/1000.0,//Radial velocity (km/s, +ve if receding).
+                     &astromCur,&ri,&di);
+            //CIRS to observed azimuth (radians East of North) and zenith
+            //distance.
+            iauAtioq(ri,di,&astromCur,&aob,&zob,&hob,&dob,&rob);
+
+            //Convert radians East of North to North of East and the zenith
+            //distance to elevation.
+            zSpher[2*curIdx]=halfPi-aob;
+            zSpher[2*curIdx+1]=halfPi-zob;
+
+            if(uObs!=NULL) {
+                const double sinZ=sin(zob);
+
+                uObs[3*curIdx]=sin(aob)*sinZ;
+                uObs[3*curIdx+1]=cos(aob)*sinZ;
+                uObs[3*curIdx+2]=cos(zob);
+            }
+
+            curStar++;
+        }
+    });
+
+    return retVal;
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -73,6 +73,11 @@ function [xpyp,dXdY,deltaUTCUT1,deltaTTUT1,LOD]=getEOP(JulUTC1,JulUTC2,refreshFr
 %
 %Once loaded, the data stays in memory until this function is cleared.
 %
+%Compiled functions, such as GCRS2ITRS, that are not given the EOP do not
+%call this function. They read ./data/EOP.txt directly with the same
+%interpolation and corrections using getEOPCPP.cpp. Thus, data downloaded
+%using refreshFromSource are only seen by them if replaceEOPtxt is true.
+%
 %x and y, sometimes called px, py or PMx, PMy are the polar motion
 %coordinates and do not include tidal or libration effects. dX and dY are
 %the celestial pole offsets with respect to the IAU 2006/2000A precession/
@@ -138,7 +143,7 @@ function [xpyp,dXdY,deltaUTCUT1,deltaTTUT1,LOD]=getEOP(JulUTC1,JulUTC2,refreshFr
     xpTable=dataFile(:,5);
     ypTable=dataFile(:,6);
     UT1UTCTable=dataFile(:,7);
-    LODTable=dataFile(:,8);
+    LODTable=dataFile(:,8)/1000;%Convert from milliseconds.
     dXTable=dataFile(:,9);
     dYTable=dataFile(:,10);
     
@@ -152,7 +157,8 @@ function [xpyp,dXdY,deltaUTCUT1,deltaTTUT1,LOD]=getEOP(JulUTC1,JulUTC2,refreshFr
     %Convert the units of the parameters to return
     xpyp=[xpInt';ypInt']*as2Rad;
     deltaUTCUT1=-UT1UTCInt;
-    dXdY=[dXInt';dYInt']*as2Rad;
+    %dX and dY are tabulated in milliarcseconds.
+    dXdY=[dXInt';dYInt']*as2Rad/1000;
     LOD=LODInt;
 
     [year,month,day,dayFrac]=UTC2Cal(JulUTC1,JulUTC2,true);
@@ -348,10 +354,10 @@ function [cor_x,cor_y,cor_ut1,cor_lod]=PMUT1_OCEANS(rjd)
 % Arguments in the following order : chi=GMST+pi,l,lp,F,D,Omega
 % et leur derivee temporelle 
 
-      ARG(1) = (67310.54841 +(876600*3600 + 8640184.812866)*T +0.093104*T^2 -6.2-6*T^3)*15.0 + 648000.0;
+      ARG(1) = (67310.54841 +(876600*3600 + 8640184.812866)*T +0.093104*T^2 -6.2e-6*T^3)*15.0 + 648000.0;
       ARG(1)= mod(ARG(1),1296000)*secrad; 
    
-      DARG(1) = (876600*3600 + 8640184.812866 + 2 * 0.093104 * T - 3 * 6.2-6*T^2)*15;
+      DARG(1) = (876600*3600 + 8640184.812866 + 2 * 0.093104 * T - 3 * 6.2e-6*T^2)*15;
       DARG(1) = DARG(1)* secrad / 36525.0;   % rad/day
 
       ARG(2) = -0.00024470*T^4 + 0.051635*T^3 + 31.8792*T^2+ 1717915923.2178*T + 485868.249036;
@@ -468,7 +474,7 @@ function [cor_x,cor_y]=PM_GRAVI (rjd)
 % Arguments in the following order : chi=GMST+pi,l,lp,F,D,Omega
 % et leur derivee temporelle 
 
-      ARG(1) = (67310.54841 +(876600*3600 + 8640184.812866)*T +0.093104*T^2 -6.2-6*T^3)*15.0 + 648000.0;
+      ARG(1) = (67310.54841 +(876600*3600 + 8640184.812866)*T +0.093104*T^2 -6.2e-6*T^3)*15.0 + 648000.0;
       ARG(1)=mod(ARG(1),1296000)*secrad;
    
 
@@ -543,7 +549,7 @@ function [dataRet,rawText]=processEOPData(source)
 %                 format:
 %[Year(UTC), month(UTC), day(UTC), Modified Julian Day (UTC),
 %x (arcseconds), y (arcseconds), UT1-UTC (seconds), LOD (milliseconds),
-%dX (arcseconds), dY (arcseconds), xErr, yErr, UT1-UTC Err, LOD Err, dX
+%dX (milliarcseconds), dY (milliarcseconds), xErr, yErr, UT1-UTC Err, LOD Err, dX
 %Err, dYErr]
 %         rawText The raw ASCII text of the downloaded data file.
 %
@@ -634,7 +640,7 @@ for curEntry=1:numEntry
     if(~isempty(val))
         dataRet(curEntry,5)=val;
     else
-        dataRet=dataRet(1:curEntry,:);
+        dataRet=dataRet(1:(curEntry-1),:);
         break;
     end
 
@@ -21,12 +21,16 @@
  *          observation is made. The units of the date are days. The full
  *          date is the sum of both terms. The date is broken into two
  *          parts to provide more bits of precision. It does not matter how
- *          the date is split.
+ *          the date is split. To find the stars at numEpochs epochs, such
+ *          as when simulating a star tracker, Jul1 and Jul2 can be
+ *          1XnumEpochs vectors or one of them can be a scalar.
  *     zObs zObs=[lat;lon;h], the longitude, geodetic latitude and height
  *          above the reference ellipsoid of the observer using the WGS-84
  *          reference ellipsoid. The units of lat and lon are radians and
  *          the height is in meters. East and North are the positive
- *          directions.
+ *          directions. With multiple epochs, this can be a 3XnumEpochs
+ *          matrix to give the location of a moving observer at each
+ *          epoch.
  *        R The relative humidity at the observer (between 0 and 1). If
  *          this parameter is omitted or an empty matrix is passed, then
  *          Constants.standardRelHumid is used.
@@ -40,38 +44,48 @@
  *          meters. If this parameter is omitted or an empty matrix is
  *          passed, then a wavelength of 0.574 micrometers is used, which
  *          is in the visible spectrum (a rather yellow color).
- *   deltaT The difference between UTC and UT1 in seconds. This
- *          information can be obtained from
+ * deltaUTCUT1 The difference UTC-UT1 in seconds. This information can be
+ *          obtained from
  *          http://www.iers.org/nn_11474/IERS/EN/DataProducts/EarthOrientationData/eop.html?__nnn=true
  *          or 
  *          http://www.usno.navy.mil/USNO/earth-orientation/eo-products
  *          If this parameter is omitted or if an empty matrix is passed,
  *          then the value provided by the function getEOP will be used
- *          instead.
- *     xpyp xpyp=[xp,yp], the polar motion coordinates of the respect
+ *          instead. With multiple epochs, this can be a 1XnumEpochs
+ *          vector.
+ *     xpyp xpyp=[xp;yp], the polar motion coordinates of the respect
  *          to the International Terrestrial Reference System. As
  *          described in Section 5.1 of the IERS Conventions 2010,
  *          values are published by the IERS and should have been
  *          updated to account for the additional temporal effects of
  *          ocean tides and librations. If this parameter is omitted,
  *          the value provided by the function getEOP will be used instead.
+ *          With multiple epochs, this can be a 2XnumEpochs matrix.
+ * numThreads The number of threads to use. Zero means that the number of
+ *          hardware threads available is used. If this parameter is
+ *          omitted or an empty matrix is passed, then one thread is used.
  *
  *OUTPUTS: zSpher For N stars, this is a 2XN matrix with each colum being
  *                the location of a star in [azimuth;elevation] in radians
  *                taken with respect to a local East-North-Up coordinate
  *                system defined on the WGS-84 ellipsoid. Azimuth is
- *                measured in radians North of East.
+ *                measured in radians North of East. With multiple epochs,
+ *                this is 2XNXnumEpochs.
  *           uObs For N stars, this is a 3XN matrix of unit vectors in
- *                WGS-84 ENU coordinates pointing toward the stars. 
+ *                WGS-84 ENU coordinates pointing toward the stars. With
+ *                multiple epochs, this is 3XNXnumEpochs.
  *
  *This is a mex wrapper for the function iauAtco13 in the International
  *Astronomical Union's (IAU) Standard's of Fundamental Astronomy library.
+ *The terms of iauAtco13 that do not depend on the star are only found
+ *once per epoch rather than once per star. See starCat2ObsCPP.cpp for
+ *details.
  *
  *The algorithm can be compiled for use in Matlab  using the 
  *CompileCLibraries function.
  *
  *The algorithm is run in Matlab using the command format
- *[zObs,uObs]=starCat2Obs(catData,Jul1,Jul2,zObs,P,T,R,wl,dut1,xpyp);
+ *[zObs,uObs]=starCat2Obs(catData,Jul1,Jul2,zObs,R,P,T,wl,deltaUTCUT1,xpyp,numThreads);
  *or
  *[zObs,uObs]=starCat2Obs(catData,Jul1,Jul2,zObs);
  *
@@ -84,35 +98,43 @@
 /*This header is for the SOFA library.*/
 #include "sofa.h"
 #include "MexValidation.h"
-#include "CoordFuncs.hpp"
+#include "AstroFuncs.hpp"
+#include "EOPFuncs.h"
+#include <algorithm>
+#include <vector>
 
-const double halfPi=1.5707963267948966192313216916398;
-const double pi=3.1415926535897932384626433832795;
-//The constant to convert arcseconds to radians. The multiplications go
-//as->arcminutes->deg->rad
-const double as2Rad=(1.0/60.0)*(1.0/60.0)*(pi/180.0);
-const double rad2as=1.0/as2Rad;
+/*Get an input with numRows elements per epoch that can be given for all
+ *epochs or for each of the numEpochs epochs. The returned stride is the
+ *offset from one epoch to the next.*/
+static const double *getEpochInput(size_t &stride, const mxArray *arr, const size_t numRows, const size_t numEpochs, const char *errMsg) {
+    const size_t dim1=mxGetM(arr);
+    const size_t dim2=mxGetN(arr);
 
-void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
-    double *catData;
-    mxArray *zSpherMATLAB;
-    //This is only used if nlhs>1. It is initialized here to  avoid a
-    //warning if compiled with -Wconditional-uninitialized
-    mxArray *uObsMATLAB=NULL;
-    size_t numStars,i;
-    double Jul1,Jul2;
-    double uENU[9];//To hold WGS-84 East-North-Up axes at the observer.
-    //The if-statements below should properly initialize all of the EOP.
-    //The following initializations to zero are to suppress warnings when
-    //compiling with -Wconditional-uninitialized.
-    double *zObs, P,T,R,wl;
-    double xp=0;
-    double yp=0;
-    double deltaT=0;
-    //Pointers to the rows of catData
-    double *RArad, *DErad, *Plx, *pmRA, *pmDE,*vRad;
+    checkRealDoubleArray(arr);
+    if(dim1*dim2==numRows) {
+        stride=0;
+    } else if(dim1==numRows&&dim2==numEpochs) {
+        stride=numRows;
+    } else {
+        mexErrMsgTxt(errMsg);
+    }
+
+    return reinterpret_cast<double*>(mxGetData(arr));
+}
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const double *catData, *Jul1, *Jul2, *zObs;
+    size_t numStars, numEpochs, numJul1, numJul2;
+    double P, T, R, wl;
+    size_t zObsStride, deltaTStride=0, xpypStride=0;
+    size_t numThreads=1;
+    //The Earth orientation parameters that are not given are put here.
+    std::vector<double> deltaUTCUT1EOP, xpypEOP;
+    const double *deltaUTCUT1=NULL;
+    const double *xpyp=NULL;
+    int retVal;
 
-    if(nrhs<4||nrhs>20) {
+    if(nrhs<4||nrhs>11) {
         mexErrMsgTxt("Wrong number of inputs.");
         return;
     }
@@ -129,42 +151,53 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
         return;
     }
     checkRealDoubleArray(prhs[0]);
-    catData=(double*)mxGetData(prhs[0]);
+    catData=reinterpret_cast<double*>(mxGetData(prhs[0]));
     
-    //Get the UTC time
-    Jul1=getDoubleFromMatlab(prhs[1]);
-    Jul2=getDoubleFromMatlab(prhs[2]);
-    
-    //Get the location
-    if(mxGetM(prhs[3])!=3||mxGetN(prhs[3])!=1) {
-        mexErrMsgTxt("The observer location has the wrong dimensionality.");
+    //Get the UTC times. These can be scalars or have one element per
+    //epoch.
+    checkRealDoubleArray(prhs[1]);
+    checkRealDoubleArray(prhs[2]);
+    numJul1=mxGetNumberOfElements(prhs[1]);
+    numJul2=mxGetNumberOfElements(prhs[2]);
+    numEpochs=std::max(numJul1,numJul2);
+    if(numJul1<1||numJul2<1||(numJul1!=1&&numJul1!=numEpochs)||(numJul2!=1&&numJul2!=numEpochs)) {
+        mexErrMsgTxt("The dates have the wrong dimensionality.");
         return;
     }
-    checkRealDoubleArray(prhs[3]);
-    zObs=(double*)mxGetData(prhs[3]);
+    Jul1=reinterpret_cast<double*>(mxGetData(prhs[1]));
+    Jul2=reinterpret_cast<double*>(mxGetData(prhs[2]));
+
+    std::vector<double> UTC1(numEpochs), UTC2(numEpochs);
+    for(size_t curEpoch=0;curEpoch<numEpochs;curEpoch++) {
+        UTC1[curEpoch]=Jul1[(numJul1==1)?0:curEpoch];
+        UTC2[curEpoch]=Jul2[(numJul2==1)?0:curEpoch];
+    }
+    
+    //Get the location
+    zObs=getEpochInput(zObsStride,prhs[3],3,numEpochs,"The observer location has the wrong dimensionality.");
     
     //Get the relative humidity
-    if(nrhs>4&&mxGetM(prhs[4])!=0) {
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
        R=getDoubleFromMatlab(prhs[4]);
     } else {//Otherwise get the value from the Constants class.
        R=getScalarMatlabClassConst("Constants","standardRelHumid");
     }
     
     //Get the pressure
-    if(nrhs>5&&mxGetM(prhs[5])!=0) {
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
         P=getDoubleFromMatlab(prhs[5]);
     } else {//Otherwise, get the value from the Constants class.
         P=getScalarMatlabClassConst("Constants","standardAtmosphericPressure");
     }
     
     //Get the temperature
-    if(nrhs>6&&mxGetM(prhs[6])!=0) {
+    if(nrhs>6&&!mxIsEmpty(prhs[6])) {
         T=getDoubleFromMatlab(prhs[6]);
     } else {//Otherwise get the value from the Constants class.
         T=getScalarMatlabClassConst("Constants","standardTemp");
     }
     
-    if(nrhs>7&&mxGetM(prhs[7])!=0) {
+    if(nrhs>7&&!mxIsEmpty(prhs[7])) {
        wl= getDoubleFromMatlab(prhs[7]);
     } else {
        wl=0.574e-6;
@@ -177,175 +210,67 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     T-=273.15;
     //Convert from meters to micrometers.
     wl*=1e6;
-    
-    //If any default values will be needed, load them.
-    if(nrhs<=9||mxGetM(prhs[8])==0||mxGetM(prhs[9])==0){
-        mxArray *retVals[3];
-        double *xpyp,*dXdY;
-        mxArray *JulUTCMATLAB[2];
-        double JulUTC[2];
-        int retVal;
-        
-        //Get the time in UTC to look up the parameters by going to TAI and
-        //then UTC.
-        retVal=iauTttai(Jul1, Jul2, &JulUTC[0], &JulUTC[1]);
-        if(retVal!=0) {
-            mexErrMsgTxt("An error occurred computing TAI.");
-        }
-        retVal=iauTaiutc(JulUTC[0], JulUTC[1], &JulUTC[0], &JulUTC[1]);
-        switch(retVal){
-            case 1:
-                mexWarnMsgTxt("Dubious Date entered.");
-                break;
-            case -1:
-                mexErrMsgTxt("Unacceptable date entered");
-                break;
-            default:
-                break;
-        }
-        
-        JulUTCMATLAB[0]=doubleMat2Matlab(&JulUTC[0],1,1);
-        JulUTCMATLAB[1]=doubleMat2Matlab(&JulUTC[1],1,1);
-        
-        //Get the Earth orientation parameters for the given date.
-        mexCallMATLAB(3,retVals,2,JulUTCMATLAB,"getEOP");
-        mxDestroyArray(JulUTCMATLAB[0]);
-        mxDestroyArray(JulUTCMATLAB[1]);
-        
-        checkRealDoubleArray(retVals[0]);
-        checkRealDoubleArray(retVals[1]);
-        if(mxGetM(retVals[0])!=2||mxGetN(retVals[0])!=1||mxGetM(retVals[1])!=2||mxGetN(retVals[1])!=1) {
-            mxDestroyArray(retVals[0]);
-            mxDestroyArray(retVals[1]);
-            mxDestroyArray(retVals[2]);
-            mexErrMsgTxt("Error using the getEOP function.");
-            return;
-        }
-        xpyp=(double*)mxGetData(retVals[0]);
-        dXdY=(double*)mxGetData(retVals[1]);//The celestial pole offsets are not used.
-        xp=xpyp[0];
-        yp=xpyp[1];
-        deltaT=getDoubleFromMatlab(retVals[2]);
-        
-        //Free the returned arrays.
-        mxDestroyArray(retVals[0]);
-        mxDestroyArray(retVals[1]);
-        mxDestroyArray(retVals[2]);
-    }
 
     //Get the UTC UT1 offset, if provided.
-    if(nrhs>8&&mxGetM(prhs[8])!=0) {
-        deltaT=getDoubleFromMatlab(prhs[8]);
+    if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+        deltaUTCUT1=getEpochInput(deltaTStride,prhs[8],1,numEpochs,"The UTC-UT1 offset has the wrong dimensionality.");
     }
-    
-    //Get the components of the polar motion coordinates.
-    if(nrhs>9&&mxGetM(prhs[9])!=0) {
-        double *XpYp;
-        if(mxGetM(prhs[9])!=2&&mxGetN(prhs[9])!=1) {
-            mexErrMsgTxt("The polar motion coordinate vector has the wrong dimensionality.");
-            return;
-        }
-        checkRealDoubleArray(prhs[9]);
-        XpYp=(double*)mxGetData(prhs[9]);
-        
-        xp=XpYp[0];
-        yp=XpYp[1];
+
+    //Get the polar motion coordinates, if provided.
+    if(nrhs>9&&!mxIsEmpty(prhs[9])) {
+        xpyp=getEpochInput(xpypStride,prhs[9],2,numEpochs,"The polar motion coordinate vector has the wrong dimensionality.");
     }
-    
-    //Get the axes at the local observer.
-    {
-        double c[3];
-        double a=getScalarMatlabClassConst("Constants","WGS84SemiMajorAxis");
-        double f=getScalarMatlabClassConst("Constants","WGS84Flattening");
 
-        getENUAxesCPP(uENU, c,zObs,false,a,f);
+    if(nrhs>10&&!mxIsEmpty(prhs[10])) {
+        numThreads=getSizeTFromMatlab(prhs[10]);
     }
 
-    //Set the pointers for each column of data in the catalog.
-    RArad=catData;
-    DErad=RArad+numStars;
-    Plx=DErad+numStars;
-    pmRA=Plx+numStars;
-    pmDE=pmRA+numStars;
-    vRad=pmDE+numStars;
-    
-    //Allocate space for the return values
-    zSpherMATLAB=mxCreateDoubleMatrix(2,numStars,mxREAL);
-    plhs[0]=zSpherMATLAB;
-    
-    if(nlhs>1) {
-        uObsMATLAB=mxCreateDoubleMatrix(3,numStars,mxREAL);
-        plhs[1]=uObsMATLAB;
+    //If any default values will be needed, load them for all of the epochs
+    //with one call. The dates are already in UTC.
+    if(deltaUTCUT1==NULL||xpyp==NULL) {
+        deltaUTCUT1EOP.resize(numEpochs);
+        xpypEOP.resize(2*numEpochs);
+
+        getEOPMex(xpypEOP.data(),NULL,deltaUTCUT1EOP.data(),NULL,NULL,UTC1.data(),UTC2.data(),numEpochs);
+        if(deltaUTCUT1==NULL) {
+            deltaUTCUT1=deltaUTCUT1EOP.data();
+            deltaTStride=1;
+        }
+        if(xpyp==NULL) {
+            xpyp=xpypEOP.data();
+            xpypStride=2;
+        }
     }
-    
-    {
-        double *uEast,*uNorth,*uUp;
-        double *zRet;
-        //This is only used if nlhs>1. It is initialized here to  avoid a
-        //warning if compiled with -Wconditional-uninitialized
-        double *uRet=NULL;
-        uEast=uENU;
-        uNorth=uENU+3;
-        uUp=uENU+6;
-        
-        zRet=(double*)mxGetData(zSpherMATLAB);
+
+    //Allocate space for the return values
+    if(numEpochs==1) {
+        plhs[0]=mxCreateDoubleMatrix(2,numStars,mxREAL);
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleMatrix(3,numStars,mxREAL);
+        }
+    } else {
+        mwSize dims[3];
+        dims[0]=2;
+        dims[1]=numStars;
+        dims[2]=numEpochs;
+        plhs[0]=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
         if(nlhs>1) {
-            uRet=(double*)mxGetData(uObsMATLAB);
+            dims[0]=3;
+            plhs[1]=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
         }
-        
-        for(i=0;i<numStars;i++) {
-            //Variables to hold the result of the iauAtco13 function.
-            double aob,zob,hob,dob,rob,eo;
-            int retVal;
-            
-            retVal=iauAtco13(RArad[i],//ICRS right ascension at J2000.0, radians.
-                          DErad[i],//ICRS declination at J2000.0, radians.
-                          pmRA[i],//RA proper motion, radians/year (in the form dRA/dt and not cos(Dec)*dRA/dt).
-                          pmDE[i],//Dec proper motion (radians/year).
-                          Plx[i]*rad2as,//parallax (arcseconds).
-                          vRad[i]/1000.0,//radial velocity (km/s, +ve if receding).
-                          Jul1, Jul2,//Quasi-Julian UTC date.
-                          -deltaT,//UT1-UTC in seconds.
-                          zObs[1],//WGS-84Longitude, radians East.
-                          zObs[0],//WGS-84 geodetic latitude (radians North).
-                          zObs[2],//WGS-84 Ellipsoidal height in meters.
-                          xp,yp,//polar motion coordinates (radians)
-                          P,//Pressure at the observer in millibars (hectoPascals).
-                          T,//Temperature at the observer (deg C).
-                          R,//Relative humidity at the observer (0-1).
-                          wl,//Wavelength (micrometers).
-                          &aob,//Observed azimuth (radians East of North).
-                          &zob,//Observed zenith distance (radians).
-                          &hob,//Observed hour angle (radians).
-                          &dob,//Observed declination (radians North).
-                          &rob,//Observed CIO-based right ascension (radians).
-                          &eo);//Equation of the Origins (ERA-GST).
+    }
 
-            if(retVal<0) {
-                mxDestroyArray(zSpherMATLAB);
-                if(nlhs>1) {
-                    mxDestroyArray(uObsMATLAB);
-                }
-                
-                mexErrMsgTxt("An error occurred during the transformation to local coordinates.");
-                return;
-            }
+    retVal=starCat2ObsCPP(reinterpret_cast<double*>(mxGetData(plhs[0])),(nlhs>1)?reinterpret_cast<double*>(mxGetData(plhs[1])):NULL,catData,numStars,UTC1.data(),UTC2.data(),numEpochs,zObs,zObsStride,deltaUTCUT1,deltaTStride,xpyp,xpypStride,P,T,R,wl,numThreads);
+    if(retVal<0) {
+        mxDestroyArray(plhs[0]);
+        if(nlhs>1) {
+            mxDestroyArray(plhs[1]);
+        }
 
-            zRet[0]=halfPi-aob;//Convert radians East of North to North of East
-            zRet[1]=halfPi-zob;
-            
-            if(nlhs>1) {
-                //Convert the  azimith and zenith distance (zenith
-                //distance=pi/2-elevation) to a unit vector in the local
-                //ENU coordinate system of the observer.
-                uRet[0]=cos(aob)*sin(zob);
-                uRet[1]=sin(aob)*sin(zob);
-                uRet[2]=cos(zob);
-                
-                uRet+=3;
-            }
-            zRet+=2;
-        }   
+        mexErrMsgTxt("An error occurred during the transformation to local coordinates.");
+        return;
+    } else if(retVal==1) {
+        mexWarnMsgTxt("Dubious Date entered.");
     }
 }
 
@@ -1,4 +1,4 @@
-function [zObs,uObs]=starCat2Obs(catData,Jul1,Jul2,zObs,P,T,R,wl,dut1,xpyp)
+function [zObs,uObs]=starCat2Obs(catData,Jul1,Jul2,zObs,R,P,T,wl,deltaUTCUT1,xpyp,numThreads)
 %%STARCAT2OBS Convert data for the location of stars as typically
 %             supplied by a star catalog, such as the Hipparcos catalog,
 %             to local ENU observed coordinates at the receiver,
@@ -22,12 +22,16 @@ function [zObs,uObs]=starCat2Obs(catData,Jul1,Jul2,zObs,P,T,R,wl,dut1,xpyp)
 %          observation is made. The units of the date are days. The full
 %          date is the sum of both terms. The date is broken into two
 %          parts to provide more bits of precision. It does not matter how
-%          the date is split.
+%          the date is split. To find the stars at numEpochs epochs, such
+%          as when simulating a star tracker, Jul1 and Jul2 can be
+%          1XnumEpochs vectors or one of them can be a scalar.
 %     zObs zObs=[lat;lon;h], the longitude, geodetic latitude and height
 %          above the reference ellipsoid of the observer using the WGS-84
 %          reference ellipsoid. The units of lat and lon are radians and
 %          the height is in meters. East and North are the positive
-%          directions.
+%          directions. With multiple epochs, this can be a 3XnumEpochs
+%          matrix to give the location of a moving observer at each
+%          epoch.
 %        R The relative humidity at the observer (between 0 and 1). If
 %          this parameter is omitted or an empty matrix is passed, then
 %          Constants.standardRelHumid is used.
@@ -41,38 +45,48 @@ function [zObs,uObs]=starCat2Obs(catData,Jul1,Jul2,zObs,P,T,R,wl,dut1,xpyp)
 %          meters. If this parameter is omitted or an empty matrix is
 %          passed, then a wavelength of 0.574 micrometers is used, which
 %          is in the visible spectrum (a rather yellow color).
-%   deltaT The difference between UTC and UT1 in seconds. This
-%          information can be obtained from
+% deltaUTCUT1 The difference UTC-UT1 in seconds. This information can be
+%          obtained from
 %          http://www.iers.org/nn_11474/IERS/EN/DataProducts/EarthOrientationData/eop.html?__nnn=true
 %          or 
 %          http://www.usno.navy.mil/USNO/earth-orientation/eo-products
 %          If this parameter is omitted or if an empty matrix is passed,
 %          then the value provided by the function getEOP will be used
-%          instead.
-%     xpyp xpyp=[xp,yp], the polar motion coordinates of the respect
+%          instead. With multiple epochs, this can be a 1XnumEpochs
+%          vector.
+%     xpyp xpyp=[xp;yp], the polar motion coordinates of the respect
 %          to the International Terrestrial Reference System. As
 %          described in Section 5.1 of the IERS Conventions 2010,
 %          values are published by the IERS and should have been
 %          updated to account for the additional temporal effects of
 %          ocean tides and librations. If this parameter is omitted,
 %          the value provided by the function getEOP will be used instead.
+%          With multiple epochs, this can be a 2XnumEpochs matrix.
+% numThreads The number of threads to use. Zero means that the number of
+%          hardware threads available is used. If this parameter is
+%          omitted or an empty matrix is passed, then one thread is used.
 %
 %OUTPUTS: zSpher For N stars, this is a 2XN matrix with each colum being
 %                the location of a star in [azimuth;elevation] in radians
 %                taken with respect to a local East-North-Up coordinate
 %                system defined on the WGS-84 ellipsoid. Azimuth is
-%                measured in radians North of East.
+%                measured in radians North of East. With multiple epochs,
+%                this is 2XNXnumEpochs.
 %           uObs For N stars, this is a 3XN matrix of unit vectors in
-%                WGS-84 ENU coordinates pointing toward the stars. 
+%                WGS-84 ENU coordinates pointing toward the stars. With
+%                multiple epochs, this is 3XNXnumEpochs.
 %
 %This is a mex wrapper for the function iauAtco13 in the International
 %Astronomical Union's (IAU) Standard's of Fundamental Astronomy library.
+%The terms of iauAtco13 that do not depend on the star are only found
+%once per epoch rather than once per star. See starCat2ObsCPP.cpp for
+%details.
 %
 %The algorithm can be compiled for use in Matlab  using the 
 %CompileCLibraries function.
 %
 %The algorithm is run in Matlab using the command format
-%[zObs,uObs]=starCat2Obs(catData,Jul1,Jul2,zObs,P,T,R,wl,dut1,xpyp);
+%[zObs,uObs]=starCat2Obs(catData,Jul1,Jul2,zObs,R,P,T,wl,deltaUTCUT1,xpyp,numThreads);
 %or
 %[zObs,uObs]=starCat2Obs(catData,Jul1,Jul2,zObs);
 %
@@ -65,32 +65,46 @@ mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','./Misc/nDim2Index.cpp');
 
 %Compile navigation code
+%Compile directGeodeticProb
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./3rd_Party_Libraries/GeographicLib-1.47/include','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Navigation/Shared C++ Code/','./Navigation/directGeodeticProb.cpp','./Navigation/Shared C++ Code/geodesicBatchCPP.cpp','./Mathematical Functions/Shared C++ Code/wrapRangeCPP.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/Geodesic.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicExact.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicLine.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicLineExact.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/EllipticFunction.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/Math.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicExactC4.cpp');
+%Compile geodesicPathPoints
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./3rd_Party_Libraries/GeographicLib-1.47/include','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Navigation/Shared C++ Code/','./Navigation/geodesicPathPoints.cpp','./Navigation/Shared C++ Code/geodesicBatchCPP.cpp','./Mathematical Functions/Shared C++ Code/wrapRangeCPP.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/Geodesic.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicExact.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicLine.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicLineExact.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/EllipticFunction.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/Math.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicExactC4.cpp');
 %Compile indirectGeodeticProb
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./3rd_Party_Libraries/GeographicLib-1.47/include','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','./Navigation/indirectGeodeticProb.cpp','./Mathematical Functions/Shared C++ Code/wrapRangeCPP.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/Geodesic.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicExact.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicLine.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicLineExact.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/EllipticFunction.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/Math.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicExactC4.cpp');
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./3rd_Party_Libraries/GeographicLib-1.47/include','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Navigation/Shared C++ Code/','./Navigation/indirectGeodeticProb.cpp','./Navigation/Shared C++ Code/geodesicBatchCPP.cpp','./Mathematical Functions/Shared C++ Code/wrapRangeCPP.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/Geodesic.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicExact.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicLine.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicLineExact.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/EllipticFunction.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/Math.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicExactC4.cpp');
+%Compile indirectGeodeticProbAllPairs
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./3rd_Party_Libraries/GeographicLib-1.47/include','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Navigation/Shared C++ Code/','./Navigation/indirectGeodeticProbAllPairs.cpp','./Navigation/Shared C++ Code/geodesicBatchCPP.cpp','./Mathematical Functions/Shared C++ Code/wrapRangeCPP.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/Geodesic.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicExact.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicLine.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicLineExact.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/EllipticFunction.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/Math.cpp','./3rd_Party_Libraries/GeographicLib-1.47/src/GeodesicExactC4.cpp');
 
 %Compile general coordinate system code.
 %Compile spher2Cart
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/spher2Cart.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/spher2Cart.cpp','./Coordinate Systems/Shared C++ Code/coordConvBatchCPP.cpp');
 %Compile Cart2Sphere
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Cart2Sphere.cpp','./Coordinate Systems/Shared C++ Code/Cart2SphereCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Cart2Sphere.cpp','./Coordinate Systems/Shared C++ Code/coordConvBatchCPP.cpp');
 %Compile ruv2Cart
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/ruv2Cart.cpp','./Coordinate Systems/Shared C++ Code/ruv2CartCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/ruv2Cart.cpp','./Coordinate Systems/Shared C++ Code/coordConvBatchCPP.cpp');
 %Compile Cart2Ruv
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Cart2Ruv.cpp','./Coordinate Systems/Shared C++ Code/Cart2RuvCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Cart2Ruv.cpp','./Coordinate Systems/Shared C++ Code/coordConvBatchCPP.cpp');
 %Compile getRangeRate
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Measurement Components/getRangeRate.cpp','./Coordinate Systems/Shared C++ Code/getRangeRateCPP.cpp');
+%Compile spher2CartWithDerivs
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/spher2CartWithDerivs.cpp','./Coordinate Systems/Shared C++ Code/convWithDerivsBatchCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp');
+%Compile ruv2CartWithDerivs
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/ruv2CartWithDerivs.cpp','./Coordinate Systems/Shared C++ Code/convWithDerivsBatchCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp');
 %Compile state2RuvRR
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/State Conversion/state2RuvRR.cpp','./Coordinate Systems/Shared C++ Code/getRangeRateCPP.cpp','./Coordinate Systems/Shared C++ Code/Cart2RuvCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/State Conversion/state2RuvRR.cpp','./Coordinate Systems/Shared C++ Code/convWithDerivsBatchCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp');
 %Compile state2SpherRR
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/State Conversion/state2SpherRR.cpp','./Coordinate Systems/Shared C++ Code/getRangeRateCPP.cpp','./Coordinate Systems/Shared C++ Code/Cart2SphereCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/State Conversion/state2SpherRR.cpp','./Coordinate Systems/Shared C++ Code/convWithDerivsBatchCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp');
 %Compile getENUAxes
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/getENUAxes.cpp','./Coordinate Systems/Shared C++ Code/getENUAxesCPP.cpp');
+%Compile Cart2ENU
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Cart2ENU.cpp','./Coordinate Systems/Shared C++ Code/ENUSiteConvCPP.cpp','./Coordinate Systems/Shared C++ Code/getENUAxesCPP.cpp','./Coordinate Systems/Shared C++ Code/ellipsConvCPP.cpp')
+%Compile ENU2Cart
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/ENU2Cart.cpp','./Coordinate Systems/Shared C++ Code/ENUSiteConvCPP.cpp','./Coordinate Systems/Shared C++ Code/getENUAxesCPP.cpp','./Coordinate Systems/Shared C++ Code/ellipsConvCPP.cpp')
 %Compile getEllipsHarmAxes
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/getEllipsHarmAxes.cpp','./Coordinate Systems/Shared C++ Code/getEllipsHarmAxesCPP.cpp');
 %Compile Cart2EllipsHarmon
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Cart2EllipsHarmon.cpp','./Coordinate Systems/Shared C++ Code/Cart2EllipsHarmonCPP.cpp');
 %Compile Cart2Ellipse
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','./Coordinate Systems/Cart2Ellipse.c')
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Cart2Ellipse.cpp','./Coordinate Systems/Shared C++ Code/ellipsConvCPP.cpp')
 
 %Compile coordinate system gradient code
 %Compile rangeGradient
@@ -98,7 +112,7 @@ mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-
 %Compile spherAngGradient
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Jacobians/Component Gradients/spherAngGradient.cpp','./Coordinate Systems/Shared C++ Code/spherAngGradientCPP.cpp');
 %Compile calcSpherConvJacob
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Jacobians/Converted Jacobians/calcSpherConvJacob.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngGradientCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Jacobians/Converted Jacobians/calcSpherConvJacob.cpp','./Coordinate Systems/Shared C++ Code/convWithDerivsBatchCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp');
 %Compile calcSpherInvJacob
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/Jacobians/calcSpherInvJacob.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvJacobCPP.cpp');
 
@@ -125,11 +139,19 @@ mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-
 %Compile normHelmholtz
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','./Mathematical Functions/Polynomials/normHelmholtz.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp');
 %Compile spherHarmonicEval
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/Spherical Harmonics/spherHarmonicEval.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvHessianCPP.cpp');
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/Spherical Harmonics/spherHarmonicEval.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicTruncCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicLegendreSumsCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvHessianCPP.cpp');
 %Compile spherHarmonicSetEval
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/Spherical Harmonics/spherHarmonicSetEval.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicSetEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvHessianCPP.cpp');
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/Spherical Harmonics/spherHarmonicSetEval.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicSetEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvHessianCPP.cpp');
+%Compile spherHarmonicSVEval
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/Spherical Harmonics/spherHarmonicSVEval.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicSVEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicSetEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvHessianCPP.cpp');
+%Compile spherHarmonicGridEval
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/Spherical Harmonics/spherHarmonicGridEval.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicGridEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicLegendreSumsCPP.cpp','./Mathematical Functions/Shared C++ Code/FFTPlanCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngGradientCPP.cpp');
+%Compile spherHarmonicModelCPPInt
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/Spherical Harmonics/spherHarmonicModelCPPInt.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicModelCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicCoeffFileCPP.cpp','./Container Classes/Shared C++ Code/mappedFileCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicTruncCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicLegendreSumsCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvHessianCPP.cpp');
+%Compile gravAccelCacheCPPInt
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','-I./Gravity/Shared C++ Code/','./Gravity/gravAccelCacheCPPInt.cpp','./Gravity/Shared C++ Code/gravAccelCacheCPP.cpp','./Container Classes/Shared C++ Code/mappedFileCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicGridEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/FFTPlanCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicTruncCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicLegendreSumsCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/rangeHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngGradientCPP.cpp','./Coordinate Systems/Shared C++ Code/spherAngHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherConvHessianCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherInvHessianCPP.cpp');
 %Compile spherHarmonicCov
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/Spherical Harmonics/spherHarmonicCov.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicCovCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp');
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/Spherical Harmonics/spherHarmonicCov.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicCovCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp');
 
 %Compile the 2D assignment algorithms
 %Compile calc2DAssignmentProbs
@@ -177,7 +199,7 @@ mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-
 %Compile binSearchDoubles
 mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C Code/','./Mathematical Functions/Searching/binSearchDoubles.c','./Mathematical Functions/Shared C Code/binSearchC.c')
 %Compile MMOSPAApprox
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Assignment Algorithms/k-Best 2D Assignment/Shared C++ Code/','-I./Mathematical Functions/MMOSPAApprox/Shared C++ Code/','./Mathematical Functions/MMOSPAApprox/MMOSPAApprox.cpp','./Mathematical Functions/MMOSPAApprox/Shared C++ Code/MMOSPAApproxCPP.cpp','./Assignment Algorithms/k-Best 2D Assignment/Shared C++ Code/ShortestPathCPP.cpp');
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Assignment Algorithms/k-Best 2D Assignment/Shared C++ Code/','-I./Mathematical Functions/MMOSPAApprox/Shared C++ Code/','./Mathematical Functions/MMOSPAApprox/MMOSPAApprox.cpp','./Mathematical Functions/MMOSPAApprox/Shared C++ Code/MMOSPAApproxCPP.cpp','./Assignment Algorithms/k-Best 2D Assignment/Shared C++ Code/ShortestPathCPP.cpp');
 %Compile wrapRange
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','./Mathematical Functions/wrapRange.cpp','./Mathematical Functions/Shared C++ Code/wrapRangeCPP.cpp')
 %Compile kronSym
@@ -205,10 +227,16 @@ blasLib='-lmwblas';
 
 %Compile the 3D assignment algorithms.
 %Compile assign3D
-mex('-v','CFLAGS="$CFLAGS -std=c99 -Wall"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/',blasInclude,'-I./','-I./Assignment Algorithms/2D Assignment/Shared C Code/','-I./Assignment Algorithms/3D Assignment/Shared C Code/','-I./Mathematical Functions/Basic Matrix Operations/Shared C Code/','./Assignment Algorithms/3D Assignment/assign3D.c','./Assignment Algorithms/2D Assignment/Shared C Code/assign2DC.c','./Mathematical Functions/Basic Matrix Operations/Shared C Code/basicMatOps.c','./Assignment Algorithms/3D Assignment/Shared C Code/assign3DC.c',blasLib);
+mex('-v','CFLAGS="$CFLAGS -std=c99 -Wall"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/',blasInclude,'-I./','-I./Assignment Algorithms/2D Assignment/Shared C Code/','-I./Assignment Algorithms/3D Assignment/Shared C Code/','-I./Mathematical Functions/Basic Matrix Operations/Shared C Code/','./Assignment Algorithms/3D Assignment/assign3D.c','./Assignment Algorithms/2D Assignment/Shared C Code/assign2DC.c','./Assignment Algorithms/2D Assignment/Shared C Code/assign2DSparseC.c','./Mathematical Functions/Basic Matrix Operations/Shared C Code/basicMatOps.c','./Assignment Algorithms/3D Assignment/Shared C Code/assign3DC.c',blasLib);
+%Compile assign3DSparse
+mex('-v','CFLAGS="$CFLAGS -std=c99 -Wall"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/',blasInclude,'-I./','-I./Assignment Algorithms/2D Assignment/Shared C Code/','-I./Assignment Algorithms/3D Assignment/Shared C Code/','-I./Mathematical Functions/Basic Matrix Operations/Shared C Code/','./Assignment Algorithms/3D Assignment/assign3DSparse.c','./Assignment Algorithms/2D Assignment/Shared C Code/assign2DC.c','./Assignment Algorithms/2D Assignment/Shared C Code/assign2DSparseC.c','./Mathematical Functions/Basic Matrix Operations/Shared C Code/basicMatOps.c','./Assignment Algorithms/3D Assignment/Shared C Code/assign3DC.c',blasLib);
+%Compile assignSD
+mex('-v','CFLAGS="$CFLAGS -std=c99 -Wall"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Assignment Algorithms/2D Assignment/Shared C Code/','-I./Assignment Algorithms/S-D Assignment/Shared C Code/','./Assignment Algorithms/S-D Assignment/assignSD.c','./Assignment Algorithms/2D Assignment/Shared C Code/assign2DSparseC.c','./Assignment Algorithms/S-D Assignment/Shared C Code/assignSDC.c');
 
 %Compile assign3DLB
 mex('-v','CFLAGS="$CFLAGS -std=c99 -Wall"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Assignment Algorithms/2D Assignment/Shared C Code/','-I./Assignment Algorithms/3D Assignment/Shared C Code/','-I./Mathematical Functions/Basic Matrix Operations/Shared C Code/','./Assignment Algorithms/3D Assignment/assign3DLB.c','./Assignment Algorithms/2D Assignment/Shared C Code/assign2DC.c','./Mathematical Functions/Basic Matrix Operations/Shared C Code/basicMatOps.c','./Mathematical Functions/Basic Matrix Operations/Shared C Code/minMatOverDimC.c','./Assignment Algorithms/3D Assignment/Shared C Code/assign3DLBC.c');
+%Compile assign3DBB
+mex('-v','CFLAGS="$CFLAGS -std=c99 -Wall"','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/',blasInclude,'-I./','-I./Assignment Algorithms/2D Assignment/Shared C Code/','-I./Assignment Algorithms/3D Assignment/Shared C Code/','-I./Assignment Algorithms/3D Assignment/Shared C++ Code/','-I./Mathematical Functions/Basic Matrix Operations/Shared C Code/','./Assignment Algorithms/3D Assignment/assign3DBB.cpp','./Assignment Algorithms/3D Assignment/Shared C++ Code/assign3DBBCPP.cpp','./Assignment Algorithms/2D Assignment/Shared C Code/assign2DC.c','./Assignment Algorithms/2D Assignment/Shared C Code/assign2DSparseC.c','./Mathematical Functions/Basic Matrix Operations/Shared C Code/basicMatOps.c','./Mathematical Functions/Basic Matrix Operations/Shared C Code/minMatOverDimC.c','./Assignment Algorithms/3D Assignment/Shared C Code/assign3DC.c','./Assignment Algorithms/3D Assignment/Shared C Code/assign3DLBC.c',blasLib);
 
 %%%Compile the SOFA library
 %If compiling under Windows, the compile environment must be set up so
@@ -342,7 +370,7 @@ cd(ScriptFolder)
 %Compile changeEpoch
 mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Astronomical Code/changeEpoch.c',linkCommands{:})
 %Compile starCat2Obs
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./Coordinate Systems/Shared C++ Code/','-I./','./Astronomical Code/starCat2Obs.cpp','./Coordinate Systems/Shared C++ Code/getENUAxesCPP.cpp',linkCommands{:})
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Astronomical Code/Shared C++ Code/','./Astronomical Code/starCat2Obs.cpp','./Astronomical Code/Shared C++ Code/starCat2ObsCPP.cpp','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile aberCorr
 mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./Coordinate Systems/Relativity/Shared C Code/','-I./','./Astronomical Code/aberCorr.c','./Coordinate Systems/Relativity/Shared C Code/relVecAddC.c',linkCommands{:})
 %Compile lightDeflectCorr
@@ -358,21 +386,21 @@ mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-out
 
 %%Compile the coordinate transforms that use the SOFA code.
 %Compile GCRS2ITRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/GCRS2ITRS.c',linkCommands{:})
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./Coordinate Systems/Shared C++ Code/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/GCRS2ITRS.cpp','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp','./Coordinate Systems/Shared C++ Code/GCRSITRSConvCPP.cpp',linkCommands{:})
 %Compile ITRS2GCRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/ITRS2GCRS.c',linkCommands{:})
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./Coordinate Systems/Shared C++ Code/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/ITRS2GCRS.cpp','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp','./Coordinate Systems/Shared C++ Code/GCRSITRSConvCPP.cpp',linkCommands{:})
 %Compile GCRS2TIRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/GCRS2TIRS.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/GCRS2TIRS.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile TIRS2GCRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/TIRS2GCRS.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/TIRS2GCRS.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile TEME2ITRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/TEME2ITRS.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/TEME2ITRS.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile ITRS2TEME
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/ITRS2TEME.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/ITRS2TEME.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile TOD2GCRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/TOD2GCRS.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/TOD2GCRS.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile GCRS2TOD
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/GCRS2TOD.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/GCRS2TOD.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile MOD2GCRS
 mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/MOD2GCRS.c',linkCommands{:})
 %Compile GCRS2MOD
@@ -382,17 +410,17 @@ mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-out
 %Compile ICRS2J2000F
 mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/ICRS2J2000F.c',linkCommands{:})
 %Compile TIRS2ITRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/TIRS2ITRS.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/TIRS2ITRS.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile ITRS2TIRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/ITRS2TIRS.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/ITRS2TIRS.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile GCRS2CIRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/GCRS2CIRS.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/GCRS2CIRS.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile CIRS2GCRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/CIRS2GCRS.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/CIRS2GCRS.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile CIRS2TIRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/CIRS2TIRS.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/CIRS2TIRS.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile TIRS2CIRS
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/TIRS2CIRS.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Celestial and Terrestrial Systems/TIRS2CIRS.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile G2ICRS
 mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/G2ICRS.c',linkCommands{:})
 %Compile ICRS2G
@@ -403,7 +431,7 @@ mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-out
 mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Celestial and Terrestrial Systems/ecliptic2ICRS.c',linkCommands{:})
 
 %Compile ellips2Cart
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./3rd_Party_Libraries/sofa/src/','./Coordinate Systems/ellips2Cart.c',linkCommands{:})
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Coordinate Systems/ellips2Cart.cpp','./Coordinate Systems/Shared C++ Code/ellipsConvCPP.cpp')
 
 %Compile the time conversion functions that use the SOFA code.
 %Compile UTC2Cal
@@ -423,9 +451,9 @@ mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-out
 %Compile TT2TCG
 mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Time/TT2TCG.c',linkCommands{:})
 %Compile TT2GMST
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Time/TT2GMST.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Time/TT2GMST.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile TT2GAST
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Time/TT2GAST.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','./Coordinate Systems/Time/TT2GAST.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile TAI2UTC
 mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Time/TAI2UTC.c',linkCommands{:})
 %Compile BesselEpoch2TDB
@@ -443,15 +471,17 @@ mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-out
 %Compile JulEpoch2JulDate
 mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','./Coordinate Systems/Time/JulEpoch2JulDate.c',linkCommands{:})
 %Compile TT2UT1
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Mathematical Functions/Shared C Code/','-I./Coordinate Systems/Time/Shared C Code/','./Coordinate Systems/Time/TT2UT1.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','-I./Mathematical Functions/Shared C Code/','-I./Coordinate Systems/Time/Shared C Code/','./Coordinate Systems/Time/TT2UT1.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile TAI2UT1
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Mathematical Functions/Shared C Code/','-I./Coordinate Systems/Time/Shared C Code/','./Coordinate Systems/Time/TAI2UT1.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','-I./Mathematical Functions/Shared C Code/','-I./Coordinate Systems/Time/Shared C Code/','./Coordinate Systems/Time/TAI2UT1.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile TT2TCB
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Mathematical Functions/Shared C Code/','-I./Coordinate Systems/Time/Shared C Code/','./Coordinate Systems/Time/TT2TCB.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','-I./Mathematical Functions/Shared C Code/','-I./Coordinate Systems/Time/Shared C Code/','./Coordinate Systems/Time/TT2TCB.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile TT2TDB
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Mathematical Functions/Shared C Code/','-I./Coordinate Systems/Time/Shared C Code/','./Coordinate Systems/Time/TT2TDB.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','-I./Mathematical Functions/Shared C Code/','-I./Coordinate Systems/Time/Shared C Code/','./Coordinate Systems/Time/TT2TDB.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 %Compile TDB2TT
-mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Mathematical Functions/Shared C Code/','-I./Coordinate Systems/Time/Shared C Code/','./Coordinate Systems/Time/TDB2TT.c',linkCommands{:})
+mex('-v','CFLAGS="$CFLAGS -std=c99"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Astronomical Code/Shared C++ Code/','-I./Mathematical Functions/Shared C Code/','-I./Coordinate Systems/Time/Shared C Code/','./Coordinate Systems/Time/TDB2TT.c','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
+%Compile convertTimeScale
+mex('-v','CXXFLAGS="$CXXFLAGS -std=c++11"','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./3rd_Party_Libraries/sofa/src/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Astronomical Code/Shared C++ Code/','-I./Coordinate Systems/Time/Shared C++ Code/','./Coordinate Systems/Time/convertTimeScale.cpp','./Coordinate Systems/Time/Shared C++ Code/timeScaleConvCPP.cpp','./Astronomical Code/Shared C++ Code/getEOPCPP.cpp',linkCommands{:})
 
 %%Compile other astronomical code
 %Compile approxSolarSysVec
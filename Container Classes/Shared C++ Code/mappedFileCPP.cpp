@@ -0,0 +1,128 @@
+/**MAPPEDFILECPP A class that maps a file read-only into memory. See
+ *               mappedFileCPP.hpp for more details.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mappedFileCPP.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+mappedFileCPP::mappedFileCPP() : ptr(NULL), numBytes(0) {
+#ifdef _WIN32
+    fileHandle=NULL;
+    mapHandle=NULL;
+#endif
+}
+
+mappedFileCPP::~mappedFileCPP() {
+    close();
+}
+
+bool mappedFileCPP::open(const char *fileName) {
+    close();
+
+#ifdef _WIN32
+    LARGE_INTEGER fileSize;
+    HANDLE hFile=CreateFileA(fileName,GENERIC_READ,FILE_SHARE_READ,NULL,OPEN_EXISTING,FILE_ATTRIBUTE_NORMAL,NULL);
+
+    if(hFile==INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    if(!GetFileSizeEx(hFile,&fileSize)||fileSize.QuadPart==0) {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    HANDLE hMap=CreateFileMappingA(hFile,NULL,PAGE_READONLY,0,0,NULL);
+    if(hMap==NULL) {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    const void *view=MapViewOfFile(hMap,FILE_MAP_READ,0,0,0);
+    if(view==NULL) {
+        CloseHandle(hMap);
+        CloseHandle(hFile);
+        return false;
+    }
+
+    fileHandle=hFile;
+    mapHandle=hMap;
+    ptr=static_cast<const char*>(view);
+    numBytes=static_cast<size_t>(fileSize.QuadPart);
+#else
+    struct stat fileStats;
+    const int fd=::open(fileName,O_RDONLY);
+
+    if(fd<0) {
+        return false;
+    }
+
+    if(fstat(fd,&fileStats)!=0||fileStats.st_size<=0) {
+        ::close(fd);
+        return false;
+    }
+
+    void *view=mmap(NULL,static_cast<size_t>(fileStats.st_size),PROT_READ,MAP_SHARED,fd,0);
+    //The mapping remains valid after the file descriptor is closed.
+    ::close(fd);
+    if(view==MAP_FAILED) {
+        return false;
+    }
+
+    ptr=static_cast<const char*>(view);
+    numBytes=static_cast<size_t>(fileStats.st_size);
+#endif
+
+    return true;
+}
+
+void mappedFileCPP::close() {
+    if(ptr==NULL) {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(ptr);
+    CloseHandle(static_cast<HANDLE>(mapHandle));
+    CloseHandle(static_cast<HANDLE>(fileHandle));
+    fileHandle=NULL;
+    mapHandle=NULL;
+#else
+    munmap(const_cast<char*>(ptr),numBytes);
+#endif
+
+    ptr=NULL;
+    numBytes=0;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
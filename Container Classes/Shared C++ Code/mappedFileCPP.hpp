@@ -0,0 +1,68 @@
+/**MAPPEDFILECPP A class that maps a file read-only into memory, so that
+ *               large binary tables can be used directly from the file
+ *               without being read and copied first. The operating system
+ *               only loads the pages that are accessed and can share them
+ *               among multiple processes mapping the same file.
+ *
+ *The open method returns false if the file could not be opened or mapped,
+ *in which case data() is NULL. The mapping is removed by close or by the
+ *destructor. On Windows, CreateFileMapping/MapViewOfFile are used;
+ *elsewhere, mmap is used. The memory returned by data() is aligned to at
+ *least the page size of the system.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef MAPPEDFILECPP
+#define MAPPEDFILECPP
+
+#include <stddef.h>
+
+class mappedFileCPP {
+public:
+    mappedFileCPP();
+    ~mappedFileCPP();
+    bool open(const char *fileName);
+    void close();
+
+    const char *data() const {
+        return ptr;
+    }
+
+    size_t size() const {
+        return numBytes;
+    }
+
+private:
+    const char *ptr;
+    size_t numBytes;
+#ifdef _WIN32
+    void *fileHandle;
+    void *mapHandle;
+#endif
+
+    //A mapping can not be shared between objects.
+    mappedFileCPP(const mappedFileCPP &);
+    mappedFileCPP &operator=(const mappedFileCPP &);
+};
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,98 @@
+function zENU=Cart2ENU(zCart,plhSites,siteIdx,a,f,numThreads)
+%%CART2ENU Convert points in global ECEF Cartesian coordinates into the
+%          local East-North-Up (ENU) Cartesian coordinate systems of a set
+%          of sites, such as fixed sensors. The local coordinate system of
+%          a site has its origin at the site and its axes are those given
+%          by getENUAxes at the site.
+%
+%INPUTS: zCart A 3XN matrix of the [x;y;z] points in ECEF Cartesian
+%              coordinates that are to be converted.
+%     plhSites A 3XnumSites matrix of the locations of the sites given in
+%              terms of [latitude;longitude;height] with the geodetic
+%              latitude and longitude in radians and the height in meters.
+%      siteIdx A length N vector of the indices (starting at 1) of the
+%              sites in whose coordinate systems the points are to be
+%              expressed. If this parameter is omitted or an empty matrix
+%              is passed, then there must be only one site, which is used
+%              for all of the points.
+%            a The semi-major axis of the reference ellipsoid. If this
+%              argument is omitted or an empty matrix is passed, the value
+%              in Constants.WGS84SemiMajorAxis is used.
+%            f The flattening factor of the reference ellipsoid. If this
+%              argument is omitted or an empty matrix is passed, the value
+%              in Constants.WGS84Flattening is used.
+%   numThreads The number of threads to use to convert the points in the
+%              C++ implementation. Zero means that the number of hardware
+%              threads available is used. The default if omitted or an
+%              empty matrix is passed is 1. This parameter is ignored by
+%              the Matlab implementation.
+%
+%OUTPUTS: zENU The 3XN matrix of the points in the local [East;North;Up]
+%              coordinate systems of the sites.
+%
+%This is the same as subtracting ellips2Cart(plhSites(:,siteIdx(i))) from
+%the ith point and then calling getLocalVectors with the axes from
+%getENUAxes at the site. However, the rotation matrix and the location of
+%each site are only computed once, which is faster when there are many
+%points per site.
+%
+%The algorithm can be compiled for use in Matlab  using the
+%CompileCLibraries function. The C++ implementation transforms each run of
+%consecutive points that share a site together. Thus, it is fastest if the
+%points are sorted by site.
+%
+%The algorithm is run in Matlab using the command format
+%zENU=Cart2ENU(zCart,plhSites,siteIdx,a,f,numThreads);
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+if(nargin<5||isempty(f))
+    f=Constants.WGS84Flattening;
+end
+
+if(nargin<4||isempty(a))
+    a=Constants.WGS84SemiMajorAxis;
+end
+
+numSites=size(plhSites,2);
+N=size(zCart,2);
+
+if(nargin<3||isempty(siteIdx))
+    if(numSites~=1)
+        error('The site indices must be given when there is more than one site.')
+    end
+    siteIdx=ones(N,1);
+end
+
+%The rotation matrices and locations of the sites.
+uSites=zeros(3,3,numSites);
+for curSite=1:numSites
+    uSites(:,:,curSite)=getENUAxes(plhSites(:,curSite),false,a,f);
+end
+lSites=ellips2Cart(plhSites,a,f);
+
+zENU=zeros(3,N);
+for curPoint=1:N
+    curSite=siteIdx(curPoint);
+    zENU(:,curPoint)=uSites(:,:,curSite)'*(zCart(:,curPoint)-lSites(:,curSite));
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -0,0 +1,155 @@
+/**CART2ELLIPSE Convert Cartesian coordinates to ellipsoidal (latitude,
+*               longitude, and altitude) coordinates.
+*
+*INPUTS: cartPoints A matrix of the points in ECEF Cartesian coordinates
+*                   that are to be transformed into ellipsoidal
+*                   coordinates. Each column of cartPoints is of the
+*                   format [x;y;z].
+*         algorithm This specified the algorithm to use for the conversion.
+*                   Note that none work at the origin. Possible values are:
+*                   0 (The default if this parameter is omitted or an empty
+*                     matrix is passed) Use the algorithm of Olson in [1].
+*                   1 Use the Algorithm of Sofair in [2], which is a
+*                     modification of [3].
+*                   2 Use the algorithm of Fukushima in [4].
+*                 a The semi-major axis of the reference ellipsoid. If this
+*                   argument is omitted, the value in
+*                   Constants.WGS84SemiMajorAxis is used.
+*                 f The flattening factor of the reference ellipsoid. If
+*                   this argument is omitted, the value in
+*                   Constants.WGS84Flattening is used.
+*        numThreads The number of threads to use to convert the points.
+*                   Zero means that the number of hardware threads
+*                   available is used. If this parameter is omitted or an
+*                   empty matrix is passed, then one thread is used.
+*
+*OUTPUTS:   points  A matrix of the converted points. Each column of the
+*                   matrix has the format [latitude;longitude;altitude],
+*                   with latitude and longitude given in radians.
+*
+*The algorithm of Olson in [1] appears to be the most precise non-iterative
+*method available. The method of Sofair in [2] and [3] is also a
+*non-iterative algorithm, but tends to have singificantly worse accuracy.
+*Fukushima's algorithm in [4] is iterative and is implemented assuming
+*convergence in six or fewer iterations. Its accuracy appears to be
+*marginally better than [1], but it is slower.
+*
+*The conversions are implemented in ellipsConvCPP.cpp, where the loops for
+*the algorithms of Olson and Fukushima are written without data-dependent
+*branches so that they can be vectorized.
+*
+* The algorithm can be compiled for use in Matlab  using the 
+* CompileCLibraries function.
+*
+*The algorithm is run in Matlab using the command format
+*points=Cart2Ellipse(cartPoints,algorithm,a,f,numThreads);
+*or
+*points=Cart2Ellipse(cartPoints);
+*
+*REFERENCES:
+*[1] D. K. Olson, "Converting Earth-centered, Earth-fixed coordinates to
+*   geodetic coordinates," IEEE Transactions on Aerospace and Electronic
+*   Systems, vol. 32, no. 1, pp. 473-476, Jan. 1996.
+*[2] I. Sofair "Improved method for calculating exact geodetic latitude and
+*    altitude revisited," Journal of Guidance, Control, and Dynamics, vol.
+*    23, no. 2, p. 369, Mar. 2000.
+*[3] I. Sofair, "Improved method for calculating exact geodetic latitude
+*    and altitude," Journal of Guidance, Control, and Dynamics, vol. 20,
+*    no. 4, pp. 824-826, Jul.-Aug. 1997.
+*[4] Fukushima, T., "Transformation from Cartesian to geodetic coordinates
+*    accelerated by Halley's method", Journal of Geodesy, vol. 79, no. 12,
+*    pp. 689-693, Mar. 2006.
+*
+*October 2016 David F. Crouse, Naval Research Laboratory, Washington D.C.
+*/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "matrix.h"
+/*This header is required by Matlab.*/
+#include "mex.h"
+#include "MexValidation.h"
+#include "CoordFuncs.hpp"
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const double *points;
+    double a,f;
+    size_t numVec;
+    size_t numThreads=1;
+    mxArray *retMat;
+    double *retData;
+    int algorithm=0;
+    
+    if(nrhs>5||nrhs<1){
+        mexErrMsgTxt("Wrong number of inputs");
+    }
+    
+    if(nlhs>1) {
+        mexErrMsgTxt("Wrong number of outputs.");
+        return;
+    }
+    
+    checkRealDoubleArray(prhs[0]);
+    numVec = mxGetN(prhs[0]);
+    
+    if(mxGetM(prhs[0])!=3) {
+        mexErrMsgTxt("The input vector has a bad dimensionality.");
+    }
+    
+    points=reinterpret_cast<double*>(mxGetData(prhs[0]));
+    //points[0] is x
+    //points[1] is y
+    //points[2] is z
+    
+    if(nrhs>1&&!mxIsEmpty(prhs[1])) {
+        algorithm=getIntFromMatlab(prhs[1]);
+    }
+    
+    if(algorithm<0||algorithm>2) {
+        mexErrMsgTxt("Unknown algorithm specified.");
+    }
+    
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        a=getDoubleFromMatlab(prhs[2]);
+    } else {
+        a=getScalarMatlabClassConst("Constants", "WGS84SemiMajorAxis");
+    }
+
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        f=getDoubleFromMatlab(prhs[3]);
+    } else {
+        f=getScalarMatlabClassConst("Constants", "WGS84Flattening");   
+    }
+    
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        numThreads=getSizeTFromMatlab(prhs[4]);
+    }
+    
+    //Allocate space for the return variables.
+    retMat=mxCreateDoubleMatrix(3,numVec,mxREAL);
+    retData=reinterpret_cast<double*>(mxGetData(retMat));
+    
+    if(!Cart2EllipseCPP(retData,points,numVec,a,f,algorithm,numThreads)) {
+        mxDestroyArray(retMat);
+        mexErrMsgTxt("The point given is too close to the center of the Earth for the algorithm of Sofair.");
+    }
+
+    plhs[0]=retMat;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -1,4 +1,4 @@
-function points=Cart2Ellipse(cartPoints,algorithm,a,f)
+function points=Cart2Ellipse(cartPoints,algorithm,a,f,numThreads)
 %%CART2ELLIPSE Convert Cartesian coordinates to ellipsoidal (latitude,
 %              longitude, and altitude) coordinates.
 %
@@ -19,6 +19,11 @@ function points=Cart2Ellipse(cartPoints,algorithm,a,f)
 %                 f The flattening factor of the reference ellipsoid. If
 %                   this argument is omitted, the value in
 %                   Constants.WGS84Flattening is used.
+%        numThreads The number of threads to use to convert the points in
+%                   the C++ implementation. Zero means that the number of
+%                   hardware threads available is used. The default if
+%                   omitted or an empty matrix is passed is 1. This
+%                   parameter is ignored by the Matlab implementation.
 %
 %OUTPUTS: points A matrix of the converted points. Each column of the
 %                matrix has the format [latitude;longitude;altitude], with
@@ -31,6 +36,14 @@ function points=Cart2Ellipse(cartPoints,algorithm,a,f)
 %convergence in six or fewer iterations. Its accuracy appears to be
 %marginally better than [1], but it is slower.
 %
+%The algorithm can be compiled for use in Matlab  using the
+%CompileCLibraries function. The C++ implementation splits the points over
+%threads and implements the algorithms of Olson and Fukushima without
+%data-dependent branches so that the loops can be vectorized.
+%
+%The algorithm is run in Matlab using the command format
+%points=Cart2Ellipse(cartPoints,algorithm,a,f,numThreads);
+%
 %REFERENCES:
 %[1] D. K. Olson, "Converting Earth-centered, Earth-fixed coordinates to
 %    geodetic coordinates," IEEE Transactions on Aerospace and Electronic
@@ -78,7 +78,7 @@
         
 void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
     double *points, *zTx, *zRx, *M;
-    size_t i, N;
+    size_t N;
     //If multiple values are passed for zTx, zRx or M, then the three
     //offsets below are used to move to the next value when going through
     //the measurements. However, if only a single value is passed, but
@@ -93,7 +93,6 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
 
     mxArray *retMat;
     double *retData;
-    size_t retVecOffset;
     //These two could be declared const, but that would just require extra
     //typecasting, since the return value of mxGetData for the inputs is
     //not const and would have to be typecase, or these would have to be
@@ -210,24 +209,15 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     }
     
     if(includeW) {
-        retVecOffset=4;
         retMat=mxCreateDoubleMatrix(4,N,mxREAL);
     } else {
-        retVecOffset=3;
         retMat=mxCreateDoubleMatrix(3,N,mxREAL);
     }
 
     retData=reinterpret_cast<double*>(mxGetData(retMat));
     
-    //Convert each of the measurements
-    for(i=0;i<N;i++) {
-        Cart2RuvGenCPP(retData,points,useHalfRange,zTx,zRx,M,includeW);
-        retData=retData+retVecOffset;
-        points=points+posOffset;
-        zTx=zTx+zTxOffset;
-        zRx=zRx+zRxOffset;
-        M=M+MOffset;
-    }
+    //Convert all of the measurements
+    Cart2RuvBatchCPP(retData,points,posOffset,N,useHalfRange,zTx,zTxOffset,zRx,zRxOffset,M,MOffset,includeW);
 
     plhs[0]=retMat;
 }
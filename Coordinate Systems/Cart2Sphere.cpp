@@ -83,7 +83,7 @@
 void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
     double *points, *zTx, *zRx, *M;
     int systemType;
-    size_t i, N;
+    size_t N;
     //If multiple values are passed for zTx, zRx or M, then the three
     //offsets below are used to move to the next value when going through
     //the measurements. However, if onyl a single value is passed, but
@@ -225,15 +225,8 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     retMat=mxCreateDoubleMatrix(3,N,mxREAL);
     retData=reinterpret_cast<double*>(mxGetData(retMat));
     
-    //Convert each of the measurements
-    for(i=0;i<N;i++) {
-        Cart2SphereGenCPP(retData,points,systemType,useHalfRange,zTx,zRx,M);
-        retData+=3;
-        points+=posOffset;
-        zTx+=zTxOffset;
-        zRx+=zRxOffset;
-        M+=MOffset;
-    }
+    //Convert all of the measurements
+    Cart2SphereBatchCPP(retData,points,posOffset,N,systemType,useHalfRange,zTx,zTxOffset,zRx,zRxOffset,M,MOffset);
 
     plhs[0]=retMat;
 }
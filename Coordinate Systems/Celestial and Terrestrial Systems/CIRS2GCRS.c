@@ -54,6 +54,7 @@
 #include "MexValidation.h"
 //For sqrt
 #include <math.h>
+#include "EOPFuncs.h"
 
 void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     double TT1, TT2, dX, dY, *xVec;
@@ -86,9 +87,7 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     
     //If some values from the function getEOP will be needed.
     if(nrhs<4||mxIsEmpty(prhs[3])) {
-        mxArray *retVals[2];
-        double *dXdY;
-        mxArray *JulUTCMATLAB[2];
+        double dXdY[2];
         double JulUTC[2];
         int retVal;
         
@@ -110,30 +109,10 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
                 break;
         }
         
-        JulUTCMATLAB[0]=doubleMat2Matlab(&JulUTC[0],1,1);
-        JulUTCMATLAB[1]=doubleMat2Matlab(&JulUTC[1],1,1);
-
         //Get the Earth orientation parameters for the given date.
-        mexCallMATLAB(2,retVals,2,JulUTCMATLAB,"getEOP");
-        mxDestroyArray(JulUTCMATLAB[0]);
-        mxDestroyArray(JulUTCMATLAB[1]);
-        
-        //%We do not need the polar motion coordinates.
-        mxDestroyArray(retVals[0]);
-        
-        checkRealDoubleArray(retVals[1]);
-        if(mxGetM(retVals[1])!=2||mxGetN(retVals[1])!=1) {
-            mxDestroyArray(retVals[1]);
-            mexErrMsgTxt("Error using the getEOP function.");
-            return;
-        }
-        
-        dXdY=(double*)mxGetData(retVals[1]);
+        getEOPMex(NULL,dXdY,NULL,NULL,NULL,&JulUTC[0],&JulUTC[1],1);
         dX=dXdY[0];
         dY=dXdY[1];
-        
-        //Free the returned arrays.
-        mxDestroyArray(retVals[1]);
     } else {//Get the celestial pole offsets
         size_t dim1, dim2;
         
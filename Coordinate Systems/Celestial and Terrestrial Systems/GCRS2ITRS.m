@@ -24,6 +24,8 @@ function [vec,rotMat]=GCRS2ITRS(x,Jul1,Jul2,deltaTTUT1,xpyp,dXdY,LOD)
 %          The units of the date are days. The full date is the sum of
 %          both terms. The date is broken into two parts to provide more
 %          bits of precision. It does not matter how the date is split.
+%          Either can also be a 1XnumVec vector, in which case each
+%          vector in x is converted at its own epoch.
 % deltaTTUT1 An optional parameter specifying the difference between TT
 %          and UT1 in seconds. This information can be obtained from
 %          http://www.iers.org/nn_11474/IERS/EN/DataProducts/EarthOrientationData/eop.html?__nnn=true
@@ -50,7 +52,8 @@ function [vec,rotMat]=GCRS2ITRS(x,Jul1,Jul2,deltaTTUT1,xpyp,dXdY,LOD)
 %OUTPUTS: vec A 3XN or 6XN matrix of vectors converted from GCRS
 %             coordinates to ITRS coordinates.
 %      rotMat The 3X3 rotation matrix used for the conversion of the
-%             positions.
+%             positions. If the vectors have their own epochs, this is
+%             a 3X3XnumVec set of matrices.
 %
 %The conversion functions from the International Astronomical Union's
 %(IAU) Standard's of Fundamental Astronomy library are put together to get
@@ -68,6 +71,20 @@ function [vec,rotMat]=GCRS2ITRS(x,Jul1,Jul2,deltaTTUT1,xpyp,dXdY,LOD)
 %Omega with the position in the TIRS, and then converting to the ITRS.
 %This is a simple Newtonian conversion.
 %
+%When each vector has its own epoch, deltaTTUT1 and LOD can be 1XnumVec
+%and xpyp and dXdY 2XnumVec to give the Earth orientation parameters of
+%each epoch; otherwise the same values are used for all of them. If any are
+%omitted, getEOP is called once for all of the epochs. Evaluating the
+%IAU 2006/2000A series for X, Y and s takes tens of microseconds, so with
+%many epochs they are instead interpolated from a table of Chebyshev
+%polynomials fit over the span of the epochs. Each segment of the table is
+%checked against the full series and is made shorter until the
+%interpolation error of X, Y and s at the check points is below 1e-12
+%radians, which is far below the accuracy of the model. The table is only
+%used when building it takes fewer series evaluations than evaluating the
+%series at every epoch, so converting a long track of states runs at a
+%small fraction of the cost of one call per state.
+%
 %The algorithm can be compiled for use in Matlab  using the 
 %CompileCLibraries function.
 %
@@ -75,6 +92,7 @@ function [vec,rotMat]=GCRS2ITRS(x,Jul1,Jul2,deltaTTUT1,xpyp,dXdY,LOD)
 %[vec,rotMat]=GCRS2ITRS(x,Jul1,Jul2);
 %or if more parameters are known,
 %[vec,rotMat]=GCRS2ITRS(x,Jul1,Jul2,deltaTTUT1,xpyp,dXdY,LOD);
+%where Jul1 and Jul2 can have one date per column of x.
 %
 %Different celestial coordinate systems are compared in [1].
 %
@@ -86,6 +86,7 @@
 /*This header is for the SOFA library.*/
 #include "sofa.h"
 #include "MexValidation.h"
+#include "EOPFuncs.h"
 
 void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     size_t numRow,numVec;
@@ -129,9 +130,7 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     
     //If some values from the function getEOP will be needed
     if(nrhs<=5||mxIsEmpty(prhs[3])||mxIsEmpty(prhs[4])||mxIsEmpty(prhs[5])) {
-        mxArray *retVals[5];
-        double *dXdY;
-        mxArray *JulUTCMATLAB[2];
+        double dXdY[2];
         double JulUTC[2];
         int retVal;
         
@@ -153,39 +152,10 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
                 break;
         }
         
-        JulUTCMATLAB[0]=doubleMat2Matlab(&JulUTC[0],1,1);
-        JulUTCMATLAB[1]=doubleMat2Matlab(&JulUTC[1],1,1);
-
         //Get the Earth orientation parameters for the given date.
-        mexCallMATLAB(5,retVals,2,JulUTCMATLAB,"getEOP");
-        mxDestroyArray(JulUTCMATLAB[0]);
-        mxDestroyArray(JulUTCMATLAB[1]);
-        
-        //%We do not need the polar motion coordinates.
-        mxDestroyArray(retVals[0]);
-        
-        checkRealDoubleArray(retVals[1]);
-        if(mxGetM(retVals[1])!=2||mxGetN(retVals[1])!=1) {
-            mxDestroyArray(retVals[1]);
-            mxDestroyArray(retVals[2]);
-            mxDestroyArray(retVals[3]);
-            mxDestroyArray(retVals[4]);
-            mexErrMsgTxt("Error using the getEOP function.");
-            return;
-        }
-        
-        dXdY=(double*)mxGetData(retVals[1]);
+        getEOPMex(NULL,dXdY,NULL,&deltaT,&LOD,&JulUTC[0],&JulUTC[1],1);
         dX=dXdY[0];
         dY=dXdY[1];
-        
-        //This is TT-UT1
-        deltaT=getDoubleFromMatlab(retVals[3]);
-        LOD=getDoubleFromMatlab(retVals[4]);
-        //Free the returned arrays.
-        mxDestroyArray(retVals[1]);
-        mxDestroyArray(retVals[2]);
-        mxDestroyArray(retVals[3]);
-        mxDestroyArray(retVals[4]);
     }
     
     //If deltaT=TT-UT1 is given
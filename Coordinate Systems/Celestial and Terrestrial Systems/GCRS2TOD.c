@@ -59,6 +59,7 @@
 /*This header is for the SOFA library.*/
 #include "sofa.h"
 #include "MexValidation.h"
+#include "EOPFuncs.h"
 
 void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     double *origVec;
@@ -104,9 +105,7 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
         dX=dXdY[0];
         dY=dXdY[1];
     }else {//get the from the function getEOP, if theya re not provided.
-        mxArray *retVals[2];
-        double *dXdY;
-        mxArray *JulUTCMATLAB[2];
+        double dXdY[2];
         double JulUTC[2];
         int retVal;
         
@@ -128,29 +127,10 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
                 break;
         }
         
-        JulUTCMATLAB[0]=doubleMat2Matlab(&JulUTC[0],1,1);
-        JulUTCMATLAB[1]=doubleMat2Matlab(&JulUTC[1],1,1);
-
         //Get the Earth orientation parameters for the given date.
-        mexCallMATLAB(2,retVals,2,JulUTCMATLAB,"getEOP");
-        mxDestroyArray(JulUTCMATLAB[0]);
-        mxDestroyArray(JulUTCMATLAB[1]);
-        
-        checkRealDoubleArray(retVals[1]);
-        if(mxGetM(retVals[1])!=2||mxGetN(retVals[1])!=1) {
-            mxDestroyArray(retVals[0]);
-            mxDestroyArray(retVals[1]);
-            mexErrMsgTxt("Error using the getEOP function.");
-            return;
-        }
-        
-        dXdY=(double*)mxGetData(retVals[1]);//The celestial pole offsets are not used.
+        getEOPMex(NULL,dXdY,NULL,NULL,NULL,&JulUTC[0],&JulUTC[1],1);
         dX=dXdY[0];
         dY=dXdY[1];
-        
-        //Free the returned arrays.
-        mxDestroyArray(retVals[0]);
-        mxDestroyArray(retVals[1]);
     }
     
     {
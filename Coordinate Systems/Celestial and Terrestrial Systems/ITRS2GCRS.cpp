@@ -0,0 +1,288 @@
+/**ITRS2GCRS Convert vectors of position and possibly velocity from the
+ *           International Terrestrial Reference System  (ITRS), a type of
+ *           Earth-Centered Earth-Fixed (ECEF)  coordinate system, to the
+ *           Geocentric Celestrial Reference System (GCRS), a type of
+ *           Earth-Centered Inertial (ECI) coordinate system. Note
+ *           that the velocity correction includes the centrifugal effects
+ *           of the conversion from the ITRS into the terrestrial 
+ *           intermediate reference system (TIRS), but omits the effects
+ *           of the conversion from the celestial intermediate reference
+ *           system (CIRS) into the GCRS. The period of the Celestial
+ *           Intermediate Pole (CIP) motion in the GCRS is on the order
+ *           of 14 months and thus is significantly smaller than the
+ *           rotation effects of the Earth in the TIRS. The velocity
+ *           conversion also does not include the (small) centrifugal
+ *           effect of polar motion.
+ *
+ *INPUTS: x The NXnumVec collection of vectors to convert. N can be 3, or
+ *          6. If the vectors are 3D, then they are position. 6D vectors
+ *          are assumed to be position and velocity, whereby the angular
+ *          velocity of the Earth's rotation is taken into account using a
+ *          non-relativistic formula.
+ * Jul1, Jul2 Two parts of a Julian date given in terrestrial time (TT).
+ *          The units of the date are days. The full date is the sum of
+ *          both terms. The date is broken into two parts to provide more
+ *          bits of precision. It does not matter how the date is split.
+ *          Either can also be a 1XnumVec vector, in which case each
+ *          vector in x is converted at its own epoch.
+ * deltaTTUT1 An optional parameter specifying the difference between TT
+ *          and UT1 in seconds. This information can be obtained from
+ * http://www.iers.org/nn_11474/IERS/EN/DataProducts/EarthOrientationData/eop.html?__nnn=true
+ *          or 
+ * http://www.usno.navy.mil/USNO/earth-orientation/eo-products
+ *          If this parameter is omitted or if an empty matrix is passed,
+ *          then the value provided by the function getEOP will be used
+ *          instead.
+ *     xpyp xpyp=[xp;yp] are the polar motion coordinates in radians
+ *          including the effects of tides and librations. If this
+ *          parameter is omitted or if an empty matrix is passed, the value
+ *          from the function getEOP will be used.
+ *     dXdY dXdY=[dX;dY] are the celestial pole offsets with respect to
+ *          the IAU 2006/2000A precession/nutation model in radians If this
+ *          parameter is omitted or if an empty matrix is passed, the value
+ *          from the function getEOP will be used.
+ *      LOD The difference between the length of the day using terrestrial
+ *          time, international atomic time, or UTC without leap seconds
+ *          and the length of the day in UT1. This is an instantaneous
+ *          parameter (in seconds) proportional to the rotation rate of the
+ *          Earth. This is only needed if more than just position
+ *          components are being converted.
+ *
+ *OUTPUTS: vec A 3XN or 6XN matrix of vectors converted from ITRS
+ *             coordinates to GCRS coordinates.
+ *      rotMat The 3X3 rotation matrix used for the conversion of the
+ *             positions. If the vectors have their own epochs, this is
+ *             a 3X3XnumVec set of matrices.
+ *
+ *The conversion functions from the International Astronomical Union's
+ *(IAU) Standard's of Fundamental Astronomy library are put together to get
+ *the necessary rotation matrix for the position.
+ *
+ *The velocity transformation deals with the instantaneous rotational
+ *velocity of the Earth using a simple Newtonian velocity addition.
+ *Basically, the axis of rotation in the Terrestrial Intermediate Reference
+ *System TIRS is the z-axis. The rotation rate in that system is
+ *Constants.IERSMeanEarthRotationRate adjusted using the Length-of-Day
+ *(LOD) Earth Orientation Parameter (EOP). Thus, in the TIRS, the angular
+ *velocity vector is [0;0;omega], where omega is the angular velocity
+ *accounting for the LOD EOP. Consequently, one account for rotation by
+ *transforming from the ITRS to the TIRS, adding the cross product of
+ *Omega with the position in the TIRS, and then converting to the GCRS.
+ *This is a simple Newtonian conversion.
+ *
+ *When each vector has its own epoch, deltaTTUT1 and LOD can be 1XnumVec
+ *and xpyp and dXdY 2XnumVec to give the Earth orientation parameters of
+ *each epoch; otherwise the same values are used for all of them. If any are
+ *omitted, getEOP is called once for all of the epochs. Evaluating the
+ *IAU 2006/2000A series for X, Y and s takes tens of microseconds, so with
+ *many epochs they are instead interpolated from a table of Chebyshev
+ *polynomials fit over the span of the epochs. Each segment of the table is
+ *checked against the full series and is made shorter until the
+ *interpolation error of X, Y and s at the check points is below 1e-12
+ *radians, which is far below the accuracy of the model. The table is only
+ *used when building it takes fewer series evaluations than evaluating the
+ *series at every epoch, so converting a long track of states runs at a
+ *small fraction of the cost of one call per state.
+ *
+ *The algorithm can be compiled for use in Matlab  using the 
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[vec,rotMat]=ITRS2GCRS(x,Jul1,Jul2);
+ *or if more parameters are known,
+ *[vec,rotMat]=ITRS2GCRS(x,Jul1,Jul2,deltaTTUT1,xpyp,dXdY,LOD);
+ *where Jul1 and Jul2 can have one date per column of x.
+ *
+ *Different celestial coordinate systems are compared in [1].
+ *
+ *REFERENCES:
+ *[1] D. F. Crouse, "An Overview of Major Terrestrial, Celestial, and
+ *    Temporal Coordinate Systems for Target Tracking," Formal Report,
+ *    Naval Research Laboratory, no. NRL/FR/5344--16-10,279, 10 Aug. 2016,
+ *    173 pages.
+ *
+ *March 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+/*This header is required by Matlab.*/
+#include "mex.h"
+/*This header is for the SOFA library.*/
+#include "sofa.h"
+#include "MexValidation.h"
+#include "CoordFuncs.hpp"
+#include "EOPFuncs.h"
+#include <vector>
+#include <algorithm>
+
+//The maximum error in radians allowed when interpolating the CIP
+//coordinates and the CIO locator over many epochs.
+static const double maxCIPErr=1e-12;
+
+/*Copy an Earth orientation parameter with numRows components into vals.
+ *The parameter can be given for all epochs or for each of the numTimes
+ *epochs.*/
+static void getEOPInput(double *vals, const mxArray *arr, const size_t numRows, const size_t numTimes, const char *errMsg) {
+    const size_t dim1=mxGetM(arr);
+    const size_t dim2=mxGetN(arr);
+    const double *data;
+
+    checkRealDoubleArray(arr);
+    data=reinterpret_cast<double*>(mxGetData(arr));
+
+    if(dim1*dim2==numRows) {
+        for(size_t curTime=0;curTime<numTimes;curTime++) {
+            for(size_t i=0;i<numRows;i++) {
+                vals[numRows*curTime+i]=data[i];
+            }
+        }
+    } else if(dim1==numRows&&dim2==numTimes) {
+        for(size_t i=0;i<numRows*numTimes;i++) {
+            vals[i]=data[i];
+        }
+    } else {
+        mexErrMsgTxt(errMsg);
+    }
+}
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t numRow, numVec, numTimes, numJul1, numJul2;
+    const double *xVec, *Jul1, *Jul2;
+    double *rotMats=NULL;
+    double omegaMean;
+
+    if(nrhs<3||nrhs>7){
+        mexErrMsgTxt("Wrong number of inputs");
+        return;
+    }
+
+    if(nlhs>2) {
+        mexErrMsgTxt("Wrong number of outputs.");
+        return;
+    }
+
+    checkRealDoubleArray(prhs[0]);
+
+    numRow = mxGetM(prhs[0]);
+    numVec = mxGetN(prhs[0]);
+
+    if(!(numRow==3||numRow==6)) {
+        mexErrMsgTxt("The input vector has a bad dimensionality.");
+        return;
+    }
+
+    xVec=reinterpret_cast<double*>(mxGetData(prhs[0]));
+
+    //The dates can be scalars or have one element per vector.
+    checkRealDoubleArray(prhs[1]);
+    checkRealDoubleArray(prhs[2]);
+    numJul1=mxGetNumberOfElements(prhs[1]);
+    numJul2=mxGetNumberOfElements(prhs[2]);
+    numTimes=std::max(numJul1,numJul2);
+    if(numJul1<1||numJul2<1||(numTimes>1&&(numTimes!=numVec||(numJul1!=1&&numJul1!=numTimes)||(numJul2!=1&&numJul2!=numTimes)))) {
+        mexErrMsgTxt("The dates have the wrong dimensionality.");
+        return;
+    }
+    Jul1=reinterpret_cast<double*>(mxGetData(prhs[1]));
+    Jul2=reinterpret_cast<double*>(mxGetData(prhs[2]));
+
+    std::vector<double> TT1(numTimes), TT2(numTimes);
+    std::vector<double> deltaTTUT1(numTimes), xpyp(2*numTimes), dXdY(2*numTimes), LOD(numTimes);
+    for(size_t curTime=0;curTime<numTimes;curTime++) {
+        TT1[curTime]=Jul1[(numJul1==1)?0:curTime];
+        TT2[curTime]=Jul2[(numJul2==1)?0:curTime];
+    }
+
+    //If some values from the function getEOP will be needed
+    if(nrhs<=6||mxIsEmpty(prhs[3])||mxIsEmpty(prhs[4])||mxIsEmpty(prhs[5])||mxIsEmpty(prhs[6])) {
+        std::vector<double> JulUTC1(numTimes), JulUTC2(numTimes);
+        bool isDubious=false;
+
+        //Get the times in UTC to look up the parameters by going to TAI
+        //and then UTC.
+        for(size_t curTime=0;curTime<numTimes;curTime++) {
+            int retVal;
+
+            retVal=iauTttai(TT1[curTime],TT2[curTime],&JulUTC1[curTime],&JulUTC2[curTime]);
+            if(retVal!=0) {
+                mexErrMsgTxt("An error occurred computing TAI.");
+                return;
+            }
+            retVal=iauTaiutc(JulUTC1[curTime],JulUTC2[curTime],&JulUTC1[curTime],&JulUTC2[curTime]);
+            if(retVal==-1) {
+                mexErrMsgTxt("Unacceptable date entered");
+                return;
+            }
+            isDubious=isDubious||(retVal==1);
+        }
+
+        if(isDubious) {
+            mexWarnMsgTxt("Dubious Date entered.");
+        }
+
+        //Get the Earth orientation parameters for all of the dates with
+        //one call. deltaTTUT1 is TT-UT1.
+        getEOPMex(xpyp.data(),dXdY.data(),NULL,deltaTTUT1.data(),LOD.data(),JulUTC1.data(),JulUTC2.data(),numTimes);
+    }
+
+    //If deltaT=TT-UT1 is given
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        getEOPInput(deltaTTUT1.data(),prhs[3],1,numTimes,"deltaTTUT1 has the wrong dimensionality.");
+    }
+
+    //Get polar motion values, if given.
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        getEOPInput(xpyp.data(),prhs[4],2,numTimes,"The polar motion coordinates have the wrong dimensionality.");
+    }
+
+    //Get the celestial pole offsets, if given.
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        getEOPInput(dXdY.data(),prhs[5],2,numTimes,"The celestial pole offsets have the wrong dimensionality.");
+    }
+
+    //If LOD is given
+    if(nrhs>6&&!mxIsEmpty(prhs[6])) {
+        getEOPInput(LOD.data(),prhs[6],1,numTimes,"LOD has the wrong dimensionality.");
+    }
+
+    //The angular velocity of the Earth in radians per second.
+    omegaMean=getScalarMatlabClassConst("Constants","IERSMeanEarthRotationRate");
+
+    //Allocate space for the return vectors.
+    plhs[0]=mxCreateDoubleMatrix(numRow,numVec,mxREAL);
+
+    //If the rotation matrices are desired on the output.
+    if(nlhs>1) {
+        if(numTimes==1) {
+            plhs[1]=mxCreateDoubleMatrix(3,3,mxREAL);
+        } else {
+            mwSize dims[3];
+            dims[0]=3;
+            dims[1]=3;
+            dims[2]=numTimes;
+
+            plhs[1]=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        }
+        rotMats=reinterpret_cast<double*>(mxGetData(plhs[1]));
+    }
+
+    ITRS2GCRSBatchCPP(reinterpret_cast<double*>(mxGetData(plhs[0])),rotMats,xVec,numRow,numVec,TT1.data(),TT2.data(),numTimes,deltaTTUT1.data(),xpyp.data(),dXdY.data(),LOD.data(),omegaMean,maxCIPErr);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
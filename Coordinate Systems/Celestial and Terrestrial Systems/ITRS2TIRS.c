@@ -60,6 +60,7 @@
 /*This header is for the SOFA library.*/
 #include "sofa.h"
 #include "MexValidation.h"
+#include "EOPFuncs.h"
 
 void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     size_t numRow,numVec;
@@ -92,9 +93,7 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     TT2=getDoubleFromMatlab(prhs[2]);
     //If xpyp should be found using the function getEOP.
    if(nrhs<4||mxIsEmpty(prhs[3])) {
-        mxArray *retVals[1];
-        double *xpyp;
-        mxArray *JulUTCMATLAB[2];
+        double xpyp[2];
         double JulUTC[2];
         int retVal;
         
@@ -116,27 +115,10 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
                 break;
         }
         
-        JulUTCMATLAB[0]=doubleMat2Matlab(&JulUTC[0],1,1);
-        JulUTCMATLAB[1]=doubleMat2Matlab(&JulUTC[1],1,1);
-
         //Get the Earth orientation parameters for the given date.
-        mexCallMATLAB(1,retVals,2,JulUTCMATLAB,"getEOP");
-        mxDestroyArray(JulUTCMATLAB[0]);
-        mxDestroyArray(JulUTCMATLAB[1]);
-        
-        checkRealDoubleArray(retVals[0]);
-        if(mxGetM(retVals[0])!=2||mxGetN(retVals[0])!=1) {
-            mxDestroyArray(retVals[0]);
-            mexErrMsgTxt("Error using the getEOP function.");
-            return;
-        }
-        
-        xpyp=(double*)mxGetData(retVals[0]);
+        getEOPMex(xpyp,NULL,NULL,NULL,NULL,&JulUTC[0],&JulUTC[1],1);
         xp=xpyp[0];
         yp=xpyp[1];
-
-        //Free the returned array.
-        mxDestroyArray(retVals[0]);
     }
     
      //Get polar motion coordinates, if given.
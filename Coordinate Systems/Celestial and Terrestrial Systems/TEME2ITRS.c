@@ -82,6 +82,7 @@
 /*This header is for the SOFA library.*/
 #include "sofa.h"
 #include "MexValidation.h"
+#include "EOPFuncs.h"
 
 void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     size_t numRow,numVec;
@@ -124,9 +125,7 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     
     //If some values from the function getEOP will be needed
     if(nrhs<6||mxIsEmpty(prhs[3])||mxIsEmpty(prhs[4])||mxIsEmpty(prhs[5])) {
-        mxArray *retVals[5];
-        double *xpyp;
-        mxArray *JulUTCMATLAB[2];
+        double xpyp[2];
         double JulUTC[2];
         int retVal;
         
@@ -148,40 +147,10 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
                 break;
         }
         
-        JulUTCMATLAB[0]=doubleMat2Matlab(&JulUTC[0],1,1);
-        JulUTCMATLAB[1]=doubleMat2Matlab(&JulUTC[1],1,1);
-
         //Get the Earth orientation parameters for the given date.
-        mexCallMATLAB(5,retVals,2,JulUTCMATLAB,"getEOP");
-        mxDestroyArray(JulUTCMATLAB[0]);
-        mxDestroyArray(JulUTCMATLAB[1]);
-        
-        checkRealDoubleArray(retVals[0]);
-        checkRealDoubleArray(retVals[1]);
-        if(mxGetM(retVals[0])!=2||mxGetN(retVals[0])!=1||mxGetM(retVals[1])!=2||mxGetN(retVals[1])!=1) {
-            mxDestroyArray(retVals[0]);
-            mxDestroyArray(retVals[1]);
-            mxDestroyArray(retVals[2]);
-            mxDestroyArray(retVals[3]);
-            mxDestroyArray(retVals[4]);
-            mexErrMsgTxt("Error using the getEOP function.");
-            return;
-        }
-        
-        xpyp=(double*)mxGetData(retVals[0]);
+        getEOPMex(xpyp,NULL,NULL,&deltaT,&LOD,&JulUTC[0],&JulUTC[1],1);
         xp=xpyp[0];
         yp=xpyp[1];
-        //The celestial pole offsets are not used.
-        
-        //This is TT-UT1
-        deltaT=getDoubleFromMatlab(retVals[3]);
-        LOD=getDoubleFromMatlab(retVals[4]);
-        //Free the returned arrays.
-        mxDestroyArray(retVals[0]);
-        mxDestroyArray(retVals[1]);
-        mxDestroyArray(retVals[2]);
-        mxDestroyArray(retVals[3]);
-        mxDestroyArray(retVals[4]);
     }
     
     //If deltaT=TT-UT1 is given
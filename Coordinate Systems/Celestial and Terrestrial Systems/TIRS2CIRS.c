@@ -72,6 +72,7 @@
 /*This header is for the SOFA library.*/
 #include "sofa.h"
 #include "MexValidation.h"
+#include "EOPFuncs.h"
 
 void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     double TT1,TT2,*xVec;
@@ -107,8 +108,6 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
         
     //If some values from the function getEOP will be needed
     if(nrhs<=4||mxIsEmpty(prhs[3])||mxIsEmpty(prhs[4])) {
-        mxArray *retVals[5];
-        mxArray *JulUTCMATLAB[2];
         double JulUTC[2];
         int retVal;
         
@@ -130,26 +129,8 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
                 break;
         }
         
-        JulUTCMATLAB[0]=doubleMat2Matlab(&JulUTC[0],1,1);
-        JulUTCMATLAB[1]=doubleMat2Matlab(&JulUTC[1],1,1);
-
         //Get the Earth orientation parameters for the given date.
-        mexCallMATLAB(5,retVals,2,JulUTCMATLAB,"getEOP");
-        mxDestroyArray(JulUTCMATLAB[0]);
-        mxDestroyArray(JulUTCMATLAB[1]);
-        
-        //We do not need the polar motion coordinates.
-        mxDestroyArray(retVals[0]);
-        //We do not need the celestial pole offsets.
-        mxDestroyArray(retVals[1]);
-
-        //This is TT-UT1
-        deltaT=getDoubleFromMatlab(retVals[3]);
-        LOD=getDoubleFromMatlab(retVals[4]);
-        //Free the returned arrays.
-        mxDestroyArray(retVals[2]);
-        mxDestroyArray(retVals[3]);
-        mxDestroyArray(retVals[4]);
+        getEOPMex(NULL,NULL,NULL,&deltaT,&LOD,&JulUTC[0],&JulUTC[1],1);
     }
 
     //If deltaT=TT-UT1 is given
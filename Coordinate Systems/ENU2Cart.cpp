@@ -0,0 +1,130 @@
+/**ENU2CART Convert points in the local East-North-Up (ENU) Cartesian
+*          coordinate systems of a set of sites, such as fixed sensors,
+*          into global ECEF Cartesian coordinates. See the comments to
+*          the Matlab implementation for more details.
+*
+*The algorithm can be compiled for use in Matlab  using the
+*CompileCLibraries function.
+*
+*The algorithm is run in Matlab using the command format
+*zCart=ENU2Cart(zENU,plhSites,siteIdx,a,f,numThreads);
+*
+*October 2026 Naval Research Laboratory, Washington D.C.
+*/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "matrix.h"
+#include "mex.h"
+/* This header validates inputs and includes a header needed to handle
+ * Matlab matrices.*/
+#include "MexValidation.h"
+#include "CoordFuncs.hpp"
+#include <vector>
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const double *zENU, *plhSites;
+    size_t numPoints, numSites;
+    size_t numThreads=1;
+    double a, f;
+    std::vector<size_t> siteIdx;
+    const size_t *siteIdxPtr=NULL;
+
+    if(nrhs<2||nrhs>6) {
+        mexErrMsgTxt("Incorrect number of inputs.");
+        return;
+    }
+
+    if(nlhs>1) {
+        mexErrMsgTxt("Wrong number of outputs.");
+        return;
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    numPoints=mxGetN(prhs[0]);
+    if(mxGetM(prhs[0])!=3) {
+        mexErrMsgTxt("The points have the wrong dimensionality.");
+        return;
+    }
+    zENU=reinterpret_cast<double*>(mxGetData(prhs[0]));
+
+    checkRealDoubleArray(prhs[1]);
+    numSites=mxGetN(prhs[1]);
+    if(mxGetM(prhs[1])!=3||numSites<1) {
+        mexErrMsgTxt("The site locations have the wrong dimensionality.");
+        return;
+    }
+    plhSites=reinterpret_cast<double*>(mxGetData(prhs[1]));
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        const double *idxData;
+
+        checkRealDoubleArray(prhs[2]);
+        if(mxGetNumberOfElements(prhs[2])!=numPoints) {
+            mexErrMsgTxt("The number of site indices does not match the number of points.");
+            return;
+        }
+        idxData=reinterpret_cast<double*>(mxGetData(prhs[2]));
+
+        //Convert the Matlab indices, which start at 1, into C++ indices.
+        siteIdx.resize(numPoints);
+        for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+            const double curIdx=idxData[curPoint];
+
+            if(!(curIdx>=1&&curIdx<=static_cast<double>(numSites))||curIdx!=static_cast<double>(static_cast<size_t>(curIdx))) {
+                mexErrMsgTxt("Invalid site index.");
+                return;
+            }
+            siteIdx[curPoint]=static_cast<size_t>(curIdx)-1;
+        }
+        siteIdxPtr=siteIdx.data();
+    } else if(numSites!=1) {
+        mexErrMsgTxt("The site indices must be given when there is more than one site.");
+        return;
+    }
+
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        a=getDoubleFromMatlab(prhs[3]);
+    } else {//Load the default value if none is supplied.
+        a=getScalarMatlabClassConst("Constants","WGS84SemiMajorAxis");
+    }
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        f=getDoubleFromMatlab(prhs[4]);
+    } else {//Load the default value if none is supplied.
+        f=getScalarMatlabClassConst("Constants","WGS84Flattening");
+    }
+
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        numThreads=getSizeTFromMatlab(prhs[5]);
+    }
+
+    //The rotation matrix and the ECEF location of each site are only
+    //computed once.
+    std::vector<double> uSites(9*numSites);
+    std::vector<double> lSites(3*numSites);
+    if(!getENUSiteTransCPP(uSites.data(),lSites.data(),plhSites,numSites,a,f)) {
+        mexErrMsgTxt("A conversion error has occurred.");
+        return;
+    }
+
+    plhs[0]=mxCreateDoubleMatrix(3,numPoints,mxREAL);
+    ENU2CartSitesCPP(reinterpret_cast<double*>(mxGetData(plhs[0])),zENU,numPoints,siteIdxPtr,uSites.data(),lSites.data(),numThreads);
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
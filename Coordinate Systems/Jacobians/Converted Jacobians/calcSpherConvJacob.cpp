@@ -70,7 +70,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     double *zSpher,*lTx,*lRx,*M;
     double lTxLocal[3],lRxLocal[3],MLocal[9];//Only used if not provided.
     int systemType;
-    size_t N,i;
+    size_t N;
     bool useHalfRange;
     mxArray *retMat;
     
@@ -181,11 +181,8 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     }
     retData=reinterpret_cast<double*>(mxGetData(retMat));
     
-    for(i=0;i<N;i++) {
-        calcSpherConvJacobGenCPP(retData,zSpher,systemType,useHalfRange,lTx,lRx,M);
-        zSpher+=3;
-        retData+=9;
-    }
+    //The Jacobians are found without keeping the converted points.
+    spher2CartWithDerivsBatchCPP(NULL,retData,NULL,zSpher,N,systemType,useHalfRange,lTx,0,lRx,0,M,0);
     plhs[0]=retMat;
 }
 
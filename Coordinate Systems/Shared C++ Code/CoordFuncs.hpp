@@ -24,6 +24,37 @@ void Cart2EllipsHarmonCPP(double *pointsHarmon,const double *cartPoints, const s
 void ruv2CartGenCPP(double *retData,const double *z,const bool useHalfRange,const double *zTx,const double *zRx,const double *M, bool hasW);
 void Cart2RuvGenCPP(double *retData,const double *points,bool useHalfRange,double *zTx,double *zRx,double *M,bool includeW);
 
+//Batch versions of the conversions above. See coordConvBatchCPP.cpp.
+void spher2CartBatchCPP(double *retData, const double *points, const size_t numPoints, const size_t systemType, const bool useHalfRange, const double *zTx, const size_t zTxStride, const double *zRx, const size_t zRxStride, const double *M, const size_t MStride);
+void spher2CartNoRangeBatchCPP(double *retData, const double *points, const size_t numPoints, const size_t systemType, const double *M, const size_t MStride);
+void Cart2SphereBatchCPP(double *retData, const double *cartPoints, const size_t pointStride, const size_t numPoints, const size_t systemType, const bool useHalfRange, const double *zTx, const size_t zTxStride, const double *zRx, const size_t zRxStride, const double *M, const size_t MStride);
+void ruv2CartBatchCPP(double *retData, const double *z, const size_t numPoints, const bool hasW, const bool useHalfRange, const double *zTx, const size_t zTxStride, const double *zRx, const size_t zRxStride, const double *M, const size_t MStride);
+void Cart2RuvBatchCPP(double *retData, const double *points, const size_t pointStride, const size_t numPoints, const bool useHalfRange, const double *zTx, const size_t zTxStride, const double *zRx, const size_t zRxStride, const double *M, const size_t MStride, const bool includeW);
+
+//Conversions that also give Jacobians and Hessians in the same pass. See
+//convWithDerivsBatchCPP.cpp.
+void spher2CartWithDerivsBatchCPP(double *zCart, double *J, double *H, const double *zSpher, const size_t numPoints, const size_t systemType, const bool useHalfRange, const double *lTx, const size_t lTxStride, const double *lRx, const size_t lRxStride, const double *M, const size_t MStride);
+void ruv2CartWithDerivsBatchCPP(double *zCart, double *J, double *H, const double *zRuv, const size_t numPoints, const bool hasW, const bool useHalfRange, const double *lTx, const size_t lTxStride, const double *lRx, const size_t lRxStride, const double *M, const size_t MStride);
+void state2SpherRRBatchCPP(double *z, double *J, const double *xTar, const size_t stateStride, const size_t numPoints, const size_t systemType, const bool useHalfRange, const double *xTx, const size_t xTxStride, const double *xRx, const size_t xRxStride, const double *M, const size_t MStride);
+void state2RuvRRBatchCPP(double *z, double *J, const double *xTar, const size_t stateStride, const size_t numPoints, const bool useHalfRange, const double *xTx, const size_t xTxStride, const double *xRx, const size_t xRxStride, const double *M, const size_t MStride, const bool includeW);
+
+//Multithreaded conversions of many points between Cartesian and
+//ellipsoidal coordinates. See ellipsConvCPP.cpp.
+bool Cart2EllipseCPP(double *retData, const double *points, const size_t numVec, const double a, const double f, const int algorithm, const size_t numThreads);
+bool ellips2CartCPP(double *retData, const double *points, const size_t numVec, const double a, const double f, const size_t numThreads);
+
+//Conversions of many points between ECEF coordinates and the ENU
+//coordinate systems of a set of sites. See ENUSiteConvCPP.cpp.
+bool getENUSiteTransCPP(double *uSites, double *lSites, const double *plhSites, const size_t numSites, const double a, const double f);
+void Cart2ENUSitesCPP(double *zENU, const double *zCart, const size_t numPoints, const size_t *siteIdx, const double *uSites, const double *lSites, const size_t numThreads);
+void ENU2CartSitesCPP(double *zCart, const double *zENU, const size_t numPoints, const size_t *siteIdx, const double *uSites, const double *lSites, const size_t numThreads);
+
+//Conversions between the GCRS and the ITRS where each vector can have its
+//own epoch. See GCRSITRSConvCPP.cpp. These require the SOFA library.
+void CIPXYsBatchCPP(double *X, double *Y, double *s, const double *TT1, const double *TT2, const size_t numTimes, const double maxErr);
+void GCRS2ITRSBatchCPP(double *retData, double *rotMats, const double *xVec, const size_t numRow, const size_t numVec, const double *TT1, const double *TT2, const size_t numTimes, const double *deltaTTUT1, const double *xpyp, const double *dXdY, const double *LOD, const double omegaMean, const double maxErr);
+void ITRS2GCRSBatchCPP(double *retData, double *rotMats, const double *xVec, const size_t numRow, const size_t numVec, const double *TT1, const double *TT2, const size_t numTimes, const double *deltaTTUT1, const double *xpyp, const double *dXdY, const double *LOD, const double omegaMean, const double maxErr);
+
 double getRangeRate2DCPP(const double *points,bool useHalfRange,const double *xTx,const double *xRx);
 double getRangeRate3DCPP(const double *xTar,bool useHalfRange,const double *xTx,const double *xRx);
 
@@ -0,0 +1,125 @@
+/**ENUSITECONVCPP Functions to convert many points between global ECEF
+ *   Cartesian coordinates and the local East-North-Up (ENU) coordinate
+ *   systems of a set of sites, such as fixed sensors. The rotation matrix
+ *   and the ECEF origin of each site are found once and the points are
+ *   then transformed in runs that share the same site. Within a run, the
+ *   rotation matrix and origin are constant, so the loop over the points
+ *   is a plain 3X3 multiply that compilers can vectorize. The points are
+ *   split into contiguous chunks over multiple threads. See the Matlab
+ *   implementations of Cart2ENU and ENU2Cart for more details.
+ *
+ *All points are 3XN matrices stored by column as in Matlab. uSites is a
+ *3X3XnumSites set of matrices whose columns are the East, North and Up
+ *unit vectors of each site, as returned by getENUAxesCPP, and lSites is
+ *a 3XnumSites matrix of the ECEF locations of the sites. siteIdx holds the
+ *0-based site index of each point; if it is NULL, then the first site is
+ *used for all of the points. numThreads=0 means that the number of
+ *hardware threads is used.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "CoordFuncs.hpp"
+#include "runChunksCPP.hpp"
+
+//The minimum number of points given to each thread.
+static const size_t minPointsPerThread=4096;
+
+bool getENUSiteTransCPP(double *uSites, double *lSites, const double *plhSites, const size_t numSites, const double a, const double f) {
+    //The return value is false if the ECEF location of a site could not be
+    //found, which only happens for invalid ellipsoids.
+    double c[3];
+
+    for(size_t curSite=0;curSite<numSites;curSite++) {
+        getENUAxesCPP(uSites+9*curSite,c,plhSites+3*curSite,false,a,f);
+    }
+
+    return ellips2CartCPP(lSites,plhSites,numSites,a,f,1);
+}
+
+/*Apply the transformation of one site to numInRun points. If toLocal is
+ *true, then zOut=u'*(zIn-l), otherwise zOut=u*zIn+l.*/
+template<bool toLocal>
+static void ENUSiteRun(double *zOut, const double *zIn, const size_t numInRun, const double *u, const double *l) {
+    const double u11=u[0], u21=u[1], u31=u[2];
+    const double u12=u[3], u22=u[4], u32=u[5];
+    const double u13=u[6], u23=u[7], u33=u[8];
+    const double l1=l[0], l2=l[1], l3=l[2];
+
+    for(size_t i=0;i<numInRun;i++) {
+        const double z1=zIn[3*i];
+        const double z2=zIn[3*i+1];
+        const double z3=zIn[3*i+2];
+
+        if(toLocal) {
+            const double d1=z1-l1;
+            const double d2=z2-l2;
+            const double d3=z3-l3;
+
+            zOut[3*i]=u11*d1+u21*d2+u31*d3;
+            zOut[3*i+1]=u12*d1+u22*d2+u32*d3;
+            zOut[3*i+2]=u13*d1+u23*d2+u33*d3;
+        } else {
+            zOut[3*i]=u11*z1+u12*z2+u13*z3+l1;
+            zOut[3*i+1]=u21*z1+u22*z2+u23*z3+l2;
+            zOut[3*i+2]=u31*z1+u32*z2+u33*z3+l3;
+        }
+    }
+}
+
+template<bool toLocal>
+static void ENUSiteChunk(double *zOut, const double *zIn, const size_t numPoints, const size_t *siteIdx, const double *uSites, const double *lSites) {
+    if(siteIdx==NULL) {
+        ENUSiteRun<toLocal>(zOut,zIn,numPoints,uSites,lSites);
+        return;
+    }
+
+    size_t runStart=0;
+    while(runStart<numPoints) {
+        const size_t curSite=siteIdx[runStart];
+        size_t runEnd=runStart+1;
+
+        while(runEnd<numPoints&&siteIdx[runEnd]==curSite) {
+            runEnd++;
+        }
+
+        ENUSiteRun<toLocal>(zOut+3*runStart,zIn+3*runStart,runEnd-runStart,uSites+9*curSite,lSites+3*curSite);
+        runStart=runEnd;
+    }
+}
+
+template<bool toLocal>
+static void ENUSiteConv(double *zOut, const double *zIn, const size_t numPoints, const size_t *siteIdx, const double *uSites, const double *lSites, const size_t numThreads) {
+    runChunksCPP(numPoints,numThreads,minPointsPerThread,[=](const size_t startIdx, const size_t endIdx) {
+        const size_t *chunkIdx=(siteIdx==NULL)?NULL:siteIdx+startIdx;
+
+        ENUSiteChunk<toLocal>(zOut+3*startIdx,zIn+3*startIdx,endIdx-startIdx,chunkIdx,uSites,lSites);
+    });
+}
+
+void Cart2ENUSitesCPP(double *zENU, const double *zCart, const size_t numPoints, const size_t *siteIdx, const double *uSites, const double *lSites, const size_t numThreads) {
+    ENUSiteConv<true>(zENU,zCart,numPoints,siteIdx,uSites,lSites,numThreads);
+}
+
+void ENU2CartSitesCPP(double *zCart, const double *zENU, const size_t numPoints, const size_t *siteIdx, const double *uSites, const double *lSites, const size_t numThreads) {
+    ENUSiteConv<false>(zCart,zENU,numPoints,siteIdx,uSites,lSites,numThreads);
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,354 @@
+/**GCRSITRSCONVCPP Functions to convert many position and velocity vectors
+ *   between the Geocentric Celestial Reference System (GCRS) and the
+ *   International Terrestrial Reference System (ITRS) when each vector can
+ *   have its own epoch. See the comments to the GCRS2ITRS and ITRS2GCRS
+ *   MEX files for more details on the conversions.
+ *
+ *Most of the cost of a conversion lies in iauXys06a, which evaluates the
+ *full IAU 2006/2000A precession-nutation series to get the coordinates X,Y
+ *of the Celestial Intermediate Pole (CIP) and the Celestial Intermediate
+ *Origin (CIO) locator s. When there are many epochs, CIPXYsBatchCPP
+ *instead evaluates iauXys06a at the Chebyshev nodes of equal-length
+ *segments spanning the epochs and interpolates X, Y and s with Chebyshev
+ *polynomials. Each segment is checked against iauXys06a at the points
+ *between the nodes and its last two coefficients are also checked. If
+ *either exceeds maxErr, the segment length is halved and the table is
+ *rebuilt. The table is only used if it needs fewer series evaluations
+ *than evaluating each epoch directly; otherwise, and if the segments would
+ *become too short, iauXys06a is called for each epoch. Epochs that are not
+ *finite are left out of the table and passed to iauXys06a directly.
+ *
+ *Times are two-part Julian dates in terrestrial time (TT). The Earth
+ *orientation parameters (EOP) are given for each epoch. deltaTTUT1 and LOD
+ *are in seconds and xpyp and dXdY are 2XnumTimes matrices in radians.
+ *If numTimes=1, then the same epoch is used for all of the vectors.
+ *Otherwise, numTimes=numVec. If rotMats is not NULL, the 3X3 rotation
+ *matrices used for the positions are saved in it by column.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "CoordFuncs.hpp"
+/*This header is for the SOFA library.*/
+#include "sofa.h"
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+//The degree of the Chebyshev polynomial on each segment.
+static const size_t chebDeg=12;
+//The initial length of a segment in TT days. The shortest periods of the
+//nutation series are a few days.
+static const double initSegLength=4.0;
+//Segments are not made shorter than this many TT days.
+static const double minSegLength=1.0/16.0;
+
+namespace {
+struct CIPTable {
+    //The epochs are given relative to the first finite epoch.
+    double tRef1, tRef2;
+    double tStart, segLength;
+    size_t numSeg;
+    //The coefficients of X, Y and s on segment k are at
+    //coeffs[3*(chebDeg+1)*k+(chebDeg+1)*i] for i=0,1,2.
+    std::vector<double> coeffs;
+};
+}
+
+static double relTime(const double *TT1, const double *TT2, const size_t refIdx, const size_t idx) {
+    return (TT1[idx]-TT1[refIdx])+(TT2[idx]-TT2[refIdx]);
+}
+
+//Evaluate a Chebyshev series of degree chebDeg at u in [-1,1] using
+//Clenshaw's recurrence.
+static double evalCheb(const double *c, const double u) {
+    double b1=0.0;
+    double b2=0.0;
+
+    for(size_t k=chebDeg;k>0;k--) {
+        const double b0=2.0*u*b1-b2+c[k];
+        b2=b1;
+        b1=b0;
+    }
+
+    return u*b1-b2+c[0];
+}
+
+/*Fill in the coefficients of all of the segments of the table. The return
+ *value is false if any segment does not meet maxErr.*/
+static bool fillCIPTable(CIPTable &table, const double maxErr) {
+    const size_t numNodes=chebDeg+1;
+    const double pi=3.14159265358979323846;
+    double fVals[3][chebDeg+1];
+
+    table.coeffs.resize(3*numNodes*table.numSeg);
+
+    for(size_t curSeg=0;curSeg<table.numSeg;curSeg++) {
+        const double tMid=table.tStart+(static_cast<double>(curSeg)+0.5)*table.segLength;
+        const double halfLength=0.5*table.segLength;
+        double *c=table.coeffs.data()+3*numNodes*curSeg;
+
+        //Evaluate the series at the Chebyshev nodes.
+        for(size_t j=0;j<numNodes;j++) {
+            const double u=cos(pi*(static_cast<double>(j)+0.5)/numNodes);
+
+            iauXys06a(table.tRef1,table.tRef2+tMid+halfLength*u,&fVals[0][j],&fVals[1][j],&fVals[2][j]);
+        }
+
+        for(size_t i=0;i<3;i++) {
+            for(size_t k=0;k<numNodes;k++) {
+                double sumVal=0.0;
+
+                for(size_t j=0;j<numNodes;j++) {
+                    sumVal+=fVals[i][j]*cos(pi*static_cast<double>(k)*(static_cast<double>(j)+0.5)/numNodes);
+                }
+                c[numNodes*i+k]=(2.0/numNodes)*sumVal;
+            }
+            c[numNodes*i]*=0.5;
+
+            //The size of the last terms bounds the truncation error if
+            //the coefficients are decaying.
+            if(fabs(c[numNodes*i+chebDeg-1])+fabs(c[numNodes*i+chebDeg])>maxErr) {
+                return false;
+            }
+        }
+
+        //Check the interpolated values halfway between the nodes.
+        for(size_t j=0;j<chebDeg;j++) {
+            const double u=cos(pi*(static_cast<double>(j)+1.0)/numNodes);
+            double trueVals[3];
+
+            iauXys06a(table.tRef1,table.tRef2+tMid+halfLength*u,&trueVals[0],&trueVals[1],&trueVals[2]);
+
+            for(size_t i=0;i<3;i++) {
+                if(fabs(evalCheb(c+numNodes*i,u)-trueVals[i])>maxErr) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void CIPXYsBatchCPP(double *X, double *Y, double *s, const double *TT1, const double *TT2, const size_t numTimes, const double maxErr) {
+    //Each segment costs this many evaluations of iauXys06a to build.
+    const size_t evalsPerSeg=2*chebDeg+1;
+    size_t refIdx=0;
+    size_t numFinite=0;
+    double tMin=0.0;
+    double tMax=0.0;
+    CIPTable table;
+
+    //Non-finite epochs are skipped when finding the span of the table.
+    while(refIdx<numTimes&&!(std::isfinite(TT1[refIdx])&&std::isfinite(TT2[refIdx]))) {
+        refIdx++;
+    }
+    for(size_t curTime=refIdx;curTime<numTimes;curTime++) {
+        const double t=relTime(TT1,TT2,refIdx,curTime);
+
+        if(std::isfinite(t)) {
+            tMin=std::min(tMin,t);
+            tMax=std::max(tMax,t);
+            numFinite++;
+        }
+    }
+
+    table.numSeg=0;
+    if(numFinite>0) {
+        //This is compared as a double so that a huge span can not
+        //overflow a size_t.
+        const double numSegVal=std::max(1.0,ceil((tMax-tMin)/initSegLength));
+
+        if(numSegVal*static_cast<double>(evalsPerSeg)<static_cast<double>(numFinite)) {
+            table.numSeg=static_cast<size_t>(numSegVal);
+        }
+        table.tRef1=TT1[refIdx];
+        table.tRef2=TT2[refIdx];
+        table.tStart=tMin;
+    }
+
+    while(table.numSeg>0&&numFinite>evalsPerSeg*table.numSeg) {
+        //Pad the span slightly so that tMax falls inside the last
+        //segment.
+        table.segLength=(tMax-tMin)/static_cast<double>(table.numSeg)*(1.0+1e-12)+1e-12;
+
+        if(fillCIPTable(table,maxErr)) {
+            const size_t numNodes=chebDeg+1;
+
+            for(size_t curTime=0;curTime<numTimes;curTime++) {
+                const double t=relTime(TT1,TT2,refIdx,curTime);
+
+                if(!std::isfinite(t)) {
+                    iauXys06a(TT1[curTime],TT2[curTime],X+curTime,Y+curTime,s+curTime);
+                    continue;
+                }
+
+                const double tOffset=(t-table.tStart)/table.segLength;
+                const size_t curSeg=std::min(table.numSeg-1,static_cast<size_t>(tOffset));
+                const double u=2.0*(tOffset-static_cast<double>(curSeg))-1.0;
+                const double *c=table.coeffs.data()+3*numNodes*curSeg;
+
+                X[curTime]=evalCheb(c,u);
+                Y[curTime]=evalCheb(c+numNodes,u);
+                s[curTime]=evalCheb(c+2*numNodes,u);
+            }
+            return;
+        }
+
+        if(table.segLength<2.0*minSegLength) {
+            break;
+        }
+        table.numSeg*=2;
+    }
+
+    //Evaluate the full series for each epoch.
+    for(size_t curTime=0;curTime<numTimes;curTime++) {
+        iauXys06a(TT1[curTime],TT2[curTime],X+curTime,Y+curTime,s+curTime);
+    }
+}
+
+namespace {
+//The rotations for a single epoch.
+struct EarthRotMats {
+    double GCRS2ITRS[3][3];
+    double GCRS2TIRS[3][3];
+    double rpom[3][3];//Polar motion matrix. ITRS=POM*TIRS.
+    double omega;//The rotation rate of the Earth in the TIRS.
+};
+}
+
+static void getEarthRotMats(EarthRotMats &mats, const double X, const double Y, const double s, const double TT1, const double TT2, const double deltaTTUT1, const double *xpyp, const double *dXdY, const double LOD, const double omegaMean) {
+    double rident[3][3]={{1,0,0},{0,1,0},{0,0,1}};
+    double UT11, UT12;
+    double rc2i[3][3];
+
+    //Obtain UT1 from terestrial time and deltaT.
+    iauTtut1(TT1,TT2,deltaTTUT1,&UT11,&UT12);
+
+    //Get the GCRS-to-CIRS matrix with the CIP offsets added.
+    iauC2ixys(X+dXdY[0],Y+dXdY[1],s,rc2i);
+
+    //Get the polar motion matrix using the Terrestrial Intermediate Origin
+    //(TIO) locator s'.
+    iauPom00(xpyp[0],xpyp[1],iauSp00(TT1,TT2),mats.rpom);
+
+    {
+        const double era=iauEra00(UT11,UT12);
+
+        iauC2tcio(rc2i,era,mats.rpom,mats.GCRS2ITRS);
+        //Leaving out polar motion gives the rotation into the TIRS.
+        iauC2tcio(rc2i,era,rident,mats.GCRS2TIRS);
+    }
+
+    //Adjust for LOD. 86400.0 is the number of seconds in a TT day.
+    mats.omega=omegaMean*(1-LOD/86400.0);
+}
+
+/*Get the rotations for epoch curTime and save the rotation matrix for the
+ *positions in rotMats if it is not NULL.*/
+template<bool toITRS>
+static void setEpochRotMats(EarthRotMats &mats, double *rotMats, const size_t curTime, const double *X, const double *Y, const double *s, const double *TT1, const double *TT2, const double *deltaTTUT1, const double *xpyp, const double *dXdY, const double *LOD, const double omegaMean) {
+    getEarthRotMats(mats,X[curTime],Y[curTime],s[curTime],TT1[curTime],TT2[curTime],deltaTTUT1[curTime],xpyp+2*curTime,dXdY+2*curTime,LOD[curTime],omegaMean);
+
+    if(rotMats!=NULL) {
+        double *R=rotMats+9*curTime;
+
+        for(size_t i=0;i<3;i++) {
+            for(size_t j=0;j<3;j++) {
+                R[i+3*j]=toITRS?mats.GCRS2ITRS[i][j]:mats.GCRS2ITRS[j][i];
+            }
+        }
+    }
+}
+
+/*Convert the vectors between the GCRS and the ITRS. If toITRS is false,
+ *the inverse conversion is done.*/
+template<bool toITRS>
+static void GCRSITRSBatch(double *retData, double *rotMats, const double *xVec, const size_t numRow, const size_t numVec, const double *TT1, const double *TT2, const size_t numTimes, const double *deltaTTUT1, const double *xpyp, const double *dXdY, const double *LOD, const double omegaMean, const double maxErr) {
+    std::vector<double> XYs(3*numTimes);
+    double *X=XYs.data();
+    double *Y=X+numTimes;
+    double *s=Y+numTimes;
+    EarthRotMats mats;
+
+    CIPXYsBatchCPP(X,Y,s,TT1,TT2,numTimes,maxErr);
+
+    //With a single epoch, the rotations are found once, even if there are
+    //no vectors, so that rotMats is always set.
+    if(numTimes==1) {
+        setEpochRotMats<toITRS>(mats,rotMats,0,X,Y,s,TT1,TT2,deltaTTUT1,xpyp,dXdY,LOD,omegaMean);
+    }
+
+    for(size_t curVec=0;curVec<numVec;curVec++) {
+        double *ret=retData+numRow*curVec;
+        const size_t curTime=(numTimes==1)?0:curVec;
+        //The SOFA functions do not take const inputs.
+        double x[6];
+
+        for(size_t i=0;i<numRow;i++) {
+            x[i]=xVec[numRow*curVec+i];
+        }
+
+        if(numTimes>1) {
+            setEpochRotMats<toITRS>(mats,rotMats,curTime,X,Y,s,TT1,TT2,deltaTTUT1,xpyp,dXdY,LOD,omegaMean);
+        }
+
+        if(toITRS) {
+            iauRxp(mats.GCRS2ITRS,x,ret);
+        } else {
+            iauTrxp(mats.GCRS2ITRS,x,ret);
+        }
+
+        //If a velocity vector was given, go through the TIRS, where the
+        //rotational axis of the Earth is the z-axis, and account for the
+        //rotation of the Earth there.
+        if(numRow>3) {
+            double Omega[3]={0,0,mats.omega};
+            double posTIRS[3], velTIRS[3], rotVel[3];
+
+            if(toITRS) {
+                iauRxp(mats.GCRS2TIRS,x,posTIRS);
+                iauRxp(mats.GCRS2TIRS,x+3,velTIRS);
+                iauPxp(Omega,posTIRS,rotVel);
+                //Subtract out the instantaneous velocity due to rotation.
+                iauPmp(velTIRS,rotVel,velTIRS);
+                iauRxp(mats.rpom,velTIRS,ret+3);
+            } else {
+                iauTrxp(mats.rpom,x,posTIRS);
+                iauTrxp(mats.rpom,x+3,velTIRS);
+                iauPxp(Omega,posTIRS,rotVel);
+                //Add the instantaneous velocity due to rotation.
+                iauPpp(velTIRS,rotVel,velTIRS);
+                iauTrxp(mats.GCRS2TIRS,velTIRS,ret+3);
+            }
+        }
+    }
+}
+
+void GCRS2ITRSBatchCPP(double *retData, double *rotMats, const double *xVec, const size_t numRow, const size_t numVec, const double *TT1, const double *TT2, const size_t numTimes, const double *deltaTTUT1, const double *xpyp, const double *dXdY, const double *LOD, const double omegaMean, const double maxErr) {
+    GCRSITRSBatch<true>(retData,rotMats,xVec,numRow,numVec,TT1,TT2,numTimes,deltaTTUT1,xpyp,dXdY,LOD,omegaMean,maxErr);
+}
+
+void ITRS2GCRSBatchCPP(double *retData, double *rotMats, const double *xVec, const size_t numRow, const size_t numVec, const double *TT1, const double *TT2, const size_t numTimes, const double *deltaTTUT1, const double *xpyp, const double *dXdY, const double *LOD, const double omegaMean, const double maxErr) {
+    GCRSITRSBatch<false>(retData,rotMats,xVec,numRow,numVec,TT1,TT2,numTimes,deltaTTUT1,xpyp,dXdY,LOD,omegaMean,maxErr);
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,679 @@
+/**CONVWITHDERIVSBATCHCPP Functions that convert many measurements or
+ *   states at once and also give the derivatives needed for filtering in
+ *   a single pass over each point.
+ *
+ *spher2CartWithDerivsBatchCPP and ruv2CartWithDerivsBatchCPP convert
+ *bistatic spherical or r-u-v measurements to Cartesian coordinates and
+ *give the Jacobians and optionally the Hessians of the measurements with
+ *respect to Cartesian position at the converted points. The results are
+ *the same as calling spher2CartGenCPP, calcSpherConvJacobGenCPP and
+ *calcSpherConvHessianGenCPP (or the r-u-v equivalents in Matlab) for each
+ *point, to within finite precision errors. However, those each convert the
+ *point to Cartesian coordinates and then back to the local coordinate
+ *system of the receiver. Here, the local point is r1*uVec, where r1 is the
+ *range from the receiver and uVec is the local unit vector of the
+ *direction, so the sines and cosines of the angles and the unit vector
+ *used in the conversion are reused for the derivatives of the angles and
+ *the range from the receiver.
+ *
+ *state2SpherRRBatchCPP and state2RuvRRBatchCPP convert Cartesian states
+ *with position and velocity to bistatic spherical or r-u-v measurements
+ *with range rate, as in the Matlab functions state2SpherRR and
+ *state2RuvRR, and optionally give the 4X6 Jacobians of [r;az;el;rr] or
+ *[r;u;v;rr] with respect to the state, as in calcSpherRRJacob and
+ *calcRuvRRJacob. The unit vectors from the transmitter and the receiver to
+ *the target and their lengths are shared by the range, the angles, the
+ *range rate and all of their derivatives.
+ *
+ *As in coordConvBatchCPP.cpp, the loops are templates instantiated for
+ *each coordinate system type and for the monostatic case, where the
+ *transmitter and the receiver are the same array with the same stride or a
+ *single transmitter and receiver have the same location (and velocity for
+ *states). In the monostatic case, the transmitter terms are not computed.
+ *
+ *All points, states, sensors and M are stored as in Matlab, one column
+ *after the other. The strides of the sensors and M are the number of
+ *elements between the values for consecutive points, with a stride of 0
+ *meaning that the same value is used for all points. stateStride is the
+ *number of rows of the states, which must be at least 6. J and H can be
+ *NULL if the Jacobians or Hessians are not desired. zCart can also be NULL
+ *in the conversions of measurements if only the derivatives are desired.
+ *J is 3X3XN for measurements and 4X6XN for states, with the components of
+ *the measurement by row and the derivatives by column. H is 3X3X3XN with
+ *H(:,:,1,i) the Hessian of the range of point i and H(:,:,2,i) and
+ *H(:,:,3,i) those of the angles or of u and v.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "CoordFuncs.hpp"
+//For sin, cos, atan2, asin and sqrt.
+#include <math.h>
+
+static bool convDerivsIsMonostatic(const double *lTx, const size_t lTxStride, const double *lRx, const size_t lRxStride, const size_t numCompare) {
+    if(lTx==lRx&&lTxStride==lRxStride) {
+        return true;
+    }
+
+    if(lTxStride!=0||lRxStride!=0) {
+        return false;
+    }
+
+    for(size_t k=0;k<numCompare;k++) {
+        if(lTx[k]!=lRx[k]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//Set retVec=vec*M, where vec is a row vector.
+static inline void rowTimesM(double *retVec, const double *vec, const double *M) {
+    retVec[0]=vec[0]*M[0]+vec[1]*M[1]+vec[2]*M[2];
+    retVec[1]=vec[0]*M[3]+vec[1]*M[4]+vec[2]*M[5];
+    retVec[2]=vec[0]*M[6]+vec[1]*M[7]+vec[2]*M[8];
+}
+
+//Set HOut=M'*H*M.
+static void rotateHessian(double *HOut, const double *H, const double *M) {
+    double HM[9];
+
+    for(size_t col=0;col<3;col++) {
+        for(size_t row=0;row<3;row++) {
+            HM[row+3*col]=H[row]*M[3*col]+H[row+3]*M[1+3*col]+H[row+6]*M[2+3*col];
+        }
+    }
+
+    for(size_t col=0;col<3;col++) {
+        for(size_t row=0;row<3;row++) {
+            HOut[row+3*col]=M[3*row]*HM[3*col]+M[1+3*row]*HM[1+3*col]+M[2+3*row]*HM[2+3*col];
+        }
+    }
+}
+
+//Add scale*(I-n*n')/normVal to H, which is the Hessian of the length of
+//a vector in direction n with length normVal.
+static inline void addRangeHessian(double *H, const double *n, const double normVal, const double scale) {
+    const double c=scale/normVal;
+
+    for(size_t col=0;col<3;col++) {
+        for(size_t row=0;row<3;row++) {
+            H[row+3*col]+=c*((row==col?1.0:0.0)-n[row]*n[col]);
+        }
+    }
+}
+
+//The local unit vector in the direction of the angles and the gradients
+//of the angles with respect to the local position of a point at unit
+//range.
+template<size_t systemType>
+static inline void spherUnitVecWithGrads(double *uVec, double *dAz, double *dEl, const double azimuth, const double angle) {
+    double elevation=angle;
+
+    if(systemType==2) {
+        const double pi=acos(-1.0);
+        elevation=pi/2.0-angle;
+    }
+
+    const double sinAz=sin(azimuth);
+    const double cosAz=cos(azimuth);
+    const double sinEl=sin(elevation);
+    const double cosEl=cos(elevation);
+
+    if(systemType==1) {
+        uVec[0]=sinAz*cosEl;
+        uVec[1]=sinEl;
+        uVec[2]=cosAz*cosEl;
+
+        dAz[0]=cosAz/cosEl;
+        dAz[1]=0;
+        dAz[2]=-sinAz/cosEl;
+
+        dEl[0]=-sinEl*sinAz;
+        dEl[1]=cosEl;
+        dEl[2]=-sinEl*cosAz;
+    } else {
+        uVec[0]=cosAz*cosEl;
+        uVec[1]=sinAz*cosEl;
+        uVec[2]=sinEl;
+
+        dAz[0]=-sinAz/cosEl;
+        dAz[1]=cosAz/cosEl;
+        dAz[2]=0;
+
+        //The angle from the z-axis in systemType 2 is pi/2 minus the
+        //elevation.
+        const double elSign=(systemType==2)?-1.0:1.0;
+        dEl[0]=-elSign*sinEl*cosAz;
+        dEl[1]=-elSign*sinEl*sinAz;
+        dEl[2]=elSign*cosEl;
+    }
+}
+
+//Given the bistatic range rB and the local direction uVec of a point, find
+//the range from the receiver r1, the Cartesian point zC, the global unit
+//vector from the receiver to the point g and the unit vector nTx and range
+//rTx from the transmitter to the point. The transmitter terms are not set
+//in the monostatic case.
+template<bool isMonostatic>
+static inline void rangeDirGeometry(double &r1, double *zC, double *g, double *nTx, double &rTx, const double rB, const double *uVec, const double *lTx, const double *lRx, const double *M) {
+    if(isMonostatic) {
+        r1=rB/2;
+    } else {
+        const double diff0=lTx[0]-lRx[0];
+        const double diff1=lTx[1]-lRx[1];
+        const double diff2=lTx[2]-lRx[2];
+        double lTxL[3];
+
+        //lTxL=M*(lTx-lRx);
+        lTxL[0]=M[0]*diff0+M[3]*diff1+M[6]*diff2;
+        lTxL[1]=M[1]*diff0+M[4]*diff1+M[7]*diff2;
+        lTxL[2]=M[2]*diff0+M[5]*diff1+M[8]*diff2;
+
+        //r1=(r^2-norm(lTxL)^2)/(2*(r-dot(uVec,lTxL)));
+        r1=(rB*rB-(lTxL[0]*lTxL[0]+lTxL[1]*lTxL[1]+lTxL[2]*lTxL[2]))/(2*(rB-uVec[0]*lTxL[0]-uVec[1]*lTxL[1]-uVec[2]*lTxL[2]));
+    }
+
+    //g=M'*uVec;
+    g[0]=M[0]*uVec[0]+M[1]*uVec[1]+M[2]*uVec[2];
+    g[1]=M[3]*uVec[0]+M[4]*uVec[1]+M[5]*uVec[2];
+    g[2]=M[6]*uVec[0]+M[7]*uVec[1]+M[8]*uVec[2];
+
+    zC[0]=r1*g[0]+lRx[0];
+    zC[1]=r1*g[1]+lRx[1];
+    zC[2]=r1*g[2]+lRx[2];
+
+    if(!isMonostatic) {
+        nTx[0]=zC[0]-lTx[0];
+        nTx[1]=zC[1]-lTx[1];
+        nTx[2]=zC[2]-lTx[2];
+        rTx=sqrt(nTx[0]*nTx[0]+nTx[1]*nTx[1]+nTx[2]*nTx[2]);
+        nTx[0]/=rTx;
+        nTx[1]/=rTx;
+        nTx[2]/=rTx;
+    }
+}
+
+//Set the range row of a 3X3 Jacobian and the range Hessian of a
+//measurement.
+template<bool isMonostatic>
+static inline void rangeDerivs(double *J, double *H, const double *g, const double r1, const double *nTx, const double rTx, const double scale) {
+    if(J!=NULL) {
+        for(size_t k=0;k<3;k++) {
+            J[3*k]=isMonostatic?2*scale*g[k]:scale*(g[k]+nTx[k]);
+        }
+    }
+
+    if(H!=NULL) {
+        for(size_t k=0;k<9;k++) {
+            H[k]=0;
+        }
+        addRangeHessian(H,g,r1,isMonostatic?2*scale:scale);
+        if(!isMonostatic) {
+            addRangeHessian(H,nTx,rTx,scale);
+        }
+    }
+}
+
+template<size_t systemType, bool isMonostatic>
+static void spher2CartWithDerivsKernel(double *zCart, double *J, double *H, const double *zSpher, const size_t numPoints, const bool useHalfRange, const double *lTx, const size_t lTxStride, const double *lRx, const size_t lRxStride, const double *M, const size_t MStride) {
+    const double rScale=useHalfRange?2.0:1.0;
+    //The derivatives of the reported range are those of the bistatic
+    //range divided by rScale.
+    const double derivScale=1.0/rScale;
+
+    for(size_t i=0;i<numPoints;i++) {
+        const double *point=zSpher+3*i;
+        const double *lTxCur=lTx+i*lTxStride;
+        const double *lRxCur=lRx+i*lRxStride;
+        const double *MCur=M+i*MStride;
+        double uVec[3], dAzL[3], dElL[3], g[3], nTx[3], zC[3];
+        double r1, rTx=0;
+
+        spherUnitVecWithGrads<systemType>(uVec,dAzL,dElL,point[1],point[2]);
+        rangeDirGeometry<isMonostatic>(r1,zC,g,nTx,rTx,rScale*point[0],uVec,lTxCur,lRxCur,MCur);
+
+        if(zCart!=NULL) {
+            zCart[3*i]=zC[0];
+            zCart[3*i+1]=zC[1];
+            zCart[3*i+2]=zC[2];
+        }
+
+        if(J!=NULL) {
+            double *JCur=J+9*i;
+            double dAz[3], dEl[3];
+
+            for(size_t k=0;k<3;k++) {
+                dAzL[k]/=r1;
+                dElL[k]/=r1;
+            }
+            //Rotate from local back to global coordinates.
+            rowTimesM(dAz,dAzL,MCur);
+            rowTimesM(dEl,dElL,MCur);
+
+            rangeDerivs<isMonostatic>(JCur,NULL,g,r1,nTx,rTx,derivScale);
+            for(size_t k=0;k<3;k++) {
+                JCur[1+3*k]=dAz[k];
+                JCur[2+3*k]=dEl[k];
+            }
+        }
+
+        if(H!=NULL) {
+            double *HCur=H+27*i;
+            double xL[3], HL[18];
+
+            rangeDerivs<isMonostatic>(NULL,HCur,g,r1,nTx,rTx,derivScale);
+
+            xL[0]=r1*uVec[0];
+            xL[1]=r1*uVec[1];
+            xL[2]=r1*uVec[2];
+            spherAngHessianCPP(HL,xL,systemType);
+            rotateHessian(HCur+9,HL,MCur);
+            rotateHessian(HCur+18,HL+9,MCur);
+        }
+    }
+}
+
+template<bool hasW, bool isMonostatic>
+static void ruv2CartWithDerivsKernel(double *zCart, double *J, double *H, const double *zRuv, const size_t numPoints, const bool useHalfRange, const double *lTx, const size_t lTxStride, const double *lRx, const size_t lRxStride, const double *M, const size_t MStride) {
+    const size_t pointStride=hasW?4:3;
+    const double rScale=useHalfRange?2.0:1.0;
+    const double derivScale=1.0/rScale;
+
+    for(size_t i=0;i<numPoints;i++) {
+        const double *point=zRuv+i*pointStride;
+        const double *lTxCur=lTx+i*lTxStride;
+        const double *lRxCur=lRx+i*lRxStride;
+        const double *MCur=M+i*MStride;
+        double uVec[3], g[3], nTx[3], zC[3];
+        double r1, rTx=0;
+
+        if(hasW) {
+            uVec[0]=point[1];
+            uVec[1]=point[2];
+            uVec[2]=point[3];
+        } else {
+            //Normalize overly large u-v values as in ruv2CartGenCPP.
+            const double u=point[1];
+            const double v=point[2];
+            const double uvMag2=u*u+v*v;
+
+            if(uvMag2>1) {
+                const double uvMag=sqrt(uvMag2);
+                uVec[0]=u/uvMag;
+                uVec[1]=v/uvMag;
+                uVec[2]=0;
+            } else {
+                uVec[0]=u;
+                uVec[1]=v;
+                uVec[2]=sqrt(1.0-uvMag2);
+            }
+        }
+
+        rangeDirGeometry<isMonostatic>(r1,zC,g,nTx,rTx,rScale*point[0],uVec,lTxCur,lRxCur,MCur);
+
+        if(zCart!=NULL) {
+            zCart[3*i]=zC[0];
+            zCart[3*i+1]=zC[1];
+            zCart[3*i+2]=zC[2];
+        }
+
+        if(J!=NULL) {
+            double *JCur=J+9*i;
+            double duL[3], dvL[3], du[3], dv[3];
+
+            //In local coordinates, the gradient of u is (e1-u*uVec)/r1 and
+            //that of v is (e2-v*uVec)/r1.
+            for(size_t k=0;k<3;k++) {
+                duL[k]=((k==0?1.0:0.0)-uVec[0]*uVec[k])/r1;
+                dvL[k]=((k==1?1.0:0.0)-uVec[1]*uVec[k])/r1;
+            }
+            rowTimesM(du,duL,MCur);
+            rowTimesM(dv,dvL,MCur);
+
+            rangeDerivs<isMonostatic>(JCur,NULL,g,r1,nTx,rTx,derivScale);
+            for(size_t k=0;k<3;k++) {
+                JCur[1+3*k]=du[k];
+                JCur[2+3*k]=dv[k];
+            }
+        }
+
+        if(H!=NULL) {
+            double *HCur=H+27*i;
+            const double r12=r1*r1;
+            double HL[9];
+
+            rangeDerivs<isMonostatic>(NULL,HCur,g,r1,nTx,rTx,derivScale);
+
+            //The local Hessian of the direction cosine along axis a is
+            //(3*n_a*n_j*n_k-delta_ak*n_j-delta_aj*n_k-n_a*delta_jk)/r1^2
+            //with n=uVec.
+            for(size_t a=0;a<2;a++) {
+                for(size_t k=0;k<3;k++) {
+                    for(size_t j=0;j<3;j++) {
+                        double val=3*uVec[a]*uVec[j]*uVec[k];
+
+                        if(a==k) {
+                            val-=uVec[j];
+                        }
+                        if(a==j) {
+                            val-=uVec[k];
+                        }
+                        if(j==k) {
+                            val-=uVec[a];
+                        }
+                        HL[j+3*k]=val/r12;
+                    }
+                }
+                rotateHessian(HCur+9*(a+1),HL,MCur);
+            }
+        }
+    }
+}
+
+//The shared terms of the bistatic range and range rate of a target state
+//and their derivatives. nRx and nTx are the unit vectors from the receiver
+//and the transmitter to the target, rRx and rTx are the distances and
+//dvRx and dvTx are the velocities of the target relative to the receiver
+//and the transmitter. The transmitter terms are not set in the monostatic
+//case.
+struct stateRRGeometry {
+    double nRx[3], nTx[3], rRx, rTx, dvRx[3], dvTx[3];
+
+    template<bool isMonostatic>
+    void set(const double *xTar, const double *xTx, const double *xRx) {
+        for(size_t k=0;k<3;k++) {
+            nRx[k]=xTar[k]-xRx[k];
+            dvRx[k]=xTar[k+3]-xRx[k+3];
+        }
+        rRx=sqrt(nRx[0]*nRx[0]+nRx[1]*nRx[1]+nRx[2]*nRx[2]);
+
+        if(!isMonostatic) {
+            for(size_t k=0;k<3;k++) {
+                nTx[k]=xTar[k]-xTx[k];
+                dvTx[k]=xTar[k+3]-xTx[k+3];
+            }
+            rTx=sqrt(nTx[0]*nTx[0]+nTx[1]*nTx[1]+nTx[2]*nTx[2]);
+        }
+
+        for(size_t k=0;k<3;k++) {
+            nRx[k]/=rRx;
+            if(!isMonostatic) {
+                nTx[k]/=rTx;
+            }
+        }
+    }
+
+    //Set the bistatic range, range rate, the range and range rate rows
+    //of the 4X6 Jacobian J and return the local position of the target.
+    template<bool isMonostatic>
+    void rangeTerms(double &r, double &rr, double *J, double *xL, const double *M, const double scale) const {
+        const double dotRx=nRx[0]*dvRx[0]+nRx[1]*dvRx[1]+nRx[2]*dvRx[2];
+        double dotTx;
+
+        //xL=M*(xTar(1:3)-xRx(1:3));
+        xL[0]=rRx*(M[0]*nRx[0]+M[3]*nRx[1]+M[6]*nRx[2]);
+        xL[1]=rRx*(M[1]*nRx[0]+M[4]*nRx[1]+M[7]*nRx[2]);
+        xL[2]=rRx*(M[2]*nRx[0]+M[5]*nRx[1]+M[8]*nRx[2]);
+
+        if(isMonostatic) {
+            r=2*scale*rRx;
+            rr=2*scale*dotRx;
+        } else {
+            dotTx=nTx[0]*dvTx[0]+nTx[1]*dvTx[1]+nTx[2]*dvTx[2];
+            r=scale*(rRx+rTx);
+            rr=scale*(dotRx+dotTx);
+        }
+
+        if(J==NULL) {
+            return;
+        }
+
+        for(size_t k=0;k<3;k++) {
+            //The derivative of the range rate with respect to position is
+            //(dv-n*dot(n,dv))/r for each leg.
+            const double dRRRx=(dvRx[k]-nRx[k]*dotRx)/rRx;
+
+            if(isMonostatic) {
+                J[4*k]=2*scale*nRx[k];
+                J[3+4*k]=2*scale*dRRRx;
+                J[3+4*(k+3)]=2*scale*nRx[k];
+            } else {
+                J[4*k]=scale*(nRx[k]+nTx[k]);
+                J[3+4*k]=scale*(dRRRx+(dvTx[k]-nTx[k]*dotTx)/rTx);
+                J[3+4*(k+3)]=scale*(nRx[k]+nTx[k]);
+            }
+            //The range does not depend on velocity and the angles are set
+            //separately.
+            J[4*(k+3)]=0;
+            J[1+4*(k+3)]=0;
+            J[2+4*(k+3)]=0;
+        }
+    }
+};
+
+template<size_t systemType, bool isMonostatic>
+static void state2SpherRRKernel(double *z, double *J, const double *xTar, const size_t stateStride, const size_t numPoints, const bool useHalfRange, const double *xTx, const size_t xTxStride, const double *xRx, const size_t xRxStride, const double *M, const size_t MStride) {
+    const double scale=useHalfRange?0.5:1.0;
+
+    for(size_t i=0;i<numPoints;i++) {
+        const double *MCur=M+i*MStride;
+        double *zCur=z+4*i;
+        double *JCur=(J!=NULL)?J+24*i:NULL;
+        stateRRGeometry geom;
+        double xL[3];
+
+        geom.set<isMonostatic>(xTar+i*stateStride,xTx+i*xTxStride,xRx+i*xRxStride);
+        geom.rangeTerms<isMonostatic>(zCur[0],zCur[3],JCur,xL,MCur,scale);
+
+        const double x=xL[0];
+        const double y=xL[1];
+        const double zL=xL[2];
+        const double r1=geom.rRx;
+
+        if(systemType==1) {
+            //The special case for two zeros deals with the fact that the
+            //standard C++ library will normally throw a domain error.
+            zCur[1]=(zL==0&&x==0)?0:atan2(x,zL);
+            zCur[2]=asin(y/r1);
+        } else {
+            zCur[1]=(y==0&&x==0)?0:atan2(y,x);
+            zCur[2]=asin(zL/r1);
+
+            if(systemType==2) {
+                const double pi=acos(-1.0);
+                zCur[2]=pi/2.0-zCur[2];
+            }
+        }
+
+        if(JCur!=NULL) {
+            double JL[6], dAz[3], dEl[3];
+
+            //The angle gradients in local coordinates are as in
+            //spherAngGradientGenCPP.
+            if(systemType==1) {
+                const double sqrVal=zL*zL+x*x;
+                const double sqrtVal=sqrt(sqrVal);
+                const double denom=r1*r1*sqrtVal;
+
+                JL[0]=zL/sqrVal;
+                JL[1]=0;
+                JL[2]=-x/sqrVal;
+                JL[3]=-x*y/denom;
+                JL[4]=sqrtVal/(r1*r1);
+                JL[5]=-zL*y/denom;
+            } else {
+                const double sqrVal=x*x+y*y;
+                const double sqrtVal=sqrt(sqrVal);
+                const double denom=r1*r1*sqrtVal;
+                const double elSign=(systemType==2)?-1.0:1.0;
+
+                JL[0]=-y/sqrVal;
+                JL[1]=x/sqrVal;
+                JL[2]=0;
+                JL[3]=-elSign*x*zL/denom;
+                JL[4]=-elSign*y*zL/denom;
+                JL[5]=elSign*sqrtVal/(r1*r1);
+            }
+
+            rowTimesM(dAz,JL,MCur);
+            rowTimesM(dEl,JL+3,MCur);
+            for(size_t k=0;k<3;k++) {
+                JCur[1+4*k]=dAz[k];
+                JCur[2+4*k]=dEl[k];
+            }
+        }
+    }
+}
+
+template<bool includeW, bool isMonostatic>
+static void state2RuvRRKernel(double *z, double *J, const double *xTar, const size_t stateStride, const size_t numPoints, const bool useHalfRange, const double *xTx, const size_t xTxStride, const double *xRx, const size_t xRxStride, const double *M, const size_t MStride) {
+    const size_t retStride=includeW?5:4;
+    const double scale=useHalfRange?0.5:1.0;
+
+    for(size_t i=0;i<numPoints;i++) {
+        const double *MCur=M+i*MStride;
+        double *zCur=z+i*retStride;
+        double *JCur=(J!=NULL)?J+24*i:NULL;
+        stateRRGeometry geom;
+        double xL[3], nL[3];
+
+        geom.set<isMonostatic>(xTar+i*stateStride,xTx+i*xTxStride,xRx+i*xRxStride);
+        geom.rangeTerms<isMonostatic>(zCur[0],zCur[retStride-1],JCur,xL,MCur,scale);
+
+        nL[0]=xL[0]/geom.rRx;
+        nL[1]=xL[1]/geom.rRx;
+        nL[2]=xL[2]/geom.rRx;
+        zCur[1]=nL[0];
+        zCur[2]=nL[1];
+        if(includeW) {
+            zCur[3]=nL[2];
+        }
+
+        if(JCur!=NULL) {
+            double duL[3], dvL[3], du[3], dv[3];
+
+            for(size_t k=0;k<3;k++) {
+                duL[k]=((k==0?1.0:0.0)-nL[0]*nL[k])/geom.rRx;
+                dvL[k]=((k==1?1.0:0.0)-nL[1]*nL[k])/geom.rRx;
+            }
+            rowTimesM(du,duL,MCur);
+            rowTimesM(dv,dvL,MCur);
+            for(size_t k=0;k<3;k++) {
+                JCur[1+4*k]=du[k];
+                JCur[2+4*k]=dv[k];
+            }
+        }
+    }
+}
+
+void spher2CartWithDerivsBatchCPP(double *zCart, double *J, double *H, const double *zSpher, const size_t numPoints, const size_t systemType, const bool useHalfRange, const double *lTx, const size_t lTxStride, const double *lRx, const size_t lRxStride, const double *M, const size_t MStride) {
+    const bool isMonostatic=convDerivsIsMonostatic(lTx,lTxStride,lRx,lRxStride,3);
+
+    switch(systemType) {
+        case 1:
+            if(isMonostatic) {
+                spher2CartWithDerivsKernel<1,true>(zCart,J,H,zSpher,numPoints,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+            } else {
+                spher2CartWithDerivsKernel<1,false>(zCart,J,H,zSpher,numPoints,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+            }
+            break;
+        case 2:
+            if(isMonostatic) {
+                spher2CartWithDerivsKernel<2,true>(zCart,J,H,zSpher,numPoints,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+            } else {
+                spher2CartWithDerivsKernel<2,false>(zCart,J,H,zSpher,numPoints,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+            }
+            break;
+        default:
+            if(isMonostatic) {
+                spher2CartWithDerivsKernel<0,true>(zCart,J,H,zSpher,numPoints,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+            } else {
+                spher2CartWithDerivsKernel<0,false>(zCart,J,H,zSpher,numPoints,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+            }
+            break;
+    }
+}
+
+void ruv2CartWithDerivsBatchCPP(double *zCart, double *J, double *H, const double *zRuv, const size_t numPoints, const bool hasW, const bool useHalfRange, const double *lTx, const size_t lTxStride, const double *lRx, const size_t lRxStride, const double *M, const size_t MStride) {
+    const bool isMonostatic=convDerivsIsMonostatic(lTx,lTxStride,lRx,lRxStride,3);
+
+    if(hasW) {
+        if(isMonostatic) {
+            ruv2CartWithDerivsKernel<true,true>(zCart,J,H,zRuv,numPoints,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+        } else {
+            ruv2CartWithDerivsKernel<true,false>(zCart,J,H,zRuv,numPoints,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+        }
+    } else {
+        if(isMonostatic) {
+            ruv2CartWithDerivsKernel<false,true>(zCart,J,H,zRuv,numPoints,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+        } else {
+            ruv2CartWithDerivsKernel<false,false>(zCart,J,H,zRuv,numPoints,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+        }
+    }
+}
+
+void state2SpherRRBatchCPP(double *z, double *J, const double *xTar, const size_t stateStride, const size_t numPoints, const size_t systemType, const bool useHalfRange, const double *xTx, const size_t xTxStride, const double *xRx, const size_t xRxStride, const double *M, const size_t MStride) {
+    const bool isMonostatic=convDerivsIsMonostatic(xTx,xTxStride,xRx,xRxStride,6);
+
+    switch(systemType) {
+        case 1:
+            if(isMonostatic) {
+                state2SpherRRKernel<1,true>(z,J,xTar,stateStride,numPoints,useHalfRange,xTx,xTxStride,xRx,xRxStride,M,MStride);
+            } else {
+                state2SpherRRKernel<1,false>(z,J,xTar,stateStride,numPoints,useHalfRange,xTx,xTxStride,xRx,xRxStride,M,MStride);
+            }
+            break;
+        case 2:
+            if(isMonostatic) {
+                state2SpherRRKernel<2,true>(z,J,xTar,stateStride,numPoints,useHalfRange,xTx,xTxStride,xRx,xRxStride,M,MStride);
+            } else {
+                state2SpherRRKernel<2,false>(z,J,xTar,stateStride,numPoints,useHalfRange,xTx,xTxStride,xRx,xRxStride,M,MStride);
+            }
+            break;
+        default:
+            if(isMonostatic) {
+                state2SpherRRKernel<0,true>(z,J,xTar,stateStride,numPoints,useHalfRange,xTx,xTxStride,xRx,xRxStride,M,MStride);
+            } else {
+                state2SpherRRKernel<0,false>(z,J,xTar,stateStride,numPoints,useHalfRange,xTx,xTxStride,xRx,xRxStride,M,MStride);
+            }
+            break;
+    }
+}
+
+void state2RuvRRBatchCPP(double *z, double *J, const double *xTar, const size_t stateStride, const size_t numPoints, const bool useHalfRange, const double *xTx, const size_t xTxStride, const double *xRx, const size_t xRxStride, const double *M, const size_t MStride, const bool includeW) {
+    const bool isMonostatic=convDerivsIsMonostatic(xTx,xTxStride,xRx,xRxStride,6);
+
+    if(includeW) {
+        if(isMonostatic) {
+            state2RuvRRKernel<true,true>(z,J,xTar,stateStride,numPoints,useHalfRange,xTx,xTxStride,xRx,xRxStride,M,MStride);
+        } else {
+            state2RuvRRKernel<true,false>(z,J,xTar,stateStride,numPoints,useHalfRange,xTx,xTxStride,xRx,xRxStride,M,MStride);
+        }
+    } else {
+        if(isMonostatic) {
+            state2RuvRRKernel<false,true>(z,J,xTar,stateStride,numPoints,useHalfRange,xTx,xTxStride,xRx,xRxStride,M,MStride);
+        } else {
+            state2RuvRRKernel<false,false>(z,J,xTar,stateStride,numPoints,useHalfRange,xTx,xTxStride,xRx,xRxStride,M,MStride);
+        }
+    }
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
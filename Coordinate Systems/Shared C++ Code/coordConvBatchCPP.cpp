@@ -0,0 +1,434 @@
+/**COORDCONVBATCHCPP Functions to convert many points at once between
+ *   bistatic spherical or r-u-v coordinates and Cartesian coordinates. The
+ *   results are the same as calling spher2CartGenCPP, Cart2SphereGenCPP,
+ *   ruv2CartGenCPP, Cart2RuvGenCPP or spher2CartNoRangeCPP for each point,
+ *   to within finite precision errors, but the work that does not depend
+ *   on the point is not repeated.
+ *
+ *The conversions for a single point branch on the coordinate system and
+ *recompute the transmitter location in the receiver's coordinate system,
+ *M*(zTx-zRx), for every point. Here, the conversion loops are templates
+ *instantiated for each coordinate system type and for the monostatic
+ *case, so there are no branches on the options inside of the loops, and
+ *when the same transmitter, receiver and rotation matrix are used for all
+ *of the points, M*(zTx-zRx) and its squared norm are only computed once.
+ *The loops have no calls other than to the standard math functions, so
+ *compilers with vectorized math libraries can vectorize them.
+ *
+ *The geometry is monostatic when the transmitter and the receiver are the
+ *same, which is detected when they are the same array with the same
+ *stride, as happens when both are omitted in Matlab, or when a single
+ *transmitter and receiver have the same location. In that case,
+ *M*(zTx-zRx) is zero and the bistatic range is just twice the one-way
+ *range, so the solution for the one-way range in the bistatic conversions
+ *is skipped.
+ *
+ *All points, zTx, zRx and M are stored as in Matlab, one column after the
+ *other. pointStride is the number of rows of the points, which can be
+ *larger than needed, in which case the extra rows are ignored. The
+ *strides of zTx, zRx and M are the number of elements between the values
+ *for consecutive points. A stride of 0 means that the same value is used
+ *for all of the points. The inputs are otherwise the same as in the
+ *per-point functions in spher2CartCPP.cpp, Cart2SphereCPP.cpp,
+ *ruv2CartCPP.cpp and Cart2RuvCPP.cpp.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "CoordFuncs.hpp"
+//For sin, cos, atan2, asin and sqrt.
+#include <math.h>
+
+//The values of a transmitter, receiver and rotation matrix that are used
+//for every point that they are shared by.
+struct coordConvSensor {
+    const double *M;
+    const double *zRx;
+    double zTxL[3];//M*(zTx-zRx)
+    double zTxL2;//The squared norm of zTxL.
+
+    void set(const double *zTx, const double *zRxCur, const double *MCur) {
+        const double diff0=zTx[0]-zRxCur[0];
+        const double diff1=zTx[1]-zRxCur[1];
+        const double diff2=zTx[2]-zRxCur[2];
+
+        M=MCur;
+        zRx=zRxCur;
+        zTxL[0]=M[0]*diff0+M[3]*diff1+M[6]*diff2;
+        zTxL[1]=M[1]*diff0+M[4]*diff1+M[7]*diff2;
+        zTxL[2]=M[2]*diff0+M[5]*diff1+M[8]*diff2;
+        zTxL2=zTxL[0]*zTxL[0]+zTxL[1]*zTxL[1]+zTxL[2]*zTxL[2];
+    }
+};
+
+//The sensor values for point i.
+struct coordConvSensorIter {
+    const double *zTx;
+    size_t zTxStride;
+    const double *zRx;
+    size_t zRxStride;
+    const double *M;
+    size_t MStride;
+    bool isConst;
+    coordConvSensor sensor;
+
+    coordConvSensorIter(const double *zTxDes, const size_t zTxStrideDes, const double *zRxDes, const size_t zRxStrideDes, const double *MDes, const size_t MStrideDes) : zTx(zTxDes), zTxStride(zTxStrideDes), zRx(zRxDes), zRxStride(zRxStrideDes), M(MDes), MStride(MStrideDes) {
+        isConst=(zTxStride==0&&zRxStride==0&&MStride==0);
+        sensor.set(zTx,zRx,M);
+    }
+
+    const coordConvSensor &get(const size_t i) {
+        if(!isConst) {
+            sensor.set(zTx+i*zTxStride,zRx+i*zRxStride,M+i*MStride);
+        }
+        return sensor;
+    }
+
+    //Point i only needs M and zRx in the monostatic case.
+    void getMonostatic(const size_t i, const double *&MCur, const double *&zRxCur) const {
+        MCur=M+i*MStride;
+        zRxCur=zRx+i*zRxStride;
+    }
+};
+
+static bool coordConvIsMonostatic(const double *zTx, const size_t zTxStride, const double *zRx, const size_t zRxStride) {
+    if(zTx==zRx&&zTxStride==zRxStride) {
+        return true;
+    }
+
+    return zTxStride==0&&zRxStride==0&&zTx[0]==zRx[0]&&zTx[1]==zRx[1]&&zTx[2]==zRx[2];
+}
+
+//Set uVec to the unit vector in the direction given by azimuth and
+//elevation in the local coordinate system.
+template<size_t systemType>
+static inline void spherUnitVec(double *uVec, const double azimuth, double elevation) {
+    double cosEl;
+
+    if(systemType==2) {
+        const double pi=acos(-1.0);
+        elevation=pi/2.0-elevation;
+    }
+
+    cosEl=cos(elevation);
+    if(systemType==1) {
+        uVec[0]=sin(azimuth)*cosEl;
+        uVec[1]=sin(elevation);
+        uVec[2]=cos(azimuth)*cosEl;
+    } else {
+        uVec[0]=cos(azimuth)*cosEl;
+        uVec[1]=sin(azimuth)*cosEl;
+        uVec[2]=sin(elevation);
+    }
+}
+
+//Set retData=M'*(r1*uVec)+zRx.
+static inline void localDir2Global(double *retData, const double r1, const double *uVec, const double *M, const double *zRx) {
+    const double zL0=r1*uVec[0];
+    const double zL1=r1*uVec[1];
+    const double zL2=r1*uVec[2];
+
+    retData[0]=M[0]*zL0+M[1]*zL1+M[2]*zL2+zRx[0];
+    retData[1]=M[3]*zL0+M[4]*zL1+M[5]*zL2+zRx[1];
+    retData[2]=M[6]*zL0+M[7]*zL1+M[8]*zL2+zRx[2];
+}
+
+//Set zCL=M*(zC-zRx) and return the range from the receiver.
+static inline double global2Local(double *zCL, const double *zC, const double *M, const double *zRx) {
+    const double diff0=zC[0]-zRx[0];
+    const double diff1=zC[1]-zRx[1];
+    const double diff2=zC[2]-zRx[2];
+
+    zCL[0]=M[0]*diff0+M[3]*diff1+M[6]*diff2;
+    zCL[1]=M[1]*diff0+M[4]*diff1+M[7]*diff2;
+    zCL[2]=M[2]*diff0+M[5]*diff1+M[8]*diff2;
+
+    return sqrt(zCL[0]*zCL[0]+zCL[1]*zCL[1]+zCL[2]*zCL[2]);
+}
+
+//The bistatic range of a point given its local coordinates and range from
+//the receiver.
+static inline double bistaticRange(const double *zCL, const double r1, const double *zTxL) {
+    const double diff0=zCL[0]-zTxL[0];
+    const double diff1=zCL[1]-zTxL[1];
+    const double diff2=zCL[2]-zTxL[2];
+
+    return r1+sqrt(diff0*diff0+diff1*diff1+diff2*diff2);
+}
+
+//Convert the bistatic range rB and the local unit vector uVec of a point
+//to Cartesian coordinates.
+template<bool isMonostatic>
+static inline void rangeDir2Cart(double *retData, const double rB, const double *uVec, coordConvSensorIter &sensors, const size_t i) {
+    if(isMonostatic) {
+        const double *M, *zRx;
+
+        sensors.getMonostatic(i,M,zRx);
+        localDir2Global(retData,rB/2,uVec,M,zRx);
+    } else {
+        const coordConvSensor &s=sensors.get(i);
+        const double *zTxL=s.zTxL;
+        //r1=(r^2-norm(zTxL)^2)/(2*(r-dot(uVec,zTxL)));
+        const double r1=(rB*rB-s.zTxL2)/(2*(rB-uVec[0]*zTxL[0]-uVec[1]*zTxL[1]-uVec[2]*zTxL[2]));
+
+        localDir2Global(retData,r1,uVec,s.M,s.zRx);
+    }
+}
+
+//Convert a Cartesian point to local coordinates zCL and return the
+//bistatic range.
+template<bool isMonostatic>
+static inline double Cart2LocalRange(double *zCL, double &r1, const double *zC, coordConvSensorIter &sensors, const size_t i) {
+    if(isMonostatic) {
+        const double *M, *zRx;
+
+        sensors.getMonostatic(i,M,zRx);
+        r1=global2Local(zCL,zC,M,zRx);
+        return 2*r1;
+    } else {
+        const coordConvSensor &s=sensors.get(i);
+
+        r1=global2Local(zCL,zC,s.M,s.zRx);
+        return bistaticRange(zCL,r1,s.zTxL);
+    }
+}
+
+template<size_t systemType, bool isMonostatic>
+static void spher2CartBatchKernel(double *retData, const double *points, const size_t numPoints, const bool useHalfRange, coordConvSensorIter &sensors) {
+    const double rScale=useHalfRange?2.0:1.0;
+
+    for(size_t i=0;i<numPoints;i++) {
+        const double *point=points+3*i;
+        double uVec[3];
+
+        spherUnitVec<systemType>(uVec,point[1],point[2]);
+        rangeDir2Cart<isMonostatic>(retData+3*i,rScale*point[0],uVec,sensors,i);
+    }
+}
+
+template<size_t systemType, bool isMonostatic>
+static void Cart2SphereBatchKernel(double *retData, const double *cartPoints, const size_t pointStride, const size_t numPoints, const bool useHalfRange, coordConvSensorIter &sensors) {
+    const double rScale=useHalfRange?0.5:1.0;
+
+    for(size_t i=0;i<numPoints;i++) {
+        double *ret=retData+3*i;
+        double zCL[3], r1;
+        const double rB=Cart2LocalRange<isMonostatic>(zCL,r1,cartPoints+i*pointStride,sensors,i);
+
+        ret[0]=rScale*rB;
+        if(systemType==1) {
+            //The special case for two zeros deals with the fact that the
+            //standard C++ library will normally throw a domain error.
+            ret[1]=(zCL[2]==0&&zCL[0]==0)?0:atan2(zCL[0],zCL[2]);
+            ret[2]=asin(zCL[1]/r1);
+        } else {
+            ret[1]=(zCL[1]==0&&zCL[0]==0)?0:atan2(zCL[1],zCL[0]);
+            ret[2]=asin(zCL[2]/r1);
+
+            if(systemType==2) {
+                const double pi=acos(-1.0);
+                ret[2]=pi/2.0-ret[2];
+            }
+        }
+    }
+}
+
+template<bool hasW, bool isMonostatic>
+static void ruv2CartBatchKernel(double *retData, const double *z, const size_t numPoints, const bool useHalfRange, coordConvSensorIter &sensors) {
+    const size_t pointStride=hasW?4:3;
+    const double rScale=useHalfRange?2.0:1.0;
+
+    for(size_t i=0;i<numPoints;i++) {
+        const double *point=z+i*pointStride;
+        double u=point[1];
+        double v=point[2];
+        double uVec[3];
+
+        if(hasW) {
+            uVec[0]=u;
+            uVec[1]=v;
+            uVec[2]=point[3];
+        } else {
+            //If the magnitude is too large, normalize it so that one does
+            //not try to take the square root of a negative number.
+            const double uvMag2=u*u+v*v;
+
+            if(uvMag2>1) {
+                const double uvMag=sqrt(uvMag2);
+                uVec[0]=u/uvMag;
+                uVec[1]=v/uvMag;
+                uVec[2]=0;
+            } else {
+                uVec[0]=u;
+                uVec[1]=v;
+                uVec[2]=sqrt(1.0-uvMag2);
+            }
+        }
+
+        rangeDir2Cart<isMonostatic>(retData+3*i,rScale*point[0],uVec,sensors,i);
+    }
+}
+
+template<bool includeW, bool isMonostatic>
+static void Cart2RuvBatchKernel(double *retData, const double *points, const size_t pointStride, const size_t numPoints, const bool useHalfRange, coordConvSensorIter &sensors) {
+    const size_t retStride=includeW?4:3;
+    const double rScale=useHalfRange?0.5:1.0;
+
+    for(size_t i=0;i<numPoints;i++) {
+        double *ret=retData+i*retStride;
+        double zCL[3], r1;
+        const double rB=Cart2LocalRange<isMonostatic>(zCL,r1,points+i*pointStride,sensors,i);
+
+        ret[0]=rScale*rB;
+        ret[1]=zCL[0]/r1;
+        ret[2]=zCL[1]/r1;
+        if(includeW) {
+            ret[3]=zCL[2]/r1;
+        }
+    }
+}
+
+template<size_t systemType>
+static void spher2CartNoRangeBatchKernel(double *retData, const double *points, const size_t numPoints, const double *M, const size_t MStride) {
+    for(size_t i=0;i<numPoints;i++) {
+        const double *MCur=M+i*MStride;
+        double *ret=retData+3*i;
+        double uVec[3];
+
+        spherUnitVec<systemType>(uVec,points[2*i],points[2*i+1]);
+
+        //retData=M'*uVecL;
+        ret[0]=MCur[0]*uVec[0]+MCur[1]*uVec[1]+MCur[2]*uVec[2];
+        ret[1]=MCur[3]*uVec[0]+MCur[4]*uVec[1]+MCur[5]*uVec[2];
+        ret[2]=MCur[6]*uVec[0]+MCur[7]*uVec[1]+MCur[8]*uVec[2];
+    }
+}
+
+void spher2CartBatchCPP(double *retData, const double *points, const size_t numPoints, const size_t systemType, const bool useHalfRange, const double *zTx, const size_t zTxStride, const double *zRx, const size_t zRxStride, const double *M, const size_t MStride) {
+    const bool isMonostatic=coordConvIsMonostatic(zTx,zTxStride,zRx,zRxStride);
+    coordConvSensorIter sensors(zTx,zTxStride,zRx,zRxStride,M,MStride);
+
+    switch(systemType) {
+        case 1:
+            if(isMonostatic) {
+                spher2CartBatchKernel<1,true>(retData,points,numPoints,useHalfRange,sensors);
+            } else {
+                spher2CartBatchKernel<1,false>(retData,points,numPoints,useHalfRange,sensors);
+            }
+            break;
+        case 2:
+            if(isMonostatic) {
+                spher2CartBatchKernel<2,true>(retData,points,numPoints,useHalfRange,sensors);
+            } else {
+                spher2CartBatchKernel<2,false>(retData,points,numPoints,useHalfRange,sensors);
+            }
+            break;
+        default:
+            if(isMonostatic) {
+                spher2CartBatchKernel<0,true>(retData,points,numPoints,useHalfRange,sensors);
+            } else {
+                spher2CartBatchKernel<0,false>(retData,points,numPoints,useHalfRange,sensors);
+            }
+            break;
+    }
+}
+
+void Cart2SphereBatchCPP(double *retData, const double *cartPoints, const size_t pointStride, const size_t numPoints, const size_t systemType, const bool useHalfRange, const double *zTx, const size_t zTxStride, const double *zRx, const size_t zRxStride, const double *M, const size_t MStride) {
+    const bool isMonostatic=coordConvIsMonostatic(zTx,zTxStride,zRx,zRxStride);
+    coordConvSensorIter sensors(zTx,zTxStride,zRx,zRxStride,M,MStride);
+
+    switch(systemType) {
+        case 1:
+            if(isMonostatic) {
+                Cart2SphereBatchKernel<1,true>(retData,cartPoints,pointStride,numPoints,useHalfRange,sensors);
+            } else {
+                Cart2SphereBatchKernel<1,false>(retData,cartPoints,pointStride,numPoints,useHalfRange,sensors);
+            }
+            break;
+        case 2:
+            if(isMonostatic) {
+                Cart2SphereBatchKernel<2,true>(retData,cartPoints,pointStride,numPoints,useHalfRange,sensors);
+            } else {
+                Cart2SphereBatchKernel<2,false>(retData,cartPoints,pointStride,numPoints,useHalfRange,sensors);
+            }
+            break;
+        default:
+            if(isMonostatic) {
+                Cart2SphereBatchKernel<0,true>(retData,cartPoints,pointStride,numPoints,useHalfRange,sensors);
+            } else {
+                Cart2SphereBatchKernel<0,false>(retData,cartPoints,pointStride,numPoints,useHalfRange,sensors);
+            }
+            break;
+    }
+}
+
+void ruv2CartBatchCPP(double *retData, const double *z, const size_t numPoints, const bool hasW, const bool useHalfRange, const double *zTx, const size_t zTxStride, const double *zRx, const size_t zRxStride, const double *M, const size_t MStride) {
+    const bool isMonostatic=coordConvIsMonostatic(zTx,zTxStride,zRx,zRxStride);
+    coordConvSensorIter sensors(zTx,zTxStride,zRx,zRxStride,M,MStride);
+
+    if(hasW) {
+        if(isMonostatic) {
+            ruv2CartBatchKernel<true,true>(retData,z,numPoints,useHalfRange,sensors);
+        } else {
+            ruv2CartBatchKernel<true,false>(retData,z,numPoints,useHalfRange,sensors);
+        }
+    } else {
+        if(isMonostatic) {
+            ruv2CartBatchKernel<false,true>(retData,z,numPoints,useHalfRange,sensors);
+        } else {
+            ruv2CartBatchKernel<false,false>(retData,z,numPoints,useHalfRange,sensors);
+        }
+    }
+}
+
+void Cart2RuvBatchCPP(double *retData, const double *points, const size_t pointStride, const size_t numPoints, const bool useHalfRange, const double *zTx, const size_t zTxStride, const double *zRx, const size_t zRxStride, const double *M, const size_t MStride, const bool includeW) {
+    const bool isMonostatic=coordConvIsMonostatic(zTx,zTxStride,zRx,zRxStride);
+    coordConvSensorIter sensors(zTx,zTxStride,zRx,zRxStride,M,MStride);
+
+    if(includeW) {
+        if(isMonostatic) {
+            Cart2RuvBatchKernel<true,true>(retData,points,pointStride,numPoints,useHalfRange,sensors);
+        } else {
+            Cart2RuvBatchKernel<true,false>(retData,points,pointStride,numPoints,useHalfRange,sensors);
+        }
+    } else {
+        if(isMonostatic) {
+            Cart2RuvBatchKernel<false,true>(retData,points,pointStride,numPoints,useHalfRange,sensors);
+        } else {
+            Cart2RuvBatchKernel<false,false>(retData,points,pointStride,numPoints,useHalfRange,sensors);
+        }
+    }
+}
+
+void spher2CartNoRangeBatchCPP(double *retData, const double *points, const size_t numPoints, const size_t systemType, const double *M, const size_t MStride) {
+    switch(systemType) {
+        case 1:
+            spher2CartNoRangeBatchKernel<1>(retData,points,numPoints,M,MStride);
+            break;
+        case 2:
+            spher2CartNoRangeBatchKernel<2>(retData,points,numPoints,M,MStride);
+            break;
+        default:
+            spher2CartNoRangeBatchKernel<0>(retData,points,numPoints,M,MStride);
+            break;
+    }
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
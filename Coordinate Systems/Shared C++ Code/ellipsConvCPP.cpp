@@ -0,0 +1,289 @@
+/**ELLIPSCONVCPP Functions to convert many points between ECEF Cartesian
+ *   coordinates and ellipsoidal (geodetic latitude, longitude and height)
+ *   coordinates using multiple threads. See the Matlab implementations of
+ *   Cart2Ellipse and ellips2Cart for details on the algorithms.
+ *
+ *The points are split into contiguous chunks, one per thread. The loops
+ *for the algorithms of Olson and Fukushima and for ellips2Cart have no
+ *data-dependent branches: In the algorithm of Olson, the sine and the
+ *cosine of the initial latitude estimate are found using both of the
+ *expansions in [1] and the one that is better conditioned is selected, and
+ *the initial latitude is atan2 of the two. In the algorithm of Fukushima,
+ *six iterations are always performed, rather than stopping early when the
+ *iterate becomes non-finite, as non-finite values remain non-finite; the
+ *case of a point on the z-axis is selected after the iterations. Thus,
+ *compilers can vectorize the loops when vectorized versions of the
+ *standard math functions are available. The results are the same as the
+ *scalar implementations, to within finite precision errors.
+ *
+ *The algorithm of Sofair stops on the first point for which it fails, so
+ *it is only split over threads.
+ *
+ *All points are 3XN matrices stored by column as in Matlab. numThreads=0
+ *means that the number of hardware threads is used.
+ *
+ *REFERENCES:
+ *[1] D. K. Olson, "Converting Earth-centered, Earth-fixed coordinates to
+ *    geodetic coordinates," IEEE Transactions on Aerospace and Electronic
+ *    Systems, vol. 32, no. 1, pp. 473-476, Jan. 1996.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "CoordFuncs.hpp"
+#include "runChunksCPP.hpp"
+//For sqrt, fabs, isfinite, fmax, fmin, copysign, trigonometric functions
+//and pow.
+#include <cmath>
+#include <atomic>
+
+//The minimum number of points given to each thread.
+static const size_t minPointsPerThread=4096;
+
+/*Evaluate convChunk(startIdx,numInChunk) over contiguous chunks of the
+ *numVec points using numThreads threads. convChunk returns false on
+ *failure. The return value is true if all of the chunks succeeded.*/
+template<class ChunkConv>
+static bool ellipsConvChunks(ChunkConv convChunk, const size_t numVec, const size_t numThreads) {
+    std::atomic<bool> allOK(true);
+
+    runChunksCPP(numVec,numThreads,minPointsPerThread,[&](const size_t startIdx, const size_t endIdx) {
+        if(!convChunk(startIdx,endIdx-startIdx)) {
+            allOK=false;
+        }
+    });
+
+    return allOK;
+}
+
+static void OlsonAlgCPP(double *retData, const double *points, const size_t numVec, const double a, const double f) {
+    //The square of the eccentricity.
+    const double e2=2*f-f*f;
+    const double a1=a*e2;
+    const double a2=a1*a1;
+    const double a3=a1*e2/2;
+    const double a4=(5.0/2.0)*a2;
+    const double a5=a1+a3;
+    const double a6=1-e2;
+
+    for(size_t i=0;i<numVec;i++) {
+        const double x=points[3*i];
+        const double y=points[3*i+1];
+        const double z=points[3*i+2];
+        const double zp=fabs(z);
+        const double w2=x*x+y*y;
+        const double w=sqrt(w2);
+        const double z2=z*z;
+        const double r2=w2+z2;
+        //The algorithm will work with points deep close to the origin.
+        //Thus, there is no need to have a test for r being too small as
+        //is the case in [1].
+        const double r=sqrt(r2);
+        const double s2=z2/r2;
+        const double c2=w2/r2;
+        const double u0=a2/r;
+        const double v0=a3-a4/r;
+
+        //The sine is expanded directly away from the z-axis and the
+        //cosine otherwise.
+        const bool expandSin=c2>0.3;
+        const double sExp=(zp/r)*(1+c2*(a1+u0+s2*v0)/r);
+        const double cExp=(w/r)*(1-s2*(a5-u0-c2*v0)/r);
+        //The fmax terms keep the unselected square root real.
+        const double s=expandSin?sExp:sqrt(fmax(1-cExp*cExp,0.0));
+        const double c=expandSin?sqrt(fmax(1-sExp*sExp,0.0)):cExp;
+        const double ss=s*s;
+
+        const double g=1-e2*ss;
+        const double rg=a/sqrt(g);
+        const double rf=a6*rg;
+        const double u=w-rg*c;
+        const double v=zp-rf*s;
+        const double fVal=c*u+s*v;
+        const double m=c*v-s*u;
+        const double p=m/(rf/g+fVal);
+        //c>=0, so atan can be used instead of atan2.
+        const double phi=atan(s/c)+p;
+
+        retData[3*i]=(z<0)?-phi:phi;
+        retData[3*i+1]=atan2(y,x);
+        retData[3*i+2]=fVal+m*p/2;
+    }
+}
+
+static void FukushimaAlgCPP(double *retData, const double *points, const size_t numVec, const double a, const double f) {
+    const double pi=acos(-1.0);
+    const double b=a*(1-f);//The semi-minor axis of the reference ellipsoid.
+    //The square of the first numerical eccentricity.
+    const double e2=2*f-f*f;
+    const double ec=sqrt(1-e2);
+    const size_t numIter=6;
+
+    for(size_t i=0;i<numVec;i++) {
+        const double x0=points[3*i];
+        const double y0=points[3*i+1];
+        const double z0=points[3*i+2];
+        const double r0=sqrt(x0*x0+y0*y0);
+        const double P=r0/a;
+        const double Z=(ec/a)*fabs(z0);
+        double S=Z;
+        double C=ec*P;
+        double A=0;
+
+        //Assume convergence in six iterations.
+        for(size_t curIter=0;curIter<numIter;curIter++) {
+            A=sqrt(S*S+C*C);
+            const double B=1.5*e2*S*C*C*((P*S-Z*C)*A-e2*S*C);
+            const double F=P*A*A*A-e2*C*C*C;
+            const double D=Z*A*A*A+e2*S*S*S;
+
+            S=(D*F-B*S)/(F*F-B*C);
+            C=1;
+        }
+        const double Cc=ec*C;
+
+        //If the point is along the z-axis, then the iterates are not
+        //finite.
+        const bool onAxis=!std::isfinite(S);
+
+        retData[3*i]=onAxis?copysign(pi/2,z0):copysign(atan(S/Cc),z0);
+        retData[3*i+1]=atan2(y0,x0);
+        retData[3*i+2]=onAxis?fabs(z0)-b:(r0*Cc+fabs(z0)*S-b*A)/sqrt(Cc*Cc+S*S);
+    }
+}
+
+static bool SofairAlgCPP(double *retData, const double *points, const size_t numVec, const double a, const double f) {
+    const double b=a*(1-f);//The semi-minor axis of the reference ellipsoid.
+    const double b2=b*b;
+    //The square of the first numerical eccentricity.
+    const double e2=2*f-f*f;
+    //The square of the second numerical eccentricity.
+    const double eps2=a*a/(b2)-1;
+
+    for(size_t i=0;i<numVec;i++) {
+        const double x0=points[3*i];
+        const double y0=points[3*i+1];
+        const double z0=points[3*i+2];
+        const double r0=sqrt(x0*x0+y0*y0);
+        const double p=fabs(z0)/eps2;
+        const double s=r0*r0/(e2*eps2);
+        const double q=p*p-b2+s;
+        double u, v, P, Q, t, c, w, z, Ne, val, phi;
+
+        retData[3*i+1]=atan2(y0,x0);
+
+        //If the point is too deep within the Earth for this algorithm to
+        //work.
+        if(q<0) {
+            return false;
+        }
+
+        u=p/sqrt(q);
+        v=b2*u*u/q;
+        P=27.0*v*s/q;
+        Q=pow(sqrt(P+1.0)+sqrt(P),2.0/3.0);
+        t=(1.0+Q+1/Q)/6.0;
+        c=u*u-1+2*t;
+        //This condition prevents finite precision problems due to
+        //subtraction within the square root.
+        c=sqrt(fmax(c,0));
+        w=(c-u)/2.0;
+
+        //The z coordinate of the closest point projected on the
+        //ellipsoid. The fmax command deals with precision problems when
+        //the argument is nearly zero.
+        z=sqrt(t*t+v)-u*w-t/2.0-1.0/4.0;
+        z=fmax(z,0);
+        z=copysign(sqrt(q)*(w+sqrt(z)),z0);
+
+        Ne=a*sqrt(1+eps2*z*z/b2);
+
+        //The min and max terms deals with finite precision problems.
+        val=fmin(z*(eps2+1)/Ne,1);
+        val=fmax(val,-1.0);
+        phi=asin(val);
+        retData[3*i]=phi;
+        retData[3*i+2]=r0*cos(phi)+z0*sin(phi)-a*a/Ne;
+    }
+
+    return true;
+}
+
+bool Cart2EllipseCPP(double *retData, const double *points, const size_t numVec, const double a, const double f, const int algorithm, const size_t numThreads) {
+    //algorithm is 0 for Olson's algorithm, 1 for Sofair's algorithm and 2
+    //for Fukushima's algorithm. The return value is false if the
+    //algorithm of Sofair failed because a point is too close to the
+    //center of the Earth.
+
+    switch(algorithm) {
+        case 1:
+            return ellipsConvChunks([=](size_t startIdx, size_t numInChunk) {
+                return SofairAlgCPP(retData+3*startIdx,points+3*startIdx,numInChunk,a,f);
+            },numVec,numThreads);
+        case 2:
+            return ellipsConvChunks([=](size_t startIdx, size_t numInChunk) {
+                FukushimaAlgCPP(retData+3*startIdx,points+3*startIdx,numInChunk,a,f);
+                return true;
+            },numVec,numThreads);
+        default:
+            return ellipsConvChunks([=](size_t startIdx, size_t numInChunk) {
+                OlsonAlgCPP(retData+3*startIdx,points+3*startIdx,numInChunk,a,f);
+                return true;
+            },numVec,numThreads);
+    }
+}
+
+static bool ellips2CartChunkCPP(double *retData, const double *points, const size_t numVec, const double a, const double f) {
+    //This is the same as iauGd2gce in the SOFA library.
+    const double w=(1.0-f)*(1.0-f);
+    bool isOK=true;
+
+    for(size_t i=0;i<numVec;i++) {
+        const double phi=points[3*i];
+        const double lambda=points[3*i+1];
+        const double height=points[3*i+2];
+        const double sp=sin(phi);
+        const double cp=cos(phi);
+        const double d=cp*cp+w*sp*sp;
+        const double ac=a/sqrt(d);
+        const double as=w*ac;
+        const double r=(ac+height)*cp;
+
+        //As in iauGd2gce, only d<=0 is an error, so NaN inputs give NaN
+        //outputs rather than failing the call.
+        isOK=isOK&!(d<=0.0);
+        retData[3*i]=r*cos(lambda);
+        retData[3*i+1]=r*sin(lambda);
+        retData[3*i+2]=(as+height)*sp;
+    }
+
+    return isOK;
+}
+
+bool ellips2CartCPP(double *retData, const double *points, const size_t numVec, const double a, const double f, const size_t numThreads) {
+    //The return value is false if the conversion failed for a point, which
+    //only happens for invalid ellipsoids.
+
+    return ellipsConvChunks([=](size_t startIdx, size_t numInChunk) {
+        return ellips2CartChunkCPP(retData+3*startIdx,points+3*startIdx,numInChunk,a,f);
+    },numVec,numThreads);
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -46,6 +46,10 @@
 *           rate coordinates. If useHalfRange=true, then the r component is
 *           half the bistatic range and the range rate is correspondingly
 *           halved.
+*         J If requested, the 4X6XN set of Jacobians of [r;u;v;rr] with
+*           respect to the position and velocity of the targets, as in
+*           calcRuvRRJacob. The w component is not included. These are
+*           found in the same pass as z.
 *
 *Details of the conversions are given in [1].
 *
@@ -53,7 +57,7 @@
 * CompileCLibraries function.
 *
 *The algorithm is run in Matlab using the command format
-* z=state2RuvRR(xTar,useHalfRange,xTx,xRx,M,includeW)
+* [z,J]=state2RuvRR(xTar,useHalfRange,xTx,xRx,M,includeW)
 *
 *REFERENCES:
 *[1] D. F. Crouse, "Basic tracking using nonlinear 3D monostatic and
@@ -73,7 +77,7 @@
         
 void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
     double *points, *xTx, *xRx, *M;
-    size_t i, N;
+    size_t N;
     //If multiple values are passed for xTx, xRx or M, then the three
     //offsets below are used to move to the next value when going through
     //the measurements. However, if only a single value is passed, but
@@ -87,8 +91,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     size_t posOffset;
 
     mxArray *retMat;
-    double *retData;
-    size_t retVecOffsetPos;
+    double *J=NULL;
     //These two could be declared const, but that would just require extra
     //typecasting, since the return value of mxGetData for the inputs is
     //not const and would have to be typecase, or these would have to be
@@ -103,7 +106,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         return;
     }
     
-    if(nlhs>1) {
+    if(nlhs>2) {
         mexErrMsgTxt("Wrong number of outputs.");
         return;
     }
@@ -205,27 +208,24 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     }
     
     if(includeW) {
-        retVecOffsetPos=4;
         retMat=mxCreateDoubleMatrix(5,N,mxREAL);
     } else {
-        retVecOffsetPos=3;
         retMat=mxCreateDoubleMatrix(4,N,mxREAL);
     }
 
-    retData=reinterpret_cast<double*>(mxGetData(retMat));
-    
-    //Convert each of the measurements
-    for(i=0;i<N;i++) {
-        Cart2RuvGenCPP(retData,points,useHalfRange,xTx,xRx,M,includeW);
-        retData=retData+retVecOffsetPos;
-        *retData=getRangeRate3DCPP(points,useHalfRange,xTx,xRx);
-        retData=retData+1;
-        points=points+posOffset;
-        xTx=xTx+xTxOffset;
-        xRx=xRx+xRxOffset;
-        M=M+MOffset;
+    if(nlhs>1) {
+        mwSize dims[3];
+        dims[0]=4;
+        dims[1]=6;
+        dims[2]=N;
+
+        plhs[1]=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        J=reinterpret_cast<double*>(mxGetData(plhs[1]));
     }
 
+    //Convert all of the states
+    state2RuvRRBatchCPP(reinterpret_cast<double*>(mxGetData(retMat)),J,points,posOffset,N,useHalfRange,xTx,xTxOffset,xRx,xRxOffset,M,MOffset,includeW);
+
     plhs[0]=retMat;
 }
 
@@ -1,4 +1,4 @@
-function z=state2RuvRR(xTar,useHalfRange,xTx,xRx,M,includeW)
+function [z,J]=state2RuvRR(xTar,useHalfRange,xTx,xRx,M,includeW)
 %%STATE2RUVRR Convert state vectors consisting of at least 3D position and
 %             velocity in 3D space into local bistatic r-u-v coordinates
 %             with non-relativistic range rate.
@@ -47,6 +47,10 @@ function z=state2RuvRR(xTar,useHalfRange,xTx,xRx,M,includeW)
 %           rate coordinates. If useHalfRange=true, then the r component is
 %           half the bistatic range and the range rate is correspondingly
 %           halved.
+%         J If requested, the 4X6XN set of Jacobians of [r;u;v;rr] with
+%           respect to the position and velocity of the targets, as in
+%           calcRuvRRJacob. The w component is not included. The compiled
+%           version finds these in the same pass as z.
 %
 %Details of the conversions are given in [1].
 %
@@ -98,6 +102,13 @@ z(1:(end-1),:)=Cart2Ruv(xTar,useHalfRange,xTx,xRx,M,includeW);
 
 %Compute the bistatic range rates.
 z(end,:)=getRangeRate(xTar(1:6,:),useHalfRange,xTx,xRx);
+
+if(nargout>1)
+    J=zeros(4,6,N);
+    for curPoint=1:N
+        J(:,:,curPoint)=calcRUVRRJacob(xTar(1:6,curPoint),useHalfRange,xTx(1:6,curPoint),xRx(1:6,curPoint),M(:,:,curPoint));
+    end
+end
 end
 
 %LICENSE:
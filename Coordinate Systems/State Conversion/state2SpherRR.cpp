@@ -60,6 +60,10 @@
 %             bistatic spherical and bistatic range rate coordinates. If
 %             useHalfRange=true, then the r component is half the bistatic
 %             range and the range rate is correspondingly halved.
+%           J If requested, the 4X6XN set of Jacobians of the components
+%             of z with respect to the position and velocity of the
+%             targets, as in calcSpherRRJacob. These are found in the same
+%             pass as z.
 %
 %Details of the conversions are given in [1].
 *
@@ -67,7 +71,7 @@
 * CompileCLibraries function.
 *
 *The algorithm is run in Matlab using the command format
-*points=Cart2Sphere(cartPoints,systemType,useHalfRange,zTx,xRx,M)
+*[z,J]=state2SpherRR(xTar,systemType,useHalfRange,xTx,xRx,M)
 %
 %REFERENCES:
 %[1] D. F. Crouse, "Basic tracking using nonlinear 3D monostatic and
@@ -88,7 +92,7 @@
 void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
     double *points, *xTx, *xRx, *M;
     int systemType;
-    size_t i, N;
+    size_t N;
     //If multiple values are passed for xTx, xRx or M, then the three
     //offsets below are used to move to the next value when going through
     //the measurements. However, if onyl a single value is passed, but
@@ -100,7 +104,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     size_t posOffset;
     
     mxArray *retMat;
-    double *retData;
+    double *J=NULL;
     //These two could be declared const, but that would just require extra
     //typecasting, since the return value of mxGetData for the inputs is
     //not const and would have to be typecase, or these would have to be
@@ -115,7 +119,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         return;
     }
     
-    if(nlhs>1) {
+    if(nlhs>2) {
         mexErrMsgTxt("Wrong number of outputs.");
         return;
     }
@@ -226,20 +230,19 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     }
 
     retMat=mxCreateDoubleMatrix(4,N,mxREAL);
-    retData=reinterpret_cast<double*>(mxGetData(retMat));
-    
-    //Convert each of the measurements
-    for(i=0;i<N;i++) {
-        Cart2SphereGenCPP(retData,points,systemType,useHalfRange,xTx,xRx,M);
-        retData+=3;
-        *retData=getRangeRate3DCPP(points,useHalfRange,xTx,xRx);
-        retData+=1;
-        points+=posOffset;
-        xTx+=xTxOffset;
-        xRx+=xRxOffset;
-        M+=MOffset;
+    if(nlhs>1) {
+        mwSize dims[3];
+        dims[0]=4;
+        dims[1]=6;
+        dims[2]=N;
+
+        plhs[1]=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        J=reinterpret_cast<double*>(mxGetData(plhs[1]));
     }
 
+    //Convert all of the states
+    state2SpherRRBatchCPP(reinterpret_cast<double*>(mxGetData(retMat)),J,points,posOffset,N,systemType,useHalfRange,xTx,xTxOffset,xRx,xRxOffset,M,MOffset);
+
     plhs[0]=retMat;
 }
 
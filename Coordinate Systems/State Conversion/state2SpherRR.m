@@ -1,4 +1,4 @@
-function z=state2SpherRR(xTar,systemType,useHalfRange,xTx,xRx,M)
+function [z,J]=state2SpherRR(xTar,systemType,useHalfRange,xTx,xRx,M)
 %%STATE2SPHERRR Convert state vectors consisting of at least 3D position
 %               and velocity in 3D space into local spherical coordinates
 %               with non-relativistic range rate. An option allows for the
@@ -59,6 +59,10 @@ function z=state2SpherRR(xTar,systemType,useHalfRange,xTx,xRx,M)
 %           bistatic spherical and bistatic range rate coordinates. If
 %           useHalfRange=true, then the r component is half the bistatic
 %           range and the range rate is correspondingly halved.
+%         J If requested, the 4X6XN set of Jacobians of the components of
+%           z with respect to the position and velocity of the targets, as
+%           in calcSpherRRJacob. The compiled version finds these in the
+%           same pass as z.
 %
 %Details of the conversions are given in [1].
 %
@@ -116,6 +120,13 @@ z(1:3,:)=Cart2Sphere(xTar,systemType,useHalfRange,xTx,xRx,M);
 
 %Compute the bistatic range rates.
 z(4,:)=getRangeRate(xTar(1:6,:),useHalfRange,xTx,xRx);
+
+if(nargout>1)
+    J=zeros(4,6,N);
+    for curPoint=1:N
+        J(:,:,curPoint)=calcSpherRRJacob(xTar(1:6,curPoint),systemType,useHalfRange,xTx(1:6,curPoint),xRx(1:6,curPoint),M(:,:,curPoint));
+    end
+end
 end
 
 %LICENSE:
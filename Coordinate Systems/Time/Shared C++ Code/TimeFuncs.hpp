@@ -0,0 +1,38 @@
+/**TIMEFUNCS A header file for C++ implementations of time conversion
+ *          functions. See the files implementing each function for more
+ *          details on their usage.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef TIMEFUNCS
+#define TIMEFUNCS
+#include <stddef.h>
+
+//The time scales that convertTimeScaleCPP can convert between.
+enum TimeScaleType {UTC_SCALE=0, TAI_SCALE, GPS_SCALE, TT_SCALE, TCG_SCALE, TDB_SCALE, TCB_SCALE};
+
+//Conversion of many two-part Julian dates from one time scale to another.
+//See timeScaleConvCPP.cpp. This requires the SOFA library.
+int convertTimeScaleCPP(double *Jul1Out, double *Jul2Out, const double *Jul1, const double *Jul2, const size_t numTimes, const TimeScaleType fromScale, const TimeScaleType toScale, const double *deltaTTUT1, const size_t deltaTStride, const double *clockLoc, const size_t numThreads);
+
+#endif
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
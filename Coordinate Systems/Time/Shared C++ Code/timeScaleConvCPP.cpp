@@ -0,0 +1,383 @@
+/**TIMESCALECONVCPP Functions to convert many two-part Julian dates from
+ *   one time scale to another in a single pass. See the Matlab function
+ *   convertTimeScale for more details on the inputs and outputs.
+ *
+ *The scales are put into three groups: universal coordinated time (UTC),
+ *international atomic time (TAI) and GPS time, which are converted through
+ *TAI; terrestrial time (TT) and geocentric coordinate time (TCG), which are
+ *converted through TT; and barycentric dynamical time (TDB) and
+ *barycentric coordinate time (TCB), which are converted through TDB. Going
+ *between groups always passes through TT. The steps are the functions of
+ *the International Astronomical Union's (IAU) Standard's of Fundamental
+ *Astronomy (SOFA) library used by the single-scale mex files, such as
+ *UTC2TAI, TT2TDB and TDB2TT, so the results are the same as chaining those
+ *files.
+ *
+ *The exception is the UTC-TAI step. SOFA's iauUtctai calls iauDat three
+ *times per date and iauTaiutc calls iauUtctai three times, with iauDat
+ *looking through its table of leap seconds on each call. Here, the table
+ *is read once out of iauDat and cached and the offset on a day is found
+ *with a binary search. For dates from 1972 onward, TAI-UTC does not drift
+ *during a day and the remaining steps are the same floating point
+ *operations as in iauUtctai, so the results are identical. Earlier dates
+ *are passed to the SOFA functions. The functions utcTai and taiUtc here
+ *are thus derived from the SOFA routines iauUtctai and iauTaiutc and are
+ *not themselves SOFA software.
+ *
+ *Jul1, Jul2, Jul1Out and Jul2Out all have numTimes elements. deltaTTUT1 is
+ *TT-UT1 in seconds, which only matters when converting between TT and TDB.
+ *It has numTimes elements with deltaTStride=1 or one with deltaTStride=0
+ *and can be NULL if no conversion between TT and TDB is needed. clockLoc
+ *is the 3X1 location of the clock in meters in the Terrestrial
+ *Intermediate Reference System or NULL for a clock at the center of the
+ *Earth. The dates are split into contiguous chunks over numThreads
+ *threads. numThreads=0 means that the number of hardware threads is used.
+ *
+ *The return value is -1 if a date could not be converted or if deltaTTUT1
+ *is needed but is NULL, 1 if a dubious date was entered and 0 otherwise.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "TimeFuncs.hpp"
+/*This header is for the SOFA library.*/
+#include "sofa.h"
+#include "runChunksCPP.hpp"
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+//The minimum number of dates given to each thread.
+static const size_t minTimesPerThread=1024;
+
+//GPS time is always 19 seconds behind TAI.
+static const double TAIMGPS=19.0;
+
+namespace {
+/*The values of TAI-UTC from 1972 onward. TAIMUTC[i] holds from the
+ *start of the day with the modified Julian date (MJD) MJD[i] until the
+ *start of MJD[i+1]. iauDat flags dates starting at dubiousMJD as
+ *dubious.*/
+struct LeapSecTable {
+    std::vector<double> MJD;
+    std::vector<double> TAIMUTC;
+    double dubiousMJD;
+};
+}
+
+/*Read the leap seconds out of iauDat. The offset only changes at the
+ *start of a month. This stops at the first month that iauDat flags as
+ *dubious, after which it just holds the last value.*/
+static LeapSecTable buildLeapSecTable() {
+    LeapSecTable table;
+
+    for(int year=1972;;year++) {
+        for(int month=1;month<=12;month++) {
+            double deltaAT, JulMJD0, MJD;
+            const int retVal=iauDat(year,month,1,0.0,&deltaAT);
+
+            iauCal2jd(year,month,1,&JulMJD0,&MJD);
+            if(retVal!=0) {
+                table.dubiousMJD=MJD;
+                return table;
+            }
+
+            if(table.TAIMUTC.empty()||deltaAT!=table.TAIMUTC.back()) {
+                table.MJD.push_back(MJD);
+                table.TAIMUTC.push_back(deltaAT);
+            }
+        }
+    }
+}
+
+static const LeapSecTable &getLeapSecTable() {
+    //This is only built on the first call. C++11 makes this thread safe.
+    static const LeapSecTable table=buildLeapSecTable();
+    return table;
+}
+
+/*TAI-UTC in seconds on the day starting at dayMJD, which must not be
+ *before table.MJD[0].*/
+static double getTAIMUTC(const LeapSecTable &table, const double dayMJD) {
+    const size_t idx=std::upper_bound(table.MJD.begin(),table.MJD.end(),dayMJD)-table.MJD.begin();
+
+    return table.TAIMUTC[idx-1];
+}
+
+/*UTC to TAI following the steps of iauUtctai. After 1972, the per-day
+ *drift dlod in iauUtctai is zero, so scaling by it does nothing.*/
+static int utcTai(double &tai1, double &tai2, const double utc1, const double utc2, const LeapSecTable &table) {
+    const bool big1=(utc1>=utc2);
+    const double u1=big1?utc1:utc2;
+    const double u2=big1?utc2:utc1;
+    int iy, im, id;
+    double fd, z1, z2, a2;
+
+    if(iauJd2cal(u1,u2,&iy,&im,&id,&fd)!=0) {
+        return -1;
+    }
+    if(iauCal2jd(iy,im,id,&z1,&z2)!=0) {
+        return -1;
+    }
+
+    //TAI-UTC drifted during the day before 1972.
+    if(z2<table.MJD[0]) {
+        return iauUtctai(utc1,utc2,&tai1,&tai2);
+    }
+
+    {
+        //TAI-UTC at 0h today and at 0h tomorrow.
+        const double dat0=getTAIMUTC(table,z2);
+        const double dat24=getTAIMUTC(table,z2+1.0);
+
+        //Remove any scaling applied to spread a leap second into the
+        //day.
+        fd*=(DAYSEC+(dat24-dat0))/DAYSEC;
+
+        //Assemble the TAI result, preserving the UTC split and order.
+        a2=z1-u1;
+        a2+=z2;
+        a2+=fd+dat0/DAYSEC;
+    }
+
+    if(big1) {
+        tai1=u1;
+        tai2=a2;
+    } else {
+        tai1=a2;
+        tai2=u1;
+    }
+
+    //iauUtctai returns the status of the date tomorrow.
+    return (z2+1.0>=table.dubiousMJD)?1:0;
+}
+
+/*TAI to UTC following the iterations of iauTaiutc.*/
+static int taiUtc(double &utc1, double &utc2, const double tai1, const double tai2, const LeapSecTable &table) {
+    const bool big1=(tai1>=tai2);
+    const double a1=big1?tai1:tai2;
+    const double a2=big1?tai2:tai1;
+    double u1=a1;
+    double u2=a2;
+    int retVal=0;
+
+    for(int curIter=0;curIter<3;curIter++) {
+        double g1, g2;
+
+        retVal=utcTai(g1,g2,u1,u2,table);
+        if(retVal<0) {
+            return retVal;
+        }
+
+        u2+=a1-g1;
+        u2+=a2-g2;
+    }
+
+    if(big1) {
+        utc1=u1;
+        utc2=u2;
+    } else {
+        utc1=u2;
+        utc2=u1;
+    }
+
+    return retVal;
+}
+
+/*Add offset seconds to the smaller part of the date, as iauTaitt does.*/
+static void addSeconds(double &out1, double &out2, const double in1, const double in2, const double offset) {
+    if(in1>in2) {
+        out1=in1;
+        out2=in2+offset/DAYSEC;
+    } else {
+        out1=in1+offset/DAYSEC;
+        out2=in2;
+    }
+}
+
+/*The fraction of a day in UT1 given TT, as in TT2TDB and TDB2TT.*/
+static double getUT1Frac(const double TT1, const double TT2, const double deltaTTUT1) {
+    double Jul1UT1, Jul2UT1, UT1Frac;
+
+    iauTtut1(TT1,TT2,deltaTTUT1,&Jul1UT1,&Jul2UT1);
+    UT1Frac=(Jul1UT1-floor(Jul1UT1))+(Jul2UT1-floor(Jul2UT1));
+    return UT1Frac-floor(UT1Frac);
+}
+
+/*TT to TDB using the same two iterations as TT2TDB.*/
+static void TT2TDB(double &TDB1, double &TDB2, const double TT1, const double TT2, const double deltaTTUT1, const double u, const double v, const double elon) {
+    const double UT1Frac=getUT1Frac(TT1,TT2,deltaTTUT1);
+
+    TDB1=TT1;
+    TDB2=TT2;
+    for(int curIter=0;curIter<2;curIter++) {
+        const double deltaT=iauDtdb(TDB1,TDB2,UT1Frac,elon,u,v);
+
+        iauTttdb(TT1,TT2,deltaT,&TDB1,&TDB2);
+    }
+}
+
+/*TDB to TT using the same two iterations as TDB2TT.*/
+static void TDB2TT(double &TT1, double &TT2, const double TDB1, const double TDB2, const double deltaTTUT1, const double u, const double v, const double elon) {
+    TT1=TDB1;
+    TT2=TDB2;
+    for(int curIter=0;curIter<2;curIter++) {
+        const double UT1Frac=getUT1Frac(TT1,TT2,deltaTTUT1);
+        const double deltaT=iauDtdb(TDB1,TDB2,UT1Frac,elon,u,v);
+
+        iauTdbtt(TDB1,TDB2,deltaT,&TT1,&TT2);
+    }
+}
+
+/*The scale in each group through which the group is converted.*/
+static TimeScaleType getHubScale(const TimeScaleType scale) {
+    switch(scale) {
+        case UTC_SCALE:
+        case TAI_SCALE:
+        case GPS_SCALE:
+            return TAI_SCALE;
+        case TDB_SCALE:
+        case TCB_SCALE:
+            return TDB_SCALE;
+        default:
+            return TT_SCALE;
+    }
+}
+
+int convertTimeScaleCPP(double *Jul1Out, double *Jul2Out, const double *Jul1, const double *Jul2, const size_t numTimes, const TimeScaleType fromScale, const TimeScaleType toScale, const double *deltaTTUT1, const size_t deltaTStride, const double *clockLoc, const size_t numThreads) {
+    const TimeScaleType fromHub=getHubScale(fromScale);
+    const TimeScaleType toHub=getHubScale(toScale);
+    const bool needsDeltaT=(fromHub!=toHub)&&(fromHub==TDB_SCALE||toHub==TDB_SCALE);
+    const bool usesUTC=(fromScale==UTC_SCALE||toScale==UTC_SCALE);
+    //The clock location in the form used by iauDtdb.
+    double u=0, v=0, elon=0;
+    std::atomic<bool> hadError(false), hadDubious(false);
+
+    if(needsDeltaT&&deltaTTUT1==NULL) {
+        return -1;
+    }
+
+    if(clockLoc!=NULL) {
+        //Convert from meters to kilometers.
+        const double x=clockLoc[0]/1000;
+        const double y=clockLoc[1]/1000;
+        const double z=clockLoc[2]/1000;
+
+        u=sqrt(x*x+y*y);
+        v=z;
+        elon=atan2(y,x);
+    }
+
+    //Load the leap seconds before any threads start. Only the UTC steps
+    //use them.
+    const LeapSecTable *table=usesUTC?&getLeapSecTable():NULL;
+
+    runChunksCPP(numTimes,numThreads,minTimesPerThread,[&](const size_t startIdx, const size_t endIdx) {
+        bool chunkError=false, chunkDubious=false;
+
+        for(size_t curTime=startIdx;curTime<endIdx;curTime++) {
+            double t1=Jul1[curTime];
+            double t2=Jul2[curTime];
+            int retVal=0;
+
+            //To the hub of the group of the source scale. The SOFA
+            //functions other than those involving UTC always return 0.
+            switch(fromScale) {
+                case UTC_SCALE:
+                    retVal=utcTai(t1,t2,t1,t2,*table);
+                    break;
+                case GPS_SCALE:
+                    addSeconds(t1,t2,t1,t2,TAIMGPS);
+                    break;
+                case TCG_SCALE:
+                    iauTcgtt(t1,t2,&t1,&t2);
+                    break;
+                case TCB_SCALE:
+                    iauTcbtdb(t1,t2,&t1,&t2);
+                    break;
+                default:
+                    break;
+            }
+            if(retVal<0) {
+                chunkError=true;
+                continue;
+            }
+            chunkDubious=chunkDubious||(retVal==1);
+
+            //Between the hubs through TT.
+            if(fromHub!=toHub) {
+                const double deltaT=needsDeltaT?deltaTTUT1[deltaTStride*curTime]:0;
+
+                if(fromHub==TAI_SCALE) {
+                    iauTaitt(t1,t2,&t1,&t2);
+                } else if(fromHub==TDB_SCALE) {
+                    TDB2TT(t1,t2,t1,t2,deltaT,u,v,elon);
+                }
+
+                if(toHub==TAI_SCALE) {
+                    iauTttai(t1,t2,&t1,&t2);
+                } else if(toHub==TDB_SCALE) {
+                    TT2TDB(t1,t2,t1,t2,deltaT,u,v,elon);
+                }
+            }
+
+            //From the hub to the target scale.
+            switch(toScale) {
+                case UTC_SCALE:
+                    retVal=taiUtc(t1,t2,t1,t2,*table);
+                    break;
+                case GPS_SCALE:
+                    addSeconds(t1,t2,t1,t2,-TAIMGPS);
+                    break;
+                case TCG_SCALE:
+                    iauTttcg(t1,t2,&t1,&t2);
+                    break;
+                case TCB_SCALE:
+                    iauTdbtcb(t1,t2,&t1,&t2);
+                    break;
+                default:
+                    break;
+            }
+            if(retVal<0) {
+                chunkError=true;
+                continue;
+            }
+            chunkDubious=chunkDubious||(retVal==1);
+
+            Jul1Out[curTime]=t1;
+            Jul2Out[curTime]=t2;
+        }
+
+        if(chunkError) {
+            hadError=true;
+        }
+        if(chunkDubious) {
+            hadDubious=true;
+        }
+    });
+
+    if(hadError) {
+        return -1;
+    }
+    return hadDubious?1:0;
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -62,6 +62,7 @@
 /*This header is for the SOFA library.*/
 #include "sofa.h"
 #include "MexValidation.h"
+#include "EOPFuncs.h"
 
 //Function prototype
 double getDeltaTFromEOP(double TT1,double TT2);
@@ -167,8 +168,6 @@ double getDeltaTFromEOP(double TT1,double TT2) {
  *                  call Matlab errors if parameter problems arise.
  */
     
-    mxArray *retVals[4];
-    mxArray *JulUTCMATLAB[2];
     double deltaT, JulUTC[2];
     int retVal;
 
@@ -190,20 +189,8 @@ double getDeltaTFromEOP(double TT1,double TT2) {
         break;
     }
 
-    JulUTCMATLAB[0]=doubleMat2Matlab(&JulUTC[0],1,1);
-    JulUTCMATLAB[1]=doubleMat2Matlab(&JulUTC[1],1,1);
-
     //Get the Earth orientation parameters for the given date.
-    mexCallMATLAB(4,retVals,2,JulUTCMATLAB,"getEOP");
-    //This is TT-UT1
-    deltaT=getDoubleFromMatlab(retVals[3]);
-    //Free the returned arrays.
-    mxDestroyArray(retVals[0]);
-    mxDestroyArray(retVals[1]);
-    mxDestroyArray(retVals[2]);
-    mxDestroyArray(retVals[3]);
-    mxDestroyArray(JulUTCMATLAB[0]);
-    mxDestroyArray(JulUTCMATLAB[1]);
+    getEOPMex(NULL,NULL,NULL,&deltaT,NULL,&JulUTC[0],&JulUTC[1],1);
     
     return deltaT;
 }
@@ -53,6 +53,7 @@
 /*This header is for the SOFA library.*/
 #include "sofa.h"
 #include "MexValidation.h"
+#include "EOPFuncs.h"
 
 void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     double TT1, TT2, UT11,UT12, deltaT,GMST;
@@ -79,8 +80,6 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     if(nrhs>3&&!mxIsEmpty(prhs[3])) {
         deltaT=getDoubleFromMatlab(prhs[3]);
     } else {
-        mxArray *retVals[4];
-        mxArray *JulUTCMATLAB[2];
         double JulUTC[2];
         
         //Get the time in UTC to look up the parameters by going to TAI and
@@ -102,20 +101,8 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
                 break;
         }
  
-        JulUTCMATLAB[0]=doubleMat2Matlab(&JulUTC[0],1,1);
-        JulUTCMATLAB[1]=doubleMat2Matlab(&JulUTC[1],1,1);
-
         //Get the Earth orientation parameters for the given date.
-        mexCallMATLAB(4,retVals,2,JulUTCMATLAB,"getEOP");
-        //This is TT-UT1
-        deltaT=getDoubleFromMatlab(retVals[3]);
-        //Free the returned arrays.
-        mxDestroyArray(retVals[0]);
-        mxDestroyArray(retVals[1]);
-        mxDestroyArray(retVals[2]);
-        mxDestroyArray(retVals[3]);
-        mxDestroyArray(JulUTCMATLAB[0]);
-        mxDestroyArray(JulUTCMATLAB[1]);
+        getEOPMex(NULL,NULL,NULL,&deltaT,NULL,&JulUTC[0],&JulUTC[1],1);
     }
      
     //Get UT1
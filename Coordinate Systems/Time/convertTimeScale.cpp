@@ -0,0 +1,263 @@
+/**CONVERTTIMESCALE Convert many dates given as two-part Julian dates from
+ *          one time scale to another in a single pass. This does the
+ *          same thing as chaining functions such as UTC2TAI, TAI2TT and
+ *          TT2TDB, but all of the dates are handled at once and the
+ *          leap seconds are found by a binary search over a cached table.
+ *
+ *INPUTS: Jul1, Jul2 Matrices of two parts of Julian dates given in the
+ *                   fromScale time scale. The units of the date are days.
+ *                   The full date is the sum of both terms. The date is
+ *                   broken into two parts to provide more bits of
+ *                   precision. It does not matter how the date is split.
+ *                   Corresponding elements in each matrix are times that
+ *                   are converted. Dates in UTC are pseudo-Julian as in
+ *                   UTC2TAI.
+ * fromScale, toScale Strings naming the time scale of the input dates and
+ *                   the time scale into which they are converted. Possible
+ *                   values are
+ *                   'UTC' Universal coordinated time.
+ *                   'TAI' International atomic time.
+ *                   'GPS' The timescale used by the Global Positioning
+ *                         System, which is 19 seconds behind TAI.
+ *                   'TT'  Terrestrial time.
+ *                   'TCG' Geocentric coordinate time.
+ *                   'TDB' Barycentric dynamical time.
+ *                   'TCB' Barycentric coordinate time.
+ *        deltaTTUT1 An optional parameter specifying the offset between TT
+ *                   and UT1 in seconds. This only matters when converting
+ *                   between one of 'TDB' and 'TCB' and one of the other
+ *                   scales. This can be a scalar or have one element per
+ *                   date. If this parameter is omitted or an empty matrix
+ *                   is passed, then the values of the function getEOP are
+ *                   used.
+ *          clockLoc An optional 3X1 vector specifying the location of the
+ *                   clock in the Terrestrial Intermediate Reference System
+ *                   (TIRS) in meters, as in TT2TDB. If this parameter is
+ *                   omitted or an empty matrix is passed, then a clock at
+ *                   the center of the Earth is used.
+ *        numThreads The number of threads to use. Zero means that the
+ *                   number of hardware threads available is used. If this
+ *                   parameter is omitted or an empty matrix is passed, then
+ *                   one thread is used.
+ *
+ *OUTPUTS: Jul1, Jul2 The dates as two-part Julian dates in the toScale
+ *                    time scale with the same dimensionalities as the
+ *                    input sets of dates.
+ *
+ *The conversions use the same functions in the International Astronomical
+ *Union's (IAU) Standard's of Fundamental Astronomy library as the
+ *functions for the individual steps, such as UTC2TAI, TT2TDB and TDB2TT,
+ *and give the same results. The exception is that when deltaTTUT1 is not
+ *given and the conversion starts in TDB or TCB, the difference TDB-TT,
+ *which is under 2 milliseconds, is ignored when looking up deltaTTUT1. See
+ *timeScaleConvCPP.cpp for details.
+ *
+ *UTC began at 1960 January 1.0 (JD 2436934.5) and this function should not
+ *be called with an earlier date in UTC.
+ *
+ *The algorithm can be compiled for use in Matlab  using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[Jul1,Jul2]=convertTimeScale(Jul1,Jul2,fromScale,toScale,deltaTTUT1,clockLoc,numThreads);
+ *or
+ *[Jul1,Jul2]=convertTimeScale(Jul1,Jul2,fromScale,toScale);
+ *
+ *EXAMPLE:
+ *Dates in UTC spread over a year are converted to TDB.
+ * [Jul1,Jul2]=Cal2UTC(2017,1,1,0,0,0);
+ * Jul2=Jul2+linspace(0,365,1e6);
+ * Jul1=Jul1*ones(size(Jul2));
+ * [TDB1,TDB2]=convertTimeScale(Jul1,Jul2,'UTC','TDB',[],[],0);
+ *
+ *Many temporal coordinate systems standards are compared in [1].
+ *
+ *REFERENCES:
+ *[1] D. F. Crouse, "An Overview of Major Terrestrial, Celestial, and
+ *    Temporal Coordinate Systems for Target Tracking," Formal Report, Naval
+ *    Research Laboratory, no. NRL/FR/5344--16-10,279, 10 Aug. 2016, 173
+ *    pages.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+/*This header is required by Matlab.*/
+#include "mex.h"
+#include "MexValidation.h"
+#include "TimeFuncs.hpp"
+#include "EOPFuncs.h"
+#include <cstring>
+#include <vector>
+
+/*Get the time scale named by a string input.*/
+static TimeScaleType getTimeScaleFromMatlab(const mxArray *arr) {
+    static const char *names[]={"UTC","TAI","GPS","TT","TCG","TDB","TCB"};
+    static const TimeScaleType scales[]={UTC_SCALE,TAI_SCALE,GPS_SCALE,TT_SCALE,TCG_SCALE,TDB_SCALE,TCB_SCALE};
+    char *scaleName;
+
+    if(!mxIsChar(arr)) {
+        mexErrMsgTxt("The time scales must be given as strings.");
+    }
+
+    scaleName=mxArrayToString(arr);
+    for(size_t curScale=0;curScale<sizeof(scales)/sizeof(scales[0]);curScale++) {
+        if(strcmp(scaleName,names[curScale])==0) {
+            mxFree(scaleName);
+            return scales[curScale];
+        }
+    }
+    mxFree(scaleName);
+
+    mexErrMsgTxt("Unknown time scale specified.");
+    return UTC_SCALE;
+}
+
+static bool isBarycentricScale(const TimeScaleType scale) {
+    return scale==TDB_SCALE||scale==TCB_SCALE;
+}
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const double *Jul1, *Jul2;
+    size_t numRow, numCol, numTimes;
+    TimeScaleType fromScale, toScale;
+    const double *deltaTTUT1=NULL;
+    size_t deltaTStride=0;
+    //deltaTTUT1 is put here if it is not given.
+    std::vector<double> deltaTTUT1EOP;
+    const double *clockLoc=NULL;
+    size_t numThreads=1;
+    mxArray *Jul1RetMATLAB, *Jul2RetMATLAB;
+    bool isDubious=false;
+    int retVal;
+
+    if(nrhs<4||nrhs>7) {
+        mexErrMsgTxt("Wrong number of inputs.");
+        return;
+    }
+
+    if(nlhs>2) {
+        mexErrMsgTxt("Wrong number of outputs.");
+        return;
+    }
+
+    numRow=mxGetM(prhs[0]);
+    numCol=mxGetN(prhs[0]);
+    numTimes=numRow*numCol;
+
+    if(numTimes==0||numRow!=mxGetM(prhs[1])||numCol!=mxGetN(prhs[1])) {
+        mexErrMsgTxt("The dimensionalities of the inputs are incorrect.");
+        return;
+    }
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+    Jul1=reinterpret_cast<double*>(mxGetData(prhs[0]));
+    Jul2=reinterpret_cast<double*>(mxGetData(prhs[1]));
+
+    fromScale=getTimeScaleFromMatlab(prhs[2]);
+    toScale=getTimeScaleFromMatlab(prhs[3]);
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        const size_t numDeltaT=mxGetNumberOfElements(prhs[4]);
+
+        checkRealDoubleArray(prhs[4]);
+        if(numDeltaT==1) {
+            deltaTStride=0;
+        } else if(numDeltaT==numTimes) {
+            deltaTStride=1;
+        } else {
+            mexErrMsgTxt("The dimensionality of deltaTTUT1 is incorrect.");
+            return;
+        }
+        deltaTTUT1=reinterpret_cast<double*>(mxGetData(prhs[4]));
+    }
+
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        if(mxGetM(prhs[5])!=3||mxGetN(prhs[5])!=1) {
+            mexErrMsgTxt("The dimensionality of the clock location is incorrect.");
+            return;
+        }
+        checkRealDoubleArray(prhs[5]);
+        clockLoc=reinterpret_cast<double*>(mxGetData(prhs[5]));
+    }
+
+    if(nrhs>6&&!mxIsEmpty(prhs[6])) {
+        numThreads=getSizeTFromMatlab(prhs[6]);
+    }
+
+    //Allocate space for the return variables.
+    Jul1RetMATLAB=mxCreateDoubleMatrix(numRow,numCol,mxREAL);
+    Jul2RetMATLAB=mxCreateDoubleMatrix(numRow,numCol,mxREAL);
+    double *Jul1Ret=reinterpret_cast<double*>(mxGetData(Jul1RetMATLAB));
+    double *Jul2Ret=reinterpret_cast<double*>(mxGetData(Jul2RetMATLAB));
+
+    //If going between TT and TDB without deltaTTUT1, look it up for all
+    //of the dates with one call. The lookup needs the dates in UTC. When
+    //starting from TDB or TCB, the offset TDB-TT of under 2ms is ignored
+    //for the lookup.
+    if(deltaTTUT1==NULL&&isBarycentricScale(fromScale)!=isBarycentricScale(toScale)) {
+        std::vector<double> UTC1(numTimes), UTC2(numTimes);
+
+        if(isBarycentricScale(fromScale)) {
+            retVal=convertTimeScaleCPP(UTC1.data(),UTC2.data(),Jul1,Jul2,numTimes,fromScale,TDB_SCALE,NULL,0,NULL,numThreads);
+            if(retVal==0) {
+                retVal=convertTimeScaleCPP(UTC1.data(),UTC2.data(),UTC1.data(),UTC2.data(),numTimes,TT_SCALE,UTC_SCALE,NULL,0,NULL,numThreads);
+            }
+        } else if(fromScale==UTC_SCALE) {
+            UTC1.assign(Jul1,Jul1+numTimes);
+            UTC2.assign(Jul2,Jul2+numTimes);
+            retVal=0;
+        } else {
+            retVal=convertTimeScaleCPP(UTC1.data(),UTC2.data(),Jul1,Jul2,numTimes,fromScale,UTC_SCALE,NULL,0,NULL,numThreads);
+        }
+
+        if(retVal<0) {
+            mxDestroyArray(Jul1RetMATLAB);
+            mxDestroyArray(Jul2RetMATLAB);
+            mexErrMsgTxt("Unacceptable date entered");
+            return;
+        }
+        isDubious=(retVal==1);
+
+        deltaTTUT1EOP.resize(numTimes);
+        getEOPMex(NULL,NULL,NULL,deltaTTUT1EOP.data(),NULL,UTC1.data(),UTC2.data(),numTimes);
+        deltaTTUT1=deltaTTUT1EOP.data();
+        deltaTStride=1;
+    }
+
+    retVal=convertTimeScaleCPP(Jul1Ret,Jul2Ret,Jul1,Jul2,numTimes,fromScale,toScale,deltaTTUT1,deltaTStride,clockLoc,numThreads);
+    if(retVal<0) {
+        mxDestroyArray(Jul1RetMATLAB);
+        mxDestroyArray(Jul2RetMATLAB);
+        mexErrMsgTxt("Unacceptable date entered");
+        return;
+    }
+    if(isDubious||retVal==1) {
+        mexWarnMsgTxt("Dubious Date entered.");
+    }
+
+    plhs[0]=Jul1RetMATLAB;
+    if(nlhs>1) {
+        plhs[1]=Jul2RetMATLAB;
+    } else {
+        mxDestroyArray(Jul2RetMATLAB);
+    }
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,105 @@
+function [Jul1,Jul2]=convertTimeScale(Jul1,Jul2,fromScale,toScale,deltaTTUT1,clockLoc,numThreads)
+%%CONVERTTIMESCALE Convert many dates given as two-part Julian dates from
+%          one time scale to another in a single pass. This does the
+%          same thing as chaining functions such as UTC2TAI, TAI2TT and
+%          TT2TDB, but all of the dates are handled at once and the
+%          leap seconds are found by a binary search over a cached table.
+%
+%INPUTS: Jul1, Jul2 Matrices of two parts of Julian dates given in the
+%                   fromScale time scale. The units of the date are days.
+%                   The full date is the sum of both terms. The date is
+%                   broken into two parts to provide more bits of
+%                   precision. It does not matter how the date is split.
+%                   Corresponding elements in each matrix are times that
+%                   are converted. Dates in UTC are pseudo-Julian as in
+%                   UTC2TAI.
+% fromScale, toScale Strings naming the time scale of the input dates and
+%                   the time scale into which they are converted. Possible
+%                   values are
+%                   'UTC' Universal coordinated time.
+%                   'TAI' International atomic time.
+%                   'GPS' The timescale used by the Global Positioning
+%                         System, which is 19 seconds behind TAI.
+%                   'TT'  Terrestrial time.
+%                   'TCG' Geocentric coordinate time.
+%                   'TDB' Barycentric dynamical time.
+%                   'TCB' Barycentric coordinate time.
+%        deltaTTUT1 An optional parameter specifying the offset between TT
+%                   and UT1 in seconds. This only matters when converting
+%                   between one of 'TDB' and 'TCB' and one of the other
+%                   scales. This can be a scalar or have one element per
+%                   date. If this parameter is omitted or an empty matrix
+%                   is passed, then the values of the function getEOP are
+%                   used.
+%          clockLoc An optional 3X1 vector specifying the location of the
+%                   clock in the Terrestrial Intermediate Reference System
+%                   (TIRS) in meters, as in TT2TDB. If this parameter is
+%                   omitted or an empty matrix is passed, then a clock at
+%                   the center of the Earth is used.
+%        numThreads The number of threads to use. Zero means that the
+%                   number of hardware threads available is used. If this
+%                   parameter is omitted or an empty matrix is passed, then
+%                   one thread is used.
+%
+%OUTPUTS: Jul1, Jul2 The dates as two-part Julian dates in the toScale
+%                    time scale with the same dimensionalities as the
+%                    input sets of dates.
+%
+%The conversions use the same functions in the International Astronomical
+%Union's (IAU) Standard's of Fundamental Astronomy library as the
+%functions for the individual steps, such as UTC2TAI, TT2TDB and TDB2TT,
+%and give the same results. The exception is that when deltaTTUT1 is not
+%given and the conversion starts in TDB or TCB, the difference TDB-TT,
+%which is under 2 milliseconds, is ignored when looking up deltaTTUT1. See
+%timeScaleConvCPP.cpp for details.
+%
+%UTC began at 1960 January 1.0 (JD 2436934.5) and this function should not
+%be called with an earlier date in UTC.
+%
+%The algorithm can be compiled for use in Matlab  using the
+%CompileCLibraries function.
+%
+%The algorithm is run in Matlab using the command format
+%[Jul1,Jul2]=convertTimeScale(Jul1,Jul2,fromScale,toScale,deltaTTUT1,clockLoc,numThreads);
+%or
+%[Jul1,Jul2]=convertTimeScale(Jul1,Jul2,fromScale,toScale);
+%
+%EXAMPLE:
+%Dates in UTC spread over a year are converted to TDB.
+% [Jul1,Jul2]=Cal2UTC(2017,1,1,0,0,0);
+% Jul2=Jul2+linspace(0,365,1e6);
+% Jul1=Jul1*ones(size(Jul2));
+% [TDB1,TDB2]=convertTimeScale(Jul1,Jul2,'UTC','TDB',[],[],0);
+%
+%Many temporal coordinate systems standards are compared in [1].
+%
+%REFERENCES:
+%[1] D. F. Crouse, "An Overview of Major Terrestrial, Celestial, and
+%    Temporal Coordinate Systems for Target Tracking," Formal Report, Naval
+%    Research Laboratory, no. NRL/FR/5344--16-10,279, 10 Aug. 2016, 173
+%    pages.
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+error('This function is only implemented as a mexed C or C++ function. Please run CompileCLibraries.m to compile the function for use.')
+
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
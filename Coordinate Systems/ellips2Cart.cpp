@@ -1,4 +1,4 @@
-/**ELLIPS2CART A C-code function to convert ellipsoidal coordinates to ECEF
+/**ELLIPS2CART A C++ function to convert ellipsoidal coordinates to ECEF
 *              Cartesian coordinates.
 *
 *INPUTS:    points  One or more points given in geodetic latitude and
@@ -12,13 +12,19 @@
 %           f       The flattening factor of the reference ellipsoid. If
 %                   this argument is omitted, the value in
 %                   Constants.WGS84Flattening is used.
+*        numThreads The number of threads to use to convert the points.
+*                   Zero means that the number of hardware threads
+*                   available is used. If this parameter is omitted or an
+*                   empty matrix is passed, then one thread is used.
 *
 *OUTPUTS:   cartPoints For N points, cartPoints is a 3XN matrix of the
 *                      converted points with each column having the format
 *                      [x;y;z].
 *
-*This just calls the appropriate conversion function from the International
-*Astronomical Union's Standard's of Fundamental Astronomy library.
+*This uses the same formulae as the function iauGd2gce in the
+*International Astronomical Union's Standard's of Fundamental Astronomy
+*library, implemented in ellipsConvCPP.cpp without data-dependent branches
+*so that the loop can be vectorized and split over multiple threads.
 *
 * The algorithm can be compiled for use in Matlab  using the 
 * CompileCLibraries function.
@@ -29,28 +35,28 @@
 *cartPoints=ellips2Cart(points,a);
 *or
 *cartPoints=ellips2Cart(points,a,f);
-*
-*Note that the WGS-84 ellipsoid parameters obtained from the IAU's library
-*should match those in Constants.WGS84SemiMajorAxis and
-*Constants.WGS84Flattening.
+*or
+*cartPoints=ellips2Cart(points,a,f,numThreads);
 *
 *December 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 */
 /*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
 
+#include "matrix.h"
 /*This header is required by Matlab.*/
 #include "mex.h"
-/*This header is for the SOFA library.*/
-#include "sofa.h"
 #include "MexValidation.h"
+#include "CoordFuncs.hpp"
 
-void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
-    size_t numRow,numVec,i;
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t numRow,numVec;
+    size_t numThreads=1;
     mxArray *retMat;
-    double *points, a, f;
+    const double *points;
+    double a, f;
     double *retData;
     
-    if(nrhs>3||nrhs<1){
+    if(nrhs>4||nrhs<1){
         mexErrMsgTxt("Wrong number of inputs");
     }
     
@@ -68,7 +74,7 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
         mexErrMsgTxt("The input vector has a bad dimensionality.");
     }
     
-    points=(double*)mxGetData(prhs[0]);
+    points=reinterpret_cast<double*>(mxGetData(prhs[0]));
     //points[0] is latitude
     //points[1] is longitude
     //points[2] is height.
@@ -85,14 +91,15 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
         f=getScalarMatlabClassConst("Constants", "WGS84Flattening");   
     }
     
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        numThreads=getSizeTFromMatlab(prhs[3]);
+    }
+    
     retMat=mxCreateDoubleMatrix(3,numVec,mxREAL);
-    retData=(double*)mxGetData(retMat);
-    for(i=0;i<numVec;i++) {
-        int retVal;
-        retVal= iauGd2gce(a,f, points[3*i+1], points[3*i], points[2+3*i], retData+3*i);
-        if(retVal!=0) {
-            mexErrMsgTxt("A conversion error has occurred.");
-        }
+    retData=reinterpret_cast<double*>(mxGetData(retMat));
+    if(!ellips2CartCPP(retData,points,numVec,a,f,numThreads)) {
+        mxDestroyArray(retMat);
+        mexErrMsgTxt("A conversion error has occurred.");
     }
     plhs[0]=retMat;
 }
@@ -1,4 +1,4 @@
-function cartPoints=ellips2Cart(points,a,f)
+function cartPoints=ellips2Cart(points,a,f,numThreads)
 %%ELLIPS2CART Convert ellipsoidal coordinates to ECEF Cartesian
 %             coordinates.
 %
@@ -13,6 +13,11 @@ function cartPoints=ellips2Cart(points,a,f)
 %             f The flattening factor of the reference ellipsoid. If this
 %               argument is omitted, the value in Constants.WGS84Flattening
 %               is used.
+%    numThreads The number of threads to use to convert the points in the
+%               C++ implementation. Zero means that the number of hardware
+%               threads available is used. The default if omitted or an
+%               empty matrix is passed is 1. This parameter is ignored by
+%               the Matlab implementation.
 %
 %OUTPUTS: cartPoints For N points, cartPoints is a 3XN matrix of the
 %               converted points with each column having the format
@@ -20,6 +25,12 @@ function cartPoints=ellips2Cart(points,a,f)
 %
 %The conversions are mentioned in [1].
 %
+%The algorithm can be compiled for use in Matlab  using the
+%CompileCLibraries function.
+%
+%The algorithm is run in Matlab using the command format
+%cartPoints=ellips2Cart(points,a,f,numThreads);
+%
 %REFERENCES:
 %[1] D. F. Crouse, "Simulating aerial targets in 3D accounting for the
 %    Earth's curvature," Journal of Advances in Information Fusion, vol.
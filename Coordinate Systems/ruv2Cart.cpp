@@ -82,7 +82,7 @@
         
 void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
     double *points, *zTx, *zRx, *M;
-    size_t i, N;
+    size_t N;
     //If multiple values are passed for zTx, zRx or M, then the three
     //offsets below are used to move to the next value when going through
     //the measurements. However, if only a single value is passed, but
@@ -212,15 +212,8 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     retMat=mxCreateDoubleMatrix(3,N,mxREAL);
     retData=reinterpret_cast<double*>(mxGetData(retMat));
     
-    //Convert each of the measurements
-    for(i=0;i<N;i++) {
-        ruv2CartGenCPP(retData,points,useHalfRange,zTx,zRx,M,hasW);
-        retData=retData+3;
-        points=points+pointOffset;
-        zTx=zTx+zTxOffset;
-        zRx=zRx+zRxOffset;
-        M=M+MOffset;
-    }
+    //Convert all of the measurements
+    ruv2CartBatchCPP(retData,points,N,hasW,useHalfRange,zTx,zTxOffset,zRx,zRxOffset,M,MOffset);
 
     plhs[0]=retMat;
 }
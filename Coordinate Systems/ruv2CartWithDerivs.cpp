@@ -0,0 +1,173 @@
+/**RUV2CARTWITHDERIVS Convert monostatic or bistatic r-u-v (or r-u-v-w)
+*            measurements to Cartesian coordinates and also get the
+*            Jacobians and optionally the Hessians of [r;u;v] with respect
+*            to Cartesian position at the converted points. See the
+*            comments to the Matlab implementation for more details.
+*
+*The algorithm can be compiled for use in Matlab  using the
+*CompileCLibraries function.
+*
+*The algorithm is run in Matlab using the command format
+*[zCart,J,H]=ruv2CartWithDerivs(zRuv,useHalfRange,lTx,lRx,M);
+*
+*October 2026 Naval Research Laboratory, Washington D.C.
+*/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "matrix.h"
+#include "mex.h"
+/* This header validates inputs and includes a header needed to handle
+ * Matlab matrices.*/
+#include "MexValidation.h"
+#include "CoordFuncs.hpp"
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const double *zRuv, *lTx, *lRx, *M;
+    const double zeroVector[3]={0,0,0};
+    const double identMat[9]={1,0,0,0,1,0,0,0,1};
+    //A stride of 0 means that the same value is used for all of the
+    //measurements.
+    size_t lTxStride=0;
+    size_t lRxStride=0;
+    size_t MStride=0;
+    size_t N;
+    bool hasW, useHalfRange;
+    double *J=NULL;
+    double *H=NULL;
+
+    if(nrhs<1||nrhs>5) {
+        mexErrMsgTxt("Incorrect number of inputs.");
+        return;
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Wrong number of outputs.");
+        return;
+    }
+
+    N=mxGetN(prhs[0]);
+    if((mxGetM(prhs[0])!=3&&mxGetM(prhs[0])!=4)||N<1) {
+       mexErrMsgTxt("The points have the wrong dimensionality.");
+       return;
+    }
+    hasW=(mxGetM(prhs[0])==4);
+
+    checkRealDoubleArray(prhs[0]);
+    zRuv=reinterpret_cast<double*>(mxGetData(prhs[0]));
+
+    if(nrhs<2||mxIsEmpty(prhs[1])) {
+        useHalfRange=false;
+    } else {
+        useHalfRange=getBoolFromMatlab(prhs[1]);
+    }
+
+    if(nrhs<3||mxIsEmpty(prhs[2])) {
+        lTx=zeroVector;
+    } else {
+        size_t numVecs, numRows;
+
+        checkRealDoubleArray(prhs[2]);
+        numVecs=mxGetN(prhs[2]);
+        numRows=mxGetM(prhs[2]);
+
+        if(numRows<3||numVecs<1||(numVecs!=N&&numVecs!=1)) {
+            mexErrMsgTxt("The transmitter locations have the wrong dimensionality.");
+            return;
+        }
+
+        lTx=reinterpret_cast<double*>(mxGetData(prhs[2]));
+        if(numVecs==N&&N>1) {
+            lTxStride=numRows;
+        }
+    }
+
+    if(nrhs<4||mxIsEmpty(prhs[3])) {
+        lRx=zeroVector;
+    } else {
+        size_t numVecs, numRows;
+
+        checkRealDoubleArray(prhs[3]);
+        numVecs=mxGetN(prhs[3]);
+        numRows=mxGetM(prhs[3]);
+
+        if(numRows<3||numVecs<1||(numVecs!=N&&numVecs!=1)) {
+            mexErrMsgTxt("The receiver locations have the wrong dimensionality.");
+            return;
+        }
+
+        lRx=reinterpret_cast<double*>(mxGetData(prhs[3]));
+        if(numVecs==N&&N>1) {
+            lRxStride=numRows;
+        }
+    }
+
+    if(nrhs<5||mxIsEmpty(prhs[4])) {
+        M=identMat;
+    } else {
+        size_t numMats;
+        size_t numMatDims;
+        const size_t *matDims;
+
+        checkRealDoubleHypermatrix(prhs[4]);
+        numMatDims=mxGetNumberOfDimensions(prhs[4]);
+        matDims=mxGetDimensions(prhs[4]);
+
+        if(numMatDims<2||numMatDims>3||matDims[0]!=3||matDims[1]!=3) {
+           mexErrMsgTxt("The rotation matrices have the wrong dimensionality.");
+        }
+
+        if(numMatDims==2) {
+            numMats=1;
+        } else {
+            numMats=matDims[2];
+        }
+
+        if(numMats!=1&&numMats!=N) {
+            mexErrMsgTxt("The rotation matrices have the wrong dimensionality.");
+        }
+
+        M=reinterpret_cast<double*>(mxGetData(prhs[4]));
+        if(numMats==N&&N>1) {
+            MStride=9;
+        }
+    }
+
+    plhs[0]=mxCreateDoubleMatrix(3,N,mxREAL);
+    if(nlhs>1) {
+        mwSize dims[4];
+        dims[0]=3;
+        dims[1]=3;
+        dims[2]=N;
+
+        plhs[1]=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        J=reinterpret_cast<double*>(mxGetData(plhs[1]));
+
+        if(nlhs>2) {
+            dims[2]=3;
+            dims[3]=N;
+
+            plhs[2]=mxCreateNumericArray(4,dims,mxDOUBLE_CLASS,mxREAL);
+            H=reinterpret_cast<double*>(mxGetData(plhs[2]));
+        }
+    }
+
+    ruv2CartWithDerivsBatchCPP(reinterpret_cast<double*>(mxGetData(plhs[0])),J,H,zRuv,N,hasW,useHalfRange,lTx,lTxStride,lRx,lRxStride,M,MStride);
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,110 @@
+function [zCart,J,H]=ruv2CartWithDerivs(zRuv,useHalfRange,lTx,lRx,M)
+%%RUV2CARTWITHDERIVS Convert monostatic or bistatic r-u-v (or r-u-v-w)
+%            measurements to Cartesian coordinates and also get the
+%            Jacobians and optionally the Hessians of [r;u;v] with respect
+%            to Cartesian position at the converted points, as are used in
+%            Cartesian-converted measurement filters. This gives the same
+%            results as calling ruv2Cart, calcRuvConvJacob and rangeHessian
+%            and uvHessian at the converted points, but is faster, because
+%            each measurement is only converted once.
+%
+%INPUTS: zRuv A 3XN matrix of vectors with elements [r;u;v], where r is
+%          the bistatic range and u and v are direction cosines, or a 4XN
+%          matrix of [r;u;v;w] vectors, as in ruv2Cart.
+% useHalfRange A boolean value specifying whether the bistatic range value
+%          has been divided by two. The default if this parameter is
+%          omitted or an empty matrix is passed is false.
+%      lTx The 3XN [x;y;z] location vectors of the transmitters in global
+%          Cartesian coordinates. If this parameter is omitted or an empty
+%          matrix is passed, then the transmitters are assumed to be at the
+%          origin. If only a single vector is passed, then it is used for
+%          all of the measurements.
+%      lRx The 3XN [x;y;z] location vectors of the receivers in global
+%          Cartesian coordinates. If this parameter is omitted or an empty
+%          matrix is passed, then the receivers are assumed to be at the
+%          origin. If only a single vector is passed, then it is used for
+%          all of the measurements.
+%        M A 3X3XN hypermatrix of the rotation matrices to go from the
+%          alignment of the global coordinate system to that at the
+%          receiver. If omitted or an empty matrix is passed, then M=eye(3)
+%          is used. If only a single 3X3 matrix is passed, then it is used
+%          for all of the measurements.
+%
+%OUTPUTS: zCart The 3XN set of converted points in [x;y;z] Cartesian
+%               coordinates, as in ruv2Cart.
+%             J The 3X3XN set of Jacobian matrices, as in calcRuvConvJacob.
+%               Each row is a component of [r;u;v] and each column a
+%               derivative with respect to [x,y,z].
+%             H The 3X3X3XN set of Hessian matrices, where H(:,:,1,i),
+%               H(:,:,2,i) and H(:,:,3,i) are the Hessians of r, u and v of
+%               the ith point. These are only computed if requested.
+%
+%The algorithm can be compiled for use in Matlab  using the
+%CompileCLibraries function. The C++ implementation reuses the unit vector
+%and the range from the receiver found in the conversion for the
+%derivatives.
+%
+%The algorithm is run in Matlab using the command format
+%[zCart,J,H]=ruv2CartWithDerivs(zRuv,useHalfRange,lTx,lRx,M);
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+N=size(zRuv,2);
+
+if(nargin<5||isempty(M))
+    M=repmat(eye(3),[1,1,N]);
+elseif(size(M,3)==1)
+    M=repmat(M,[1,1,N]);
+end
+
+if(nargin<4||isempty(lRx))
+    lRx=zeros(3,N);
+elseif(size(lRx,2)==1)
+    lRx=repmat(lRx,[1,N]);
+end
+
+if(nargin<3||isempty(lTx))
+    lTx=zeros(3,N);
+elseif(size(lTx,2)==1)
+    lTx=repmat(lTx,[1,N]);
+end
+
+if(nargin<2||isempty(useHalfRange))
+    useHalfRange=false;
+end
+
+zCart=ruv2Cart(zRuv,useHalfRange,lTx,lRx,M);
+
+J=zeros(3,3,N);
+for curPoint=1:N
+    J(1,:,curPoint)=rangeGradient(zCart(:,curPoint),useHalfRange,lTx(1:3,curPoint),lRx(1:3,curPoint));
+    J(2:3,:,curPoint)=uvGradient(zCart(:,curPoint),lRx(1:3,curPoint),M(:,:,curPoint));
+end
+
+if(nargout>2)
+    H=zeros(3,3,3,N);
+    for curPoint=1:N
+        H(:,:,1,curPoint)=rangeHessian(zCart(:,curPoint),useHalfRange,lTx(1:3,curPoint),lRx(1:3,curPoint));
+        H(:,:,2:3,curPoint)=uvHessian(zCart(:,curPoint),lRx(1:3,curPoint),M(:,:,curPoint));
+    end
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -98,7 +98,7 @@
 void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
     double *points, *zTx, *zRx, *M;
     int systemType;
-    size_t i, N, numRows;
+    size_t N, numRows;
     //If multiple values are passed for zTx, zRx or M, then the three
     //offsets below are used to move to the next value when going through
     //the measurements. However, if onyl a single value is passed, but
@@ -240,24 +240,11 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     retMat=mxCreateDoubleMatrix(3,N,mxREAL);
     retData=reinterpret_cast<double*>(mxGetData(retMat));
     
-    //Convert each of the measurements
+    //Convert all of the measurements
     if(numRows==3) {//There is range.
-        for(i=0;i<N;i++) {
-            spher2CartGenCPP(retData,points,systemType,useHalfRange,zTx,zRx,M);
-            retData=retData+3;
-            points=points+3;
-            zTx=zTx+zTxOffset;
-            zRx=zRx+zRxOffset;
-            M=M+MOffset;
-        }
+        spher2CartBatchCPP(retData,points,N,systemType,useHalfRange,zTx,zTxOffset,zRx,zRxOffset,M,MOffset);
     } else {//M==2 --there is no range
-        for(i=0;i<N;i++) {
-            spher2CartNoRangeCPP(retData,points,systemType,M);
-
-            retData=retData+3;
-            points=points+2;
-            M=M+MOffset;
-        }
+        spher2CartNoRangeBatchCPP(retData,points,N,systemType,M,MOffset);
     }
     
     plhs[0]=retMat;
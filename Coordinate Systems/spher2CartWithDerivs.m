@@ -0,0 +1,134 @@
+function [zCart,J,H]=spher2CartWithDerivs(zSpher,systemType,useHalfRange,lTx,lRx,M)
+%%SPHER2CARTWITHDERIVS Convert monostatic or bistatic spherical
+%            measurements to Cartesian coordinates and also get the
+%            Jacobians and optionally the Hessians of the measurements with
+%            respect to Cartesian position at the converted points, as are
+%            used in Cartesian-converted measurement filters. This gives
+%            the same results as calling spher2Cart, calcSpherConvJacob and
+%            calcSpherConvHessian, but is faster, because each measurement
+%            is only converted once.
+%
+%INPUTS: zSpher A 3XN set of points in range and azimuth and angle in the
+%           format [range;azimuth;angle], where the angles are given in
+%           radians.
+% systemType An optional parameter specifying the axes from which the
+%           angles are measured in radians. Possible values are
+%           0 (The default if omitted) Azimuth is measured
+%             counterclockwise from the x-axis in the x-y plane. Elevation
+%             is measured up from the x-y plane (towards the z-axis). This
+%             is consistent with common spherical coordinate systems for
+%             specifying longitude (azimuth) and geocentric latitude
+%             (elevation).
+%           1 Azimuth is measured counterclockwise from the z-axis in the
+%             z-x plane. Elevation is measured up from the z-x plane
+%             (towards the y-axis). This is consistent with some spherical
+%             coordinate systems that use the z axis as the boresight
+%             direction of the radar.
+%           2 This is the same as 0 except instead of being given
+%             elevation, one is given the angle away from the z-axis, which
+%             is (pi/2-elevation).
+% useHalfRange An optional boolean value specifying whether the bistatic
+%           (round-trip) range value has been divided by two. The default
+%           if this parameter is omitted or an empty matrix is passed is
+%           false if lTx is provided and true if it is omitted
+%           (monostatic).
+%       lTx The 3XN [x;y;z] location vectors of the transmitters in global
+%           Cartesian coordinates. If this parameter is omitted or an
+%           empty matrix is passed, then the transmitters are assumed to
+%           be at the origin. If only a single vector is passed, then it is
+%           used for all of the measurements.
+%       lRx The 3XN [x;y;z] location vectors of the receivers in global
+%           Cartesian coordinates. If this parameter is omitted or an
+%           empty matrix is passed, then the receivers are assumed to be
+%           at the origin. If only a single vector is passed, then it is
+%           used for all of the measurements.
+%         M A 3X3XN hypermatrix of the rotation matrices to go from the
+%           alignment of the global coordinate system to that at the
+%           receiver. If omitted or an empty matrix is passed, then
+%           M=eye(3) is used. If only a single 3X3 matrix is passed, then
+%           it is used for all of the measurements.
+%
+%OUTPUTS: zCart The 3XN set of converted points in [x;y;z] Cartesian
+%               coordinates, as in spher2Cart.
+%             J The 3X3XN set of Jacobian matrices, as in
+%               calcSpherConvJacob. Each row is a component of
+%               [range;azimuth;angle] and each column a derivative with
+%               respect to [x,y,z].
+%             H The 3X3X3XN set of Hessian matrices, where H(:,:,1,i),
+%               H(:,:,2,i) and H(:,:,3,i) are the Hessians of the range,
+%               azimuth and angle of the ith point, as in
+%               calcSpherConvHessian. These are only computed if requested.
+%
+%The algorithm can be compiled for use in Matlab  using the
+%CompileCLibraries function. The C++ implementation reuses the sines and
+%cosines of the angles and the range from the receiver found in the
+%conversion for the derivatives.
+%
+%The algorithm is run in Matlab using the command format
+%[zCart,J,H]=spher2CartWithDerivs(zSpher,systemType,useHalfRange,lTx,lRx,M);
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+N=size(zSpher,2);
+
+if(nargin<6||isempty(M))
+    M=repmat(eye(3),[1,1,N]);
+elseif(size(M,3)==1)
+    M=repmat(M,[1,1,N]);
+end
+
+if(nargin<5||isempty(lRx))
+    lRx=zeros(3,N);
+elseif(size(lRx,2)==1)
+    lRx=repmat(lRx,[1,N]);
+end
+
+if((nargin<4||isempty(lTx))&&(nargin<3||isempty(useHalfRange)))
+    useHalfRange=true;
+elseif(nargin<3||isempty(useHalfRange))
+    useHalfRange=false;
+end
+
+if(nargin<4||isempty(lTx))
+    lTx=zeros(3,N);
+elseif(size(lTx,2)==1)
+    lTx=repmat(lTx,[1,N]);
+end
+
+if(nargin<2||isempty(systemType))
+    systemType=0;
+end
+
+zCart=spher2Cart(zSpher,systemType,useHalfRange,lTx,lRx,M);
+
+J=zeros(3,3,N);
+for curPoint=1:N
+    J(:,:,curPoint)=calcSpherConvJacob(zSpher(:,curPoint),systemType,useHalfRange,lTx(1:3,curPoint),lRx(1:3,curPoint),M(:,:,curPoint));
+end
+
+if(nargout>2)
+    H=zeros(3,3,3,N);
+    for curPoint=1:N
+        H(:,:,:,curPoint)=calcSpherConvHessian(zSpher(:,curPoint),systemType,useHalfRange,lTx(1:3,curPoint),lRx(1:3,curPoint),M(:,:,curPoint));
+    end
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -0,0 +1,600 @@
+/**GRAVACCELCACHECPP A C++ class that holds a precomputed interpolation
+ *               table of the acceleration due to a gravitational potential
+ *               given in terms of spherical harmonic coefficients. See
+ *               gravAccelCacheCPP.hpp for more details.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "gravAccelCacheCPP.hpp"
+#include "mathFuncs.hpp"
+//For sqrt, cos, atan2, asin and floor
+#include <cmath>
+//For memcpy and memcmp
+#include <cstring>
+//For fopen, fwrite and fclose
+#include <cstdio>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+static const char gravAccelCacheMagic[8]={'T','C','L','G','R','A','V','1'};
+static const uint64_t gravAccelCacheByteOrder=0x0102030405060708ULL;
+//The number of directions used to check the Chebyshev series in range.
+static const size_t gravAccelCacheNumDirs=48;
+//The scale factor for the Legendre function ratios.
+static const double gravAccelCacheScalFactor=1e-280;
+
+static size_t gravAccelCacheNumCoeffs(const gravAccelShellCPP &shell, const size_t chebOrder);
+static void gravAccelCacheTruth(double *accelVals, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double *pointSpher, const size_t numPoints, const double a, const double c, const size_t numThreads, const double tol);
+static double gravAccelCacheRadialErr(const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double a, const double c, const double r0, const double r1, const size_t chebOrder, const size_t numThreads, const double tol);
+static void gravAccelCacheFillShell(double *shellData, const gravAccelShellCPP &shell, const size_t chebOrder, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double a, const double c, const double cC00, const size_t numThreads);
+static void gravAccelCacheEvalShell(double *accelVal, const gravAccelShellCPP &shell, const double *shellData, const size_t chebOrder, const double r, const double azimuth, const double elevation);
+static void cubicLagrangeWeights(double w[4], const double f);
+
+//The definition is needed because std::min takes its arguments by reference.
+const size_t gravAccelCacheCPP::maxChebOrder;
+
+gravAccelCacheCPP::gravAccelCacheCPP() : rMin(0), rMax(0), tol(0), cC00(0), chebOrder(0), coeffData(NULL) {}
+
+void gravAccelCacheCPP::build(const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double a, const double c, const double rMinDes, const double rMaxDes, const double tolDes, const size_t chebOrderDes, const size_t maxNumLon, const size_t numThreads) {
+    const size_t M=C.numClust-1;
+    const double pi=2.0*acos(0.0);
+    vector<double> degreeNorms(M+1);
+    vector<double> rBounds;
+    vector<double> pointSpher, truth;
+    vector<double> shellData;
+
+    file.close();
+    ownedData.clear();
+    shells.clear();
+    coeffData=NULL;
+
+    rMin=rMinDes;
+    rMax=rMaxDes;
+    tol=tolDes;
+    cC00=c*C[0][0];
+    chebOrder=min(chebOrderDes,maxChebOrder);
+
+    spherHarmonicDegreeNormsCPP(degreeNorms.data(),C,S);
+
+    //Split the band of ranges until the Chebyshev series in range of each
+    //shell is accurate enough. The intervals on the stack are kept in
+    //decreasing order so that the shells come out in increasing order.
+    {
+        vector<pair<double,double> > intervals;
+        const double minWidth=(rMax-rMin)*1e-6;
+
+        intervals.push_back(make_pair(rMin,rMax));
+        while(!intervals.empty()) {
+            const pair<double,double> cur=intervals.back();
+            intervals.pop_back();
+
+            if(cur.second-cur.first>minWidth&&gravAccelCacheRadialErr(C,S,a,c,cur.first,cur.second,chebOrder,numThreads,tol/16)>tol/4) {
+                const double rMid=(cur.first+cur.second)/2;
+                intervals.push_back(make_pair(rMid,cur.second));
+                intervals.push_back(make_pair(cur.first,rMid));
+            } else {
+                rBounds.push_back(cur.first);
+            }
+        }
+        rBounds.push_back(rMax);
+    }
+
+    for(size_t curShell=0;curShell+1<rBounds.size();curShell++) {
+        gravAccelShellCPP shell;
+        //The degree needed at the bottom of the shell, which is the most
+        //that is needed anywhere in the shell.
+        const size_t NEff=spherHarmonicTruncDegreeCPP(degreeNorms.data(),M,rBounds[curShell],a,c,true,tol/8);
+        CountingClusterSetCPP<double> CTrunc, STrunc;
+        size_t numLon=max(static_cast<size_t>(8),2*(NEff+1));
+        double maxErr;
+
+        //Views of the first NEff+1 degrees of the coefficients.
+        CTrunc.numClust=NEff+1;
+        CTrunc.totalNumEl=(NEff+1)*(NEff+2)/2;
+        CTrunc.clusterEls=C.clusterEls;
+        STrunc.numClust=NEff+1;
+        STrunc.totalNumEl=CTrunc.totalNumEl;
+        STrunc.clusterEls=S.clusterEls;
+
+        memset(&shell,0,sizeof(shell));
+        shell.r0=rBounds[curShell];
+        shell.r1=rBounds[curShell+1];
+        //The pole reflection requires an even number of azimuths.
+        numLon+=numLon%2;
+
+        while(true) {
+            //Validate at the centers of the cells between the grid points,
+            //taking at most about 64 samples in each angle, at the bottom
+            //and in the middle of the shell. The rows between the last
+            //grid points and the poles are also checked.
+            size_t numLat, latStride, lonStride, numVal;
+            double deltaLat, deltaLon;
+
+            shell.numLon=numLon;
+            shell.numLat=numLon/2;
+            numLat=shell.numLat;
+            deltaLat=pi/numLat;
+            deltaLon=2*pi/numLon;
+
+            shellData.resize(gravAccelCacheNumCoeffs(shell,chebOrder));
+            gravAccelCacheFillShell(shellData.data(),shell,chebOrder,CTrunc,STrunc,a,c,cC00,numThreads);
+
+            latStride=max(static_cast<size_t>(1),numLat/64);
+            lonStride=max(static_cast<size_t>(1),numLon/64);
+            pointSpher.clear();
+            for(size_t curR=0;curR<2;curR++) {
+                const double r=(curR==0)?shell.r0:(shell.r0+shell.r1)/2;
+
+                for(size_t curLat=0;curLat<=numLat;curLat+=latStride) {
+                    double elev;
+
+                    if(curLat==0) {
+                        elev=-pi/2+deltaLat/4;
+                    } else if(curLat==numLat) {
+                        elev=pi/2-deltaLat/4;
+                    } else {
+                        elev=-pi/2+curLat*deltaLat;
+                    }
+
+                    for(size_t curLon=0;curLon<numLon;curLon+=lonStride) {
+                        pointSpher.push_back(r);
+                        pointSpher.push_back((curLon+0.5)*deltaLon);
+                        pointSpher.push_back(elev);
+                    }
+
+                    //Make sure that the row next to the north pole is
+                    //included.
+                    if(curLat<numLat&&curLat+latStride>numLat) {
+                        curLat=numLat-latStride;
+                    }
+                }
+            }
+            numVal=pointSpher.size()/3;
+            truth.resize(3*numVal);
+            gravAccelCacheTruth(truth.data(),C,S,pointSpher.data(),numVal,a,c,numThreads,tol/16);
+
+            maxErr=0;
+            for(size_t curVal=0;curVal<numVal;curVal++) {
+                const double r=pointSpher[3*curVal];
+                const double azimuth=pointSpher[3*curVal+1];
+                const double elev=pointSpher[3*curVal+2];
+                //The unit vector in the direction of the point.
+                const double u[3]={cos(elev)*cos(azimuth),cos(elev)*sin(azimuth),sin(elev)};
+                double approx[3];
+                double err=0;
+
+                gravAccelCacheEvalShell(approx,shell,shellData.data(),chebOrder,r,azimuth,elev);
+                for(size_t k=0;k<3;k++) {
+                    const double diff=approx[k]-cC00*u[k]/(r*r)-truth[3*curVal+k];
+                    err+=diff*diff;
+                }
+                maxErr=max(maxErr,sqrt(err));
+            }
+
+            if(maxErr<=tol/2||2*numLon>maxNumLon) {
+                break;
+            }
+            numLon*=2;
+        }
+
+        shell.errBound=2*maxErr;
+        shell.dataOffset=ownedData.size();
+        ownedData.insert(ownedData.end(),shellData.begin(),shellData.end());
+        shells.push_back(shell);
+    }
+
+    coeffData=ownedData.data();
+}
+
+bool gravAccelCacheCPP::save(const char *fileName) const {
+    gravAccelCacheHeaderCPP header;
+    size_t numCoeffs=0;
+    bool success;
+    FILE *fp;
+
+    if(shells.empty()) {
+        return false;
+    }
+
+    memset(&header,0,sizeof(header));
+    memcpy(header.magic,gravAccelCacheMagic,sizeof(header.magic));
+    header.byteOrder=gravAccelCacheByteOrder;
+    header.numShells=shells.size();
+    header.chebOrder=chebOrder;
+    header.rMin=rMin;
+    header.rMax=rMax;
+    header.tol=tol;
+    header.cC00=cC00;
+
+    for(size_t curShell=0;curShell<shells.size();curShell++) {
+        numCoeffs+=gravAccelCacheNumCoeffs(shells[curShell],chebOrder);
+    }
+
+    fp=fopen(fileName,"wb");
+    if(fp==NULL) {
+        return false;
+    }
+
+    success=fwrite(&header,sizeof(header),1,fp)==1;
+    success=success&&fwrite(shells.data(),sizeof(gravAccelShellCPP),shells.size(),fp)==shells.size();
+    success=success&&fwrite(coeffData,sizeof(double),numCoeffs,fp)==numCoeffs;
+    success=(fclose(fp)==0)&&success;
+
+    return success;
+}
+
+bool gravAccelCacheCPP::load(const char *fileName) {
+    gravAccelCacheHeaderCPP header;
+    const gravAccelShellCPP *fileShells;
+    size_t numCoeffs=0;
+    size_t dataStart;
+
+    file.close();
+    ownedData.clear();
+    shells.clear();
+    coeffData=NULL;
+
+    if(!file.open(fileName)) {
+        return false;
+    }
+
+    if(file.size()<sizeof(header)) {
+        file.close();
+        return false;
+    }
+    memcpy(&header,file.data(),sizeof(header));
+
+    if(memcmp(header.magic,gravAccelCacheMagic,sizeof(header.magic))!=0||header.byteOrder!=gravAccelCacheByteOrder||header.numShells==0||header.chebOrder>maxChebOrder||header.numShells>(file.size()-sizeof(header))/sizeof(gravAccelShellCPP)) {
+        file.close();
+        return false;
+    }
+
+    dataStart=sizeof(header)+header.numShells*sizeof(gravAccelShellCPP);
+    //The mapping is page aligned and the header and shell table have sizes
+    //that are multiples of 8 bytes, so the coefficients are aligned.
+    fileShells=reinterpret_cast<const gravAccelShellCPP*>(file.data()+sizeof(header));
+    shells.assign(fileShells,fileShells+header.numShells);
+    chebOrder=header.chebOrder;
+
+    //Make sure that every shell is valid and lies within the file, so that
+    //a corrupt file can not cause reads past the end of the mapping. The
+    //bounds on numLat keep 2*numLat and the products in
+    //gravAccelCacheNumCoeffs from overflowing.
+    {
+        const size_t maxNumCoeffs=(file.size()-dataStart)/sizeof(double);
+        const size_t numPerNode=3*(chebOrder+1);
+        const size_t maxSize=numeric_limits<size_t>::max();
+
+        for(size_t curShell=0;curShell<shells.size();curShell++) {
+            const gravAccelShellCPP &shell=shells[curShell];
+
+            if(shell.numLat<4||shell.numLat>maxSize/(2*numPerNode)||shell.numLon!=2*shell.numLat||!(shell.r1>shell.r0)||shell.dataOffset!=numCoeffs||shell.numLat>maxSize/(numPerNode*shell.numLon)||gravAccelCacheNumCoeffs(shell,chebOrder)>maxNumCoeffs-numCoeffs) {
+                shells.clear();
+                file.close();
+                return false;
+            }
+
+            numCoeffs+=gravAccelCacheNumCoeffs(shell,chebOrder);
+        }
+    }
+
+    //The coefficients must take up the rest of the file.
+    if(file.size()!=dataStart+numCoeffs*sizeof(double)) {
+        shells.clear();
+        file.close();
+        return false;
+    }
+
+    rMin=header.rMin;
+    rMax=header.rMax;
+    tol=header.tol;
+    cC00=header.cC00;
+    coeffData=reinterpret_cast<const double*>(file.data()+dataStart);
+
+    return true;
+}
+
+void gravAccelCacheCPP::accel(double *accelVals, double *errBound, const double *xyz, const size_t numPoints) const {
+    //errBound can be NULL if it is not desired.
+    for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+        double curErrBound;
+
+        accelPoint(accelVals+3*curPoint,curErrBound,xyz+3*curPoint);
+        if(errBound!=NULL) {
+            errBound[curPoint]=curErrBound;
+        }
+    }
+}
+
+void gravAccelCacheCPP::accelPoint(double *accelVal, double &errBound, const double *xyz) const {
+    const double x=xyz[0];
+    const double y=xyz[1];
+    const double z=xyz[2];
+    const double r=sqrt(x*x+y*y+z*z);
+    size_t lower, upper;
+
+    if(!(r>=rMin&&r<=rMax)||shells.empty()) {
+        accelVal[0]=accelVal[1]=accelVal[2]=numeric_limits<double>::quiet_NaN();
+        errBound=numeric_limits<double>::infinity();
+        return;
+    }
+
+    //Binary search for the shell containing r.
+    lower=0;
+    upper=shells.size()-1;
+    while(lower<upper) {
+        const size_t mid=(lower+upper)/2;
+
+        if(r>shells[mid].r1) {
+            lower=mid+1;
+        } else {
+            upper=mid;
+        }
+    }
+
+    {
+        const gravAccelShellCPP &shell=shells[lower];
+        const double elevation=asin(max(-1.0,min(1.0,z/r)));
+        const double azimuth=atan2(y,x);
+
+        const double pointMassScal=cC00/(r*r*r);
+
+        gravAccelCacheEvalShell(accelVal,shell,coeffData+shell.dataOffset,chebOrder,r,azimuth,elevation);
+        accelVal[0]-=pointMassScal*x;
+        accelVal[1]-=pointMassScal*y;
+        accelVal[2]-=pointMassScal*z;
+        errBound=shell.errBound;
+    }
+}
+
+static size_t gravAccelCacheNumCoeffs(const gravAccelShellCPP &shell, const size_t chebOrder) {
+    return static_cast<size_t>(shell.numLat*shell.numLon)*(chebOrder+1)*3;
+}
+
+static void gravAccelCacheTruth(double *accelVals, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double *pointSpher, const size_t numPoints, const double a, const double c, const size_t numThreads, const double tol) {
+    //The accelerations from the spherical harmonic coefficients in
+    //Cartesian coordinates, truncated per point to the given tolerance.
+    vector<double> V(numPoints);
+
+    spherHarmonicEvalCPPRealTrunc(V.data(),accelVals,NULL,NULL,C,S,pointSpher,numPoints,a,c,0,false,gravAccelCacheScalFactor,0,numThreads,tol,NULL);
+}
+
+static double gravAccelCacheRadialErr(const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double a, const double c, const double r0, const double r1, const size_t chebOrder, const size_t numThreads, const double tol) {
+    //The maximum error of the Chebyshev interpolating series of degree
+    //chebOrder in range on [r0,r1] through the samples at the Chebyshev
+    //nodes of the first kind in a set of directions. The series is checked
+    //at the extrema of the Chebyshev polynomial of degree chebOrder+1,
+    //which lie between the nodes and include the ends of the interval.
+    const double pi=2.0*acos(0.0);
+    const size_t numNodes=chebOrder+1;
+    const size_t numTest=chebOrder+2;
+    const size_t numPerDir=numNodes+numTest;
+    const double rMid=(r0+r1)/2;
+    const double rHalf=(r1-r0)/2;
+    vector<double> sVals(numPerDir);
+    vector<double> pointSpher(3*numPerDir*gravAccelCacheNumDirs);
+    vector<double> accelVals(3*numPerDir*gravAccelCacheNumDirs);
+    double maxErr=0;
+
+    for(size_t k=0;k<numNodes;k++) {
+        sVals[k]=cos(pi*(k+0.5)/numNodes);
+    }
+    for(size_t k=0;k<numTest;k++) {
+        sVals[numNodes+k]=cos(pi*k/(numTest-1));
+    }
+
+    //A Fibonacci lattice of directions.
+    for(size_t curDir=0;curDir<gravAccelCacheNumDirs;curDir++) {
+        const double goldenAngle=pi*(3.0-sqrt(5.0));
+        const double elev=asin(1.0-(2.0*curDir+1.0)/gravAccelCacheNumDirs);
+        const double azimuth=fmod(goldenAngle*curDir,2*pi);
+
+        for(size_t k=0;k<numPerDir;k++) {
+            double *curPoint=pointSpher.data()+3*(curDir*numPerDir+k);
+            curPoint[0]=rMid+rHalf*sVals[k];
+            curPoint[1]=azimuth;
+            curPoint[2]=elev;
+        }
+    }
+
+    gravAccelCacheTruth(accelVals.data(),C,S,pointSpher.data(),numPerDir*gravAccelCacheNumDirs,a,c,numThreads,tol);
+
+    for(size_t curDir=0;curDir<gravAccelCacheNumDirs;curDir++) {
+        const double *dirVals=accelVals.data()+3*curDir*numPerDir;
+        double coeffs[3*(gravAccelCacheCPP::maxChebOrder+1)];
+
+        //The Chebyshev coefficients from the values at the nodes.
+        for(size_t n=0;n<numNodes;n++) {
+            for(size_t comp=0;comp<3;comp++) {
+                double sum=0;
+                for(size_t k=0;k<numNodes;k++) {
+                    sum+=dirVals[3*k+comp]*cos(pi*n*(k+0.5)/numNodes);
+                }
+                coeffs[3*n+comp]=((n==0)?1.0:2.0)*sum/numNodes;
+            }
+        }
+
+        for(size_t k=0;k<numTest;k++) {
+            const double s=sVals[numNodes+k];
+            const double *trueVal=dirVals+3*(numNodes+k);
+            double err=0;
+
+            for(size_t comp=0;comp<3;comp++) {
+                double b1=0, b2=0, diff;
+                for(size_t n=chebOrder;n>0;n--) {
+                    const double b0=2*s*b1-b2+coeffs[3*n+comp];
+                    b2=b1;
+                    b1=b0;
+                }
+                diff=s*b1-b2+coeffs[comp]-trueVal[comp];
+                err+=diff*diff;
+            }
+            maxErr=max(maxErr,sqrt(err));
+        }
+    }
+
+    return maxErr;
+}
+
+static void gravAccelCacheFillShell(double *shellData, const gravAccelShellCPP &shell, const size_t chebOrder, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double a, const double c, const double cC00, const size_t numThreads) {
+    //Sample the Cartesian acceleration without the point-mass term on the
+    //grid of the shell at the Chebyshev nodes in range and convert the
+    //samples at each grid point into Chebyshev coefficients.
+    const double pi=2.0*acos(0.0);
+    const size_t numLat=shell.numLat;
+    const size_t numLon=shell.numLon;
+    const size_t numNodes=chebOrder+1;
+    const double rMid=(shell.r0+shell.r1)/2;
+    const double rHalf=(shell.r1-shell.r0)/2;
+    vector<double> elevation(numLat);
+    vector<double> rRow(numLat);
+    vector<double> V(numLat*numLon);
+    vector<double> gradV(3*numLat*numLon);
+    vector<double> cosTable(numNodes*numNodes);
+    vector<double> samples(3*numNodes);
+
+    for(size_t curLat=0;curLat<numLat;curLat++) {
+        elevation[curLat]=-pi/2+(curLat+0.5)*pi/numLat;
+    }
+
+    for(size_t k=0;k<numNodes;k++) {
+        const double r=rMid+rHalf*cos(pi*(k+0.5)/numNodes);
+
+        fill(rRow.begin(),rRow.end(),r);
+        spherHarmonicGridEvalCPP(V.data(),gradV.data(),C,S,elevation.data(),rRow.data(),numLat,numLon,0.0,a,c,false,gravAccelCacheScalFactor,numThreads);
+
+        for(size_t curLat=0;curLat<numLat;curLat++) {
+            const double cosElev=cos(elevation[curLat]);
+            const double sinElev=sin(elevation[curLat]);
+            const double pointMassScal=cC00/(r*r);
+
+            for(size_t curLon=0;curLon<numLon;curLon++) {
+                const double azimuth=2*pi*curLon/numLon;
+                const double *src=gradV.data()+3*(curLat+numLat*curLon);
+                double *dest=shellData+3*(numNodes*(curLat*numLon+curLon)+k);
+
+                dest[0]=src[0]+pointMassScal*cosElev*cos(azimuth);
+                dest[1]=src[1]+pointMassScal*cosElev*sin(azimuth);
+                dest[2]=src[2]+pointMassScal*sinElev;
+            }
+        }
+    }
+
+    for(size_t n=0;n<numNodes;n++) {
+        for(size_t k=0;k<numNodes;k++) {
+            cosTable[n*numNodes+k]=((n==0)?1.0:2.0)*cos(pi*n*(k+0.5)/numNodes)/numNodes;
+        }
+    }
+
+    for(size_t curNode=0;curNode<numLat*numLon;curNode++) {
+        double *nodeData=shellData+3*numNodes*curNode;
+
+        memcpy(samples.data(),nodeData,sizeof(double)*3*numNodes);
+        for(size_t n=0;n<numNodes;n++) {
+            double sum[3]={0,0,0};
+            for(size_t k=0;k<numNodes;k++) {
+                const double w=cosTable[n*numNodes+k];
+                sum[0]+=w*samples[3*k];
+                sum[1]+=w*samples[3*k+1];
+                sum[2]+=w*samples[3*k+2];
+            }
+            nodeData[3*n]=sum[0];
+            nodeData[3*n+1]=sum[1];
+            nodeData[3*n+2]=sum[2];
+        }
+    }
+}
+
+static void gravAccelCacheEvalShell(double *accelVal, const gravAccelShellCPP &shell, const double *shellData, const size_t chebOrder, const double r, const double azimuth, const double elevation) {
+    const double pi=2.0*acos(0.0);
+    const size_t numLat=shell.numLat;
+    const size_t numLon=shell.numLon;
+    const size_t numCoeffs=3*(chebOrder+1);
+    const double deltaLon=2*pi/numLon;
+    const double deltaLat=pi/numLat;
+    double coeffs[3*(gravAccelCacheCPP::maxChebOrder+1)];
+    double wLon[4], wLat[4];
+    double lonIdx, latIdx, s;
+    ptrdiff_t lon0, lat0;
+
+    lonIdx=azimuth/deltaLon;
+    lon0=static_cast<ptrdiff_t>(floor(lonIdx));
+    cubicLagrangeWeights(wLon,lonIdx-lon0);
+    //Put lon0 in the range 0 to numLon-1.
+    lon0%=static_cast<ptrdiff_t>(numLon);
+    if(lon0<0) {
+        lon0+=numLon;
+    }
+
+    latIdx=(elevation+pi/2)/deltaLat-0.5;
+    lat0=static_cast<ptrdiff_t>(floor(latIdx));
+    cubicLagrangeWeights(wLat,latIdx-lat0);
+
+    fill(coeffs,coeffs+numCoeffs,0.0);
+    for(ptrdiff_t i=0;i<4;i++) {
+        ptrdiff_t curLat=lat0-1+i;
+        size_t lonShift=0;
+
+        //Continue over the poles onto the other side of the sphere.
+        if(curLat<0) {
+            curLat=-1-curLat;
+            lonShift=numLon/2;
+        } else if(curLat>=static_cast<ptrdiff_t>(numLat)) {
+            curLat=2*static_cast<ptrdiff_t>(numLat)-1-curLat;
+            lonShift=numLon/2;
+        }
+
+        for(ptrdiff_t j=0;j<4;j++) {
+            const size_t curLon=(lon0+numLon-1+j+lonShift)%numLon;
+            const double w=wLat[i]*wLon[j];
+            const double *nodeData=shellData+numCoeffs*(curLat*numLon+curLon);
+
+            for(size_t q=0;q<numCoeffs;q++) {
+                coeffs[q]+=w*nodeData[q];
+            }
+        }
+    }
+
+    //Clenshaw's recurrence to sum the Chebyshev series in range.
+    s=(2*r-shell.r0-shell.r1)/(shell.r1-shell.r0);
+    for(size_t comp=0;comp<3;comp++) {
+        double b1=0, b2=0;
+        for(size_t n=chebOrder;n>0;n--) {
+            const double b0=2*s*b1-b2+coeffs[3*n+comp];
+            b2=b1;
+            b1=b0;
+        }
+        accelVal[comp]=s*b1-b2+coeffs[comp];
+    }
+}
+
+static void cubicLagrangeWeights(double w[4], const double f) {
+    //The weights of cubic Lagrange interpolation at the points -1, 0, 1
+    //and 2 for a value at f, where 0<=f<1.
+    w[0]=-f*(f-1)*(f-2)/6;
+    w[1]=(f+1)*(f-1)*(f-2)/2;
+    w[2]=-(f+1)*f*(f-2)/2;
+    w[3]=(f+1)*f*(f-1)/6;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
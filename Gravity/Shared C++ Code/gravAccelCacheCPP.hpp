@@ -0,0 +1,143 @@
+/**GRAVACCELCACHECPP A C++ class that holds a precomputed interpolation
+ *               table of the acceleration due to a gravitational
+ *               potential given by real, fully normalized spherical
+ *               harmonic coefficients over a band of ranges, so that the
+ *               acceleration can be obtained in O(1) operations per point
+ *               rather than the O(M^2) operations of a full spherical
+ *               harmonic synthesis of degree M.
+ *
+ *The band of ranges rMin<=r<=rMax is split into spherical shells. In each
+ *shell, the Cartesian acceleration components are stored on a grid of
+ *numLat elevations by numLon azimuths. The elevations are at the centers
+ *of numLat equal cells from -pi/2 to pi/2, so no point is at a pole, and
+ *the azimuths are 2*pi*i/numLon. At each grid point, the variation with
+ *range is given by a Chebyshev series of degree chebOrder in range over
+ *the shell. To find the acceleration at a point, the Chebyshev coefficients
+ *of the 4X4 nearest grid points are combined with cubic Lagrange
+ *interpolation weights in elevation and azimuth and the resulting series
+ *is summed. Near the poles, the interpolation stencil continues over the
+ *pole onto the grid points on the other side (azimuth plus pi), because
+ *the Cartesian components are smooth functions of elevation and azimuth
+ *continued past the poles in that manner. The point-mass term
+ *-c*C00*r/norm(r)^3 is computed directly and only the rest of the
+ *acceleration is interpolated, as the point-mass term is by far the
+ *largest and varies the most with the angles in Cartesian coordinates.
+ *
+ *The table is built adaptively. A shell is split in half while the error
+ *of the Chebyshev series in range, checked at test points in a set of
+ *directions, exceeds tol/4. For each shell, the grid starts with enough
+ *points to resolve the degree needed at the bottom of the shell, as given
+ *by spherHarmonicTruncDegreeCPP, and the number of points is doubled in
+ *both angles while the error found at validation points at the centers of
+ *the grid cells, where the interpolation error is largest, exceeds tol/2,
+ *unless numLon would exceed maxNumLon. The samples are computed with
+ *spherHarmonicGridEvalCPP using the coefficients truncated to that degree
+ *for a tolerance of tol/8. The errBound of each shell is twice the largest
+ *error found at the validation points. It is an estimate of the maximum
+ *error and not a strict bound.
+ *
+ *The table can be saved to a file and loaded from it. The file format is a
+ *64-byte header (gravAccelCacheHeaderCPP), followed by a 64-byte
+ *gravAccelShellCPP entry for each shell and then the coefficients of all
+ *of the shells as doubles. The values are in the byte order of the
+ *computer that wrote the file and load rejects files with a different
+ *byte order. When loaded, the file is memory mapped, so the coefficients
+ *are used directly from the file.
+ *
+ *The acceleration is in the same coordinate system as the coefficients,
+ *usually an Earth-fixed system, and does not include any Coriolis or
+ *centrifugal terms. Points outside of the band of ranges have NaN
+ *accelerations and an infinite error bound.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef GRAVACCELCACHECPP
+#define GRAVACCELCACHECPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "CountingClusterSetCPP.hpp"
+#include "mappedFileCPP.hpp"
+
+//The header at the start of a file.
+struct gravAccelCacheHeaderCPP {
+    char magic[8];//"TCLGRAV1"
+    uint64_t byteOrder;//0x0102030405060708 in the byte order of the file.
+    uint64_t numShells;
+    uint64_t chebOrder;
+    double rMin;
+    double rMax;
+    double tol;
+    double cC00;
+};
+
+//The description of a shell.
+struct gravAccelShellCPP {
+    double r0;//The range at the bottom of the shell.
+    double r1;//The range at the top of the shell.
+    double errBound;//The estimated maximum error in the shell.
+    uint64_t numLat;//The number of elevations.
+    uint64_t numLon;//The number of azimuths.
+    //The offset of the coefficients of the shell in doubles from the start
+    //of the coefficients of the first shell. The coefficients of grid
+    //point (curLat,curLon) start at index
+    //3*(chebOrder+1)*(curLat*numLon+curLon) and consist of chebOrder+1
+    //sets of the 3 Chebyshev coefficients of the x, y, and z components.
+    uint64_t dataOffset;
+    uint64_t reserved[2];
+};
+
+class gravAccelCacheCPP {
+public:
+    double rMin;
+    double rMax;
+    double tol;//The requested tolerance.
+    //c*C00, the gravitational parameter of the point-mass term.
+    double cC00;
+    size_t chebOrder;
+    std::vector<gravAccelShellCPP> shells;
+
+    //The largest value of chebOrder that is supported.
+    static const size_t maxChebOrder=32;
+
+    gravAccelCacheCPP();
+    void build(const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double a, const double c, const double rMinDes, const double rMaxDes, const double tolDes, const size_t chebOrderDes, const size_t maxNumLon, const size_t numThreads);
+    bool save(const char *fileName) const;
+    bool load(const char *fileName);
+    void accel(double *accelVals, double *errBound, const double *xyz, const size_t numPoints) const;
+
+private:
+    //The coefficients, either in ownedData or in the mapped file.
+    std::vector<double> ownedData;
+    mappedFileCPP file;
+    const double *coeffData;
+
+    void accelPoint(double *accelVal, double &errBound, const double *xyz) const;
+
+    //The tables can be large, so copying is not allowed.
+    gravAccelCacheCPP(const gravAccelCacheCPP &);
+    gravAccelCacheCPP &operator=(const gravAccelCacheCPP &);
+};
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
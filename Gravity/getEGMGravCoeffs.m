@@ -101,6 +101,18 @@ function [C,S,a,c,CStdDev,SStdDev]=getEGMGravCoeffs(M,isTideFree,modelType,TT1,T
 %faster. Note that after the .mat file has ben created, the text file can
 %be deleted.
 %
+%When the text file is read in full, the coefficients are also saved in
+%the binary format of saveSpherHarmonicCoeffs, in a file with the same
+%name and the extension .shcb. If that file exists, it is used before the
+%.mat file, because only the coefficients up to degree M are read from it.
+%The .shcb file can also be passed to the spherHarmonicModel class, which
+%memory maps it when the C++ implementation is available, so that
+%multiple processes can share the coefficients. It can be made from an
+%existing .mat file using
+% [C,S,a,c,CStdDev,SStdDev]=getEGMGravCoeffs();
+% saveSpherHarmonicCoeffs('EGM2008_to2190_TideFree.shcb',C,S,a,c,CStdDev,SStdDev);
+%and moving the file into the data folder.
+%
 %More on using the spherical harmonic coefficients is given in
 %the comments for the function spherHarmonicEval and the format and use of
 %the coefficients is also documented in
@@ -188,9 +200,11 @@ totalNumCoeffs=(M+1)*(M+2)/2;
 ScriptPath=mfilename('fullpath');
 ScriptFolder = fileparts(ScriptPath);
 
-%First, see if a .mat file with all of the data exists. If so, then use
-%that and ignore everything else.
-if(exist([ScriptFolder,fileName,'.mat'],'file'))
+%First, see if a binary or .mat file with all of the data exists. If so,
+%then use that and ignore everything else.
+if(exist([ScriptFolder,fileName,'.shcb'],'file'))
+    [C,S,~,~,CStdDev,SStdDev]=loadSpherHarmonicCoeffs([ScriptFolder,fileName,'.shcb'],M);
+elseif(exist([ScriptFolder,fileName,'.mat'],'file'))
     load([ScriptFolder,fileName,'.mat'],'C','S','CStdDev','SStdDev');
 
     C=C(1:totalNumCoeffs);
@@ -232,6 +246,7 @@ else
     %.mat file so that it can be read faster in the future.
     if(modelType==0&&M==2190||modelType==1&&M==360)
         save([ScriptFolder,fileName,'.mat'],'C','S','CStdDev','SStdDev');
+        saveSpherHarmonicCoeffs([ScriptFolder,fileName,'.shcb'],C,S,a,c,CStdDev,SStdDev);
     end
 end
 
@@ -0,0 +1,249 @@
+classdef gravAccelCache < handle
+%%GRAVACCELCACHE A precomputed interpolation table of the acceleration due
+%          to a gravitational field given by spherical harmonic
+%          coefficients over a band of ranges, such as the altitudes of
+%          low-Earth orbits. After the table has been built, the
+%          acceleration at a point is found in a fixed number of
+%          operations, independent of the degree of the model, rather
+%          than with a full spherical harmonic synthesis. The table can be
+%          saved to a file and loaded later, in which case the file is
+%          memory mapped, so loading is fast and multiple Matlab processes
+%          using the same file share its memory.
+%
+%The band of ranges is split into shells. In each shell, the Cartesian
+%components of the acceleration are stored as Chebyshev series in range on
+%a grid in elevation and azimuth and are interpolated with bicubic
+%Lagrange interpolation in the angles. The shells and grids are chosen
+%adaptively so that the error found at a set of validation points, where
+%the interpolation error is largest, does not exceed tol. Each shell has an
+%error bound equal to twice the largest error found at its validation
+%points. This is an estimate and not a strict bound. See the comments in
+%gravAccelCacheCPP.hpp for more details.
+%
+%The acceleration is given in the coordinate system of the coefficients,
+%such as the ITRS for EGM2008, and does not include Coriolis or
+%centrifugal terms. Points outside of the band of ranges produce NaN
+%accelerations and infinite error bounds. Cache files use the byte order
+%of the computer that made them and can not be loaded on a computer with a
+%different byte order.
+%
+%A cache requires the C++ implementation, which is compiled as
+%gravAccelCacheCPPInt. If it has not been compiled, then the accel method
+%just evaluates the coefficients with spherHarmonicEval, the error bounds
+%are zero and the save method and loading from a file are not available.
+%Note that if the C++ implementation is used, the mex file is locked when
+%a gravAccelCache object is created and is not unlocked (and able to be
+%recompiled) until all of the gravAccelCache objects have been freed.
+%
+%Modification of the CPPData member of this class can potentially lead to
+%Matlab crashing as CPPData is a pointer to data in the C++
+%implementation.
+%
+%EXAMPLE:
+%Here, a cache of the tide-free EGM2008 model truncated to degree 360 is
+%built for altitudes from 300km to 2000km with a tolerance of 1e-7 m/s^2,
+%saved and then loaded again.
+% [C,S]=getEGMGravCoeffs(360,true);
+% a=Constants.EGM2008SemiMajorAxis;
+% cache=gravAccelCache(C,S,a+300e3,a+2000e3,1e-7);
+% cache.save('EGM2008Deg360.bin');
+% cache=gravAccelCache('EGM2008Deg360.bin');
+% [accel,errBound]=cache.accel([a+500e3;0;1e6]);
+%The acceleration is the same to within errBound as that from
+% [~,accel]=spherHarmonicEval(C,S,Cart2Sphere([a+500e3;0;1e6]));
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+properties(Access=private)
+   C%The coefficients. These are only used if there is no C++
+   S%implementation.
+   a
+   c
+   rMin
+   rMax
+
+   CPPData%Only used if an interface to a C++ implementation exists.
+end
+
+methods
+    function newCache=gravAccelCache(C,S,rMin,rMax,tol,a,c,chebOrder,maxNumLon,numThreads)
+    %%GRAVACCELCACHE Build a new cache from a set of spherical harmonic
+    %          coefficients or load a cache from a file.
+    %
+    %INPUTS: C, S Length (M+2)*(M+1)/2 real arrays holding the fully
+    %             normalized coefficients of the potential, as in
+    %             spherHarmonicEval. If CountingClusterSet objects are
+    %             passed, their clusterEls are used. Alternatively, C can
+    %             be the name of a file made with the save method, in which
+    %             case no other inputs are used.
+    %   rMin, rMax The lowest and highest ranges (distances from the
+    %             origin) in meters at which the acceleration can be found.
+    %         tol The desired maximum error of the acceleration in meters
+    %             per second squared. If omitted or an empty matrix is
+    %             passed, 1e-8 is used.
+    %           a The numerator in the (a/r)^n term in the spherical
+    %             harmonic sum. If omitted or an empty matrix is passed,
+    %             Constants.EGM2008SemiMajorAxis is used.
+    %           c The constant value by which the spherical harmonic series
+    %             is multiplied. If omitted or an empty matrix is passed,
+    %             Constants.EGM2008GM is used.
+    %   chebOrder The degree of the Chebyshev series in range in each
+    %             shell, from 1 to 32. If omitted or an empty matrix is
+    %             passed, 8 is used. Higher values make fewer, thicker
+    %             shells, but make each evaluation slower.
+    %   maxNumLon The maximum number of azimuths in the grid of a shell. The
+    %             number of elevations is half of this. If the tolerance is
+    %             not reached with this many points, then the error bound
+    %             of the shell will be larger than tol. If omitted or an
+    %             empty matrix is passed, 8192 is used.
+    %  numThreads The number of threads to use when building the table. If
+    %             omitted or an empty matrix is passed, 1 is used.
+    %
+    %OUTPUTS: newCache A new gravAccelCache instance.
+    %
+    %Building a cache takes longer than evaluating the coefficients at the
+    %points of the grids, which can be many millions of points for a
+    %high-degree model near the surface of the Earth. The size of the table
+    %in bytes is about 24*(chebOrder+1)*numLat*numLon per shell.
+
+        if(ischar(C))
+            if(~exist('gravAccelCacheCPPInt','file'))
+                error('Loading a cache from a file requires the compiled C++ implementation.')
+            end
+            newCache.CPPData=gravAccelCacheCPPInt('load',C);
+            return;
+        end
+
+        if(nargin<10||isempty(numThreads))
+            numThreads=1;
+        end
+
+        if(nargin<9||isempty(maxNumLon))
+            maxNumLon=8192;
+        end
+
+        if(nargin<8||isempty(chebOrder))
+            chebOrder=8;
+        end
+
+        if(nargin<7||isempty(c))
+            c=Constants.EGM2008GM;
+        end
+
+        if(nargin<6||isempty(a))
+            a=Constants.EGM2008SemiMajorAxis;
+        end
+
+        if(nargin<5||isempty(tol))
+            tol=1e-8;
+        end
+
+        if(isa(C,'CountingClusterSet'))
+            C=C.clusterEls;
+        end
+
+        if(isa(S,'CountingClusterSet'))
+            S=S.clusterEls;
+        end
+
+        if(~isreal(C)||~isreal(S)||~isreal(a)||~isreal(c))
+            error('Only real spherical harmonic models are supported.')
+        end
+
+        if(exist('gravAccelCacheCPPInt','file'))
+            newCache.CPPData=gravAccelCacheCPPInt('gravAccelCacheCPP',C(:),S(:),a,c,rMin,rMax,tol,chebOrder,maxNumLon,numThreads);
+        else
+            newCache.C=C(:);
+            newCache.S=S(:);
+            newCache.a=a;
+            newCache.c=c;
+            newCache.rMin=rMin;
+            newCache.rMax=rMax;
+        end
+    end
+
+    function [accel,errBound]=accel(theCache,xyz)
+    %%ACCEL Find the acceleration at a set of points.
+    %
+    %INPUTS: xyz A 3XN set of N points in Cartesian coordinates in the
+    %            coordinate system of the coefficients.
+    %
+    %OUTPUTS: accel The 3XN set of accelerations. These are NaN for points
+    %               outside of the band of ranges of the cache.
+    %      errBound A 1XN set of the estimated maximum errors of the
+    %               accelerations. These are Inf for points outside of the
+    %               band of ranges.
+
+        if(exist('gravAccelCacheCPPInt','file'))
+            if(nargout>1)
+                [accel,errBound]=gravAccelCacheCPPInt('accel',theCache.CPPData,xyz);
+            else
+                accel=gravAccelCacheCPPInt('accel',theCache.CPPData,xyz);
+            end
+        else
+            [~,accel]=spherHarmonicEval(theCache.C,theCache.S,Cart2Sphere(xyz),theCache.a,theCache.c);
+
+            r=sqrt(sum(xyz.*xyz,1));
+            errBound=zeros(1,size(xyz,2));
+            outOfBand=~(r>=theCache.rMin&r<=theCache.rMax);
+            accel(:,outOfBand)=NaN;
+            errBound(outOfBand)=Inf;
+        end
+    end
+
+    function save(theCache,fileName)
+    %%SAVE Save the cache to a file that can be loaded by passing the
+    %      file name to the constructor.
+
+        if(~exist('gravAccelCacheCPPInt','file'))
+            error('Saving a cache requires the compiled C++ implementation.')
+        end
+
+        gravAccelCacheCPPInt('save',theCache.CPPData,fileName);
+    end
+
+    function [shellInfo,rMin,rMax,tol,chebOrder]=getInfo(theCache)
+    %%GETINFO Get a description of the shells of the cache.
+    %
+    %OUTPUTS: shellInfo A 5XnumShells matrix whose columns are
+    %                  [r0;r1;errBound;numLat;numLon] for each shell, where
+    %                  r0 and r1 are the bounds of the shell in range.
+    %   rMin, rMax, tol, chebOrder The values used to build the cache.
+
+        if(~exist('gravAccelCacheCPPInt','file'))
+            error('getInfo requires the compiled C++ implementation.')
+        end
+
+        [shellInfo,rMin,rMax,tol,chebOrder]=gravAccelCacheCPPInt('getInfo',theCache.CPPData);
+    end
+
+    function delete(theCache)
+    %%DELETE The destructor method. This method is used when the cache is
+    %        implemented as a C++ class. This method prevents a memory
+    %        leak.
+
+        if(exist('gravAccelCacheCPPInt','file')&&~isempty(theCache.CPPData))
+            gravAccelCacheCPPInt('~gravAccelCacheCPP',theCache.CPPData);
+        end
+    end
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
\ No newline at end of file
@@ -0,0 +1,240 @@
+/**GRAVACCELCACHECPPINT An interface between the Matlab gravAccelCache
+ *              class and the C++ gravAccelCacheCPP class. This function is
+ *              meant to be called by the gravAccelCache class in Matlab;
+ *              not directly by the user.
+ *
+ *As the data of the true C++ class is stored in the CPPData input that is
+ *passed to this function, passing garbage for the CPPData input can cause
+ *Matlab to crash.
+ *
+ *The function is called as
+ *newCache.CPPData=gravAccelCacheCPPInt('gravAccelCacheCPP',C,S,a,c,rMin,rMax,tol,chebOrder,maxNumLon,numThreads);
+ *or
+ *newCache.CPPData=gravAccelCacheCPPInt('load',fileName);
+ *or
+ *[accel,errBound]=gravAccelCacheCPPInt('accel',CPPData,xyz);
+ *or
+ *gravAccelCacheCPPInt('save',CPPData,fileName);
+ *or
+ *[shellInfo,rMin,rMax,tol,chebOrder]=gravAccelCacheCPPInt('getInfo',CPPData);
+ *or
+ *gravAccelCacheCPPInt('~gravAccelCacheCPP',CPPData);
+ *
+ *shellInfo is a 5XnumShells matrix whose columns are
+ *[r0;r1;errBound;numLat;numLon] for each shell.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For strcmp
+#include <cstring>
+//Needed for sqrt
+#include <cmath>
+#include "matrix.h"
+#include "mex.h"
+#include "MexValidation.h"
+#include "gravAccelCacheCPP.hpp"
+
+void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
+    char cmd[64];
+    gravAccelCacheCPP *theCache;
+
+    if(nrhs<2||nrhs>11) {
+        mexErrMsgTxt("Wrong number of inputs.");
+    }
+
+    //Get the command string that is passed.
+    mxGetString(prhs[0], cmd, sizeof(cmd));
+
+    if(!strcmp("gravAccelCacheCPP", cmd)){
+        size_t M, totalNumEls, chebOrder, maxNumLon, numThreads;
+        double a, c, rMin, rMax, tol;
+        CountingClusterSetCPP<double> C, S;
+        mxArray *retPtr;
+
+        if(nrhs!=11) {
+            mexErrMsgTxt("Wrong number of inputs.");
+        }
+
+        checkRealDoubleArray(prhs[1]);
+        checkRealDoubleArray(prhs[2]);
+        if(mxIsEmpty(prhs[1])||mxIsEmpty(prhs[2])||mxGetM(prhs[1])!=mxGetM(prhs[2])||mxGetN(prhs[1])!=mxGetN(prhs[2])) {
+            mexErrMsgTxt("Invalid data passed.");
+        }
+
+        //Since the total number of points in a CountingClusterSetCPP
+        //is (M+1)*(M+2)/2, where M is the number of clusters -1, we can
+        //easily verify that a valid number of points was passed.
+        totalNumEls=mxGetM(prhs[1])*mxGetN(prhs[1]);
+        M=(-3+static_cast<size_t>(sqrt(static_cast<double>(1+8*totalNumEls))))/2;
+        if((M+1)*(M+2)/2!=totalNumEls) {
+            mexErrMsgTxt("S and C contain an inconsistent number of elements.");
+        }
+
+        a=getDoubleFromMatlab(prhs[3]);
+        c=getDoubleFromMatlab(prhs[4]);
+        rMin=getDoubleFromMatlab(prhs[5]);
+        rMax=getDoubleFromMatlab(prhs[6]);
+        tol=getDoubleFromMatlab(prhs[7]);
+        chebOrder=getSizeTFromMatlab(prhs[8]);
+        maxNumLon=getSizeTFromMatlab(prhs[9]);
+        numThreads=getSizeTFromMatlab(prhs[10]);
+
+        if(!(rMin>0)||!(rMax>rMin)) {
+            mexErrMsgTxt("The range bounds must satisfy 0<rMin<rMax.");
+        }
+
+        if(!(tol>0)) {
+            mexErrMsgTxt("The tolerance must be positive.");
+        }
+
+        if(chebOrder<1||chebOrder>gravAccelCacheCPP::maxChebOrder) {
+            mexErrMsgTxt("chebOrder must be from 1 to 32.");
+        }
+
+        //The coefficients are used in place, so these do not own their
+        //memory.
+        C.numClust=M+1;
+        C.totalNumEl=totalNumEls;
+        C.clusterEls=mxGetPr(prhs[1]);
+        S.numClust=M+1;
+        S.totalNumEl=totalNumEls;
+        S.clusterEls=mxGetPr(prhs[2]);
+
+        theCache=new gravAccelCacheCPP();
+        theCache->build(C,S,a,c,rMin,rMax,tol,chebOrder,maxNumLon,numThreads);
+
+        //Convert the pointer to a Matlab matrix to return.
+        retPtr=ptr2Matlab<gravAccelCacheCPP*>(theCache);
+
+        //Lock this mex file so that it can not be cleared until the object
+        //has been deleted (This avoids a memory leak).
+        mexLock();
+        //Return the pointer to the cache
+        plhs[0]=retPtr;
+    } else if(!strcmp("load",cmd)) {
+        char *fileName;
+        bool success;
+
+        if(nrhs!=2||!mxIsChar(prhs[1])) {
+            mexErrMsgTxt("A file name must be given.");
+        }
+
+        fileName=mxArrayToString(prhs[1]);
+        theCache=new gravAccelCacheCPP();
+        success=theCache->load(fileName);
+        mxFree(fileName);
+
+        if(!success) {
+            delete theCache;
+            mexErrMsgTxt("The file could not be opened or is not a valid cache file for this computer.");
+        }
+
+        plhs[0]=ptr2Matlab<gravAccelCacheCPP*>(theCache);
+        mexLock();
+    } else if(!strcmp("accel",cmd)) {
+        size_t numPoints;
+        mxArray *accelMATLAB;
+        double *errBound=NULL;
+
+        if(nrhs!=3) {
+            mexErrMsgTxt("Wrong number of inputs.");
+        }
+
+        if(nlhs>2) {
+            mexErrMsgTxt("Invalid number of outputs.");
+        }
+
+        //Get the pointer back from Matlab.
+        theCache=Matlab2Ptr<gravAccelCacheCPP*>(prhs[1]);
+
+        checkRealDoubleArray(prhs[2]);
+        if(mxGetM(prhs[2])!=3) {
+            mexErrMsgTxt("The points have an incorrect dimensionality.");
+        }
+        numPoints=mxGetN(prhs[2]);
+
+        accelMATLAB=mxCreateDoubleMatrix(3,numPoints,mxREAL);
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleMatrix(1,numPoints,mxREAL);
+            errBound=mxGetPr(plhs[1]);
+        }
+
+        theCache->accel(mxGetPr(accelMATLAB),errBound,mxGetPr(prhs[2]),numPoints);
+        plhs[0]=accelMATLAB;
+    } else if(!strcmp("save",cmd)) {
+        char *fileName;
+        bool success;
+
+        if(nrhs!=3||!mxIsChar(prhs[2])) {
+            mexErrMsgTxt("A file name must be given.");
+        }
+
+        theCache=Matlab2Ptr<gravAccelCacheCPP*>(prhs[1]);
+        fileName=mxArrayToString(prhs[2]);
+        success=theCache->save(fileName);
+        mxFree(fileName);
+
+        if(!success) {
+            mexErrMsgTxt("The file could not be written.");
+        }
+    } else if(!strcmp("getInfo",cmd)) {
+        size_t numShells;
+        double *shellInfo;
+
+        theCache=Matlab2Ptr<gravAccelCacheCPP*>(prhs[1]);
+        numShells=theCache->shells.size();
+
+        plhs[0]=mxCreateDoubleMatrix(5,numShells,mxREAL);
+        shellInfo=mxGetPr(plhs[0]);
+        for(size_t curShell=0;curShell<numShells;curShell++) {
+            const gravAccelShellCPP &shell=theCache->shells[curShell];
+
+            shellInfo[5*curShell]=shell.r0;
+            shellInfo[5*curShell+1]=shell.r1;
+            shellInfo[5*curShell+2]=shell.errBound;
+            shellInfo[5*curShell+3]=static_cast<double>(shell.numLat);
+            shellInfo[5*curShell+4]=static_cast<double>(shell.numLon);
+        }
+
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleScalar(theCache->rMin);
+            if(nlhs>2) {
+                plhs[2]=mxCreateDoubleScalar(theCache->rMax);
+                if(nlhs>3) {
+                    plhs[3]=mxCreateDoubleScalar(theCache->tol);
+                    if(nlhs>4) {
+                        plhs[4]=unsignedSizeMat2Matlab(&(theCache->chebOrder),1,1);
+                    }
+                }
+            }
+        }
+    } else if(!strcmp("~gravAccelCacheCPP", cmd)){
+        theCache=Matlab2Ptr<gravAccelCacheCPP*>(prhs[1]);
+
+        delete theCache;
+        //Unlock the mex file allowing it to be cleared.
+        mexUnlock();
+    } else {
+        mexErrMsgTxt("Invalid string passed to gravAccelCacheCPPInt.");
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
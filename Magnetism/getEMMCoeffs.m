@@ -1,4 +1,4 @@
-function [C,S,a,c]=getEMMCoeffs(M,year,fullyNormalize)
+function [C,S,a,c,CDot,SDot]=getEMMCoeffs(M,year,fullyNormalize)
 %%GETEMMCOEFFS Obtain spherical harmonic coefficients for the 2017 
 %              version of the National Oceanic and Atmospheric
 %              Administration's (NOAA's) Enchaned Magnetic Model (EMM) at a
@@ -36,6 +36,13 @@ function [C,S,a,c]=getEMMCoeffs(M,year,fullyNormalize)
 %           having units of meters.
 %         c The constant value by which the spherical harmonic series is
 %           multiplied, having units of squared meters.
+%  CDot, SDot The secular variation of C and S in Tesla per year, having
+%           the same format and normalization as C and S. The secular
+%           variation is only given to a lower degree than the
+%           coefficients, so the higher-degree terms are zero. The
+%           coefficients at a nearby time t are C+(t-year)*CDot and
+%           S+(t-year)*SDot, so these can be passed to spherHarmonicSVEval
+%           to evaluate the model at points having different times.
 %
 %Details on the normalization of the coefficients is given in the comments
 %to the function spherHarmonicEval.
@@ -237,6 +244,26 @@ end
 C=C.clusterEls;
 S=S.clusterEls;
 
+if(nargout>4)
+    %The drift terms are padded with zeros to the size of the
+    %coefficients.
+    totalNumCoeffs=length(C);
+    idx=1:min(totalNumDriftCoeffs,totalNumCoeffs);
+    CDot=zeros(totalNumCoeffs,1);
+    SDot=zeros(totalNumCoeffs,1);
+    CDot(idx)=C1.clusterEls(idx);
+    SDot(idx)=S1.clusterEls(idx);
+    
+    if(fullyNormalize~=false)
+        for n=0:M
+            k=1/sqrt(1+2*n);
+            idxN=(n*(n+1)/2+1):((n+1)*(n+2)/2);
+            CDot(idxN)=k*CDot(idxN);
+            SDot(idxN)=k*SDot(idxN);
+        end
+    end
+end
+
 %The EMM2015 model uses the same reference ellipse as the WMM2010.
 a=Constants.WMM2010SphereRad;%meters
 c=a^2;
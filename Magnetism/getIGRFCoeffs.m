@@ -1,4 +1,4 @@
-function [C,S,a,c]=getIGRFCoeffs(year,fullyNormalize)
+function [C,S,a,c,CDot,SDot]=getIGRFCoeffs(year,fullyNormalize)
 %%GETIGRFCOEFFS Obtain spherical harmonic coefficients for the
 %               12th generation International Geomagnetic Reference Field
 %               (IGRF) at a particular time or at the latest reference
@@ -38,6 +38,15 @@ function [C,S,a,c]=getIGRFCoeffs(year,fullyNormalize)
 %           having units of meters.
 %         c The constant value by which the spherical harmonic series is
 %           multiplied, having units of squared meters.
+%  CDot, SDot The rates of change of C and S in Tesla per year, having the
+%           same format and normalization as C and S. These are the slopes
+%           of the linear interpolation between the epochs that bracket
+%           year or, after the last epoch, the secular variation terms. If
+%           year is exactly an epoch, the rates of the interval starting at
+%           that epoch are returned. The coefficients at a time t in the
+%           same interval are C+(t-year)*CDot and S+(t-year)*SDot, so these
+%           can be passed to spherHarmonicSVEval to evaluate the model at
+%           points having different times.
 %
 %Details on the normalization of the coefficients is given in the comments
 %to the function spherHarmonicEval.
@@ -116,6 +125,8 @@ C=CountingClusterSet(emptyData);
 S=CountingClusterSet(emptyData);
 C1=CountingClusterSet(emptyData);
 S1=CountingClusterSet(emptyData);
+CDot=zeros(totalNumCoeffs,1);
+SDot=zeros(totalNumCoeffs,1);
 
 %Next, the closest two years of coefficients for the data must be read in
 %so that one can linearly interpolate to the proper time. If the requested
@@ -170,11 +181,29 @@ if(year>yearList(end))
             S(n+1,m+1)=S(n+1,m+1)+yearDiff*S1(n+1,m+1);
         end
     end
+    
+    CDot=C1.clusterEls;
+    SDot=S1.clusterEls;
 else
     [val,idx]=sort(abs(yearList-year));
     
     if(val(1)==0)%If it perfectly matched a year, then no extrapolation is needed.
         putCoeffsIntoCS(rowData,C,S,idx(1)+3);
+        
+        if(nargout>4)
+            %The rates are those of the interval starting at this epoch,
+            %or the prediction coefficients at the last epoch.
+            if(idx(1)==numYears)
+                putCoeffsIntoCS(rowData,C1,S1,length(HeaderData));
+                CDot=C1.clusterEls;
+                SDot=S1.clusterEls;
+            else
+                putCoeffsIntoCS(rowData,C1,S1,idx(1)+4);
+                yearSpan=yearList(idx(1)+1)-yearList(idx(1));
+                CDot=(C1.clusterEls-C.clusterEls)/yearSpan;
+                SDot=(S1.clusterEls-S.clusterEls)/yearSpan;
+            end
+        end
     else%Otherwise, get the final two years and perform linear extrapolation between them.
         putCoeffsIntoCS(rowData,C,S,idx(1)+3);
         putCoeffsIntoCS(rowData,C1,S1,idx(2)+3);
@@ -182,6 +211,10 @@ else
         yearSpan=yearList(idx(2))-yearList(idx(1));
         yearDiff=year-yearList(idx(1));
         
+        %The slopes of the interpolation.
+        CDot=(C1.clusterEls-C.clusterEls)/yearSpan;
+        SDot=(S1.clusterEls-S.clusterEls)/yearSpan;
+        
         %Perform linear interpolation between the points and put the result
         %into S and C.
         for n=0:M
@@ -199,6 +232,8 @@ end
 %Change the units fron Nanotesla to Tesla.
 C(:)=10^(-9)*C(:);
 S(:)=10^(-9)*S(:);
+CDot=10^(-9)*CDot;
+SDot=10^(-9)*SDot;
 
 %If the coefficients should be fully normalized.
 if(fullyNormalize~=false)
@@ -208,6 +243,10 @@ if(fullyNormalize~=false)
             C(n+1,m+1)=k*C(n+1,m+1);
             S(n+1,m+1)=k*S(n+1,m+1);
         end
+        
+        idxN=(n*(n+1)/2+1):((n+1)*(n+2)/2);
+        CDot(idxN)=k*CDot(idxN);
+        SDot(idxN)=k*SDot(idxN);
      end
 end
 
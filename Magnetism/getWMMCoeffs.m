@@ -1,4 +1,4 @@
-function [C,S,a,c]=getWMMCoeffs(year,fullyNormalize)
+function [C,S,a,c,CDot,SDot]=getWMMCoeffs(year,fullyNormalize)
 %%GETWMMCOEFFS Obtain spherical harmonic coefficients for the 2015 
 %              version of the DoD's World Magnetic Model (WMM) at a
 %              particular time or at the reference epoch (2015). The WMM
@@ -45,6 +45,12 @@ function [C,S,a,c]=getWMMCoeffs(year,fullyNormalize)
 %           having units of meters.
 %         c The constant value by which the spherical harmonic series is
 %           multiplied, having units of squared meters.
+%  CDot, SDot The secular variation of C and S in Tesla per year, having
+%           the same format and normalization as C and S. The coefficients
+%           at a nearby time t are C+(t-year)*CDot and S+(t-year)*SDot.
+%           These can be passed to spherHarmonicSVEval to evaluate the
+%           model at points having different times without forming the
+%           coefficients for each time.
 %
 %Details on the normalization of the coefficients is given in the comments
 %to the function spherHarmonicEval.
@@ -116,17 +122,19 @@ if(nargin<2||isempty(fullyNormalize))
    fullyNormalize=true; 
 end
 
+putCoeffsIntoC(rowData,C,3);
+putCoeffsIntoC(rowData,S,4);
+if(year~=yearRef||nargout>4)
+    %The slopes for interpolation.
+    putCoeffsIntoC(rowData,C1,5);
+    putCoeffsIntoC(rowData,S1,6);
+end
+
 if(year~=yearRef)
     if(year<yearRef)
         warning('Interpolation to past years might not be accurate');
     end
     
-    putCoeffsIntoC(rowData,C,3);
-    putCoeffsIntoC(rowData,S,4);
-    %The slopes for interpolation.
-    putCoeffsIntoC(rowData,C1,5);
-    putCoeffsIntoC(rowData,S1,6);
-    
     yearDiff=year-yearRef;
     
     %Perform linear interpolation.
@@ -136,14 +144,13 @@ if(year~=yearRef)
             S(n+1,m+1)=S(n+1,m+1)+yearDiff*S1(n+1,m+1);
         end
     end
-else
-    putCoeffsIntoC(rowData,C,3);
-    putCoeffsIntoC(rowData,S,4);
 end
 
 %Change the units from Nanotesla to Tesla.
 C(:)=10^(-9)*C(:);
 S(:)=10^(-9)*S(:);
+C1(:)=10^(-9)*C1(:);
+S1(:)=10^(-9)*S1(:);
 
 %If the coefficients should be fully normalized.
 if(fullyNormalize~=false)
@@ -151,12 +158,16 @@ if(fullyNormalize~=false)
         k=1/sqrt(1+2*n);
         C(n+1,:)=k*C(n+1,:);
         S(n+1,:)=k*S(n+1,:);
+        C1(n+1,:)=k*C1(n+1,:);
+        S1(n+1,:)=k*S1(n+1,:);
      end
 end
 
 %Return S and C as arrays, not as a CountingClusterSet classes.
 C=C.clusterEls;
 S=S.clusterEls;
+CDot=C1.clusterEls;
+SDot=S1.clusterEls;
 
 a=Constants.WMM2010SphereRad;%meters
 c=a^2;
@@ -19,12 +19,24 @@
 *                    scans of the approximate algorithm to perform. Even 
 *                    though more scans can improve the estimate, global
 *                    convergence is not guaranteed. The default is 1 if
-*                    this parameter is not provided.
+*                    this parameter is not provided or an empty matrix is
+*                    passed.
+*         numThreads An optional parameter specifying the number of threads
+*                    to use when x holds more than one set of hypotheses
+*                    (see below). The default if omitted or an empty matrix
+*                    is passed is the number of hardware threads available.
 * 
 * OUTPUTS:  MMOSPAEst The approximate xDim X numTar MMOSPA estimate.
 *           orderList A numTarXnumHyp matrix specifying the ordering of the
 *                     targets in each hypothesis that went into the
 *                     approximate MMOSPA estimate.
+*
+* Many independent sets of hypotheses can be processed at once by passing
+* an xDim X numTar X numHyp X numSets hypermatrix for x and a numHyp X
+* numSets matrix for w, where x(:,:,:,curSet) and w(:,curSet) are the
+* inputs for one set. In that case, MMOSPAEst is xDim X numTar X numSets
+* and orderList is numTar X numHyp X numSets. The sets are processed in
+* parallel using numThreads threads.
 * 
 * Given a set of numHyp hypotheses, the standard expected value minimizes
 * the mean squared error. The standard expected value is just
@@ -50,7 +62,7 @@
 * CompileCLibraries function.
 *
 * The algorithm is run in Matlab using the command format
-* [MMOSPAEst,orderList]=MMOSPAApprox(x,w,numScans);
+* [MMOSPAEst,orderList]=MMOSPAApprox(x,w,numScans,numThreads);
 *
 *REFERENCES:
 *[1] D. F. Crouse, "Advances in displaying uncertain estimates of multiple
@@ -70,6 +82,8 @@ using namespace std;
 
 void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
     size_t xDim,numTar,numHyp,numScans;
+    size_t numSets=1;
+    size_t numThreads=0;
     mxArray *MMOSPAEstMATLAB,*orderListMATLAB;//These will hold the values to be returned.
     const mwSize *xDims;
     double *MMOSPAEst,*x,*w;
@@ -80,7 +94,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         return;
     }
     
-    if(nrhs<3){
+    if(nrhs<3||mxIsEmpty(prhs[2])){
         numScans=1;
     }else {
         numScans=getSizeTFromMatlab(prhs[2]);
@@ -91,11 +105,15 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         }
     }
     
-    if(nrhs>3) {
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        numThreads=getSizeTFromMatlab(prhs[3]);
+    }
+    
+    if(nrhs>4) {
         mexErrMsgTxt("Too many inputs.");
         return;
     }
-    
+
     /*Verify the validity of the x and w parameters.*/
     checkRealDoubleArray(prhs[0]);
     checkRealDoubleArray(prhs[1]);
@@ -106,13 +124,17 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     
     if(mxGetNumberOfDimensions(prhs[0])<3){
         numHyp=1;
-    } else if(mxGetNumberOfDimensions(prhs[0])>3) {
+    } else if(mxGetNumberOfDimensions(prhs[0])>4) {
         mexErrMsgTxt("The first parameter has too many dimensions.");
         return;
     } else {
         numHyp=xDims[2];
+        
+        if(mxGetNumberOfDimensions(prhs[0])==4) {
+            numSets=xDims[3];
+        }
     }
-    
+
     //Check the dimensionality of the second input
     if(mxGetNumberOfDimensions(prhs[1])>2){
         mexErrMsgTxt("The second parameter has too may dimensions.");
@@ -120,14 +142,22 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     }
     
     xDims = mxGetDimensions(prhs[1]);
-    if(xDims[0]!=numHyp||xDims[1]!=1) {
+    if(xDims[0]!=numHyp||xDims[1]!=numSets) {
         mexErrMsgTxt("The dimensionality of the second parameter is inconsistent.");
         return;
     }
     
     //Allocate space for the return variables.
-    MMOSPAEstMATLAB = mxCreateNumericMatrix(xDim,numTar,mxDOUBLE_CLASS,mxREAL);
-    orderListMATLAB=allocUnsignedSizeMatInMatlab(numTar,numHyp);
+    orderListMATLAB=allocUnsignedSizeMatInMatlab(numTar,numHyp*numSets);
+    if(numSets==1) {
+        MMOSPAEstMATLAB = mxCreateNumericMatrix(xDim,numTar,mxDOUBLE_CLASS,mxREAL);
+    } else {
+        const mwSize estDims[3]={xDim,numTar,numSets};
+        const mwSize orderDims[3]={numTar,numHyp,numSets};
+        
+        MMOSPAEstMATLAB=mxCreateNumericArray(3,estDims,mxDOUBLE_CLASS,mxREAL);
+        mxSetDimensions(orderListMATLAB,orderDims,3);
+    }
 
     MMOSPAEst=reinterpret_cast<double*>(mxGetData(MMOSPAEstMATLAB));
     orderList=reinterpret_cast<size_t*>(mxGetData(orderListMATLAB));
@@ -137,20 +167,33 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     w = reinterpret_cast<double*>(mxGetData(prhs[1]));
     
     //Run the algorithm
-    MMOSPAApproxCPP(MMOSPAEst,
-                    orderList,
-                    x,
-                    w,
-                    xDim,
-                    numTar,
-                    numHyp,
-                    numScans);
-    
+    if(numSets==1) {
+        MMOSPAApproxCPP(MMOSPAEst,
+                        orderList,
+                        x,
+                        w,
+                        xDim,
+                        numTar,
+                        numHyp,
+                        numScans);
+    } else {
+        MMOSPAApproxBatchCPP(MMOSPAEst,
+                             orderList,
+                             x,
+                             w,
+                             xDim,
+                             numTar,
+                             numHyp,
+                             numSets,
+                             numScans,
+                             numThreads);
+    }
+
 /*Set the outputs*/
     plhs[0]=MMOSPAEstMATLAB;
     if(nlhs>1) {
         /*Convert C++ indices to Matlab indices*/
-        for_each(orderList, orderList+numTar*numHyp, increment<size_t>);
+        for_each(orderList, orderList+numTar*numHyp*numSets, increment<size_t>);
         plhs[1]=orderListMATLAB;
     } else {
         mxDestroyArray(orderListMATLAB);
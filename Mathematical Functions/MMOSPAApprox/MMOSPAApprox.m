@@ -1,4 +1,4 @@
-function [MMOSPAEst,orderList]=MMOSPAApprox(x,w,numScans)
+function [MMOSPAEst,orderList]=MMOSPAApprox(x,w,numScans,numThreads)
 %%MMOSPAAPPROX Find the approximate minimum mean optimal sub-pattern
 %              assignment (MMOSPA) estimate from a set of weighted 
 %              discrete sets of target estimates using 2D assignment in a
@@ -17,13 +17,26 @@ function [MMOSPAEst,orderList]=MMOSPAApprox(x,w,numScans)
 % numScans An optional parameter >=1 specifying how many forward scans of
 %          the approximate algorithm to perform. Even though more scans can
 %          improve the estimate, global convergence is not guaranteed. The
-%          default is 1 if this parameter is not provided.
+%          default is 1 if this parameter is not provided or an empty
+%          matrix is passed.
+% numThreads An optional parameter specifying the number of threads to use
+%          when x holds more than one set of hypotheses. This is only used
+%          in the compiled version of this function. The default if
+%          omitted or an empty matrix is passed is the number of hardware
+%          threads available.
 %
 %OUTPUTS: MMOSPAEst The approximate xDim X numTar MMOSPA estimate.
 %         orderList A numTarXnumHyp matrix specifying the ordering of the
 %                   targets in each hypothesis that went into the
 %                   approximate MMOSPA estimate.
 %
+%Many independent sets of hypotheses can be processed at once by passing an
+%xDim X numTar X numHyp X numSets hypermatrix for x and a numHyp X numSets
+%matrix for w, where x(:,:,:,curSet) and w(:,curSet) are the inputs for one
+%set. In that case, MMOSPAEst is xDim X numTar X numSets and orderList is
+%numTar X numHyp X numSets. In the compiled version of this function, the
+%sets are processed in parallel.
+%
 %Given a set of numHyp hypotheses, the standard expected value minimizes
 %the mean squared error. The standard expected value is just
 %the weighted sum of the hypothese for all of the targets. In the MMOSPA
@@ -52,10 +65,24 @@ function [MMOSPAEst,orderList]=MMOSPAApprox(x,w,numScans)
 %October 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
-    if(nargin<3)
+    if(nargin<3||isempty(numScans))
         numScans=1;
     end
 
+    numSets=size(x,4);
+    if(numSets~=1)
+        xDim=size(x,1);
+        numTar=size(x,2);
+        numHyp=size(x,3);
+        
+        MMOSPAEst=zeros(xDim,numTar,numSets);
+        orderList=zeros(numTar,numHyp,numSets);
+        for curSet=1:numSets
+            [MMOSPAEst(:,:,curSet),orderList(:,:,curSet)]=MMOSPAApprox(x(:,:,:,curSet),w(:,curSet),numScans);
+        end
+        return;
+    end
+
     %First, get the forward solution, which might be bad.
     [MMOSPAEst,orderList]=MMOSPAApproxForward(x,w);
     numScans=numScans-1;
@@ -1,10 +1,18 @@
 /*Code implementing the MMOSPA optimization algorithm in C++.
  *
+ *The batch version of the algorithm processes independent sets of
+ *hypotheses in parallel. Each thread has its own MurtyHyp and ScratchSpace
+ *instances, which are reused for all of the sets that the thread
+ *processes.
+ *
 *November 2013 David F. Crouse, Naval Research Laboratory, Washington D.C*/
 /*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
 
 #include <limits>
 #include <algorithm>
+#include <vector>
+#include <thread>
+#include <atomic>
 #include "MMOSPAApproxCPP.hpp"
 
 using namespace std;
@@ -30,7 +38,30 @@ void doUpdate4Col(double *MMOSPAEst,
                   const size_t xDim,
                   const size_t numTar,
                   const size_t varHyp);
-                         
+
+void MMOSPAApproxWorkMem(double *MMOSPAEst,
+                         size_t *orderList,
+                         MurtyHyp *problemSol,
+                         ScratchSpace &workMem,
+                         double *xOptCur,
+                         const double *x,
+                         const double *w,
+                         const size_t xDim,
+                         const size_t numTar,
+                         const size_t numHyp,
+                         size_t numScan);
+
+void MMOSPAApproxBatchWorker(double *MMOSPAEst,
+                             size_t *orderList,
+                             const double *x,
+                             const double *w,
+                             const size_t xDim,
+                             const size_t numTar,
+                             const size_t numHyp,
+                             const size_t numSets,
+                             const size_t numScan,
+                             atomic<size_t> *nextSet);
+
 inline void multScalVec(double *result, const double scalarVal, const double* vectorVal, const size_t length){
     /* Multiply all of the elements in vectorVal by ScalarVal and save the
      * results in result*/
@@ -217,6 +248,74 @@ void doUpdate4Col(double *MMOSPAEst,
 }
 
 
+void MMOSPAApproxWorkMem(double *MMOSPAEst,
+                         size_t *orderList,
+                         MurtyHyp *problemSol,
+                         ScratchSpace &workMem,
+                         double *xOptCur,
+                         const double *x,
+                         const double *w,
+                         const size_t xDim,
+                         const size_t numTar,
+                         const size_t numHyp,
+                         size_t numScan) {
+/**MMOSPAAPPROXWORKMEM Run the approximate MMOSPA algorithm using
+*                     previously allocated scratch space. problemSol and
+*                     workMem must have been allocated for numTar rows and
+*                     columns and xOptCur must hold xDim*numTar doubles.
+*                     The other inputs and the outputs are the same as in
+*                     MMOSPAApproxCPP.
+*
+*October 2026 Naval Research Laboratory, Washington D.C.*/
+    size_t curHyp;
+    
+    if(numHyp==0) {
+        fill(MMOSPAEst,MMOSPAEst+xDim*numTar,0.0);
+        return;
+    }
+    
+    /*Run the forward algorithm*/
+    MMOSPAApproxForward(MMOSPAEst,orderList,problemSol,workMem,x,w,xDim,numTar,numHyp);
+    
+    //With fewer than three hypotheses, the forward algorithm is optimal.
+    if(numHyp<3) {
+        return;
+    }
+    
+    //Do a reverse and then a forward scan numScans times.
+    while(numScan>1) {
+        //Re-evaluate the hypotheses going backwards.
+        for(curHyp=numHyp-2;curHyp>0;curHyp--) {
+            doUpdate4Col(MMOSPAEst,
+                         orderList,
+                         problemSol,
+                         workMem,
+                         xOptCur,
+                         x,
+                         w,
+                         xDim,
+                         numTar,
+                         curHyp);
+        }
+
+        //Re-evaluate the hypotheses going forwards.
+        for(curHyp=2;curHyp<numHyp;curHyp++){
+            doUpdate4Col(MMOSPAEst,
+                         orderList,
+                         problemSol,
+                         workMem,
+                         xOptCur,
+                         x,
+                         w,
+                         xDim,
+                         numTar,
+                         curHyp);
+        }
+
+        numScan--;
+    }
+}
+
 void MMOSPAApproxCPP(double *MMOSPAEst,
                      size_t *orderList,
                      const double *x,
@@ -227,48 +326,85 @@ void MMOSPAApproxCPP(double *MMOSPAEst,
                      size_t numScan) {
     MurtyHyp problemSol(numTar,numTar);
     ScratchSpace workMem(numTar,numTar);
-    size_t curHyp;
+    vector<double> xOptCur(xDim*numTar);//Scratch space for the update steps.
     
-    /*Run the forward algorithm*/
-    MMOSPAApproxForward(MMOSPAEst,orderList,&problemSol,workMem,x,w,xDim,numTar,numHyp);
+    MMOSPAApproxWorkMem(MMOSPAEst,orderList,&problemSol,workMem,xOptCur.data(),x,w,xDim,numTar,numHyp,numScan);
+}
+
+void MMOSPAApproxBatchWorker(double *MMOSPAEst,
+                             size_t *orderList,
+                             const double *x,
+                             const double *w,
+                             const size_t xDim,
+                             const size_t numTar,
+                             const size_t numHyp,
+                             const size_t numSets,
+                             const size_t numScan,
+                             atomic<size_t> *nextSet) {
+/**MMOSPAAPPROXBATCHWORKER The function run by each thread in
+*                     MMOSPAApproxBatchCPP. Sets of hypotheses are taken
+*                     from the shared counter nextSet until all of them
+*                     have been processed. The scratch space is allocated
+*                     once per thread.
+*
+*October 2026 Naval Research Laboratory, Washington D.C.*/
+    const size_t stackedTarDim=xDim*numTar;
+    MurtyHyp problemSol(numTar,numTar);
+    ScratchSpace workMem(numTar,numTar);
+    vector<double> xOptCur(stackedTarDim);
     
-    if(numScan>1) {
-        double *xOptCur = new double[xDim*numTar];//Scratch space for the update steps.
+    for(;;) {
+        const size_t curSet=nextSet->fetch_add(1);
         
-        //Do a reverse and then a forward scan numScans times.
-        while(numScan>1) {
-            //Re-evaluate the hypotheses going backwards.
-            for(curHyp=numHyp-2;curHyp>0;curHyp--) {
-                doUpdate4Col(MMOSPAEst,
-                             orderList,
-                             &problemSol,
-                             workMem,
-                             xOptCur,
-                             x,
-                             w,
-                             xDim,
-                             numTar,
-                             curHyp);
-            }
-
-            //Re-evaluate the hypotheses going forwards.
-            for(curHyp=2;curHyp<numHyp;curHyp++){
-                doUpdate4Col(MMOSPAEst,
-                             orderList,
-                             &problemSol,
-                             workMem,
-                             xOptCur,
-                             x,
-                             w,
-                             xDim,
-                             numTar,
-                             curHyp);
-            }
-
-            numScan--;
+        if(curSet>=numSets) {
+            break;
         }
+        
+        MMOSPAApproxWorkMem(MMOSPAEst+stackedTarDim*curSet,
+                            orderList+numTar*numHyp*curSet,
+                            &problemSol,
+                            workMem,
+                            xOptCur.data(),
+                            x+stackedTarDim*numHyp*curSet,
+                            w+numHyp*curSet,
+                            xDim,
+                            numTar,
+                            numHyp,
+                            numScan);
+    }
+}
 
-        delete[] xOptCur;
+void MMOSPAApproxBatchCPP(double *MMOSPAEst,
+                          size_t *orderList,
+                          const double *x,
+                          const double *w,
+                          const size_t xDim,
+                          const size_t numTar,
+                          const size_t numHyp,
+                          const size_t numSets,
+                          const size_t numScan,
+                          size_t numThreads) {
+    atomic<size_t> nextSet(0);
+    
+    if(numThreads==0) {
+        numThreads=max<size_t>(1,thread::hardware_concurrency());
+    }
+    numThreads=min(numThreads,numSets);
+    
+    if(numThreads<=1) {
+        MMOSPAApproxBatchWorker(MMOSPAEst,orderList,x,w,xDim,numTar,numHyp,numSets,numScan,&nextSet);
+    } else {
+        vector<thread> threads;
+        size_t curThread;
+        
+        threads.reserve(numThreads);
+        for(curThread=0;curThread<numThreads;curThread++) {
+            threads.emplace_back(MMOSPAApproxBatchWorker,MMOSPAEst,orderList,x,w,xDim,numTar,numHyp,numSets,numScan,&nextSet);
+        }
+        
+        for(curThread=0;curThread<numThreads;curThread++) {
+            threads[curThread].join();
+        }
     }
 }
 
@@ -45,6 +45,44 @@ void MMOSPAApproxCPP(double *MMOSPAEst,
  * November 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
  */ 
 
+void MMOSPAApproxBatchCPP(double *MMOSPAEst,
+                          size_t *orderList,
+                          const double *x,
+                          const double *w,
+                          const size_t xDim,
+                          const size_t numTar,
+                          const size_t numHyp,
+                          const size_t numSets,
+                          const size_t numScan,
+                          size_t numThreads);
+/*MMOSPAAPPROXBATCHCPP Run MMOSPAApproxCPP on numSets independent sets of
+ *                hypotheses, processing the sets in parallel.
+ *
+ *INPUTS: MMOSPAEst  An array with xDim*numTar*numSets elements to hold
+ *                   the approximate MMOSPA estimates of all of the sets.
+ *        orderList  An array with numTar*numHyp*numSets elements to hold
+ *                   the orderings of the targets of all of the sets.
+ *        x         An xDim * numTar * numHyp * numSets array where
+ *                  x(:,:,:,curSet) is the x input of MMOSPAApproxCPP for
+ *                  the set curSet.
+ *        w         A numHyp X numSets matrix where w(:,curSet) holds the
+ *                  probabilities of the hypotheses of the set curSet.
+ *        xDim, numTar, numHyp, numScan These are the same as in
+ *                  MMOSPAApproxCPP and are the same for all of the sets.
+ *        numSets   The number of sets of hypotheses.
+ *        numThreads The number of threads to use. If this is 0, the
+ *                  number of hardware threads is used. No more than
+ *                  numSets threads are ever used.
+ *
+ *OUTPUT: The output is placed in MMOSPAEst and orderList. The results
+ *        are the same as calling MMOSPAApproxCPP on each set. Within a
+ *        set, the hypotheses have to be processed sequentially, because
+ *        each reordering depends on the estimate formed from the previous
+ *        ones.
+ *
+ * October 2026 Naval Research Laboratory, Washington D.C.
+ */
+
 #endif
 
 /*LICENSE:
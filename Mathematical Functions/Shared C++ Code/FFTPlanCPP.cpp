@@ -0,0 +1,153 @@
+/*FFTPLANCPP A C++ class for computing unnormalized discrete Fourier
+ *           transforms of a fixed length using a radix-2 algorithm or,
+ *           if the length is not a power of two, Bluestein's algorithm.
+ *           See FFTPlanCPP.hpp for more details.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "FFTPlanCPP.hpp"
+//For sin and cos.
+#include <cmath>
+//For swap
+#include <algorithm>
+
+using namespace std;
+
+FFTPlanCPP::FFTPlanCPP(const size_t N) : N(N) {
+    const double pi=2.0*acos(0.0);
+
+    NPow2=1;
+    while(NPow2<N) {
+        NPow2*=2;
+    }
+    useBluestein=(NPow2!=N);
+
+    if(useBluestein) {
+        //The circular convolution must have a length of at least 2N-1 to
+        //not wrap around.
+        NPow2=1;
+        while(NPow2<2*N-1) {
+            NPow2*=2;
+        }
+    }
+
+    twiddles.resize(NPow2/2);
+    for(size_t k=0;k<NPow2/2;k++) {
+        const double theta=-2.0*pi*static_cast<double>(k)/static_cast<double>(NPow2);
+        twiddles[k]=complex<double>(cos(theta),sin(theta));
+    }
+
+    if(useBluestein) {
+        chirp.resize(N);
+        chirpFFT.assign(NPow2,complex<double>(0.0,0.0));
+        work.resize(NPow2);
+
+        for(size_t k=0;k<N;k++) {
+            //k^2 is reduced modulo 2N so that the argument of the
+            //exponential stays small and accurate for large k.
+            const size_t kSquareMod=(k*k)%(2*N);
+            const double theta=-pi*static_cast<double>(kSquareMod)/static_cast<double>(N);
+
+            chirp[k]=complex<double>(cos(theta),sin(theta));
+        }
+
+        chirpFFT[0]=conj(chirp[0]);
+        for(size_t k=1;k<N;k++) {
+            chirpFFT[k]=conj(chirp[k]);
+            chirpFFT[NPow2-k]=conj(chirp[k]);
+        }
+        radix2Forward(chirpFFT.data());
+    }
+}
+
+void FFTPlanCPP::radix2Forward(complex<double> *x) const {
+    const size_t n=NPow2;
+
+    //Bit-reversal permutation.
+    size_t j=0;
+    for(size_t i=1;i<n;i++) {
+        size_t bit=n>>1;
+        while(j&bit) {
+            j^=bit;
+            bit>>=1;
+        }
+        j|=bit;
+
+        if(i<j) {
+            swap(x[i],x[j]);
+        }
+    }
+
+    //Butterflies
+    for(size_t len=2;len<=n;len*=2) {
+        const size_t halfLen=len/2;
+        const size_t twiddleStep=n/len;
+
+        for(size_t start=0;start<n;start+=len) {
+            for(size_t k=0;k<halfLen;k++) {
+                const complex<double> t=twiddles[k*twiddleStep]*x[start+k+halfLen];
+
+                x[start+k+halfLen]=x[start+k]-t;
+                x[start+k]+=t;
+            }
+        }
+    }
+}
+
+void FFTPlanCPP::transform(complex<double> *x, const bool inverse) {
+    //The inverse transform is obtained from the forward transform as
+    //conj(FFT(conj(x))).
+    if(inverse) {
+        for(size_t k=0;k<N;k++) {
+            x[k]=conj(x[k]);
+        }
+    }
+
+    if(!useBluestein) {
+        radix2Forward(x);
+    } else {
+        const double scale=1.0/static_cast<double>(NPow2);
+
+        for(size_t k=0;k<N;k++) {
+            work[k]=x[k]*chirp[k];
+        }
+        fill(work.begin()+N,work.end(),complex<double>(0.0,0.0));
+
+        radix2Forward(work.data());
+        for(size_t k=0;k<NPow2;k++) {
+            //The conjugation is for the inverse transform of the product.
+            work[k]=conj(work[k]*chirpFFT[k]);
+        }
+        radix2Forward(work.data());
+
+        for(size_t k=0;k<N;k++) {
+            x[k]=chirp[k]*conj(work[k])*scale;
+        }
+    }
+
+    if(inverse) {
+        for(size_t k=0;k<N;k++) {
+            x[k]=conj(x[k]);
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
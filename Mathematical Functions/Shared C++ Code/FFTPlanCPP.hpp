@@ -0,0 +1,81 @@
+/**FFTPLANCPP A header file for a C++ class that computes unnormalized
+ *           discrete Fourier transforms (DFTs) of complex data of a fixed
+ *           length N. The forward transform is
+ *           X(k)=sum_{j=0}^{N-1}x(j)*exp(-2*pi*1i*j*k/N)
+ *           and the inverse transform is the same with a positive sign in
+ *           the exponent and no 1/N scaling. When N is a power of two, a
+ *           radix-2 decimation-in-time algorithm is used. Otherwise,
+ *           Bluestein's algorithm is used, which rewrites the DFT as a
+ *           circular convolution of a power-of-two length. In both cases,
+ *           the complexity is O(N*log(N)).
+ *
+ *The twiddle factors and the Bluestein chirp are computed once, when the
+ *class is constructed, and are reused for every transform. The class
+ *holds internal scratch space, so a single instance should not be used by
+ *multiple threads at the same time; separate instances can be.
+ *
+ *Bluestein's algorithm is described in
+ *L. I. Bluestein, "A linear filtering approach to the computation of
+ *discrete Fourier transform," IEEE Transactions on Audio and
+ *Electroacoustics, vol. 18, no. 4, pp. 451-455, Dec. 1970.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef FFTPLANCPP
+#define FFTPLANCPP
+
+#include <stddef.h>
+#include <complex>
+#include <vector>
+
+class FFTPlanCPP {
+public:
+    //N is the length of the transforms. It must be >=1.
+    explicit FFTPlanCPP(const size_t N);
+
+    //Transform the length N vector x in place. If inverse is true, the
+    //inverse transform (without 1/N scaling) is performed.
+    void transform(std::complex<double> *x, const bool inverse);
+
+    size_t length() const {
+        return N;
+    }
+
+private:
+    size_t N;
+    //The length of the power-of-two transforms used internally. This is N
+    //if N is a power of two.
+    size_t NPow2;
+    bool useBluestein;
+    //exp(-2*pi*1i*k/NPow2) for k=0 to NPow2/2-1.
+    std::vector<std::complex<double> > twiddles;
+    //exp(-pi*1i*k^2/N) for k=0 to N-1.
+    std::vector<std::complex<double> > chirp;
+    //The forward transform of the zero-padded conjugate chirp.
+    std::vector<std::complex<double> > chirpFFT;
+    std::vector<std::complex<double> > work;
+
+    void radix2Forward(std::complex<double> *x) const;
+};
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
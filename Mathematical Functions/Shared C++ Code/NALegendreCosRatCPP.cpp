@@ -192,6 +192,306 @@ void NALegendreCosRatDeriv2CPP(CountingClusterSetCPP<double> &d2PBarUValsdTheta2
     }
 }
 
+/*The batched functions below compute the same values as the functions
+ *above for numLanes values of theta at once. Value (n,m) for lane k is
+ *stored at index numLanes*(n*(n+1)/2+m)+k, so the lanes of each value are
+ *adjacent in memory. The recursion is serial in n and m, but the lanes are
+ *independent, so the innermost loops over the lanes can be vectorized by
+ *the compiler and the coefficients g, h and e, which require square roots,
+ *are computed once for all of the lanes. With 4 to 8 lanes, this hides the
+ *latency of the dependency chain of the recursion.
+ *
+ *The coefficients only depend on n and m. NALegendreCosRatCoeffsCPP
+ *computes them for all n and m up to M so that they can be stored and
+ *reused. The result holds 3*(M+1)*(M+2)/2 elements. The coefficients for
+ *degree n start at index 3*n*(n+1)/2 and consist of three rows of n+1
+ *elements each. The first holds g for m<n and the factor relating the
+ *diagonal term (n,n) to (n-1,n-1) for m=n (sqrt(3) for n=1). The second
+ *holds h and the third holds e, including the factor of 1/sqrt(2) for
+ *m=0. Thus, the first 3*(N+1)*(N+2)/2 elements are the coefficients for
+ *any degree N<M. NALegendreCosRatRowCoeffsCPP computes
+ *the same values for a single degree n, where any of the outputs can be
+ *NULL.
+ *
+ *The row functions compute a single degree n for all lanes. gRow, hRow and
+ *eRow point to the coefficients for degree n. In
+ *NALegendreCosRatRowBatchCPP, PBarUDiagPrev points to the values for
+ *(n-1,n-1), which is only used for n>=2 and may point into PBarURow, so a
+ *single row buffer of length numLanes*(M+1) can be updated in place going
+ *from n-1 to n. t and u hold cos(theta) and sin(theta) for each lane. This
+ *makes it possible to consume the values one degree at a time without
+ *storing all (M+1)*(M+2)/2 values per lane, as is done in
+ *spherHarmonicLegendreSumsBatchCPP.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+
+void NALegendreCosRatRowCoeffsCPP(double *gRow, double *hRow, double *eRow, const size_t n) {
+    const double nf=static_cast<double>(n);
+    double mf;
+    size_t m;
+
+    if(n==0) {
+        if(gRow!=NULL) {
+            gRow[0]=1.0;
+        }
+        if(hRow!=NULL) {
+            hRow[0]=0.0;
+        }
+        if(eRow!=NULL) {
+            eRow[0]=0.0;
+        }
+        return;
+    }
+
+    if(gRow!=NULL) {
+        if(n==1) {
+            gRow[1]=sqrt(3.0);
+        } else {
+            gRow[n]=sqrt((2*nf+1)/(2*nf));
+        }
+
+        //g is given in Equation 18 of the first Holmes and Featherstone
+        //paper.
+        mf=0.0;
+        for(m=0;m<n;m++) {
+            gRow[m]=2*(mf+1)/sqrt((nf-mf)*(nf+mf+1));
+            mf++;
+        }
+    }
+
+    if(hRow!=NULL) {
+        //h is given in Equation 19 of the first Holmes and Featherstone
+        //paper. It is not used for m>n-2.
+        mf=0.0;
+        for(m=0;m+1<n;m++) {
+            hRow[m]=sqrt((nf+mf+2)*(nf-mf-1)/((nf-mf)*(nf+mf+1)));
+            mf++;
+        }
+        hRow[n-1]=0.0;
+        hRow[n]=0.0;
+    }
+
+    if(eRow!=NULL) {
+        //e is given in Equation 22 of the first Holmes and Featherstone
+        //paper.
+        eRow[0]=sqrt((nf+1)*nf/2);
+        mf=1.0;
+        for(m=1;m<n;m++) {
+            eRow[m]=sqrt((nf+mf+1)*(nf-mf));
+            mf++;
+        }
+        eRow[n]=0.0;
+    }
+}
+
+void NALegendreCosRatCoeffsCPP(double *coeffs, const size_t M) {
+    for(size_t n=0;n<=M;n++) {
+        double *gRow=coeffs+3*(n*(n+1)/2);
+
+        NALegendreCosRatRowCoeffsCPP(gRow,gRow+n+1,gRow+2*(n+1),n);
+    }
+}
+
+void NALegendreCosRatRowBatchCPP(double *PBarURow, const double *PBarUDiagPrev, const size_t n, const double *t, const double *u, const double *gRow, const double *hRow, const size_t numLanes, const double scalFactor) {
+    const double jTerm=1/sqrt(2.0);
+    size_t m, k;
+
+    if(n==0) {
+        for(k=0;k<numLanes;k++) {
+            PBarURow[k]=1.0*scalFactor;
+        }
+        return;
+    }
+
+    if(n==1) {
+        double *PCur=PBarURow+numLanes;
+        const double g=gRow[0];
+
+        for(k=0;k<numLanes;k++) {
+            PCur[k]=gRow[1]*scalFactor;
+        }
+
+        for(k=0;k<numLanes;k++) {
+            PBarURow[k]=jTerm*g*t[k]*PCur[k];
+        }
+        return;
+    }
+
+    //The main diagonal, Equation 28 in the first Holmes and Featherstone
+    //paper.
+    {
+        const double diagScal=gRow[n];
+        double *PCur=PBarURow+numLanes*n;
+
+        for(k=0;k<numLanes;k++) {
+            PCur[k]=diagScal*PBarUDiagPrev[k];
+        }
+    }
+
+    //The first element of the recursion, where m=n-1.
+    m=n-1;
+    {
+        const double g=gRow[m];
+        double *PCur=PBarURow+numLanes*m;
+        const double *P1=PCur+numLanes;
+
+        for(k=0;k<numLanes;k++) {
+            PCur[k]=g*t[k]*P1[k];
+        }
+    }
+
+    //The rest of the recursion using Equation 27, with the m=0 case being
+    //scaled by jTerm.
+    do {
+        m--;
+        const double g=gRow[m];
+        const double h=hRow[m];
+        double *PCur=PBarURow+numLanes*m;
+        const double *P1=PCur+numLanes;
+        const double *P2=P1+numLanes;
+
+        if(m>0) {
+            for(k=0;k<numLanes;k++) {
+                PCur[k]=g*t[k]*P1[k]-h*u[k]*u[k]*P2[k];
+            }
+        } else {
+            for(k=0;k<numLanes;k++) {
+                PCur[k]=jTerm*(g*t[k]*P1[k]-h*u[k]*u[k]*P2[k]);
+            }
+        }
+    } while(m>0);
+}
+
+void NALegendreCosRatDerivRowBatchCPP(double *dPBarURow, const double *PBarURow, const size_t n, const double *t, const double *u, const double *eRow, const size_t numLanes) {
+    const double nf=static_cast<double>(n);
+    double mf;
+    size_t m, k;
+
+    if(n==0) {
+        for(k=0;k<numLanes;k++) {
+            dPBarURow[k]=0;
+        }
+        return;
+    }
+
+    //The diagonal term, from Equation 30 in the first Holmes and
+    //Featherstone paper.
+    {
+        double *dPCur=dPBarURow+numLanes*n;
+        const double *PCur=PBarURow+numLanes*n;
+
+        for(k=0;k<numLanes;k++) {
+            dPCur[k]=nf*(t[k]/u[k])*PCur[k];
+        }
+    }
+
+    mf=nf-1;
+    for(m=n-1;m>0;m--) {
+        const double e=eRow[m];
+        double *dPCur=dPBarURow+numLanes*m;
+        const double *PCur=PBarURow+numLanes*m;
+        const double *P1=PCur+numLanes;
+
+        for(k=0;k<numLanes;k++) {
+            dPCur[k]=mf*(t[k]/u[k])*PCur[k]-e*u[k]*P1[k];
+        }
+
+        mf--;
+    }
+
+    //The special m=0 case.
+    {
+        const double e=eRow[0];
+        const double *P1=PBarURow+numLanes;
+
+        for(k=0;k<numLanes;k++) {
+            dPBarURow[k]=-e*u[k]*P1[k];
+        }
+    }
+}
+
+void NALegendreCosRatDeriv2RowBatchCPP(double *d2PBarURow, const double *dPBarURow, const double *PBarURow, const size_t n, const double *t, const double *u, const size_t numLanes) {
+    const double nf=static_cast<double>(n);
+    double mf=0.0;
+
+    for(size_t m=0;m<=n;m++) {
+        const size_t offset=numLanes*m;
+
+        for(size_t k=0;k<numLanes;k++) {
+            //From the first (un-numbered) equation in the second Holmes
+            //and Featherstone paper AFTER correction.
+            d2PBarURow[offset+k]=((mf*mf)/(u[k]*u[k])-nf*(nf+1))*PBarURow[offset+k]-(t[k]/u[k])*dPBarURow[offset+k];
+        }
+
+        mf++;
+    }
+}
+
+void NALegendreCosRatBatchCPP(double *PBarUVals, const size_t M, const double *theta, const size_t numLanes, const double scalFactor) {
+    //t and u for each lane and g and h for the current degree.
+    double *buffer=new double[2*numLanes+2*(M+1)];
+    double *t=buffer;
+    double *u=t+numLanes;
+    double *gRow=u+numLanes;
+    double *hRow=gRow+M+1;
+
+    for(size_t k=0;k<numLanes;k++) {
+        u[k]=sin(theta[k]);
+        t[k]=cos(theta[k]);
+    }
+
+    for(size_t n=0;n<=M;n++) {
+        double *PBarURow=PBarUVals+numLanes*(n*(n+1)/2);
+        const double *PBarUDiagPrev=(n>0)?PBarUVals+numLanes*((n-1)*n/2+n-1):NULL;
+
+        NALegendreCosRatRowCoeffsCPP(gRow,hRow,NULL,n);
+        NALegendreCosRatRowBatchCPP(PBarURow,PBarUDiagPrev,n,t,u,gRow,hRow,numLanes,scalFactor);
+    }
+
+    delete[] buffer;
+}
+
+void NALegendreCosRatDerivBatchCPP(double *dPBarUValsdTheta, const double *PBarUVals, const size_t M, const double *theta, const size_t numLanes) {
+    //t and u for each lane and e for the current degree.
+    double *buffer=new double[2*numLanes+(M+1)];
+    double *t=buffer;
+    double *u=t+numLanes;
+    double *eRow=u+numLanes;
+
+    for(size_t k=0;k<numLanes;k++) {
+        u[k]=sin(theta[k]);
+        t[k]=cos(theta[k]);
+    }
+
+    for(size_t n=0;n<=M;n++) {
+        const size_t offset=numLanes*(n*(n+1)/2);
+
+        NALegendreCosRatRowCoeffsCPP(NULL,NULL,eRow,n);
+        NALegendreCosRatDerivRowBatchCPP(dPBarUValsdTheta+offset,PBarUVals+offset,n,t,u,eRow,numLanes);
+    }
+
+    delete[] buffer;
+}
+
+void NALegendreCosRatDeriv2BatchCPP(double *d2PBarUValsdTheta2, const double *dPBarUValsdTheta, const double *PBarUVals, const size_t M, const double *theta, const size_t numLanes) {
+    double *t=new double[2*numLanes];
+    double *u=t+numLanes;
+
+    for(size_t k=0;k<numLanes;k++) {
+        u[k]=sin(theta[k]);
+        t[k]=cos(theta[k]);
+    }
+
+    for(size_t n=0;n<=M;n++) {
+        const size_t offset=numLanes*(n*(n+1)/2);
+
+        NALegendreCosRatDeriv2RowBatchCPP(d2PBarUValsdTheta2+offset,dPBarUValsdTheta+offset,PBarUVals+offset,n,t,u,numLanes);
+    }
+
+    delete[] t;
+}
+
 /*LICENSE:
 %
 %The source code is in the public domain and not licensed or under
@@ -12,18 +12,55 @@
 #include <stddef.h>
 #include "CountingClusterSetCPP.hpp"
 #include <complex>
+#include <vector>
 
 size_t findFirstMaxCPP(const double *arr, const size_t arrayLen);
 
-void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const CountingClusterSetCPP<double> &C,const CountingClusterSetCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm);
-void spherHarmonicEvalCPPComplex(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetCPP<double> &CReal,const CountingClusterSetCPP<double> &CImag,const CountingClusterSetCPP<double> &SReal,const CountingClusterSetCPP<double> &SImag, const double *point, const size_t numPoints, const std::complex <double> a, const std::complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm);
-void spherHarmonicSetEvalCPPReal(double *V, double *gradV, double *HessianV,const CountingClusterSetVecCPP<double> &C,const CountingClusterSetVecCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm);
-void spherHarmonicSetEvalCPPComplex(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetVecCPP<double> &CReal,const CountingClusterSetVecCPP<double> &CImag,const CountingClusterSetVecCPP<double> &SReal,const CountingClusterSetVecCPP<double> &SImag, const double *point, const size_t numPoints, const std::complex <double> a, const std::complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm);
+//Precomputed values and memory that can be reused across calls to
+//spherHarmonicEvalCPPReal. legendreCoeffs is NULL or the output of
+//NALegendreCosRatCoeffsCPP for the degree of the coefficients or higher.
+//degreeNorms is NULL or the output of spherHarmonicDegreeNormsCPP and is
+//only used by spherHarmonicEvalCPPRealTrunc. The vectors are enlarged as
+//needed. See spherHarmonicModelCPP.hpp.
+struct spherHarmonicWorkCPP {
+    const double *legendreCoeffs;
+    const double *degreeNorms;
+    std::vector<std::vector<double> > workspaces;
+    std::vector<double> sortBuffer;
+    std::vector<size_t> order;
+
+    spherHarmonicWorkCPP() : legendreCoeffs(NULL), degreeNorms(NULL) {}
+};
+
+void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const CountingClusterSetCPP<double> &C,const CountingClusterSetCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm,size_t numThreads);
+void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const CountingClusterSetCPP<double> &C,const CountingClusterSetCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm,size_t numThreads,spherHarmonicWorkCPP *work);
+void spherHarmonicDegreeNormsCPP(double *degreeNorms, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S);
+size_t spherHarmonicTruncDegreeCPP(const double *degreeNorms, const size_t M, const double r, const double a, const double c, const bool gradDesired, const double truncTol);
+void spherHarmonicEvalCPPRealTrunc(double *V, double *gradV, double *HessianV, size_t *degreeUsed, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs, const double scalFactor, const size_t algorithm, size_t numThreads, const double truncTol, spherHarmonicWorkCPP *work);
+void spherHarmonicEvalCPPComplex(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetCPP<double> &CReal,const CountingClusterSetCPP<double> &CImag,const CountingClusterSetCPP<double> &SReal,const CountingClusterSetCPP<double> &SImag, const double *point, const size_t numPoints, const std::complex <double> a, const std::complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm,size_t numThreads);
+void spherHarmonicSetEvalCPPReal(double *V, double *gradV, double *HessianV,const CountingClusterSetVecCPP<double> &C,const CountingClusterSetVecCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm,size_t numThreads);
+void spherHarmonicSVEvalCPPReal(double *V, double *gradV, double *HessianV, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const CountingClusterSetCPP<double> &CDot, const CountingClusterSetCPP<double> &SDot, const double *deltaT, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs, const double scalFactor, const size_t algorithm, const size_t numThreads);
+void spherHarmonicSetEvalCPPComplex(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetVecCPP<double> &CReal,const CountingClusterSetVecCPP<double> &CImag,const CountingClusterSetVecCPP<double> &SReal,const CountingClusterSetVecCPP<double> &SImag, const double *point, const size_t numPoints, const std::complex <double> a, const std::complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm,size_t numThreads);
+void spherHarmonicGridEvalCPP(double *V, double *gradV, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double *elevation, const double *r, const size_t numLat, const size_t numLon, const double lon0, const double a, const double c, const bool spherDerivs, const double scalFactor, size_t numThreads);
+//The number of combinations of range and colatitude for which
+//spherHarmonicLegendreSumsBatchCPP is called at once by the spherical
+//harmonic evaluation routines.
+const size_t spherHarmonicNumLanes=4;
+void spherHarmonicLegendreSumsBatchCPP(double *sums, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double *theta, const double *r, const double a, const size_t numLanes, const size_t derivOrder, const double scalFactor, const double *legendreCoeffs);
 bool spherHarmonicCovCPP(double *sigma2, double *Sigma, const CountingClusterSetCPP<double> &CStdDev,const CountingClusterSetCPP<double> &SStdDev, const double *point, const size_t numPoints,const double a, const double c, const double scalFactor);
+bool spherHarmonicCovPackedCPP(double *VCov, const CountingClusterSetCPP<double> &CStdDev,const CountingClusterSetCPP<double> &SStdDev, const double *point, const size_t numPoints, const double a, const double c, const double scalFactor, size_t numThreads);
 
 void NALegendreCosRatCPP(CountingClusterSetCPP<double> &PBarUVals, const double theta, const double scalFactor);
 void NALegendreCosRatDerivCPP(CountingClusterSetCPP<double> &dPBarUValsdTheta, const CountingClusterSetCPP<double> &PBarUVals, const double theta);
 void NALegendreCosRatDeriv2CPP(CountingClusterSetCPP<double> &d2PBarUValsdTheta2, const CountingClusterSetCPP<double> &dPBarUValsdTheta, const CountingClusterSetCPP<double> &PBarUVals, const double theta);
+void NALegendreCosRatRowCoeffsCPP(double *gRow, double *hRow, double *eRow, const size_t n);
+void NALegendreCosRatCoeffsCPP(double *coeffs, const size_t M);
+void NALegendreCosRatRowBatchCPP(double *PBarURow, const double *PBarUDiagPrev, const size_t n, const double *t, const double *u, const double *gRow, const double *hRow, const size_t numLanes, const double scalFactor);
+void NALegendreCosRatDerivRowBatchCPP(double *dPBarURow, const double *PBarURow, const size_t n, const double *t, const double *u, const double *eRow, const size_t numLanes);
+void NALegendreCosRatDeriv2RowBatchCPP(double *d2PBarURow, const double *dPBarURow, const double *PBarURow, const size_t n, const double *t, const double *u, const size_t numLanes);
+void NALegendreCosRatBatchCPP(double *PBarUVals, const size_t M, const double *theta, const size_t numLanes, const double scalFactor);
+void NALegendreCosRatDerivBatchCPP(double *dPBarUValsdTheta, const double *PBarUVals, const size_t M, const double *theta, const size_t numLanes);
+void NALegendreCosRatDeriv2BatchCPP(double *d2PBarUValsdTheta2, const double *dPBarUValsdTheta, const double *PBarUVals, const size_t M, const double *theta, const size_t numLanes);
 
 void normHelmHoltzCPP(CountingClusterSetCPP<double> &HBar,const double u, const double scalFactor);
 void normHelmHoltzDerivCPP(CountingClusterSetCPP<double> &dHBardu,const CountingClusterSetCPP<double> &HBar);
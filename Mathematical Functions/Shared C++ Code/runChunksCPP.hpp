@@ -0,0 +1,69 @@
+/**RUNCHUNKSCPP A header file for a function that splits a loop over many
+ *          independent items into contiguous chunks evaluated by multiple
+ *          threads. This is used by the batch conversion functions that
+ *          take a numThreads input.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef RUNCHUNKSCPP
+#define RUNCHUNKSCPP
+
+#include <stddef.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/**RUNCHUNKSCPP Evaluate func(startIdx,endIdx) over contiguous chunks of
+ *          numItems items, with item endIdx not included. At most
+ *          numThreads threads are used and each gets at least minPerThread
+ *          items, because splitting very few items over threads costs more
+ *          than it saves. numThreads=0 means that the number of hardware
+ *          threads is used. The chunk sizes differ by at most one item and
+ *          the final chunk is evaluated in the calling thread.
+ **/
+template<typename Func>
+inline void runChunksCPP(const size_t numItems, size_t numThreads, const size_t minPerThread, Func func) {
+    if(numThreads==0) {
+        numThreads=std::max<size_t>(1,std::thread::hardware_concurrency());
+    }
+    numThreads=std::min(numThreads,std::max<size_t>(1,numItems/std::max<size_t>(1,minPerThread)));
+
+    if(numThreads<=1) {
+        func(0,numItems);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads-1);
+
+    for(size_t curThread=0;curThread+1<numThreads;curThread++) {
+        threads.push_back(std::thread(func,curThread*numItems/numThreads,(curThread+1)*numItems/numThreads));
+    }
+    func((numThreads-1)*numItems/numThreads,numItems);
+
+    for(size_t curThread=0;curThread<threads.size();curThread++) {
+        threads[curThread].join();
+    }
+}
+
+#endif
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
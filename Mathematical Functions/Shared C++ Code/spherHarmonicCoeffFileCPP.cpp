@@ -0,0 +1,125 @@
+/**SPHERHARMONICCOEFFFILECPP A C++ class that memory maps a file of real
+ *                  spherical harmonic coefficients. See
+ *                  spherHarmonicCoeffFileCPP.hpp for more details.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "spherHarmonicCoeffFileCPP.hpp"
+//For memcpy and memcmp
+#include <cstring>
+
+static const char spherHarmonicCoeffFileMagic[8]={'T','C','L','S','H','C','0','1'};
+static const uint64_t spherHarmonicCoeffFileByteOrder=0x0102030405060708ULL;
+
+spherHarmonicCoeffFileCPP::spherHarmonicCoeffFileCPP() : M(0), MFile(0), numArrays(0), a(0), c(0), arrayStride(0) {
+    //The views start out empty.
+    C.numClust=0;
+    C.totalNumEl=0;
+    C.clusterEls=NULL;
+    S.numClust=0;
+    S.totalNumEl=0;
+    S.clusterEls=NULL;
+}
+
+spherHarmonicCoeffFileCPP::~spherHarmonicCoeffFileCPP() {
+    close();
+}
+
+bool spherHarmonicCoeffFileCPP::load(const char *fileName, const size_t MMax) {
+    //The coefficients are truncated to degree MMax if the file has more.
+    spherHarmonicCoeffFileHeaderCPP header;
+    size_t totalNumEl;
+    const double *arrayStart;
+
+    close();
+
+    if(!file.open(fileName)) {
+        return false;
+    }
+
+    if(file.size()<sizeof(header)) {
+        file.close();
+        return false;
+    }
+    memcpy(&header,file.data(),sizeof(header));
+
+    //Make sure that the arrays lie within the file, so that a corrupt file
+    //can not cause reads past the end of the mapping. The limit on M keeps
+    //the number of coefficients from overflowing.
+    if(memcmp(header.magic,spherHarmonicCoeffFileMagic,sizeof(header.magic))!=0||header.byteOrder!=spherHarmonicCoeffFileByteOrder||(header.numArrays!=2&&header.numArrays!=4)||header.M>(1ULL<<24)) {
+        file.close();
+        return false;
+    }
+
+    totalNumEl=(header.M+1)*(header.M+2)/2;
+    if(header.arrayStride<totalNumEl||header.arrayStride>(file.size()-sizeof(header))/sizeof(double)/header.numArrays) {
+        file.close();
+        return false;
+    }
+
+    MFile=header.M;
+    M=MMax<MFile?MMax:MFile;
+    numArrays=header.numArrays;
+    arrayStride=header.arrayStride;
+    a=header.a;
+    c=header.c;
+
+    //The mapping is page aligned and the header is 64 bytes, so the
+    //arrays are aligned.
+    arrayStart=reinterpret_cast<const double*>(file.data()+sizeof(header));
+    totalNumEl=(M+1)*(M+2)/2;
+
+    //The views do not modify the coefficients, but CountingClusterSetCPP
+    //only holds non-const pointers.
+    C.numClust=M+1;
+    C.totalNumEl=totalNumEl;
+    C.clusterEls=const_cast<double*>(arrayStart);
+    S.numClust=M+1;
+    S.totalNumEl=totalNumEl;
+    S.clusterEls=const_cast<double*>(arrayStart+arrayStride);
+
+    return true;
+}
+
+void spherHarmonicCoeffFileCPP::close() {
+    file.close();
+
+    M=0;
+    MFile=0;
+    numArrays=0;
+    arrayStride=0;
+    C.numClust=0;
+    C.totalNumEl=0;
+    C.clusterEls=NULL;
+    S.numClust=0;
+    S.totalNumEl=0;
+    S.clusterEls=NULL;
+}
+
+const double *spherHarmonicCoeffFileCPP::getArray(const size_t idx) const {
+    if(idx>=numArrays) {
+        return NULL;
+    }
+
+    return reinterpret_cast<const double*>(file.data()+sizeof(spherHarmonicCoeffFileHeaderCPP))+idx*arrayStride;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
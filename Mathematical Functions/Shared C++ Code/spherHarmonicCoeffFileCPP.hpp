@@ -0,0 +1,103 @@
+/**SPHERHARMONICCOEFFFILECPP A C++ class that memory maps a file of real
+ *                  spherical harmonic coefficients stored in the layout
+ *                  used by CountingClusterSetCPP, so that the coefficients
+ *                  can be evaluated directly from the file without being
+ *                  read, parsed or copied.
+ *
+ *Large models, such as the EGM2008 gravity model or the DTM2006.0 and
+ *Earth2014 terrain models, have millions of coefficients, and parsing
+ *them from text or loading them from .mat files can take longer than the
+ *computation in which they are used. With a memory mapped file, only the
+ *pages that are used are loaded by the operating system, and multiple
+ *processes on the same computer that map the same file share the same
+ *physical memory.
+ *
+ *The file format is a 64-byte header (spherHarmonicCoeffFileHeaderCPP)
+ *followed by numArrays arrays of arrayStride doubles each. Each array holds
+ *the (M+1)*(M+2)/2 coefficients of degree M in the order used by
+ *CountingClusterSetCPP, where the coefficient of degree n and order m is
+ *at index n*(n+1)/2+m, padded with zeros to a multiple of 8 doubles so
+ *that every array starts on a 64-byte boundary. The arrays are C, S and,
+ *if numArrays is 4, the standard deviations CStdDev and SStdDev. The
+ *values are in the byte order of the computer that wrote the file and
+ *load rejects files with a different byte order. Files are written by the
+ *Matlab function saveSpherHarmonicCoeffs.
+ *
+ *As the coefficients of a model truncated to degree N<=M are the first
+ *(N+1)*(N+2)/2 coefficients of each array, load can give views of a
+ *truncated model, still without copying. The C and S members are views
+ *into the mapping and are only valid while the object is loaded.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef SPHERHARMONICCOEFFFILECPP
+#define SPHERHARMONICCOEFFFILECPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include "CountingClusterSetCPP.hpp"
+#include "mappedFileCPP.hpp"
+
+//The header at the start of a file.
+struct spherHarmonicCoeffFileHeaderCPP {
+    char magic[8];//"TCLSHC01"
+    uint64_t byteOrder;//0x0102030405060708 in the byte order of the file.
+    uint64_t M;//The maximum degree of the coefficients.
+    uint64_t numArrays;//2 or 4.
+    //The number of doubles from the start of one array to the next.
+    uint64_t arrayStride;
+    double a;//The reference radius of the model.
+    double c;//The scale factor of the model.
+    uint64_t reserved;
+};
+
+class spherHarmonicCoeffFileCPP {
+public:
+    size_t M;//The degree of the views C and S.
+    size_t MFile;//The maximum degree of the coefficients in the file.
+    size_t numArrays;
+    double a;
+    double c;
+    //Views of the coefficients in the file. These do not own their
+    //memory.
+    CountingClusterSetCPP<double> C;
+    CountingClusterSetCPP<double> S;
+
+    spherHarmonicCoeffFileCPP();
+    ~spherHarmonicCoeffFileCPP();
+    bool load(const char *fileName, const size_t MMax);
+    void close();
+    //Get array idx (0=C, 1=S, 2=CStdDev, 3=SStdDev) or NULL if it is not
+    //in the file.
+    const double *getArray(const size_t idx) const;
+
+private:
+    mappedFileCPP file;
+    size_t arrayStride;
+
+    //The views point into the mapping, so copying is not allowed.
+    spherHarmonicCoeffFileCPP(const spherHarmonicCoeffFileCPP &);
+    spherHarmonicCoeffFileCPP &operator=(const spherHarmonicCoeffFileCPP &);
+};
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
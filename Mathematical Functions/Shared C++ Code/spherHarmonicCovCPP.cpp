@@ -12,6 +12,13 @@
  *can be consulted for more information regarding the implementation and
  *the meaning of the results. 
  *
+ *spherHarmonicCovPackedCPP finds the covariance matrix of the potential
+ *between all pairs of points, keeping only the lower triangle. The terms
+ *of each point are computed once for a block of degrees and the
+ *covariances are their inner products, which are formed in tiles of
+ *points split among threads. The degrees are split into blocks so that
+ *the terms of all of the points need not be held at once.
+ *
  *April 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
  **/
 /*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
@@ -24,6 +31,10 @@
 #include <limits>
 //for memset
 #include <string.h>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 //Many versions of Windows and some other operating systems do not support
 //the isfinite function in C++, so we just define our own isFinite function
@@ -329,6 +340,227 @@ bool spherHarmonicCovCPP(double *sigma2, double *Sigma, const CountingClusterSet
     return didOverflow;
 }
 
+static void spherHarmonicCovFeaturesCPP(double *F, const size_t numFeat, bool &didOverflow, const CountingClusterSetCPP<double> &CStdDev,const CountingClusterSetCPP<double> &SStdDev, const double *point, const size_t startPoint, const size_t endPoint, const size_t nStart, const size_t nEnd, const double a, const double c, const double scalFactor, std::vector<double> &workspace) {
+    //Fill rows startPoint to endPoint-1 of F with the terms of degrees
+    //nStart to nEnd-1 of the sum for the potential, each multiplied by the
+    //standard deviation of its coefficient. The variance of the potential
+    //is the sum of the squares of the terms in a row and the covariance
+    //between two points is the inner product of their rows.
+    CountingClusterSetCPP<double> FuncVals;
+    double *nCoeff, *rm, *im;
+
+    //A view of the first nEnd degrees, as the Helmholtz polynomials of
+    //the lower degrees do not depend on the higher ones.
+    FuncVals.numClust=nEnd;
+    FuncVals.totalNumEl=nEnd*(nEnd+1)/2;
+    workspace.resize(FuncVals.totalNumEl+3*nEnd);
+    FuncVals.clusterEls=workspace.data();
+    nCoeff=workspace.data()+FuncVals.totalNumEl;
+    rm=nCoeff+nEnd;
+    im=rm+nEnd;
+
+    for(size_t curPoint=startPoint;curPoint<endPoint;curPoint++) {
+        const double r=point[3*curPoint];
+        const double scal=c/(r*scalFactor);
+        double *FCur=F+numFeat*(curPoint-startPoint);
+        double CartPoint[3];
+        double s,t,u;
+        size_t curFeat=0;
+
+        spher2CartCPP(CartPoint,point+3*curPoint,0);
+        s=CartPoint[0]/r;
+        t=CartPoint[1]/r;
+        u=CartPoint[2]/r;
+
+        nCoeff[0]=1;
+        for(size_t n=1;n<nEnd;n++) {
+            nCoeff[n]=nCoeff[n-1]*(a/r);
+        }
+
+        normHelmHoltzCPP(FuncVals,u,scalFactor);
+
+        rm[0]=1;
+        im[0]=0;
+        for(size_t m=1;m<nEnd;m++) {
+            rm[m]=s*rm[m-1]-t*im[m-1];
+            im[m]=s*im[m-1]+t*rm[m-1];
+        }
+
+        for(size_t n=nStart;n<nEnd;n++) {
+            for(size_t m=0;m<=n;m++) {
+                const double HVal=nCoeff[n]*FuncVals[n][m];
+                double CTerm=CStdDev[n][m]*rm[m]*HVal;
+
+                //Terms that overflow are dropped, as in
+                //spherHarmonicCovCPP.
+                if(!isFinite(CTerm)) {
+                    CTerm=0;
+                    didOverflow=true;
+                }
+                FCur[curFeat++]=scal*CTerm;
+
+                if(m>0) {
+                    double STerm=SStdDev[n][m]*im[m]*HVal;
+                    if(!isFinite(STerm)) {
+                        STerm=0;
+                        didOverflow=true;
+                    }
+                    FCur[curFeat++]=scal*STerm;
+                }
+            }
+        }
+    }
+}
+
+static void spherHarmonicCovTileCPP(double *VCov, const double *F, const size_t numFeat, const size_t numPoints, const size_t iStart, const size_t iEnd, const size_t jStart, const size_t jEnd) {
+    //Add the inner products of rows i of F for iStart<=i<iEnd and rows j
+    //for jStart<=j<jEnd with j<=i to the packed lower triangle of the
+    //covariance matrix. Two rows are taken against two rows at a time so
+    //that each value loaded from F is used twice.
+    for(size_t j=jStart;j<jEnd;j+=2) {
+        const bool hasJ1=j+1<jEnd;
+        const double *b0=F+numFeat*j;
+        const double *b1=hasJ1?b0+numFeat:b0;
+        //The index in VCov of element (j,j) and (j+1,j+1).
+        const size_t col0=j*numPoints-j*(j-1)/2;
+        const size_t col1=col0+numPoints-j;
+
+        for(size_t i=std::max(iStart,j);i<iEnd;i+=2) {
+            const bool hasI1=i+1<iEnd;
+            const double *a0=F+numFeat*i;
+            const double *a1=hasI1?a0+numFeat:a0;
+            double s00=0,s01=0,s10=0,s11=0;
+
+            for(size_t k=0;k<numFeat;k++) {
+                const double a0k=a0[k];
+                const double a1k=a1[k];
+                const double b0k=b0[k];
+                const double b1k=b1[k];
+
+                s00+=a0k*b0k;
+                s01+=a0k*b1k;
+                s10+=a1k*b0k;
+                s11+=a1k*b1k;
+            }
+
+            VCov[col0+i-j]+=s00;
+            if(hasI1) {
+                VCov[col0+i+1-j]+=s10;
+            }
+            //Only the elements on or below the diagonal are stored.
+            if(hasJ1&&i>=j+1) {
+                VCov[col1+i-j-1]+=s01;
+            }
+            if(hasJ1&&hasI1) {
+                VCov[col1+i-j]+=s11;
+            }
+        }
+    }
+}
+
+bool spherHarmonicCovPackedCPP(double *VCov, const CountingClusterSetCPP<double> &CStdDev,const CountingClusterSetCPP<double> &SStdDev, const double *point, const size_t numPoints, const double a, const double c, const double scalFactor, size_t numThreads) {
+    //VCov must have room for numPoints*(numPoints+1)/2 doubles. The
+    //covariance matrix of the potential at the points is written there as
+    //its lower triangle stacked column-wise, as with the vech function.
+    //The return value indicates whether any terms were discarded due to
+    //overflow errors.
+    const size_t M=CStdDev.numClust-1;
+    //The number of points handled together when forming inner products.
+    const size_t tileSize=64;
+    const size_t numTiles=(numPoints+tileSize-1)/tileSize;
+    //The memory used for the terms of all of the points at once is limited
+    //to about this many doubles by splitting the degrees into blocks.
+    const size_t maxBlockEls=size_t(1)<<25;
+    std::vector<double> F;
+    std::vector<char> threadOverflow;
+    size_t nStart=0;
+
+    if(numThreads==0) {
+        numThreads=std::max<size_t>(1,std::thread::hardware_concurrency());
+    }
+    numThreads=std::min(numThreads,std::max<size_t>(1,numTiles));
+    threadOverflow.assign(numThreads,0);
+
+    memset(VCov,0,sizeof(double)*numPoints*(numPoints+1)/2);
+
+    while(nStart<=M) {
+        size_t nEnd=nStart;
+        size_t numFeat=0;
+
+        //Add degrees to the block while the terms fit. Degree n has 2*n+1
+        //terms. At least one degree is always taken.
+        do {
+            numFeat+=2*nEnd+1;
+            nEnd++;
+        } while(nEnd<=M&&(numFeat+2*nEnd+1)*numPoints<=maxBlockEls);
+
+        F.resize(numFeat*numPoints);
+
+        {
+            //Compute the terms, splitting the points among the threads.
+            std::vector<std::thread> threads;
+            const size_t pointsPerThread=(numPoints+numThreads-1)/numThreads;
+
+            for(size_t curThread=0;curThread<numThreads;curThread++) {
+                const size_t startPoint=std::min(numPoints,curThread*pointsPerThread);
+                const size_t endPoint=std::min(numPoints,startPoint+pointsPerThread);
+
+                threads.push_back(std::thread([&,curThread,startPoint,endPoint]() {
+                    std::vector<double> workspace;
+                    bool overflow=false;
+
+                    spherHarmonicCovFeaturesCPP(F.data()+numFeat*startPoint,numFeat,overflow,CStdDev,SStdDev,point,startPoint,endPoint,nStart,nEnd,a,c,scalFactor,workspace);
+                    if(overflow) {
+                        threadOverflow[curThread]=1;
+                    }
+                }));
+            }
+            for(size_t curThread=0;curThread<numThreads;curThread++) {
+                threads[curThread].join();
+            }
+        }
+
+        {
+            //Accumulate the inner products. Each thread takes whole rows of
+            //tiles, so no two threads write to the same elements. The
+            //longest rows are taken first to balance the load.
+            std::vector<std::thread> threads;
+            std::atomic<size_t> nextRow(0);
+
+            for(size_t curThread=0;curThread<numThreads;curThread++) {
+                threads.push_back(std::thread([&]() {
+                    size_t curRow;
+
+                    while((curRow=nextRow++)<numTiles) {
+                        const size_t tileI=numTiles-1-curRow;
+                        const size_t iStart=tileI*tileSize;
+                        const size_t iEnd=std::min(numPoints,iStart+tileSize);
+
+                        for(size_t tileJ=0;tileJ<=tileI;tileJ++) {
+                            const size_t jStart=tileJ*tileSize;
+                            const size_t jEnd=std::min(numPoints,jStart+tileSize);
+
+                            spherHarmonicCovTileCPP(VCov,F.data(),numFeat,numPoints,iStart,iEnd,jStart,jEnd);
+                        }
+                    }
+                }));
+            }
+            for(size_t curThread=0;curThread<numThreads;curThread++) {
+                threads[curThread].join();
+            }
+        }
+
+        nStart=nEnd;
+    }
+
+    for(size_t curThread=0;curThread<numThreads;curThread++) {
+        if(threadOverflow[curThread]) {
+            return true;
+        }
+    }
+    return false;
+}
+
 /*LICENSE:
 %
 %The source code is in the public domain and not licensed or under
@@ -10,6 +10,14 @@
  *can be consulted for more information regarding the implementation and
  *the meaning of the results. 
  *
+ *The points can be split among multiple threads using the numThreads
+ *input. If the points are not grouped by elevation and range, they are
+ *evaluated sorted by those values and the results are put back in the
+ *original order. See spherHarmonicPointsCPP.hpp for details. In the real
+ *implementation, the sums for Legendre's algorithm are computed for up to
+ *spherHarmonicNumLanes upcoming combinations of range and elevation at
+ *once using spherHarmonicLegendreSumsBatchCPP.
+ *
  *July 2017 David F. Crouse, Naval Research Laboratory, Washington D.C.
  **/
 /*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
@@ -24,16 +32,50 @@
 #include <cstring>
 //For the implementation in the complex domain.
 #include <complex>
+//For splitting the points among threads.
+#include "spherHarmonicPointsCPP.hpp"
+#include <vector>
+#include <atomic>
 
 using namespace std;
 
-void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const CountingClusterSetCPP<double> &C,const CountingClusterSetCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm) {
+/*GETSPHERHARMONICBUFFERCPP Return a buffer of at least numEls doubles.
+ *          If workspace is NULL, the buffer is allocated with new[] and
+ *          must be deleted by the caller. Otherwise, workspace is enlarged
+ *          if necessary and its memory is returned.
+ */
+static double *getSpherHarmonicBufferCPP(vector<double> *workspace, const size_t numEls) {
+    if(workspace==NULL) {
+        return new double[numEls];
+    }
+
+    if(workspace->size()<numEls) {
+        workspace->resize(numEls);
+    }
+    return workspace->data();
+}
+
+static void spherHarmonicEvalCPPRealSerial(double *V, double *gradV, double *HessianV,const CountingClusterSetCPP<double> &C,const CountingClusterSetCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm, const double *legendreCoeffs, vector<double> *workspace) {
     //If a NULL pointer is passed for gradV, then it is assumed that the
     //gradient is not desired. If a NULL pointer is passed for HessianV,
-    //then it is assumed that the Hessian is not desired.
+    //then it is assumed that the Hessian is not desired. If workspace is
+    //not NULL, it is used (and enlarged if necessary) in place of
+    //allocating memory.
     const size_t M=C.numClust-1;
     const size_t M1=C.numClust;
     const double pi=2.0*acos(0.0);
+    //The sums for the Legendre algorithm for up to spherHarmonicNumLanes
+    //combinations of range and colatitude, as computed by
+    //spherHarmonicLegendreSumsBatchCPP, are put at the end of the buffer.
+    const size_t derivOrder=(HessianV!=NULL)?2:((gradV!=NULL)?1:0);
+    const size_t numSums=(derivOrder==0)?2:((derivOrder==1)?6:12);
+    const size_t numLaneSums=(algorithm==2)?0:spherHarmonicNumLanes*numSums*M1;
+    //The tables of Legendre ratios and Helmholtz polynomials are only
+    //needed by Pines' algorithm, because the Legendre sums are computed
+    //one degree at a time.
+    const size_t tableNumEl=(algorithm==1)?0:C.totalNumEl;
+    size_t bufferSize;
+    double *laneSums;
     size_t curPoint;
     double rPrev, thetaPrev, crScal;
     CountingClusterSetCPP<double> FuncVals;
@@ -95,11 +137,12 @@ void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const C
         double *tempPtr;
 
         if(gradV==NULL&&HessianV==NULL) {
-            buffer=new double[3*M1+C.totalNumEl];
+            bufferSize=3*M1+C.totalNumEl;
         }else{
-            buffer=new double[3*M1+3*C.totalNumEl];
+            bufferSize=3*M1+3*C.totalNumEl;
         }
         
+        buffer=getSpherHarmonicBufferCPP(workspace,bufferSize+numLaneSums);
         tempPtr=buffer;
         nCoeff=tempPtr;//Length M1
 
@@ -126,17 +169,18 @@ void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const C
         //memory needed varies depending on the highest order derivative
         //that is needed.
         if(HessianV!=NULL) {
-            buffer=new double[15*M1+3*C.totalNumEl];
+            bufferSize=15*M1+3*tableNumEl;
         } else if(gradV!=NULL) {
             if(algorithm==0) {//If Pines' algorithm might be used
-                buffer=new double[9*M1+3*C.totalNumEl];
+                bufferSize=9*M1+3*tableNumEl;
             } else {
-                buffer=new double[9*M1+2*C.totalNumEl];
+                bufferSize=9*M1+2*tableNumEl;
             }
         } else {
-            buffer=new double[5*M1+C.totalNumEl];
+            bufferSize=5*M1+tableNumEl;
         }
         
+        buffer=getSpherHarmonicBufferCPP(workspace,bufferSize+numLaneSums);
         tempPtr=buffer;
         nCoeff=tempPtr;//Length M1
 
@@ -158,7 +202,7 @@ void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const C
         FuncVals.clusterEls=tempPtr;//Length C.totalNumEl
             
         if(gradV!=NULL||HessianV!=NULL) {
-            tempPtr+=C.totalNumEl;
+            tempPtr+=tableNumEl;
             Ar=tempPtr;//Length M1
 
             tempPtr+=M1;
@@ -174,12 +218,12 @@ void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const C
             FuncDerivs.clusterEls=tempPtr;//Length C.totalNumEl
 
             if(HessianV!=NULL||algorithm!=0) {
-                tempPtr+=C.totalNumEl;
+                tempPtr+=tableNumEl;
                 FuncDerivs2.clusterEls=tempPtr;//Length C.totalNumEl
             }
 
             if(HessianV!=NULL) {
-                tempPtr+=C.totalNumEl;
+                tempPtr+=tableNumEl;
                 AThetaTheta=tempPtr;//Length M1
 
                 tempPtr+=M1;
@@ -200,7 +244,12 @@ void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const C
         }
     }
 
+    laneSums=buffer+bufferSize;
     nCoeff[0]=1;
+
+    double laneR[spherHarmonicNumLanes];
+    double laneTheta[spherHarmonicNumLanes];
+    size_t numLanesFilled=0;
     
     rPrev=std::numeric_limits<double>::infinity();
     thetaPrev=std::numeric_limits<double>::infinity();
@@ -273,102 +322,65 @@ void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const C
             //method uses clolatitude, pi/2-elevation
             theta=pi/2-thetaCur;
             u=sin(theta);
-            if(thetaChanged) {
-                //Get the associated Legendre function ratios.
-                NALegendreCosRatCPP(FuncVals,  theta, scalFactor);
+            //Evaluate Equation 7 from the Holmes and Featherstone paper.
+            //The sums are computed for several of the upcoming
+            //combinations of range and colatitude at once.
+            if(rChanged||thetaChanged) {
+                const double *laneSumsCur;
+                size_t curLane;
 
-                //Get Legendre ratio values if the gradient or Hessian
-                //terms are desired.
-                if(gradV!=NULL||HessianV!=NULL) {
-                    NALegendreCosRatDerivCPP(FuncDerivs,FuncVals,theta);
-                    
-                    if(HessianV!=NULL) {
-                        NALegendreCosRatDeriv2CPP(FuncDerivs2,FuncDerivs,FuncVals,theta);
+                for(curLane=0;curLane<numLanesFilled;curLane++) {
+                    if(laneR[curLane]==r&&laneTheta[curLane]==theta) {
+                        break;
                     }
                 }
-            }
-            
-            //Evaluate Equation 7 from the Holmes and Featherstone paper.
-            if(rChanged||thetaChanged) {
-                //Zero the arrays.
-                memset(A,0,sizeof(double)*M1);
-                memset(B,0,sizeof(double)*M1);
 
-                //Compute the X coefficients for the sum
-                for(m=0;m<=M;m++) {
-                    for(n=m;n<=M;n++) {
-                        A[m]+=nCoeff[n]*C[n][m]*FuncVals[n][m];
-                        B[m]+=nCoeff[n]*S[n][m]*FuncVals[n][m];
+                if(curLane==numLanesFilled) {
+                    //Collect the next distinct combinations of range and
+                    //colatitude that use the Legendre algorithm, starting
+                    //with the current point.
+                    numLanesFilled=0;
+                    for(size_t scanPoint=curPoint;scanPoint<numPoints&&numLanesFilled<spherHarmonicNumLanes;scanPoint++) {
+                        const double rScan=point[0+3*scanPoint];
+                        const double elScan=(systemType==2)?pi/2.0-point[2+3*scanPoint]:point[2+3*scanPoint];
+                        const double thetaScan=pi/2-elScan;
+
+                        if(algorithm==0&&!(fabs(elScan)<88.0*pi/180.0||(gradV==NULL&&HessianV==NULL))) {
+                            continue;
+                        }
+
+                        if(numLanesFilled>0&&rScan==laneR[numLanesFilled-1]&&thetaScan==laneTheta[numLanesFilled-1]) {
+                            continue;
+                        }
+
+                        laneR[numLanesFilled]=rScan;
+                        laneTheta[numLanesFilled]=thetaScan;
+                        numLanesFilled++;
                     }
+
+                    spherHarmonicLegendreSumsBatchCPP(laneSums,C,S,laneTheta,laneR,a,numLanesFilled,derivOrder,scalFactor,legendreCoeffs);
+                    curLane=0;
                 }
-                
+
+                laneSumsCur=laneSums+curLane*numSums*M1;
+                memcpy(A,laneSumsCur,sizeof(double)*M1);
+                memcpy(B,laneSumsCur+M1,sizeof(double)*M1);
+
                 //If additional terms should be computed so a gradient or
                 //Hessian can be computed.
                 if(gradV!=NULL||HessianV!=NULL) {
-                    memset(Ar,0,sizeof(double)*M1);
-                    memset(Br,0,sizeof(double)*M1);
-                    memset(ATheta,0,sizeof(double)*M1);
-                    memset(BTheta,0,sizeof(double)*M1);
+                    memcpy(Ar,laneSumsCur+2*M1,sizeof(double)*M1);
+                    memcpy(Br,laneSumsCur+3*M1,sizeof(double)*M1);
+                    memcpy(ATheta,laneSumsCur+4*M1,sizeof(double)*M1);
+                    memcpy(BTheta,laneSumsCur+5*M1,sizeof(double)*M1);
 
-                    mf=0;
-                    for(m=0;m<=M;m++) {
-                        nf=mf;
-                        for(n=m;n<=M;n++) {
-                            const double CScal=nCoeff[n]*C[n][m];
-                            const double SScal=nCoeff[n]*S[n][m];
-                            double curVal;
-                            
-                            curVal=FuncVals[n][m];
-                            Ar[m]+=(nf+1)*CScal*curVal;
-                            Br[m]+=(nf+1)*SScal*curVal;
-                            
-                            curVal=FuncDerivs[n][m];
-                            ATheta[m]+=CScal*curVal;
-                            BTheta[m]+=SScal*curVal;
-                                                        
-                            nf++;
-                        }
-                                    
-                        mf++;
-                    }
-                    
                     if(HessianV!=NULL) {
-                        memset(Arr,0,sizeof(double)*M1);
-                        memset(Brr,0,sizeof(double)*M1);
-                        memset(AThetar,0,sizeof(double)*M1);
-                        memset(BThetar,0,sizeof(double)*M1);
-                        memset(AThetaTheta,0,sizeof(double)*M1);
-                        memset(BThetaTheta,0,sizeof(double)*M1);
-                        
-                        mf=0;
-                        for(m=0;m<=M;m++) {
-                            nf=mf;
-                            for(n=m;n<=M;n++) {
-                                const double CScal=nCoeff[n]*C[n][m];
-                                const double SScal=nCoeff[n]*S[n][m];
-                                double curVal;
-                                
-                                curVal=FuncVals[n][m];
-                                //From Table 5, with the correction from the
-                                //erratum.
-                                Arr[m]+=(nf+1)*(nf+2)*CScal*curVal;
-                                Brr[m]+=(nf+1)*(nf+2)*SScal*curVal;;
-                                
-                                curVal=FuncDerivs[n][m];
-                                //From Table 5
-                                AThetar[m]+=(nf+1)*CScal*curVal;
-                                BThetar[m]+=(nf+1)*SScal*curVal;
-                                
-                                curVal=FuncDerivs2[n][m];
-                                //From Table 5
-                                AThetaTheta[m]+=CScal*curVal;
-                                BThetaTheta[m]+=SScal*curVal;
-
-                                nf++;
-                            }
-                            
-                            mf++;
-                        }
+                        memcpy(Arr,laneSumsCur+6*M1,sizeof(double)*M1);
+                        memcpy(Brr,laneSumsCur+7*M1,sizeof(double)*M1);
+                        memcpy(AThetar,laneSumsCur+8*M1,sizeof(double)*M1);
+                        memcpy(BThetar,laneSumsCur+9*M1,sizeof(double)*M1);
+                        memcpy(AThetaTheta,laneSumsCur+10*M1,sizeof(double)*M1);
+                        memcpy(BThetaTheta,laneSumsCur+11*M1,sizeof(double)*M1);
                     }
                 }
             }
@@ -928,10 +940,12 @@ void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const C
         }
     }
     
-    delete[] buffer;
+    if(workspace==NULL) {
+        delete[] buffer;
+    }
 }
 
-void spherHarmonicEvalCPPComplex(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetCPP<double> &CReal,const CountingClusterSetCPP<double> &CImag,const CountingClusterSetCPP<double> &SReal,const CountingClusterSetCPP<double> &SImag, const double *point, const size_t numPoints, const complex <double> a, const complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm) {
+static void spherHarmonicEvalCPPComplexSerial(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetCPP<double> &CReal,const CountingClusterSetCPP<double> &CImag,const CountingClusterSetCPP<double> &SReal,const CountingClusterSetCPP<double> &SImag, const double *point, const size_t numPoints, const complex <double> a, const complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm) {
     //If a NULL pointer is passed for gradV, then it is assumed that the
     //gradient is not desired. If a NULL pointer is passed for HessianV,
     //then it is assumed that the Hessian is not desired.
@@ -2020,6 +2034,149 @@ void spherHarmonicEvalCPPComplex(double *VReal, double *VImag, double *gradVReal
     delete[] bufferComplex;
 }
 
+static void spherHarmonicEvalCPPRealThreaded(double *V, double *gradV, double *HessianV,const CountingClusterSetCPP<double> &C,const CountingClusterSetCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm, size_t numThreads, spherHarmonicWorkCPP *work) {
+    const double *legendreCoeffs=NULL;
+    //Each chunk takes the next unused workspace.
+    atomic<size_t> nextWorkspace(0);
+
+    if(numThreads==0) {
+        numThreads=max<size_t>(1,thread::hardware_concurrency());
+    }
+
+    if(work!=NULL) {
+        legendreCoeffs=work->legendreCoeffs;
+        if(work->workspaces.size()<numThreads) {
+            work->workspaces.resize(numThreads);
+        }
+    }
+
+    auto evalChunk=[&](const size_t startIdx, const size_t numInChunk) {
+        double *VCur=V+startIdx;
+        double *gradVCur=gradV!=NULL?gradV+3*startIdx:NULL;
+        double *HessianVCur=HessianV!=NULL?HessianV+9*startIdx:NULL;
+        vector<double> *workspace=NULL;
+        if(work!=NULL) {
+            workspace=&(work->workspaces[nextWorkspace++]);
+        }
+        spherHarmonicEvalCPPRealSerial(VCur,gradVCur,HessianVCur,C,S,point+3*startIdx,numInChunk,a,c,systemType,spherDerivs,scalFactor,algorithm,legendreCoeffs,workspace);
+    };
+
+    spherHarmonicEvalChunksCPP(evalChunk,point,numPoints,numThreads);
+}
+
+static void spherHarmonicEvalCPPComplexThreaded(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetCPP<double> &CReal,const CountingClusterSetCPP<double> &CImag,const CountingClusterSetCPP<double> &SReal,const CountingClusterSetCPP<double> &SImag, const double *point, const size_t numPoints, const complex <double> a, const complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm, size_t numThreads) {
+    auto evalChunk=[&](const size_t startIdx, const size_t numInChunk) {
+        double *VRealCur=VReal+startIdx;
+        double *VImagCur=VImag+startIdx;
+        double *gradVRealCur=gradVReal!=NULL?gradVReal+3*startIdx:NULL;
+        double *gradVImagCur=gradVImag!=NULL?gradVImag+3*startIdx:NULL;
+        double *HessianVRealCur=HessianVReal!=NULL?HessianVReal+9*startIdx:NULL;
+        double *HessianVImagCur=HessianVImag!=NULL?HessianVImag+9*startIdx:NULL;
+        spherHarmonicEvalCPPComplexSerial(VRealCur,VImagCur,gradVRealCur,gradVImagCur,HessianVRealCur,HessianVImagCur,CReal,CImag,SReal,SImag,point+3*startIdx,numInChunk,a,c,systemType,spherDerivs,scalFactor,algorithm);
+    };
+
+    spherHarmonicEvalChunksCPP(evalChunk,point,numPoints,numThreads);
+}
+
+void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const CountingClusterSetCPP<double> &C,const CountingClusterSetCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm, size_t numThreads) {
+    spherHarmonicEvalCPPReal(V,gradV,HessianV,C,S,point,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads,NULL);
+}
+
+void spherHarmonicEvalCPPReal(double *V, double *gradV, double *HessianV,const CountingClusterSetCPP<double> &C,const CountingClusterSetCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm, size_t numThreads, spherHarmonicWorkCPP *work) {
+    //If work is not NULL, the memory that it holds is reused across calls.
+    vector<size_t> orderLocal;
+    vector<double> sortBufferLocal;
+    vector<size_t> &order=(work!=NULL)?work->order:orderLocal;
+    vector<double> &sortBuffer=(work!=NULL)?work->sortBuffer:sortBufferLocal;
+
+    if(orderSpherPointsCPP(order,point,numPoints)) {
+        //Evaluate the points sorted by elevation and range so that the
+        //terms that only depend on those are computed once for each
+        //distinct value, and then put the results back in the original
+        //order.
+        const size_t numPerPoint=1+(gradV!=NULL?3:0)+(HessianV!=NULL?9:0);
+        if(sortBuffer.size()<(3+numPerPoint)*numPoints) {
+            sortBuffer.resize((3+numPerPoint)*numPoints);
+        }
+        double *tempPtr=sortBuffer.data();
+        double *pointSorted=tempPtr;
+        tempPtr+=3*numPoints;
+        double *VSorted=tempPtr;
+        tempPtr+=numPoints;
+        double *gradVSorted=NULL;
+        if(gradV!=NULL) {
+            gradVSorted=tempPtr;
+            tempPtr+=3*numPoints;
+        }
+        double *HessianVSorted=NULL;
+        if(HessianV!=NULL) {
+            HessianVSorted=tempPtr;
+            tempPtr+=9*numPoints;
+        }
+
+        gatherSpherBlocksCPP(pointSorted,point,order.data(),numPoints,3);
+        spherHarmonicEvalCPPRealThreaded(VSorted,gradVSorted,HessianVSorted,C,S,pointSorted,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads,work);
+
+        scatterSpherBlocksCPP(V,VSorted,order.data(),numPoints,1);
+        scatterSpherBlocksCPP(gradV,gradVSorted,order.data(),numPoints,3);
+        scatterSpherBlocksCPP(HessianV,HessianVSorted,order.data(),numPoints,9);
+    } else {
+        spherHarmonicEvalCPPRealThreaded(V,gradV,HessianV,C,S,point,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads,work);
+    }
+}
+
+void spherHarmonicEvalCPPComplex(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetCPP<double> &CReal,const CountingClusterSetCPP<double> &CImag,const CountingClusterSetCPP<double> &SReal,const CountingClusterSetCPP<double> &SImag, const double *point, const size_t numPoints, const complex <double> a, const complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm, size_t numThreads) {
+    vector<size_t> order;
+
+    if(orderSpherPointsCPP(order,point,numPoints)) {
+        //Evaluate the points sorted by elevation and range so that the
+        //terms that only depend on those are computed once for each
+        //distinct value, and then put the results back in the original
+        //order.
+        const size_t numPerPoint=2+(gradVReal!=NULL?3:0)+(gradVImag!=NULL?3:0)+(HessianVReal!=NULL?9:0)+(HessianVImag!=NULL?9:0);
+        vector<double> sortBuffer((3+numPerPoint)*numPoints);
+        double *tempPtr=sortBuffer.data();
+        double *pointSorted=tempPtr;
+        tempPtr+=3*numPoints;
+        double *VRealSorted=tempPtr;
+        tempPtr+=numPoints;
+        double *VImagSorted=tempPtr;
+        tempPtr+=numPoints;
+        double *gradVRealSorted=NULL;
+        if(gradVReal!=NULL) {
+            gradVRealSorted=tempPtr;
+            tempPtr+=3*numPoints;
+        }
+        double *gradVImagSorted=NULL;
+        if(gradVImag!=NULL) {
+            gradVImagSorted=tempPtr;
+            tempPtr+=3*numPoints;
+        }
+        double *HessianVRealSorted=NULL;
+        if(HessianVReal!=NULL) {
+            HessianVRealSorted=tempPtr;
+            tempPtr+=9*numPoints;
+        }
+        double *HessianVImagSorted=NULL;
+        if(HessianVImag!=NULL) {
+            HessianVImagSorted=tempPtr;
+            tempPtr+=9*numPoints;
+        }
+
+        gatherSpherBlocksCPP(pointSorted,point,order.data(),numPoints,3);
+        spherHarmonicEvalCPPComplexThreaded(VRealSorted,VImagSorted,gradVRealSorted,gradVImagSorted,HessianVRealSorted,HessianVImagSorted,CReal,CImag,SReal,SImag,pointSorted,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+
+        scatterSpherBlocksCPP(VReal,VRealSorted,order.data(),numPoints,1);
+        scatterSpherBlocksCPP(VImag,VImagSorted,order.data(),numPoints,1);
+        scatterSpherBlocksCPP(gradVReal,gradVRealSorted,order.data(),numPoints,3);
+        scatterSpherBlocksCPP(gradVImag,gradVImagSorted,order.data(),numPoints,3);
+        scatterSpherBlocksCPP(HessianVReal,HessianVRealSorted,order.data(),numPoints,9);
+        scatterSpherBlocksCPP(HessianVImag,HessianVImagSorted,order.data(),numPoints,9);
+    } else {
+        spherHarmonicEvalCPPComplexThreaded(VReal,VImag,gradVReal,gradVImag,HessianVReal,HessianVImag,CReal,CImag,SReal,SImag,point,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+    }
+}
+
 /*LICENSE:
 %
 %The source code is in the public domain and not licensed or under
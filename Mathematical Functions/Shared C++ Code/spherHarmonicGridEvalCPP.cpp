@@ -0,0 +1,226 @@
+/*SPHERHARMONICGRIDEVALCPP A C++ implementation of a function to evaluate
+ *                  a real spherical harmonic series and optionally its
+ *                  gradient on a regular grid of points in elevation and
+ *                  azimuth.
+ *
+ *The grid consists of numLat rows of arbitrary elevations, each of which
+ *may have its own range, and numLon azimuths evenly spaced around the
+ *full circle, lambda(j)=lon0+2*pi*j/numLon for j=0 to numLon-1. For each
+ *row, the Legendre terms and the coefficient sums A_m and B_m of
+ *Legendre's method (the same as in spherHarmonicEvalCPPReal) are
+ *computed once in O(M^2) operations. spherHarmonicNumLanes rows are
+ *handled together by spherHarmonicLegendreSumsBatchCPP. The potential
+ *along the row is then sum_m u^m*(A_m*cos(m*lambda)+B_m*sin(m*lambda)),
+ *which is a Fourier series in lambda, so it is evaluated at all numLon
+ *azimuths using a single FFT of length numLon. Orders m>=numLon are folded onto m modulo
+ *numLon, which is exact at the grid points, so any numLon>=1 can be used.
+ *The three spherical derivatives needed for the gradient are computed the
+ *same way using one FFT each.
+ *
+ *As with algorithm 1 of spherHarmonicEval, the gradient in Cartesian
+ *coordinates is singular at the poles. The rows are split among numThreads
+ *threads, each of which has its own workspace.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mathFuncs.hpp"
+#include "CoordFuncs.hpp"
+#include "FFTPlanCPP.hpp"
+
+//For sin and cos.
+#include <cmath>
+#include <complex>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <algorithm>
+
+using namespace std;
+
+static void spherHarmonicGridEvalRowsCPP(double *V, double *gradV, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double *elevation, const double *r, const size_t numLat, const size_t rowStart, const size_t rowEnd, const size_t numLon, const double lon0, const double a, const double c, const bool spherDerivs, const double scalFactor) {
+    const size_t M=C.numClust-1;
+    const size_t M1=C.numClust;
+    const double pi=2.0*acos(0.0);
+    const double invScalFactor=1.0/scalFactor;
+    //The number of Fourier series that are synthesized per row. The
+    //potential and if the gradient is desired, the derivatives with
+    //respect to range, azimuth and elevation.
+    const size_t numSeries=(gradV!=NULL)?4:1;
+    //The sums A, B and, if the gradient is desired, Ar, Br, ATheta and
+    //BTheta for each row are computed for spherHarmonicNumLanes rows at
+    //once.
+    const size_t derivOrder=(gradV!=NULL)?1:0;
+    const size_t numSums=(gradV!=NULL)?6:2;
+    FFTPlanCPP plan(numLon);
+    vector<double> laneSums(spherHarmonicNumLanes*numSums*M1);
+    vector<complex<double> > series(numSeries*numLon);
+    //exp(1i*m*lon0) for m=0 to M, so that the first azimuth can be lon0.
+    vector<complex<double> > lonShift(M1);
+    double laneTheta[spherHarmonicNumLanes];
+
+    for(size_t m=0;m<=M;m++) {
+        const double angle=static_cast<double>(m)*lon0;
+        lonShift[m]=complex<double>(cos(angle),sin(angle));
+    }
+
+    for(size_t curRow=rowStart;curRow<rowEnd;curRow++) {
+        const size_t curLane=(curRow-rowStart)%spherHarmonicNumLanes;
+        const double rCur=r[curRow];
+        const double elCur=elevation[curRow];
+        //The formulae for spherical harmonic synthesis with Legendre's
+        //method use colatitude.
+        const double theta=pi/2-elCur;
+        const double u=sin(theta);
+        const double crScal=c/rCur;
+        const double *A, *B, *Ar, *Br, *ATheta, *BTheta;
+        double uPow;
+        size_t m;
+        double mf;
+
+        //Evaluate Equation 7 from the Holmes and Featherstone paper, as in
+        //spherHarmonicEvalCPPReal, for the next set of rows.
+        if(curLane==0) {
+            const size_t numLanes=min(spherHarmonicNumLanes,rowEnd-curRow);
+
+            for(size_t k=0;k<numLanes;k++) {
+                laneTheta[k]=pi/2-elevation[curRow+k];
+            }
+
+            spherHarmonicLegendreSumsBatchCPP(laneSums.data(),C,S,laneTheta,r+curRow,a,numLanes,derivOrder,scalFactor,NULL);
+        }
+
+        A=laneSums.data()+curLane*numSums*M1;
+        B=A+M1;
+        if(gradV!=NULL) {
+            Ar=B+M1;
+            Br=Ar+M1;
+            ATheta=Br+M1;
+            BTheta=ATheta+M1;
+        } else {
+            Ar=NULL;
+            Br=NULL;
+            ATheta=NULL;
+            BTheta=NULL;
+        }
+
+        //Form the Fourier coefficients. A series
+        //sum_m (P_m*cos(m*lambda)+Q_m*sin(m*lambda)) is the real part of
+        //sum_m (P_m-1i*Q_m)*exp(1i*m*lambda). The u^m terms that Horner's
+        //method applies in spherHarmonicEvalCPPReal are applied here
+        //directly, along with the removal of the scale factor. When u^m
+        //underflows, the corresponding terms are negligible.
+        fill(series.begin(),series.end(),complex<double>(0.0,0.0));
+        uPow=1;
+        mf=0;
+        for(m=0;m<=M;m++) {
+            const double w=uPow*invScalFactor;
+            const complex<double> shift=lonShift[m]*w;
+            const size_t k=m%numLon;
+
+            series[k]+=complex<double>(A[m],-B[m])*shift;
+            if(gradV!=NULL) {
+                //Derivative with respect to range.
+                series[k+numLon]+=complex<double>(-Ar[m],Br[m])*shift;
+                //Derivative with respect to azimuth.
+                series[k+2*numLon]+=complex<double>(mf*B[m],mf*A[m])*shift;
+                //Derivative with respect to elevation. The minus sign
+                //adjusts for the change from colatitude.
+                series[k+3*numLon]+=complex<double>(-ATheta[m],BTheta[m])*shift;
+            }
+
+            uPow*=u;
+            mf++;
+        }
+
+        for(size_t curSeries=0;curSeries<numSeries;curSeries++) {
+            plan.transform(series.data()+curSeries*numLon,true);
+        }
+
+        for(size_t curLon=0;curLon<numLon;curLon++) {
+            const size_t idx=curRow+numLat*curLon;
+
+            V[idx]=crScal*real(series[curLon]);
+
+            if(gradV!=NULL) {
+                const double dVdr=crScal*real(series[curLon+numLon])/rCur;
+                const double dVdLambda=crScal*real(series[curLon+2*numLon]);
+                const double dVdTheta=crScal*real(series[curLon+3*numLon]);
+
+                if(spherDerivs) {
+                    gradV[0+3*idx]=dVdr;
+                    gradV[1+3*idx]=dVdLambda;
+                    gradV[2+3*idx]=dVdTheta;
+                } else {
+                    double J[9];
+                    double pointCur[3];
+
+                    pointCur[0]=rCur;
+                    pointCur[1]=lon0+2.0*pi*static_cast<double>(curLon)/static_cast<double>(numLon);
+                    pointCur[2]=elCur;
+                    calcSpherConvJacobCPP(J,pointCur,0);
+
+                    //Multiply the transpose of the Jacobian Matrix by
+                    //the vector of [dVdr;dVdLambda;dVdTheta]
+                    gradV[0+3*idx]=dVdr*J[0]+dVdLambda*J[1]+dVdTheta*J[2];
+                    gradV[1+3*idx]=dVdr*J[3]+dVdLambda*J[4]+dVdTheta*J[5];
+                    gradV[2+3*idx]=dVdr*J[6]+dVdLambda*J[7]+dVdTheta*J[8];
+                }
+            }
+        }
+    }
+}
+
+void spherHarmonicGridEvalCPP(double *V, double *gradV, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double *elevation, const double *r, const size_t numLat, const size_t numLon, const double lon0, const double a, const double c, const bool spherDerivs, const double scalFactor, size_t numThreads) {
+    //If a NULL pointer is passed for gradV, then it is assumed that the
+    //gradient is not desired.
+    vector<thread> threads;
+    size_t curThread;
+
+    if(numLat==0||numLon==0) {
+        return;
+    }
+
+    if(numThreads==0) {
+        numThreads=max<size_t>(1,thread::hardware_concurrency());
+    }
+
+    if(numThreads>numLat) {
+        numThreads=numLat;
+    }
+
+    //The rows all cost the same, so they are split evenly. The last set of
+    //rows is evaluated in this thread.
+    threads.reserve(numThreads-1);
+    for(curThread=0;curThread+1<numThreads;curThread++) {
+        const size_t rowStart=(curThread*numLat)/numThreads;
+        const size_t rowEnd=((curThread+1)*numLat)/numThreads;
+
+        threads.push_back(thread(spherHarmonicGridEvalRowsCPP,V,gradV,cref(C),cref(S),elevation,r,numLat,rowStart,rowEnd,numLon,lon0,a,c,spherDerivs,scalFactor));
+    }
+
+    spherHarmonicGridEvalRowsCPP(V,gradV,C,S,elevation,r,numLat,(curThread*numLat)/numThreads,numLat,numLon,lon0,a,c,spherDerivs,scalFactor);
+
+    for(curThread=0;curThread<threads.size();curThread++) {
+        threads[curThread].join();
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
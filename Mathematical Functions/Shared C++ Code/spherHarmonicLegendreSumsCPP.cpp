@@ -0,0 +1,206 @@
+/*SPHERHARMONICLEGENDRESUMSCPP A C++ function to compute the sums over
+ *                  degree that are used in Legendre's method of spherical
+ *                  harmonic synthesis for multiple combinations of range
+ *                  and colatitude at once.
+ *
+ *For a point with range r and colatitude theta, Legendre's method as
+ *implemented in spherHarmonicEvalCPPReal computes
+ *A_m=sum_{n=m}^M (a/r)^n*C(n,m)*PBarU(n,m)
+ *B_m=sum_{n=m}^M (a/r)^n*S(n,m)*PBarU(n,m)
+ *for m=0 to M, where PBarU are the Legendre function ratios from
+ *NALegendreCosRatCPP, and, for the gradient and Hessian, similar sums
+ *weighted by (n+1), (n+1)*(n+2) and the derivatives of the ratios with
+ *respect to theta. These sums only depend on r and theta and take O(M^2)
+ *operations, whereas the remaining Horner evaluation in azimuth takes
+ *O(M) operations. This function computes the sums for numLanes
+ *combinations of r and theta (lanes) together. The Legendre ratios are
+ *computed one degree at a time for all lanes using the batched row
+ *functions in NALegendreCosRatCPP.cpp and are added into the sums as soon
+ *as they are computed, so only O(numLanes*M) memory is needed rather than
+ *storing all (M+1)*(M+2)/2 ratios per lane. The loops over the lanes are
+ *innermost, so they can be vectorized. The sums are accumulated in the
+ *same order as in spherHarmonicEvalCPPReal, so the results are the same.
+ *
+ *The inputs are the coefficients C and S, the numLanes colatitudes theta
+ *and ranges r, the reference radius a, derivOrder, which is 0 if only the
+ *sums for the potential are desired, 1 if the sums for the gradient are
+ *also desired and 2 if the sums for the Hessian are also desired, and the
+ *scale factor used for the Legendre ratios. legendreCoeffs is either NULL
+ *or the output of NALegendreCosRatCoeffsCPP for degree M or higher, in
+ *which case the recursion coefficients are not recomputed. The output sums holds
+ *numSums*(M+1) values for each lane, with the values for lane k starting
+ *at sums+k*numSums*(M+1), where numSums is 2, 6, or 12 depending on
+ *derivOrder. The sums for each lane are stored one after the other, each
+ *of length M+1, in the order A, B, Ar, Br, ATheta, BTheta, Arr, Brr,
+ *AThetar, BThetar, AThetaTheta, BThetaTheta, using the names from
+ *spherHarmonicEvalCPPReal.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mathFuncs.hpp"
+//For sin and cos.
+#include <cmath>
+#include <vector>
+
+using namespace std;
+
+void spherHarmonicLegendreSumsBatchCPP(double *sums, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double *theta, const double *r, const double a, const size_t numLanes, const size_t derivOrder, const double scalFactor, const double *legendreCoeffs) {
+    const size_t M=C.numClust-1;
+    const size_t M1=C.numClust;
+    const size_t L=numLanes;
+    const size_t numSums=(derivOrder==0)?2:((derivOrder==1)?6:12);
+    //The accumulated sums, interleaved by lane so that the innermost loops
+    //are over the lanes.
+    vector<double> acc(numSums*M1*L,0.0);
+    //The current rows of the Legendre ratios and their derivatives.
+    vector<double> rowBuffer(((derivOrder==0)?1:((derivOrder==1)?2:3))*M1*L);
+    //t, u, a/r and (a/r)^n for each lane.
+    vector<double> laneBuffer(4*L);
+    //The recursion coefficients for the current degree if legendreCoeffs
+    //is NULL.
+    vector<double> coeffBuffer((legendreCoeffs==NULL)?3*M1:0);
+    double *PBarURow=rowBuffer.data();
+    double *dPBarURow=(derivOrder>0)?PBarURow+M1*L:NULL;
+    double *d2PBarURow=(derivOrder>1)?dPBarURow+M1*L:NULL;
+    double *t=laneBuffer.data();
+    double *u=t+L;
+    double *aOverR=u+L;
+    double *nCoeff=aOverR+L;
+    double nf;
+    size_t n, m, k;
+
+    for(k=0;k<L;k++) {
+        u[k]=sin(theta[k]);
+        t[k]=cos(theta[k]);
+        aOverR[k]=a/r[k];
+        nCoeff[k]=1;
+    }
+
+    nf=0;
+    for(n=0;n<=M;n++) {
+        if(n>0) {
+            for(k=0;k<L;k++) {
+                nCoeff[k]=nCoeff[k]*aOverR[k];
+            }
+        }
+
+        const double *gRow, *hRow, *eRow;
+        if(legendreCoeffs!=NULL) {
+            gRow=legendreCoeffs+3*(n*(n+1)/2);
+            hRow=gRow+n+1;
+            eRow=hRow+n+1;
+        } else {
+            double *gRowCur=coeffBuffer.data();
+            double *hRowCur=gRowCur+M1;
+            double *eRowCur=hRowCur+M1;
+
+            NALegendreCosRatRowCoeffsCPP(gRowCur,hRowCur,(derivOrder>0)?eRowCur:NULL,n);
+            gRow=gRowCur;
+            hRow=hRowCur;
+            eRow=eRowCur;
+        }
+
+        //Update the row in place from degree n-1 to degree n.
+        NALegendreCosRatRowBatchCPP(PBarURow,(n>0)?PBarURow+L*(n-1):NULL,n,t,u,gRow,hRow,L,scalFactor);
+        if(derivOrder>0) {
+            NALegendreCosRatDerivRowBatchCPP(dPBarURow,PBarURow,n,t,u,eRow,L);
+
+            if(derivOrder>1) {
+                NALegendreCosRatDeriv2RowBatchCPP(d2PBarURow,dPBarURow,PBarURow,n,t,u,L);
+            }
+        }
+
+        for(m=0;m<=n;m++) {
+            const double CCur=C[n][m];
+            const double SCur=S[n][m];
+            const double *PCur=PBarURow+L*m;
+            double *A=acc.data()+L*m;
+            double *B=A+L*M1;
+
+            //Equation 7 from the Holmes and Featherstone paper.
+            for(k=0;k<L;k++) {
+                const double CScal=nCoeff[k]*CCur;
+                const double SScal=nCoeff[k]*SCur;
+
+                A[k]+=CScal*PCur[k];
+                B[k]+=SScal*PCur[k];
+            }
+
+            if(derivOrder>0) {
+                const double *dPCur=dPBarURow+L*m;
+                double *Ar=B+L*M1;
+                double *Br=Ar+L*M1;
+                double *ATheta=Br+L*M1;
+                double *BTheta=ATheta+L*M1;
+
+                for(k=0;k<L;k++) {
+                    const double CScal=nCoeff[k]*CCur;
+                    const double SScal=nCoeff[k]*SCur;
+
+                    Ar[k]+=(nf+1)*CScal*PCur[k];
+                    Br[k]+=(nf+1)*SScal*PCur[k];
+                    ATheta[k]+=CScal*dPCur[k];
+                    BTheta[k]+=SScal*dPCur[k];
+                }
+
+                if(derivOrder>1) {
+                    const double *d2PCur=d2PBarURow+L*m;
+                    double *Arr=BTheta+L*M1;
+                    double *Brr=Arr+L*M1;
+                    double *AThetar=Brr+L*M1;
+                    double *BThetar=AThetar+L*M1;
+                    double *AThetaTheta=BThetar+L*M1;
+                    double *BThetaTheta=AThetaTheta+L*M1;
+
+                    //From Table 5, with the correction from the erratum.
+                    for(k=0;k<L;k++) {
+                        const double CScal=nCoeff[k]*CCur;
+                        const double SScal=nCoeff[k]*SCur;
+
+                        Arr[k]+=(nf+1)*(nf+2)*CScal*PCur[k];
+                        Brr[k]+=(nf+1)*(nf+2)*SScal*PCur[k];
+                        AThetar[k]+=(nf+1)*CScal*dPCur[k];
+                        BThetar[k]+=(nf+1)*SScal*dPCur[k];
+                        AThetaTheta[k]+=CScal*d2PCur[k];
+                        BThetaTheta[k]+=SScal*d2PCur[k];
+                    }
+                }
+            }
+        }
+
+        nf++;
+    }
+
+    //Put the sums for each lane together.
+    for(k=0;k<L;k++) {
+        double *sumsCur=sums+k*numSums*M1;
+
+        for(size_t curSum=0;curSum<numSums;curSum++) {
+            const double *accCur=acc.data()+L*M1*curSum;
+
+            for(m=0;m<=M;m++) {
+                sumsCur[m+M1*curSum]=accCur[L*m+k];
+            }
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
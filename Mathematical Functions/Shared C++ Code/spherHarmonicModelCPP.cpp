@@ -0,0 +1,117 @@
+/*SPHERHARMONICMODELCPP A C++ class that holds a real spherical harmonic
+ *                  model along with the precomputed values and memory
+ *                  that can be reused across evaluations. See
+ *                  spherHarmonicModelCPP.hpp for more details.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "spherHarmonicModelCPP.hpp"
+//For memcpy
+#include <cstring>
+//For uintptr_t
+#include <stdint.h>
+
+using namespace std;
+
+//The alignment of the coefficients in bytes.
+static const size_t spherHarmonicModelAlign=64;
+
+spherHarmonicModelCPP::spherHarmonicModelCPP() : M(0), a(0), c(0), scalFactor(0) {}
+
+spherHarmonicModelCPP::spherHarmonicModelCPP(const double *CDes, const double *SDes, const size_t MDes, const double aDes, const double cDes, const double scalFactorDes) : M(MDes), a(aDes), c(cDes), scalFactor(scalFactorDes) {
+    const size_t alignEls=spherHarmonicModelAlign/sizeof(double);
+    const size_t totalNumEl=(M+1)*(M+2)/2;
+    //The length of each table rounded up so that the next table is also
+    //aligned.
+    const size_t paddedNumEl=((totalNumEl+alignEls-1)/alignEls)*alignEls;
+    double *alignedStart;
+    size_t offset;
+
+    //The extra alignEls elements make room to shift the start of the
+    //tables to an aligned address.
+    coeffBuffer.resize(2*paddedNumEl+3*totalNumEl+alignEls);
+    offset=reinterpret_cast<uintptr_t>(coeffBuffer.data())%spherHarmonicModelAlign;
+    alignedStart=coeffBuffer.data();
+    if(offset!=0) {
+        alignedStart+=(spherHarmonicModelAlign-offset)/sizeof(double);
+    }
+
+    C.numClust=M+1;
+    C.totalNumEl=totalNumEl;
+    C.clusterEls=alignedStart;
+    memcpy(C.clusterEls,CDes,sizeof(double)*totalNumEl);
+
+    S.numClust=M+1;
+    S.totalNumEl=totalNumEl;
+    S.clusterEls=alignedStart+paddedNumEl;
+    memcpy(S.clusterEls,SDes,sizeof(double)*totalNumEl);
+
+    initTables(alignedStart+2*paddedNumEl);
+}
+
+spherHarmonicModelCPP *spherHarmonicModelCPP::fromFile(const char *fileName, const size_t MMax, const double scalFactorDes) {
+    //The coefficients are truncated to degree MMax if the file has more.
+    spherHarmonicModelCPP *theModel=new spherHarmonicModelCPP();
+
+    if(!theModel->coeffFile.load(fileName,MMax)) {
+        delete theModel;
+        return NULL;
+    }
+
+    theModel->M=theModel->coeffFile.M;
+    theModel->a=theModel->coeffFile.a;
+    theModel->c=theModel->coeffFile.c;
+    theModel->scalFactor=scalFactorDes;
+
+    //The views refer to the mapped file, which is already aligned.
+    theModel->C.numClust=theModel->coeffFile.C.numClust;
+    theModel->C.totalNumEl=theModel->coeffFile.C.totalNumEl;
+    theModel->C.clusterEls=theModel->coeffFile.C.clusterEls;
+    theModel->S.numClust=theModel->coeffFile.S.numClust;
+    theModel->S.totalNumEl=theModel->coeffFile.S.totalNumEl;
+    theModel->S.clusterEls=theModel->coeffFile.S.clusterEls;
+
+    theModel->coeffBuffer.resize(3*theModel->C.totalNumEl);
+    theModel->initTables(theModel->coeffBuffer.data());
+
+    return theModel;
+}
+
+void spherHarmonicModelCPP::initTables(double *legendreCoeffs) {
+    //Compute the recursion coefficients into legendreCoeffs, which has
+    //space for 3*(M+1)*(M+2)/2 elements, and the norms of each degree.
+    NALegendreCosRatCoeffsCPP(legendreCoeffs,M);
+    work.legendreCoeffs=legendreCoeffs;
+
+    degreeNorms.resize(M+1);
+    spherHarmonicDegreeNormsCPP(degreeNorms.data(),C,S);
+    work.degreeNorms=degreeNorms.data();
+}
+
+void spherHarmonicModelCPP::evaluate(double *V, double *gradV, double *HessianV, size_t *degreeUsed, const double *point, const size_t numPoints, const size_t systemType, const bool spherDerivs, const size_t algorithm, const size_t numThreads, const double truncTol) {
+    //If a NULL pointer is passed for gradV, then it is assumed that the
+    //gradient is not desired. If a NULL pointer is passed for HessianV,
+    //then it is assumed that the Hessian is not desired. degreeUsed can
+    //also be NULL.
+    spherHarmonicEvalCPPRealTrunc(V,gradV,HessianV,degreeUsed,C,S,point,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads,truncTol,&work);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,99 @@
+/*SPHERHARMONICMODELCPP A C++ class that holds a real spherical harmonic
+ *                  model, such as a gravitational or magnetic field model,
+ *                  along with everything that can be precomputed or reused
+ *                  across calls to spherHarmonicEvalCPPReal.
+ *
+ *When the same model is evaluated many times, such as once per
+ *measurement in a tracking filter, a large part of the cost of calling
+ *spherHarmonicEval can be copying and validating the coefficients,
+ *recomputing the square roots in the recursion for the Legendre function
+ *ratios and allocating temporary memory. This class owns 64-byte aligned
+ *copies of the coefficients C and S, the recursion coefficients of
+ *NALegendreCosRatCoeffsCPP and the workspaces for each thread, which are
+ *kept between calls. Thus, the cost of a call to evaluate is just the cost
+ *of the evaluation.
+ *
+ *The constructor takes the coefficients C and S of degree M, each with
+ *(M+1)*(M+2)/2 elements ordered as in a CountingClusterSetCPP, as well as
+ *the a, c and scalFactor inputs of spherHarmonicEvalCPPReal. The inputs
+ *to evaluate are the same as the remaining inputs of
+ *spherHarmonicEvalCPPRealTrunc, which is used so that the degree can be
+ *truncated separately for each point when truncTol>0. The norms of the
+ *coefficients of each degree that are used to choose the degree are also
+ *precomputed.
+ *
+ *Alternatively, the static function fromFile creates a model from a file
+ *written by saveSpherHarmonicCoeffs, which is memory mapped with
+ *spherHarmonicCoeffFileCPP. In that case, C and S are views into the
+ *mapped file rather than copies, so the coefficients are not read or
+ *copied and the memory that they use is shared among all processes using
+ *the same file. fromFile returns NULL if the file can not be loaded. As the
+ *workspaces are modified, evaluate must not be called
+ *on the same object from multiple threads at once; the threading is
+ *handled within evaluate using numThreads.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef SPHERHARMONICMODELCPP
+#define SPHERHARMONICMODELCPP
+
+#include <stddef.h>
+#include <vector>
+#include "CountingClusterSetCPP.hpp"
+#include "mathFuncs.hpp"
+#include "spherHarmonicCoeffFileCPP.hpp"
+
+class spherHarmonicModelCPP {
+public:
+    size_t M;//The maximum degree of the model.
+    double a;//The reference radius.
+    double c;//The scale factor applied to the potential.
+    double scalFactor;//The scale factor used for the Legendre ratios.
+    //Views of the aligned coefficients. These do not own their memory.
+    CountingClusterSetCPP<double> C;
+    CountingClusterSetCPP<double> S;
+
+    spherHarmonicModelCPP(const double *CDes, const double *SDes, const size_t MDes, const double aDes, const double cDes, const double scalFactorDes);
+    static spherHarmonicModelCPP *fromFile(const char *fileName, const size_t MMax, const double scalFactorDes);
+    void evaluate(double *V, double *gradV, double *HessianV, size_t *degreeUsed, const double *point, const size_t numPoints, const size_t systemType, const bool spherDerivs, const size_t algorithm, const size_t numThreads, const double truncTol);
+
+private:
+    //Holds C, S (unless they are in coeffFile) and the recursion
+    //coefficients with room for alignment.
+    std::vector<double> coeffBuffer;
+    //The mapped coefficients when the model is loaded from a file.
+    spherHarmonicCoeffFileCPP coeffFile;
+    //The output of spherHarmonicDegreeNormsCPP for the coefficients.
+    std::vector<double> degreeNorms;
+    spherHarmonicWorkCPP work;
+
+    spherHarmonicModelCPP();
+    void initTables(double *legendreCoeffs);
+
+    //The views in C and S point into coeffBuffer, so copying is not
+    //allowed.
+    spherHarmonicModelCPP(const spherHarmonicModelCPP &);
+    spherHarmonicModelCPP &operator=(const spherHarmonicModelCPP &);
+};
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,218 @@
+/**SPHERHARMONICPOINTSCPP A header file with functions for dividing the
+ *                  points at which spherical harmonic series are evaluated
+ *                  among multiple threads. The evaluation routines cache
+ *                  the terms that depend only on the range and on the
+ *                  elevation of the point, so consecutive points sharing
+ *                  an elevation are cheaper to evaluate than points that
+ *                  do not. The points are thus split into contiguous
+ *                  chunks, one per thread, with the boundaries of the
+ *                  chunks moved to places where the elevation changes.
+ *                  Each chunk is evaluated by a separate call to a serial
+ *                  routine, so each thread has its own workspace and its
+ *                  own cache. When the points are not already grouped,
+ *                  they can also be evaluated in an order sorted by
+ *                  elevation and range, with the results put back in the
+ *                  original order afterwards.
+ *
+ *The point input to the functions here is a 3XnumPoints set of points in
+ *spherical coordinates, ordered [range;azimuth;elevation]. The functions
+ *must be compiled with C++11 or later support.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef SPHERHARMONICPOINTSCPP
+#define SPHERHARMONICPOINTSCPP
+
+#include <stddef.h>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <cmath>
+
+/**PARTITIONSPHERPOINTSCPP Split numPoints points into at most maxChunks
+ *          contiguous chunks of approximately equal size. The nominal
+ *          boundary of each chunk is moved forward to the first point
+ *          whose elevation differs from that of the point before it,
+ *          unless that would lengthen the chunk by more than a quarter of
+ *          the nominal chunk length, in which case the nominal boundary is
+ *          kept, because a single extra recursion at the start of a chunk
+ *          costs far less than the resulting load imbalance. The start
+ *          index of chunk i is placed in chunkStart[i] and
+ *          chunkStart[numChunks]=numPoints, so chunkStart must have space
+ *          for maxChunks+1 elements. The number of chunks, which is at
+ *          least 1, is returned.
+ **/
+inline size_t partitionSpherPointsCPP(size_t *chunkStart, const double *point, const size_t numPoints, const size_t maxChunks) {
+    const size_t maxShift=numPoints/(4*maxChunks);
+    size_t numChunks=0;
+
+    chunkStart[0]=0;
+    for(size_t curChunk=1;curChunk<maxChunks;curChunk++) {
+        size_t idx=(curChunk*numPoints)/maxChunks;
+
+        if(idx<=chunkStart[numChunks]) {
+            continue;
+        }
+
+        for(size_t curShift=0;curShift<=maxShift&&idx+curShift<numPoints;curShift++) {
+            const size_t curIdx=idx+curShift;
+            if(point[2+3*curIdx]!=point[2+3*(curIdx-1)]) {
+                idx=curIdx;
+                break;
+            }
+        }
+
+        numChunks++;
+        chunkStart[numChunks]=idx;
+    }
+    numChunks++;
+    chunkStart[numChunks]=numPoints;
+
+    return numChunks;
+}
+
+/**ORDERSPHERPOINTSCPP Determine whether evaluating the points sorted by
+ *          elevation and then by range would reduce the number of times
+ *          that the terms depending on the range and elevation have to be
+ *          recomputed. If so, true is returned and order is set to the
+ *          indices of the points in sorted order. Otherwise, false is
+ *          returned and order should not be used. Elevation is the
+ *          primary key, because the Legendre recursion only depends on it.
+ *          If any range or elevation is not finite, false is returned,
+ *          because the comparison used for sorting would not be a strict
+ *          weak ordering.
+ **/
+inline bool orderSpherPointsCPP(std::vector<size_t> &order, const double *point, const size_t numPoints) {
+    size_t numRuns, numDistinct;
+
+    if(numPoints<3) {
+        return false;
+    }
+
+    //NaNs compare as equal to everything, which would break std::sort.
+    for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+        if(!std::isfinite(point[3*curPoint])||!std::isfinite(point[2+3*curPoint])) {
+            return false;
+        }
+    }
+
+    //The number of runs of equal values in the original order.
+    numRuns=1;
+    for(size_t curPoint=1;curPoint<numPoints;curPoint++) {
+        if(point[2+3*curPoint]!=point[2+3*(curPoint-1)]||point[3*curPoint]!=point[3*(curPoint-1)]) {
+            numRuns++;
+        }
+    }
+
+    order.resize(numPoints);
+    for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+        order[curPoint]=curPoint;
+    }
+
+    std::sort(order.begin(),order.end(),[point](const size_t i1, const size_t i2) {
+        if(point[2+3*i1]!=point[2+3*i2]) {
+            return point[2+3*i1]<point[2+3*i2];
+        }
+        if(point[3*i1]!=point[3*i2]) {
+            return point[3*i1]<point[3*i2];
+        }
+        return i1<i2;
+    });
+
+    numDistinct=1;
+    for(size_t curPoint=1;curPoint<numPoints;curPoint++) {
+        const size_t i1=order[curPoint-1];
+        const size_t i2=order[curPoint];
+        if(point[2+3*i2]!=point[2+3*i1]||point[3*i2]!=point[3*i1]) {
+            numDistinct++;
+        }
+    }
+
+    return numDistinct<numRuns;
+}
+
+/**GATHERSPHERBLOCKSCPP Copy blocks of blockSize values from src into
+ *          dest such that block i of dest is block order[i] of src. This
+ *          is used to put the points into sorted order.
+ **/
+inline void gatherSpherBlocksCPP(double *dest, const double *src, const size_t *order, const size_t numBlocks, const size_t blockSize) {
+    for(size_t curBlock=0;curBlock<numBlocks;curBlock++) {
+        std::copy(src+blockSize*order[curBlock],src+blockSize*(order[curBlock]+1),dest+blockSize*curBlock);
+    }
+}
+
+/**SCATTERSPHERBLOCKSCPP Copy blocks of blockSize values from src into
+ *          dest such that block order[i] of dest is block i of src. This
+ *          is used to put the results back into the original order. If
+ *          dest is NULL, nothing is done.
+ **/
+inline void scatterSpherBlocksCPP(double *dest, const double *src, const size_t *order, const size_t numBlocks, const size_t blockSize) {
+    if(dest==NULL) {
+        return;
+    }
+
+    for(size_t curBlock=0;curBlock<numBlocks;curBlock++) {
+        std::copy(src+blockSize*curBlock,src+blockSize*(curBlock+1),dest+blockSize*order[curBlock]);
+    }
+}
+
+/**SPHERHARMONICEVALCHUNKSCPP Evaluate a set of points using numThreads
+ *          threads. evalChunk is a callable object such that
+ *          evalChunk(startIdx,numInChunk) evaluates the points
+ *          startIdx to startIdx+numInChunk-1. If numThreads=0, the number
+ *          of hardware threads is used. The final chunk is evaluated in
+ *          the calling thread.
+ **/
+template<class ChunkEval>
+void spherHarmonicEvalChunksCPP(ChunkEval &evalChunk, const double *point, const size_t numPoints, size_t numThreads) {
+    if(numThreads==0) {
+        numThreads=std::max<size_t>(1,std::thread::hardware_concurrency());
+    }
+
+    if(numThreads>numPoints) {
+        numThreads=numPoints;
+    }
+
+    if(numThreads<=1) {
+        evalChunk(0,numPoints);
+        return;
+    }
+
+    std::vector<size_t> chunkStart(numThreads+1);
+    const size_t numChunks=partitionSpherPointsCPP(chunkStart.data(),point,numPoints,numThreads);
+    std::vector<std::thread> threads;
+    threads.reserve(numChunks-1);
+
+    for(size_t curChunk=0;curChunk+1<numChunks;curChunk++) {
+        threads.push_back(std::thread(std::ref(evalChunk),chunkStart[curChunk],chunkStart[curChunk+1]-chunkStart[curChunk]));
+    }
+
+    evalChunk(chunkStart[numChunks-1],numPoints-chunkStart[numChunks-1]);
+
+    for(size_t curThread=0;curThread<threads.size();curThread++) {
+        threads[curThread].join();
+    }
+}
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,95 @@
+/*SPHERHARMONICSVEVALCPP A C++ implementation of a function to evaluate a
+ *                  real spherical harmonic series whose coefficients
+ *                  change linearly over time, as in magnetic field models
+ *                  with secular variation, at points that each have their
+ *                  own time.
+ *
+ *The coefficients at the time of point i are C+deltaT[i]*CDot and
+ *S+deltaT[i]*SDot. As the potential, gradient and Hessian are linear in
+ *the coefficients, they equal the values for C and S plus deltaT[i] times
+ *the values for CDot and SDot. Both are computed in a single pass with
+ *spherHarmonicSetEvalCPPReal using two coefficient sets, so the Legendre
+ *functions, powers of a/r and sines and cosines for each point are only
+ *computed once and shared between the base coefficients and the rates. No
+ *set of coefficients is formed for any particular time. The results are
+ *the same as calling spherHarmonicEvalCPPReal separately for each point
+ *with the coefficients at its time, to within finite precision errors.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mathFuncs.hpp"
+//For memcpy
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+void spherHarmonicSVEvalCPPReal(double *V, double *gradV, double *HessianV, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const CountingClusterSetCPP<double> &CDot, const CountingClusterSetCPP<double> &SDot, const double *deltaT, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs, const double scalFactor, const size_t algorithm, const size_t numThreads) {
+    //If a NULL pointer is passed for gradV, then it is assumed that the
+    //gradient is not desired. If a NULL pointer is passed for HessianV,
+    //then it is assumed that the Hessian is not desired. CDot and SDot
+    //must have the same number of elements as C and S.
+    const size_t totalNumEl=C.totalNumEl;
+    CountingClusterSetVecCPP<double> CSet, SSet;
+    vector<double> VSet(2*numPoints);
+    vector<double> gradVSet;
+    vector<double> HessianVSet;
+
+    //Set 0 holds the base coefficients and set 1 the rates.
+    CSet.initWithNumClust(C.numClust,2);
+    SSet.initWithNumClust(C.numClust,2);
+    memcpy(CSet.clusterEls,C.clusterEls,sizeof(double)*totalNumEl);
+    memcpy(CSet.clusterEls+totalNumEl,CDot.clusterEls,sizeof(double)*totalNumEl);
+    memcpy(SSet.clusterEls,S.clusterEls,sizeof(double)*totalNumEl);
+    memcpy(SSet.clusterEls+totalNumEl,SDot.clusterEls,sizeof(double)*totalNumEl);
+
+    if(gradV!=NULL) {
+        gradVSet.resize(2*3*numPoints);
+    }
+    if(HessianV!=NULL) {
+        HessianVSet.resize(2*9*numPoints);
+    }
+
+    spherHarmonicSetEvalCPPReal(VSet.data(),gradV!=NULL?gradVSet.data():NULL,HessianV!=NULL?HessianVSet.data():NULL,CSet,SSet,point,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+
+    //The values for the two sets of each point are stored consecutively.
+    for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+        const double dt=deltaT[curPoint];
+
+        V[curPoint]=VSet[2*curPoint]+dt*VSet[2*curPoint+1];
+
+        if(gradV!=NULL) {
+            const double *gradBase=gradVSet.data()+6*curPoint;
+            for(size_t k=0;k<3;k++) {
+                gradV[3*curPoint+k]=gradBase[k]+dt*gradBase[3+k];
+            }
+        }
+
+        if(HessianV!=NULL) {
+            const double *HessianBase=HessianVSet.data()+18*curPoint;
+            for(size_t k=0;k<9;k++) {
+                HessianV[9*curPoint+k]=HessianBase[k]+dt*HessianBase[9+k];
+            }
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -10,6 +10,11 @@
  *can be consulted for more information regarding the implementation and
  *the meaning of the results. 
  *
+ *The points can be split among multiple threads using the numThreads
+ *input. If the points are not grouped by elevation and range, they are
+ *evaluated sorted by those values and the results are put back in the
+ *original order. See spherHarmonicPointsCPP.hpp for details.
+ *
  *July 2017 David F. Crouse, Naval Research Laboratory, Washington D.C.
  **/
 /*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
@@ -24,12 +29,14 @@
 #include <cstring>
 //For the implementation in the complex domain.
 #include <complex>
+//For splitting the points among threads.
+#include "spherHarmonicPointsCPP.hpp"
 //For max
 #include <algorithm>
 
 using namespace std;
 
-void spherHarmonicSetEvalCPPReal(double *V, double *gradV, double *HessianV,const CountingClusterSetVecCPP<double> &C,const CountingClusterSetVecCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm) {
+static void spherHarmonicSetEvalCPPRealSerial(double *V, double *gradV, double *HessianV,const CountingClusterSetVecCPP<double> &C,const CountingClusterSetVecCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm) {
     //If a NULL pointer is passed for gradV, then it is assumed that the
     //gradient is not desired. If a NULL pointer is passed for HessianV,
     //then it is assumed that the Hessian is not desired.
@@ -379,7 +386,7 @@ void spherHarmonicSetEvalCPPReal(double *V, double *gradV, double *HessianV,cons
             tempPtrPines+=numSets;
             B2=tempPtrPines;//Length numSets
 
-            tempPtr+=numSets;
+            tempPtrPines+=numSets;
             B3=tempPtrPines;//Length numSets
             
             if(HessianV!=NULL) {
@@ -1293,7 +1300,7 @@ void spherHarmonicSetEvalCPPReal(double *V, double *gradV, double *HessianV,cons
     delete[] buffer;
 }
 
-void spherHarmonicSetEvalCPPComplex(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetVecCPP<double> &CReal,const CountingClusterSetVecCPP<double> &CImag,const CountingClusterSetVecCPP<double> &SReal,const CountingClusterSetVecCPP<double> &SImag, const double *point, const size_t numPoints, const complex <double> a, const complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm) {
+static void spherHarmonicSetEvalCPPComplexSerial(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetVecCPP<double> &CReal,const CountingClusterSetVecCPP<double> &CImag,const CountingClusterSetVecCPP<double> &SReal,const CountingClusterSetVecCPP<double> &SImag, const double *point, const size_t numPoints, const complex <double> a, const complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm) {
 //If a NULL pointer is passed for gradV, then it is assumed that the
     //gradient is not desired. If a NULL pointer is passed for HessianV,
     //then it is assumed that the Hessian is not desired.
@@ -1524,7 +1531,7 @@ void spherHarmonicSetEvalCPPComplex(double *VReal, double *VImag, double *gradVR
         tempPtr+=M1;
         CosVec=tempPtr;//Length M1
 
-        tempPtr+=M1NumSets;
+        tempPtr+=M1;
         FuncVals.clusterEls=tempPtr;//Length C.totalNumEl
         
         tempPtrComplex+=M1;
@@ -1656,7 +1663,7 @@ void spherHarmonicSetEvalCPPComplex(double *VReal, double *VImag, double *gradVR
             tempPtrPines+=numSets;
             B2=tempPtrPines;//Length numSets (complex)
 
-            tempPtr+=numSets;
+            tempPtrPines+=numSets;
             B3=tempPtrPines;//Length numSets (complex)
             
             if(HessianVReal!=NULL) {
@@ -2514,26 +2521,26 @@ void spherHarmonicSetEvalCPPComplex(double *VReal, double *VImag, double *gradVR
                         
                         calcSpherInvHessianCPP(H,pointCur,0);
 
-                        const double d2xdrdr=H[0];//H(1,1,1);
-                        const double d2xdAzdAz=H[4];//H(2,2,1);
-                        const double d2xdEldEl=H[8];//H(3,3,1);
-                        const double d2xdrdAz=H[3];//H(1,2,1);
-                        const double d2xdrdEl=H[6];//H(1,3,1);
-                        const double d2xdAzdEl=H[7];//H(2,3,1);
-
-                        const double d2ydrdr=H[9];//H(1,1,2);
-                        const double d2ydAzdAz=H[13];//H(2,2,2);
-                        const double d2ydEldEl=H[17];//H(3,3,2);
-                        const double d2ydrdAz=H[12];//H(1,2,2);
-                        const double d2ydrdEl=H[15];//H(1,3,2);
-                        const double d2ydAzdEl=H[16];//H(2,3,2);
-
-                        const double d2zdrdr=H[18];//H(1,1,3);
-                        const double d2zdAzdAz=H[22];//H(2,2,3);
-                        const double d2zdEldEl=H[26];//H(3,3,3);
-                        const double d2zdrdAz=H[21];//H(1,2,3);
-                        const double d2zdrdEl=H[24];//H(1,3,3);
-                        const double d2zdAzdEl=H[25];//H(2,3,3);
+                        d2xdrdr=H[0];//H(1,1,1);
+                        d2xdAzdAz=H[4];//H(2,2,1);
+                        d2xdEldEl=H[8];//H(3,3,1);
+                        d2xdrdAz=H[3];//H(1,2,1);
+                        d2xdrdEl=H[6];//H(1,3,1);
+                        d2xdAzdEl=H[7];//H(2,3,1);
+
+                        d2ydrdr=H[9];//H(1,1,2);
+                        d2ydAzdAz=H[13];//H(2,2,2);
+                        d2ydEldEl=H[17];//H(3,3,2);
+                        d2ydrdAz=H[12];//H(1,2,2);
+                        d2ydrdEl=H[15];//H(1,3,2);
+                        d2ydAzdEl=H[16];//H(2,3,2);
+
+                        d2zdrdr=H[18];//H(1,1,3);
+                        d2zdAzdAz=H[22];//H(2,2,3);
+                        d2zdEldEl=H[26];//H(3,3,3);
+                        d2zdrdAz=H[21];//H(1,2,3);
+                        d2zdrdEl=H[24];//H(1,3,3);
+                        d2zdAzdEl=H[25];//H(2,3,3);
                     }
 
                     for(curSet=0;curSet<numSets;curSet++) {               
@@ -2734,6 +2741,124 @@ void spherHarmonicSetEvalCPPComplex(double *VReal, double *VImag, double *gradVR
     delete[] bufferComplex;
 }
 
+static void spherHarmonicSetEvalCPPRealThreaded(double *V, double *gradV, double *HessianV,const CountingClusterSetVecCPP<double> &C,const CountingClusterSetVecCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm, size_t numThreads) {
+    auto evalChunk=[&](const size_t startIdx, const size_t numInChunk) {
+        const size_t numSets=C.numSets;
+        double *VCur=V+startIdx*numSets;
+        double *gradVCur=gradV!=NULL?gradV+3*startIdx*numSets:NULL;
+        double *HessianVCur=HessianV!=NULL?HessianV+9*startIdx*numSets:NULL;
+        spherHarmonicSetEvalCPPRealSerial(VCur,gradVCur,HessianVCur,C,S,point+3*startIdx,numInChunk,a,c,systemType,spherDerivs,scalFactor,algorithm);
+    };
+
+    spherHarmonicEvalChunksCPP(evalChunk,point,numPoints,numThreads);
+}
+
+static void spherHarmonicSetEvalCPPComplexThreaded(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetVecCPP<double> &CReal,const CountingClusterSetVecCPP<double> &CImag,const CountingClusterSetVecCPP<double> &SReal,const CountingClusterSetVecCPP<double> &SImag, const double *point, const size_t numPoints, const complex <double> a, const complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm, size_t numThreads) {
+    auto evalChunk=[&](const size_t startIdx, const size_t numInChunk) {
+        const size_t numSets=CReal.numSets;
+        double *VRealCur=VReal+startIdx*numSets;
+        double *VImagCur=VImag+startIdx*numSets;
+        double *gradVRealCur=gradVReal!=NULL?gradVReal+3*startIdx*numSets:NULL;
+        double *gradVImagCur=gradVImag!=NULL?gradVImag+3*startIdx*numSets:NULL;
+        double *HessianVRealCur=HessianVReal!=NULL?HessianVReal+9*startIdx*numSets:NULL;
+        double *HessianVImagCur=HessianVImag!=NULL?HessianVImag+9*startIdx*numSets:NULL;
+        spherHarmonicSetEvalCPPComplexSerial(VRealCur,VImagCur,gradVRealCur,gradVImagCur,HessianVRealCur,HessianVImagCur,CReal,CImag,SReal,SImag,point+3*startIdx,numInChunk,a,c,systemType,spherDerivs,scalFactor,algorithm);
+    };
+
+    spherHarmonicEvalChunksCPP(evalChunk,point,numPoints,numThreads);
+}
+
+void spherHarmonicSetEvalCPPReal(double *V, double *gradV, double *HessianV,const CountingClusterSetVecCPP<double> &C,const CountingClusterSetVecCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm, size_t numThreads) {
+    vector<size_t> order;
+
+    if(orderSpherPointsCPP(order,point,numPoints)) {
+        //Evaluate the points sorted by elevation and range so that the
+        //terms that only depend on those are computed once for each
+        //distinct value, and then put the results back in the original
+        //order.
+        const size_t numSets=C.numSets;
+        const size_t numPerPoint=(1+(gradV!=NULL?3:0)+(HessianV!=NULL?9:0))*numSets;
+        vector<double> sortBuffer((3+numPerPoint)*numPoints);
+        double *tempPtr=sortBuffer.data();
+        double *pointSorted=tempPtr;
+        tempPtr+=3*numPoints;
+        double *VSorted=tempPtr;
+        tempPtr+=numSets*numPoints;
+        double *gradVSorted=NULL;
+        if(gradV!=NULL) {
+            gradVSorted=tempPtr;
+            tempPtr+=3*numSets*numPoints;
+        }
+        double *HessianVSorted=NULL;
+        if(HessianV!=NULL) {
+            HessianVSorted=tempPtr;
+            tempPtr+=9*numSets*numPoints;
+        }
+
+        gatherSpherBlocksCPP(pointSorted,point,order.data(),numPoints,3);
+        spherHarmonicSetEvalCPPRealThreaded(VSorted,gradVSorted,HessianVSorted,C,S,pointSorted,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+
+        scatterSpherBlocksCPP(V,VSorted,order.data(),numPoints,numSets);
+        scatterSpherBlocksCPP(gradV,gradVSorted,order.data(),numPoints,3*numSets);
+        scatterSpherBlocksCPP(HessianV,HessianVSorted,order.data(),numPoints,9*numSets);
+    } else {
+        spherHarmonicSetEvalCPPRealThreaded(V,gradV,HessianV,C,S,point,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+    }
+}
+
+void spherHarmonicSetEvalCPPComplex(double *VReal, double *VImag, double *gradVReal, double *gradVImag, double *HessianVReal, double *HessianVImag,const CountingClusterSetVecCPP<double> &CReal,const CountingClusterSetVecCPP<double> &CImag,const CountingClusterSetVecCPP<double> &SReal,const CountingClusterSetVecCPP<double> &SImag, const double *point, const size_t numPoints, const complex <double> a, const complex <double> c, const size_t systemType, const bool spherDerivs,const double scalFactor,const size_t algorithm, size_t numThreads) {
+    vector<size_t> order;
+
+    if(orderSpherPointsCPP(order,point,numPoints)) {
+        //Evaluate the points sorted by elevation and range so that the
+        //terms that only depend on those are computed once for each
+        //distinct value, and then put the results back in the original
+        //order.
+        const size_t numSets=CReal.numSets;
+        const size_t numPerPoint=(2+(gradVReal!=NULL?3:0)+(gradVImag!=NULL?3:0)+(HessianVReal!=NULL?9:0)+(HessianVImag!=NULL?9:0))*numSets;
+        vector<double> sortBuffer((3+numPerPoint)*numPoints);
+        double *tempPtr=sortBuffer.data();
+        double *pointSorted=tempPtr;
+        tempPtr+=3*numPoints;
+        double *VRealSorted=tempPtr;
+        tempPtr+=numSets*numPoints;
+        double *VImagSorted=tempPtr;
+        tempPtr+=numSets*numPoints;
+        double *gradVRealSorted=NULL;
+        if(gradVReal!=NULL) {
+            gradVRealSorted=tempPtr;
+            tempPtr+=3*numSets*numPoints;
+        }
+        double *gradVImagSorted=NULL;
+        if(gradVImag!=NULL) {
+            gradVImagSorted=tempPtr;
+            tempPtr+=3*numSets*numPoints;
+        }
+        double *HessianVRealSorted=NULL;
+        if(HessianVReal!=NULL) {
+            HessianVRealSorted=tempPtr;
+            tempPtr+=9*numSets*numPoints;
+        }
+        double *HessianVImagSorted=NULL;
+        if(HessianVImag!=NULL) {
+            HessianVImagSorted=tempPtr;
+            tempPtr+=9*numSets*numPoints;
+        }
+
+        gatherSpherBlocksCPP(pointSorted,point,order.data(),numPoints,3);
+        spherHarmonicSetEvalCPPComplexThreaded(VRealSorted,VImagSorted,gradVRealSorted,gradVImagSorted,HessianVRealSorted,HessianVImagSorted,CReal,CImag,SReal,SImag,pointSorted,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+
+        scatterSpherBlocksCPP(VReal,VRealSorted,order.data(),numPoints,numSets);
+        scatterSpherBlocksCPP(VImag,VImagSorted,order.data(),numPoints,numSets);
+        scatterSpherBlocksCPP(gradVReal,gradVRealSorted,order.data(),numPoints,3*numSets);
+        scatterSpherBlocksCPP(gradVImag,gradVImagSorted,order.data(),numPoints,3*numSets);
+        scatterSpherBlocksCPP(HessianVReal,HessianVRealSorted,order.data(),numPoints,9*numSets);
+        scatterSpherBlocksCPP(HessianVImag,HessianVImagSorted,order.data(),numPoints,9*numSets);
+    } else {
+        spherHarmonicSetEvalCPPComplexThreaded(VReal,VImag,gradVReal,gradVImag,HessianVReal,HessianVImag,CReal,CImag,SReal,SImag,point,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+    }
+}
+
 /*LICENSE:
 %
 %The source code is in the public domain and not licensed or under
@@ -0,0 +1,236 @@
+/*SPHERHARMONICTRUNCCPP C++ functions for evaluating a real spherical
+ *                  harmonic series with the maximum degree chosen
+ *                  separately for each point so that the omitted terms
+ *                  are below a given absolute tolerance.
+ *
+ *The coefficients decay with degree and, at a range r>a, the terms of
+ *degree n are further attenuated by (a/r)^n, so at satellite altitudes the
+ *high-degree terms of a model such as EGM2008 are far below the accuracy
+ *that is needed. For fully normalized coefficients, the addition theorem
+ *gives sum_m PBar(n,m)^2=2*n+1 and sum_m |gradS(PBar(n,m)*cos/sin)|^2=
+ *n*(n+1)*(2*n+1), where gradS is the gradient on the unit sphere. Applying
+ *the Cauchy-Schwarz inequality to the terms of degree n, the magnitude of
+ *the contribution of degree n to the potential is bounded by
+ *(|c|/r)*(a/r)^n*sigma(n)
+ *and the magnitude of its contribution to the gradient is bounded by
+ *(|c|/r^2)*(a/r)^n*sigma(n)*sqrt((n+1)*(2*n+1))
+ *where sigma(n)=sqrt((2*n+1)*sum_m(C(n,m)^2+S(n,m)^2)) is computed from
+ *the degree variances by spherHarmonicDegreeNormsCPP. These bounds hold at
+ *any point with range r, regardless of the azimuth and elevation.
+ *
+ *spherHarmonicTruncDegreeCPP returns the smallest degree N such that the
+ *sum of the bounds for degrees N+1 to M is at most truncTol for the
+ *potential and, if gradDesired is true, also for the gradient. Thus, the
+ *difference between the truncated and the full degree M series is at most
+ *truncTol. The degree is never less than 3 (or M, if M<3). If r<=a, the
+ *bounds generally do not decrease with the degree, so little truncation
+ *is possible.
+ *
+ *spherHarmonicEvalCPPRealTrunc takes the same inputs as
+ *spherHarmonicEvalCPPReal plus the tolerance truncTol and an optional
+ *output degreeUsed, which receives the degree used for each point if it
+ *is not NULL. If truncTol<=0, all points are evaluated to degree M. The
+ *points are grouped by degree and each group is evaluated by
+ *spherHarmonicEvalCPPReal using the first (N+1)*(N+2)/2 coefficients,
+ *which is the model truncated to degree N. The Hessian, if desired, is
+ *evaluated to the degree chosen for the gradient, but its error is not
+ *bounded by truncTol. If work is not NULL and work->degreeNorms is not
+ *NULL, the values of spherHarmonicDegreeNormsCPP are not recomputed.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mathFuncs.hpp"
+//For sqrt, pow and fabs
+#include <cmath>
+#include <vector>
+//For the gather and scatter functions.
+#include "spherHarmonicPointsCPP.hpp"
+
+using namespace std;
+
+void spherHarmonicDegreeNormsCPP(double *degreeNorms, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S) {
+    const size_t M=C.numClust-1;
+
+    for(size_t n=0;n<=M;n++) {
+        double sumVal=0;
+
+        for(size_t m=0;m<=n;m++) {
+            sumVal+=C[n][m]*C[n][m]+S[n][m]*S[n][m];
+        }
+
+        degreeNorms[n]=sqrt((2.0*static_cast<double>(n)+1.0)*sumVal);
+    }
+}
+
+size_t spherHarmonicTruncDegreeCPP(const double *degreeNorms, const size_t M, const double r, const double a, const double c, const bool gradDesired, const double truncTol) {
+    const size_t minDegree=(M<3)?M:3;
+    const double aOverR=a/r;
+    const double VScal=fabs(c)/r;
+    const double gradScal=VScal/r;
+    double VTail=0;
+    double gradTail=0;
+
+    //Add the bounds on the omitted terms from the highest degree down
+    //until the tolerance would be exceeded.
+    for(size_t n=M;n>minDegree;n--) {
+        const double nf=static_cast<double>(n);
+        const double term=pow(aOverR,nf)*degreeNorms[n];
+
+        VTail+=VScal*term;
+        if(gradDesired) {
+            gradTail+=gradScal*term*sqrt((nf+1)*(2*nf+1));
+        }
+
+        //The negated comparison also catches NaNs.
+        if(!(VTail<=truncTol&&gradTail<=truncTol)) {
+            return n;
+        }
+    }
+
+    return minDegree;
+}
+
+void spherHarmonicEvalCPPRealTrunc(double *V, double *gradV, double *HessianV, size_t *degreeUsed, const CountingClusterSetCPP<double> &C, const CountingClusterSetCPP<double> &S, const double *point, const size_t numPoints, const double a, const double c, const size_t systemType, const bool spherDerivs, const double scalFactor, const size_t algorithm, size_t numThreads, const double truncTol, spherHarmonicWorkCPP *work) {
+    const size_t M=C.numClust-1;
+    const bool gradDesired=(gradV!=NULL||HessianV!=NULL);
+    vector<size_t> degreeLocal;
+    vector<double> normsLocal;
+    const double *degreeNorms;
+    size_t *degrees;
+    size_t minDegree, maxDegree;
+
+    if(numPoints==0) {
+        return;
+    }
+
+    if(!(truncTol>0)) {
+        if(degreeUsed!=NULL) {
+            for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+                degreeUsed[curPoint]=M;
+            }
+        }
+
+        spherHarmonicEvalCPPReal(V,gradV,HessianV,C,S,point,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads,work);
+        return;
+    }
+
+    if(work!=NULL&&work->degreeNorms!=NULL) {
+        degreeNorms=work->degreeNorms;
+    } else {
+        normsLocal.resize(M+1);
+        spherHarmonicDegreeNormsCPP(normsLocal.data(),C,S);
+        degreeNorms=normsLocal.data();
+    }
+
+    if(degreeUsed!=NULL) {
+        degrees=degreeUsed;
+    } else {
+        degreeLocal.resize(numPoints);
+        degrees=degreeLocal.data();
+    }
+
+    //Consecutive points usually share a range, so the degree is only
+    //recomputed when the range changes.
+    minDegree=M;
+    maxDegree=0;
+    for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+        if(curPoint>0&&point[3*curPoint]==point[3*(curPoint-1)]) {
+            degrees[curPoint]=degrees[curPoint-1];
+        } else {
+            degrees[curPoint]=spherHarmonicTruncDegreeCPP(degreeNorms,M,point[3*curPoint],a,c,gradDesired,truncTol);
+        }
+
+        minDegree=min(minDegree,degrees[curPoint]);
+        maxDegree=max(maxDegree,degrees[curPoint]);
+    }
+
+    if(minDegree==maxDegree) {
+        //All points use the same degree, so no reordering is needed.
+        CountingClusterSetCPP<double> CTrunc;
+        CountingClusterSetCPP<double> STrunc;
+
+        CTrunc.numClust=minDegree+1;
+        CTrunc.totalNumEl=(minDegree+1)*(minDegree+2)/2;
+        CTrunc.clusterEls=C.clusterEls;
+        STrunc.numClust=CTrunc.numClust;
+        STrunc.totalNumEl=CTrunc.totalNumEl;
+        STrunc.clusterEls=S.clusterEls;
+
+        spherHarmonicEvalCPPReal(V,gradV,HessianV,CTrunc,STrunc,point,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads,work);
+        return;
+    }
+
+    //Group the points by degree, keeping the original order within each
+    //degree, and evaluate each group separately.
+    {
+        const size_t numPerPoint=1+(gradV!=NULL?3:0)+(HessianV!=NULL?9:0);
+        vector<size_t> order(numPoints);
+        vector<size_t> degreeStart(maxDegree-minDegree+2,0);
+        vector<double> buffer((3+numPerPoint)*numPoints);
+        double *pointSorted=buffer.data();
+        double *VSorted=pointSorted+3*numPoints;
+        double *gradVSorted=(gradV!=NULL)?VSorted+numPoints:NULL;
+        double *HessianVSorted=(HessianV!=NULL)?VSorted+(gradV!=NULL?4:1)*numPoints:NULL;
+
+        //A counting sort by degree.
+        for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+            degreeStart[degrees[curPoint]-minDegree+1]++;
+        }
+        for(size_t curDegree=1;curDegree<degreeStart.size();curDegree++) {
+            degreeStart[curDegree]+=degreeStart[curDegree-1];
+        }
+        {
+            vector<size_t> nextIdx(degreeStart.begin(),degreeStart.end()-1);
+
+            for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+                order[nextIdx[degrees[curPoint]-minDegree]++]=curPoint;
+            }
+        }
+
+        gatherSpherBlocksCPP(pointSorted,point,order.data(),numPoints,3);
+
+        for(size_t N=minDegree;N<=maxDegree;N++) {
+            const size_t startIdx=degreeStart[N-minDegree];
+            const size_t numInDegree=degreeStart[N-minDegree+1]-startIdx;
+            CountingClusterSetCPP<double> CTrunc;
+            CountingClusterSetCPP<double> STrunc;
+
+            if(numInDegree==0) {
+                continue;
+            }
+
+            CTrunc.numClust=N+1;
+            CTrunc.totalNumEl=(N+1)*(N+2)/2;
+            CTrunc.clusterEls=C.clusterEls;
+            STrunc.numClust=CTrunc.numClust;
+            STrunc.totalNumEl=CTrunc.totalNumEl;
+            STrunc.clusterEls=S.clusterEls;
+
+            spherHarmonicEvalCPPReal(VSorted+startIdx,(gradV!=NULL)?gradVSorted+3*startIdx:NULL,(HessianV!=NULL)?HessianVSorted+9*startIdx:NULL,CTrunc,STrunc,pointSorted+3*startIdx,numInDegree,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads,work);
+        }
+
+        scatterSpherBlocksCPP(V,VSorted,order.data(),numPoints,1);
+        scatterSpherBlocksCPP(gradV,gradVSorted,order.data(),numPoints,3);
+        scatterSpherBlocksCPP(HessianV,HessianVSorted,order.data(),numPoints,9);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
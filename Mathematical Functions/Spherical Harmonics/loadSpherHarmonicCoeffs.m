@@ -0,0 +1,108 @@
+function [C,S,a,c,CStdDev,SStdDev]=loadSpherHarmonicCoeffs(fileName,M)
+%%LOADSPHERHARMONICCOEFFS Load real spherical harmonic coefficients from a
+%               file written by saveSpherHarmonicCoeffs. Only the
+%               coefficients up to the requested degree are read.
+%
+%INPUTS: fileName The name of the file.
+%               M The maximum degree of the coefficients to return. If this
+%                 is omitted, an empty matrix is passed or M is larger than
+%                 the maximum degree in the file, all of the coefficients
+%                 are returned.
+%
+%OUTPUTS: C, S The length (M+2)*(M+1)/2 arrays of coefficients that are
+%              multiplied by cosines and sines in the harmonic expansion.
+%              These can be given to a CountingClusterSet class so that
+%              C(n+1,m+1) is the coefficient of degree n and order m.
+%         a, c The numerator in the (a/r)^n term and the constant by which
+%              the spherical harmonic series is multiplied.
+% CStdDev, SStdDev The standard deviations of the coefficients. An error
+%              is raised if these are requested and the file does not have
+%              them.
+%
+%The file format is described in the comments to saveSpherHarmonicCoeffs.
+%To evaluate the coefficients many times, one can instead pass the file
+%name to the spherHarmonicModel class, which memory maps the file when the
+%C++ implementation is available.
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+fileID=fopen(fileName,'r');
+if(fileID==-1)
+    error(['The file ',fileName,' could not be opened.'])
+end
+
+magic=fread(fileID,[1,8],'char*1=>char');
+byteOrder=fread(fileID,[1,8],'uint8=>uint8');
+[~,~,endian]=computer();
+if(endian=='L')
+    byteOrderExpected=uint8(8:-1:1);
+else
+    byteOrderExpected=uint8(1:8);
+end
+
+if(~strcmp(magic,'TCLSHC01')||~isequal(byteOrder,byteOrderExpected))
+    fclose(fileID);
+    error('The file is not a valid coefficient file for this computer.')
+end
+
+vals=fread(fileID,3,'uint64');
+MFile=vals(1);
+numArrays=vals(2);
+arrayStride=vals(3);
+vals=fread(fileID,2,'double');
+a=vals(1);
+c=vals(2);
+
+if(nargin<2||isempty(M)||M>MFile)
+    M=MFile;
+end
+
+if(nargout>4&&numArrays<4)
+    fclose(fileID);
+    error('The file does not contain standard deviations of the coefficients.')
+end
+
+%The first (M+1)*(M+2)/2 elements of each array are the coefficients up
+%to degree M.
+totalNumCoeffs=(M+1)*(M+2)/2;
+numArrays2Read=2;
+if(nargout>4)
+    numArrays2Read=4;
+end
+arrays=cell(numArrays2Read,1);
+for curArray=1:numArrays2Read
+    fseek(fileID,64+8*(curArray-1)*arrayStride,'bof');
+    arrays{curArray}=fread(fileID,totalNumCoeffs,'double');
+    if(length(arrays{curArray})~=totalNumCoeffs)
+        fclose(fileID);
+        error('The file is truncated.')
+    end
+end
+fclose(fileID);
+
+C=arrays{1};
+S=arrays{2};
+if(nargout>4)
+    CStdDev=arrays{3};
+    SStdDev=arrays{4};
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -0,0 +1,133 @@
+function saveSpherHarmonicCoeffs(fileName,C,S,a,c,CStdDev,SStdDev)
+%%SAVESPHERHARMONICCOEFFS Save a set of real spherical harmonic
+%               coefficients to a compact binary file that can be memory
+%               mapped by the C++ implementation of the spherHarmonicModel
+%               class or read quickly with loadSpherHarmonicCoeffs. This
+%               is useful for large models, such as EGM2008, which take a
+%               long time to read from text or .mat files.
+%
+%INPUTS: fileName The name of the file to write, for example
+%             'EGM2008.shcb'. An existing file is overwritten.
+%        C, S Length (M+2)*(M+1)/2 real arrays holding the fully
+%             normalized coefficients that are multiplied by cosines and
+%             sines in the harmonic expansion, as in spherHarmonicEval. If
+%             CountingClusterSet objects are passed, their clusterEls are
+%             used.
+%        a, c The numerator in the (a/r)^n term and the constant by which
+%             the spherical harmonic series is multiplied. These are saved
+%             so that the model is fully described by the file. For
+%             terrain models, use a=1 and c=1. If omitted or empty
+%             matrices are passed, Constants.EGM2008SemiMajorAxis and
+%             Constants.EGM2008GM are used.
+% CStdDev, SStdDev Optional standard deviations of the coefficients, as
+%             are returned by getEGMGravCoeffs. If omitted or empty
+%             matrices are passed, no standard deviations are saved.
+%
+%OUTPUTS: None
+%
+%The file is a 64-byte header followed by the arrays C, S and, if given,
+%CStdDev and SStdDev, each padded with zeros to a multiple of 8 doubles so
+%that each starts on a 64-byte boundary. The coefficients of degree n and
+%order m are at index n*(n+1)/2+m (starting from 0) of each array, which
+%is the layout used by CountingClusterSet, so a mapped array can be used
+%directly as the coefficients. The header holds the characters
+%'TCLSHC01', the number 0x0102030405060708 to mark the byte order, M, the
+%number of arrays and the number of doubles per padded array as 64-bit
+%unsigned integers, a and c as doubles, and a reserved zero. The values
+%are written in the byte order of the computer and a file written on a
+%computer with a different byte order is rejected when loaded. The format
+%is described in spherHarmonicCoeffFileCPP.hpp.
+%
+%EXAMPLE:
+%The EGM2008 coefficients are converted once, after which every process
+%can use them without parsing them.
+% [C,S,a,c]=getEGMGravCoeffs();
+% saveSpherHarmonicCoeffs('EGM2008.shcb',C,S,a,c);
+% model=spherHarmonicModel('EGM2008.shcb');
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+if(nargin<4||isempty(a))
+    a=Constants.EGM2008SemiMajorAxis;
+end
+
+if(nargin<5||isempty(c))
+    c=Constants.EGM2008GM;
+end
+
+if(isa(C,'CountingClusterSet'))
+    C=C.clusterEls;
+end
+
+if(isa(S,'CountingClusterSet'))
+    S=S.clusterEls;
+end
+
+arrays={C,S};
+if(nargin>5&&~isempty(CStdDev))
+    arrays={C,S,CStdDev,SStdDev};
+end
+numArrays=length(arrays);
+
+totalNumCoeffs=length(C);
+M=(-3+sqrt(1+8*totalNumCoeffs))/2;
+if(M~=fix(M))
+    error('C contains an invalid number of elements.')
+end
+
+for curArray=1:numArrays
+    if(numel(arrays{curArray})~=totalNumCoeffs||~isreal(arrays{curArray}))
+        error('All of the coefficient arrays must be real and have the same number of elements.')
+    end
+end
+
+%Each array is padded to a multiple of 8 doubles (64 bytes).
+arrayStride=8*ceil(totalNumCoeffs/8);
+
+%The byte order marker is written byte by byte so that its value does not
+%pass through a double.
+[~,~,endian]=computer();
+if(endian=='L')
+    byteOrder=uint8(8:-1:1);
+else
+    byteOrder=uint8(1:8);
+end
+
+fileID=fopen(fileName,'w');
+if(fileID==-1)
+    error(['The file ',fileName,' could not be opened for writing.'])
+end
+
+fwrite(fileID,'TCLSHC01','char*1');
+fwrite(fileID,byteOrder,'uint8');
+fwrite(fileID,[M;numArrays;arrayStride],'uint64');
+fwrite(fileID,[a;c],'double');
+fwrite(fileID,0,'uint64');
+for curArray=1:numArrays
+    fwrite(fileID,arrays{curArray}(:),'double');
+    fwrite(fileID,zeros(arrayStride-totalNumCoeffs,1),'double');
+end
+
+if(fclose(fileID)~=0)
+    error(['The file ',fileName,' could not be written.'])
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
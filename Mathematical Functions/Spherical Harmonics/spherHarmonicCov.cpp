@@ -6,12 +6,14 @@
  *CompileCLibraries function.
  *
  *The function is called in Matlab using the format:
- *[sigma2,Sigma,didOverflow]=spherHarmonicCov(CStdDev,SStdDev,point,a,c,scalFactor);
+ *[sigma2,Sigma,didOverflow,VCov]=spherHarmonicCov(CStdDev,SStdDev,point,a,c,scalFactor,numThreads);
  *or using 
  *[sigma2]=spherHarmonicCov(CStdDev,SStdDev,point,a,c,scalFactor);
  *if one only the variance of the potential is desired. The function
  *executes faster if only the variance of the potential and not the
- *covariance matrix of the gradient need be computed.
+ *covariance matrix of the gradient need be computed. The packed covariance
+ *matrix of the potential between all of the points, VCov, is only
+ *computed if it is requested.
  *
  *April 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
  */
@@ -38,13 +40,14 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     //suppress a warning if compiled using -Wconditional-uninitialized.
     mxArray *SigmaMATLAB=NULL;
     double *sigma2,*Sigma;
+    size_t numThreads;
     bool didOverflow;
     
-    if(nrhs<3||nrhs>6) {
+    if(nrhs<3||nrhs>7) {
         mexErrMsgTxt("Wrong number of inputs.");
     }
     
-    if(nlhs>3) {
+    if(nlhs>4) {
         mexErrMsgTxt("Invalid number of outputs.");
     }
     
@@ -105,7 +108,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
 
         curCopyPoint=pointCopy;
         curOrigPoint=point;
-        for(curPoint=1;curPoint<numPoints;curPoint++) {
+        for(curPoint=0;curPoint<numPoints;curPoint++) {
             *(curCopyPoint)=1;
             *(curCopyPoint+1)=*(curOrigPoint);
             *(curCopyPoint+2)=*(curOrigPoint+1);
@@ -142,6 +145,12 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     } else {
         scalFactor=getDoubleFromMatlab(prhs[5]);
     }
+
+    if(nrhs<7||mxIsEmpty(prhs[6])) {
+        numThreads=1;
+    } else {
+        numThreads=getSizeTFromMatlab(prhs[6]);
+    }
     
     //Allocate space for the return values
     sigma2MATLAB=mxCreateDoubleMatrix(numPoints, 1,mxREAL);
@@ -165,13 +174,22 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     
     if(nlhs>1) {
         plhs[1]=SigmaMATLAB;
+        if(nlhs>3) {
+            mxArray *VCovMATLAB=mxCreateDoubleMatrix(numPoints*(numPoints+1)/2,1,mxREAL);
+
+            if(spherHarmonicCovPackedCPP(mxGetPr(VCovMATLAB),CStdDev,SStdDev,point,numPoints,a,c,scalFactor,numThreads)) {
+                didOverflow=true;
+            }
+            plhs[3]=VCovMATLAB;
+        }
+
         if(nlhs>2) {
             plhs[2]=boolMat2Matlab(&didOverflow,1,1);
         }
     }
     
     if(pointCopy!=NULL) {
-        mxFree(pointCopy);
+        delete[] pointCopy;
     }
 }
 
@@ -1,4 +1,4 @@
-function [sigma2,Sigma,didOverflow]=spherHarmonicCov(CStdDev,SStdDev,point,a,c,scalFactor)
+function [sigma2,Sigma,didOverflow,VCov]=spherHarmonicCov(CStdDev,SStdDev,point,a,c,scalFactor,numThreads)
 %%SPHERHARMONICCOV Evaluate the variance of a potential or the covariance
 %                  matrix of a gradient that one might compute using a
 %                  spherical harmonic coefficient model with
@@ -64,6 +64,12 @@ function [sigma2,Sigma,didOverflow]=spherHarmonicCov(CStdDev,SStdDev,point,a,c,s
 %               overflows. However overflows (and a loss of precision) are
 %               unavoidable when using the full EGM2008 model. These
 %               effects are worse near the poles.
+%    numThreads An optional parameter specifying the number of threads to
+%               use when computing VCov in the compiled version of this
+%               function. Zero means that the number of hardware threads
+%               available is used. The default if omitted or an empty
+%               matrix is passed is 1. This parameter is ignored by the
+%               Matlab implementation.
 %
 %OUTPUTS: sigma2 The NX1 vector of variances (squared standard deviations)
 %                of the potential estimate at the given points.
@@ -77,9 +83,25 @@ function [sigma2,Sigma,didOverflow]=spherHarmonicCov(CStdDev,SStdDev,point,a,c,s
 %                Also, if scaling is extremely bad, it is possible for
 %                NaNs or Inf terms to still be returned in sigma2 and
 %                Sigma.
+%           VCov The NXN covariance matrix of the potential between all
+%                pairs of the points, as a (N*(N+1)/2)X1 vector holding its
+%                lower-triangular part listed column-by-column, as returned
+%                by the vech function. The full matrix is
+%                vech2Mat(VCov). The diagonal elements are sigma2. This is
+%                only computed if requested.
 %
 %The algorithm used here is described in [1].
 %
+%For VCov, the errors in the coefficients are taken to be independent, as
+%for sigma2, so the covariance between the potentials at two points is the
+%sum over all coefficients of the products of the terms for the two points
+%that multiply each coefficient times the coefficient's variance. The terms
+%for each point are computed once and the covariances are formed as inner
+%products between the points. This takes O(N^2*M^2) operations, which is
+%feasible for about 10^4 points with the compiled implementation, which
+%splits the work among numThreads threads. The Matlab implementation stores
+%the (M+1)^2 terms of all N points at once.
+%
 %Since Matlab uses double precision arithmetic, when using high degree and
 %order models, such as the full 2190 degree EGM2008 model, the precision of
 %Sigma will be reduced as higher-order terms can experience overflow
@@ -152,6 +174,13 @@ end
 CStdDev=CountingClusterSet(CStdDev);
 SStdDev=CountingClusterSet(SStdDev);
 
+if(nargout>3)
+    %The terms of the potential of each point multiplied by the standard
+    %deviations of their coefficients. The term for the coefficient S(n,0)
+    %is omitted, because it is always zero.
+    potTerms=zeros((M+1)^2,numPoints);
+end
+
 sigma2=zeros(numPoints,1);
 Sigma=zeros(3,3,numPoints);
 
@@ -227,6 +256,31 @@ for curPoint=1:numPoints
 
     sigma2(curPoint)=(c/r)^2*sigma2(curPoint)/scalFactor^2;
 
+    if(nargout>3)
+        curTerm=1;
+        for n=0:M
+            for m=0:n
+                CTerm=nCoeff(n+1)*CStdDev(n+1,m+1)*rm(m+1)*HBar(n+1,m+1);
+                if(~isfinite(CTerm))
+                    CTerm=0;
+                    didOverflow=true;
+                end
+                potTerms(curTerm,curPoint)=(c/(r*scalFactor))*CTerm;
+                curTerm=curTerm+1;
+
+                if(m>0)
+                    STerm=nCoeff(n+1)*SStdDev(n+1,m+1)*im(m+1)*HBar(n+1,m+1);
+                    if(~isfinite(STerm))
+                        STerm=0;
+                        didOverflow=true;
+                    end
+                    potTerms(curTerm,curPoint)=(c/(r*scalFactor))*STerm;
+                    curTerm=curTerm+1;
+                end
+            end
+        end
+    end
+
     %Now, compute the cosigma matrix of the gradient, if requested.
     if(nargout>1)
         a11=0;
@@ -338,6 +392,10 @@ for curPoint=1:numPoints
     end
 
 end
+
+if(nargout>3)
+    VCov=vech(potTerms'*potTerms);
+end
 end
 
 %LICENSE:
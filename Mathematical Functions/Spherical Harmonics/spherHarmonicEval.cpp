@@ -6,9 +6,9 @@
  *CompileCLibraries function.
  *
  *The function is called in Matlab using the format:
- *[V,gradV,HessianV]=spherHarmonicEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm);
+ *[V,gradV,HessianV,degreeUsed]=spherHarmonicEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads,truncTol);
  *or using 
- *[V]=spherHarmonicEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm);
+ *[V]=spherHarmonicEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads,truncTol);
  *if one only wants the potential. The function executes faster if only the
  *potential and not the gradient and Hessian need be computed.
  *
@@ -31,7 +31,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     double scalFactor;
     std::complex <double> a,c;
     bool spherDerivs;
-    size_t algorithm;
+    size_t algorithm, numThreads;
+    double truncTol;
+    size_t *degreeUsed=NULL;
     double *point, *pointCopy=NULL;
     CountingClusterSetCPP<double> CReal;
     CountingClusterSetCPP<double> SReal;
@@ -56,11 +58,11 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     //example, if S is real and C is complex.
     double *buffer=NULL;
     
-    if(nrhs<3||nrhs>9) {
+    if(nrhs<3||nrhs>11) {
         mexErrMsgTxt("Wrong number of inputs.");
     }
     
-    if(nlhs>3) {
+    if(nlhs>4) {
         mexErrMsgTxt("Invalid number of outputs.");
     }
 
@@ -125,7 +127,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
 
         curCopyPoint=pointCopy;
         curOrigPoint=point;
-        for(curPoint=1;curPoint<numPoints;curPoint++) {
+        for(curPoint=0;curPoint<numPoints;curPoint++) {
             *(curCopyPoint)=1;
             *(curCopyPoint+1)=*(curOrigPoint);
             *(curCopyPoint+2)=*(curOrigPoint+1);
@@ -190,6 +192,18 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     if(algorithm>2) {
         mexErrMsgTxt("Unknown algorithm option specified.");
     }
+
+    if(nrhs<10||mxIsEmpty(prhs[9])) {
+        numThreads=1;
+    } else {
+        numThreads=getSizeTFromMatlab(prhs[9]);
+    }
+
+    if(nrhs<11||mxIsEmpty(prhs[10])) {
+        truncTol=0;
+    } else {
+        truncTol=getDoubleFromMatlab(prhs[10]);
+    }
     
     //Allocate space for the return values
     if(useComplexAlg) {
@@ -244,13 +258,27 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
             HessianVMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,complexVal);
             HessianVReal=mxGetPr(HessianVMATLAB);
             HessianVImag=mxGetPi(HessianVMATLAB);
+
+            if(nlhs>3) {
+                degreeUsed=new size_t[numPoints];
+            }
         }
     }
 
     if(useComplexAlg) {
-        spherHarmonicEvalCPPComplex(VReal, VImag, gradVReal, gradVImag, HessianVReal, HessianVImag, CReal, CImag, SReal, SImag, point, numPoints, a, c, systemType, spherDerivs,scalFactor,algorithm);
+        if(truncTol>0) {
+            mexErrMsgTxt("Truncation of the degree is only supported for real coefficients.");
+        }
+
+        if(degreeUsed!=NULL) {
+            for(i=0;i<numPoints;i++) {
+                degreeUsed[i]=M;
+            }
+        }
+
+        spherHarmonicEvalCPPComplex(VReal, VImag, gradVReal, gradVImag, HessianVReal, HessianVImag, CReal, CImag, SReal, SImag, point, numPoints, a, c, systemType, spherDerivs,scalFactor,algorithm,numThreads);
     } else {
-        spherHarmonicEvalCPPReal(VReal,gradVReal,HessianVReal,CReal,SReal,point,numPoints,real(a),real(c),systemType, spherDerivs,scalFactor,algorithm);
+        spherHarmonicEvalCPPRealTrunc(VReal,gradVReal,HessianVReal,degreeUsed,CReal,SReal,point,numPoints,real(a),real(c),systemType, spherDerivs,scalFactor,algorithm,numThreads,truncTol,NULL);
     }
 
     plhs[0]=VMATLAB;
@@ -258,11 +286,15 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         plhs[1]=gradVMATLAB;
         if(nlhs>2) {
             plhs[2]=HessianVMATLAB;
+            if(nlhs>3) {
+                plhs[3]=sizeTMat2MatlabDoubles(degreeUsed,numPoints,1);
+                delete[] degreeUsed;
+            }
         }
     }
 
     if(pointCopy!=NULL) {
-        delete pointCopy;
+        delete[] pointCopy;
     }
 
     if(buffer!=NULL) {
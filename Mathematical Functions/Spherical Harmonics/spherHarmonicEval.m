@@ -1,4 +1,4 @@
-function [V,gradV,HessianV]=spherHarmonicEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm)
+function [V,gradV,HessianV,degreeUsed]=spherHarmonicEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads,truncTol)
 %%SPHERHARMONICEVAL Evaluate a real or complex potential (e.g.
 %                   gravitational or magnetic field) and/ or the gradient
 %                   and Hessian of a potential when the potential is
@@ -32,7 +32,10 @@ function [V,gradV,HessianV]=spherHarmonicEval(C,S,point,a,c,systemType,spherDeri
 %          consisting of [r;azimuth;elevation]; When evaluating points on a
 %          grid, the algorithm will be fastest if the points are provided
 %          presorted by range and then by azimuth. This reduces the amount
-%          of recomputation of certain values. Alternatively, if C and S
+%          of recomputation of certain values. The compiled version of this
+%          function internally evaluates the points sorted by elevation and
+%          range when that reduces the recomputation, so presorting mostly
+%          matters for the Matlab implementation. Alternatively, if C and S
 %          are for evaluating terrain heights, then points are 2XN having
 %          the format [azimuth;elevation] and it is best if the points are
 %          sorted by azimuth. Azimuth is measured counterclockwise from the
@@ -91,6 +94,27 @@ function [V,gradV,HessianV]=spherHarmonicEval(C,S,point,a,c,systemType,spherDeri
 %            the points. Note that the gradient is singular at the poles,
 %            so numerical problems will arise.
 %          2 Only use Pines' algorithm.
+% numThreads An optional parameter specifying the number of threads to use
+%          when evaluating the points in the compiled version of this
+%          function. Zero means that the number of hardware threads
+%          available is used. The default if omitted or an empty matrix is
+%          passed is 1. The points are split into contiguous chunks, one per
+%          thread, so that consecutive points with the same elevation are
+%          kept together as much as possible. This parameter is ignored by
+%          the Matlab implementation.
+% truncTol An optional absolute tolerance for choosing the maximum degree
+%          separately for each point. If truncTol>0, each point is
+%          evaluated with the coefficients truncated to the smallest
+%          degree N such that a bound on the terms of degrees N+1 to M is
+%          at most truncTol for the potential and, if the gradient is
+%          requested, for the Cartesian gradient. The bound only depends
+%          on the range and decreases like (a/r)^n, so far from the
+%          reference sphere, such as at satellite altitudes, high-degree
+%          terms are skipped. The Hessian, if requested, uses the degree
+%          chosen for the gradient. The default if omitted or an empty
+%          matrix is passed is 0, which means that all points are
+%          evaluated to degree M. Truncation is only supported for real
+%          coefficients.
 %
 %OUTPUTS: V The NX1 set of scalar potentials as obtained from the spherical
 %           harmonic series. When dealing with gravitational models, the
@@ -115,6 +139,9 @@ function [V,gradV,HessianV]=spherHarmonicEval(C,S,point,a,c,systemType,spherDeri
 %            d2/(dzdx),d2/(dzdy),d2/(dxdx)]; If spherical derivatives are
 %            used, then the ordering is the same with (x,y,z) replaced by
 %            (r,Az,El).
+% degreeUsed The NX1 set of maximum degrees used for each point. This is
+%           M for all points unless truncTol>0. Note that requesting this
+%           output means that the Hessian is also computed.
 %
 %This function implements Legendre's algorithm from [2], but evaluates the
 %sums using Horner's method as in and the Legendre function ratios as
@@ -379,6 +406,14 @@ function [V,gradV,HessianV]=spherHarmonicEval(C,S,point,a,c,systemType,spherDeri
 %December 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
+if(nargin<11||isempty(truncTol))
+    truncTol=0;
+end
+
+if(nargin<10||isempty(numThreads))
+    numThreads=1;
+end
+
 if(nargin<9||isempty(algorithm))
     algorithm=0; 
 end
@@ -431,6 +466,36 @@ switch(size(point,1))
         error('Invalid point length');
 end
 
+%If the degree is chosen separately for each point, then the points are
+%grouped by degree and each group is evaluated using the coefficients up
+%to that degree, which are the first (N+1)*(N+2)/2 coefficients.
+if(truncTol>0)
+    if(~isreal(C)||~isreal(S)||~isreal(a)||~isreal(c))
+        error('Truncation of the degree is only supported for real coefficients.')
+    end
+    
+    degreeUsed=truncDegrees(C,S,point(1,:),a,c,nargout>1,truncTol);
+    
+    V=zeros(numPoints,1);
+    gradV=zeros(3,numPoints);
+    HessianV=zeros(3,3,numPoints);
+    for N=unique(degreeUsed).'
+        sel=(degreeUsed==N);
+        numEls=(N+1)*(N+2)/2;
+        
+        switch(nargout)
+            case {0,1}
+                V(sel)=spherHarmonicEval(C(1:numEls),S(1:numEls),point(:,sel),a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+            case 2
+                [V(sel),gradV(:,sel)]=spherHarmonicEval(C(1:numEls),S(1:numEls),point(:,sel),a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+            otherwise
+                [V(sel),gradV(:,sel),HessianV(:,:,sel)]=spherHarmonicEval(C(1:numEls),S(1:numEls),point(:,sel),a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+        end
+    end
+    return
+end
+degreeUsed=M*ones(numPoints,1);
+
 %Using a CountingClusterSet simplifies the indexation of the coefficients.
 C=CountingClusterSet(C);
 S=CountingClusterSet(S);
@@ -1039,6 +1104,48 @@ if(spherDerivs&&systemType==2)
 end
 end
 
+function degreeUsed=truncDegrees(C,S,r,a,c,gradDesired,truncTol)
+%%TRUNCDEGREES Find the smallest degree for each range in r such that a
+%              bound on the magnitude of the omitted terms of the
+%              potential and, if gradDesired is true, of the gradient is at
+%              most truncTol. For fully normalized coefficients, the
+%              addition theorem and the Cauchy-Schwarz inequality bound the
+%              terms of degree n of the potential by
+%              (|c|/r)*(a/r)^n*degreeNorms(n+1) and of the gradient by
+%              (|c|/r^2)*(a/r)^n*degreeNorms(n+1)*sqrt((n+1)*(2*n+1)),
+%              where degreeNorms(n+1)=sqrt((2*n+1)*sum_m(C^2+S^2)) for the
+%              coefficients of degree n.
+
+M=(1/2)*(sqrt(1+8*length(C))-1)-1;
+minDegree=min(M,3);
+
+degreeNorms=zeros(M+1,1);
+for n=0:M
+    idx=(n*(n+1)/2+1):((n+1)*(n+2)/2);
+    degreeNorms(n+1)=sqrt((2*n+1)*sum(C(idx).^2+S(idx).^2));
+end
+
+numPoints=length(r);
+degreeUsed=minDegree*ones(numPoints,1);
+for curPoint=1:numPoints
+    rCur=r(curPoint);
+    VTail=0;
+    gradTail=0;
+    for n=M:-1:(minDegree+1)
+        term=(a/rCur)^n*degreeNorms(n+1);
+        VTail=VTail+(abs(c)/rCur)*term;
+        if(gradDesired)
+            gradTail=gradTail+(abs(c)/rCur^2)*term*sqrt((n+1)*(2*n+1));
+        end
+        
+        if(~(VTail<=truncTol&&gradTail<=truncTol))
+            degreeUsed(curPoint)=n;
+            break;
+        end
+    end
+end
+end
+
 function [SinVec,CosVec]=calcSinCosTerms(lambda,M)
     %Compute sin(m*lambda) and cos(m*lambda) for m=0 to m=M.
     SinVec=zeros(M+1,1);
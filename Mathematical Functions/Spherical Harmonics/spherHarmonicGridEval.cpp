@@ -0,0 +1,202 @@
+/**SPHERHARMONICGRIDEVAL A mex file implementation of the function
+ *                  spherHarmonicGridEval. See the comments to the Matlab
+ *                  implementation for more details.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The function is called in Matlab using the format:
+ *[V,gradV]=spherHarmonicGridEval(C,S,elevations,numLon,r,lon0,a,c,spherDerivs,scalFactor,numThreads);
+ *or using
+ *V=spherHarmonicGridEval(C,S,elevations,numLon,r,lon0,a,c,spherDerivs,scalFactor,numThreads);
+ *if one only wants the potential. The function executes faster if only the
+ *potential and not the gradient need be computed.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "matrix.h"
+#include "mex.h"
+/* This header validates inputs and includes a header needed to handle
+ * Matlab matrices.*/
+#include "MexValidation.h"
+#include "mathFuncs.hpp"
+//Needed for sqrt
+#include <cmath>
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    double scalFactor, a, c, lon0;
+    bool spherDerivs, isTerrain;
+    size_t numThreads, numLat, numLon;
+    double *elevation, *r, *rCopy=NULL;
+    CountingClusterSetCPP<double> C;
+    CountingClusterSetCPP<double> S;
+    size_t M, totalNumEls;
+    mxArray *VMATLAB;
+    mxArray *gradVMATLAB=NULL;
+    double *V;
+    double *gradV=NULL;
+
+    if(nrhs<4||nrhs>11) {
+        mexErrMsgTxt("Wrong number of inputs.");
+    }
+
+    if(nlhs>2) {
+        mexErrMsgTxt("Invalid number of outputs.");
+    }
+
+    //Check the validity of the ClusterSets
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+
+    //Make sure that both of the coefficient sets have the same number of
+    //elements and are not empty.
+    if(mxIsEmpty(prhs[0])||mxIsEmpty(prhs[1])||mxGetM(prhs[0])!=mxGetM(prhs[1])||mxGetN(prhs[0])!=mxGetN(prhs[1])) {
+        mexErrMsgTxt("Invalid data passed.");
+    }
+
+    C.clusterEls=mxGetPr(prhs[0]);
+    S.clusterEls=mxGetPr(prhs[1]);
+
+    //The number of elements in the ClusterSets
+    totalNumEls=mxGetM(prhs[0])*mxGetN(prhs[0]);
+
+    //Since the total number of points in a CountingClusterSetCPP
+    //is (M+1)*(M+2)/2, where M is the number of clusters -1, we can easily
+    //verify that a valid number of points was passed.
+    M=(-3+static_cast<size_t>(sqrt(static_cast<double>(1+8*totalNumEls))))/2;
+    if((M+1)*(M+2)/2!=totalNumEls) {
+        mexErrMsgTxt("S and C contain an inconsistent number of elements.");
+    }
+
+    C.numClust=M+1;
+    S.numClust=M+1;
+    C.totalNumEl=totalNumEls;
+    S.totalNumEl=totalNumEls;
+
+    checkRealDoubleArray(prhs[2]);
+    numLat=mxGetM(prhs[2])*mxGetN(prhs[2]);
+    elevation=mxGetPr(prhs[2]);
+
+    numLon=getSizeTFromMatlab(prhs[3]);
+    if(numLon==0) {
+        mexErrMsgTxt("numLon must be positive.");
+    }
+
+    isTerrain=(nrhs<5||mxIsEmpty(prhs[4]));
+    if(isTerrain) {
+        rCopy=new double[numLat];
+        for(size_t curLat=0;curLat<numLat;curLat++) {
+            rCopy[curLat]=1;
+        }
+        r=rCopy;
+    } else {
+        size_t numR;
+
+        checkRealDoubleArray(prhs[4]);
+        numR=mxGetM(prhs[4])*mxGetN(prhs[4]);
+        if(numR==1) {
+            const double rVal=mxGetPr(prhs[4])[0];
+
+            rCopy=new double[numLat];
+            for(size_t curLat=0;curLat<numLat;curLat++) {
+                rCopy[curLat]=rVal;
+            }
+            r=rCopy;
+        } else if(numR==numLat) {
+            r=mxGetPr(prhs[4]);
+        } else {
+            mexErrMsgTxt("r must be a scalar or have one element per elevation.");
+            return;
+        }
+    }
+
+    if(nrhs<6||mxIsEmpty(prhs[5])) {
+        lon0=0;
+    } else {
+        lon0=getDoubleFromMatlab(prhs[5]);
+    }
+
+    if(nrhs<7||mxIsEmpty(prhs[6])) {
+        if(isTerrain) {
+            a=1;
+        } else {
+            a=getScalarMatlabClassConst("Constants", "EGM2008SemiMajorAxis");
+        }
+    } else {
+        a=getDoubleFromMatlab(prhs[6]);
+    }
+
+    if(nrhs<8||mxIsEmpty(prhs[7])) {
+        if(isTerrain) {
+            c=1;
+        } else {
+            c=getScalarMatlabClassConst("Constants", "EGM2008GM");
+        }
+    } else {
+        c=getDoubleFromMatlab(prhs[7]);
+    }
+
+    if(nrhs<9||mxIsEmpty(prhs[8])) {
+        spherDerivs=false;
+    } else {
+        spherDerivs=getBoolFromMatlab(prhs[8]);
+    }
+
+    if(nrhs<10||mxIsEmpty(prhs[9])) {
+        scalFactor=1e-280;
+    } else {
+        scalFactor=getDoubleFromMatlab(prhs[9]);
+    }
+
+    if(nrhs<11||mxIsEmpty(prhs[10])) {
+        numThreads=1;
+    } else {
+        numThreads=getSizeTFromMatlab(prhs[10]);
+    }
+
+    //Allocate space for the return values
+    VMATLAB=mxCreateDoubleMatrix(numLat,numLon,mxREAL);
+    V=mxGetPr(VMATLAB);
+
+    if(nlhs>1) {
+        mwSize dims[3];
+
+        dims[0]=3;
+        dims[1]=numLat;
+        dims[2]=numLon;
+
+        gradVMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        gradV=mxGetPr(gradVMATLAB);
+    }
+
+    spherHarmonicGridEvalCPP(V,gradV,C,S,elevation,r,numLat,numLon,lon0,a,c,spherDerivs,scalFactor,numThreads);
+
+    plhs[0]=VMATLAB;
+    if(nlhs>1) {
+        plhs[1]=gradVMATLAB;
+    }
+
+    if(rCopy!=NULL) {
+        delete[] rCopy;
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
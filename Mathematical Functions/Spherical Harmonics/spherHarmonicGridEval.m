@@ -0,0 +1,272 @@
+function [V,gradV]=spherHarmonicGridEval(C,S,elevations,numLon,r,lon0,a,c,spherDerivs,scalFactor,numThreads)
+%%SPHERHARMONICGRIDEVAL Evaluate a real potential (e.g. gravitational or
+%                   magnetic field) and/or its gradient when the potential
+%                   is expressed in terms of real spherical harmonic
+%                   coefficients on a regular grid of points. The grid
+%                   consists of a set of elevations (rows) and numLon
+%                   azimuths that are evenly spaced about the full circle.
+%                   This is much faster than evaluating the same points
+%                   with spherHarmonicEval when producing maps of
+%                   quantities such as geoid heights, gravity anomalies or
+%                   terrain heights. Alternatively, by omitting r, this
+%                   function can be used to evaluate the type of spherical
+%                   harmonic series used to express terrain heights.
+%
+%INPUTS: C A length (M+2)*(M+1)/2 array holding the real coefficient terms
+%          that are multiplied by cosines in the harmonic expansion. The
+%          coefficients must be fully normalized using the type of full
+%          normalization that is used in the EGM2008 model. The format is
+%          the same as in spherHarmonicEval. It is assumed that M>=3.
+%        S A length (M+2)*(M+1)/2 array holding the coefficient terms that
+%          are multiplied by sines in the harmonic expansion. The
+%          requirements on S are the same as those on C.
+% elevations A numLatX1 or 1XnumLat vector of the elevations (geocentric
+%          latitudes) in radians of the rows of the grid. These need not
+%          be evenly spaced. Elevation is measured up from the x-y plane
+%          (towards the z-axis).
+%   numLon The number of azimuths in each row of the grid. The azimuths
+%          are lambda(j)=lon0+2*pi*(j-1)/numLon for j=1 to numLon, where
+%          azimuth is measured counterclockwise from the x-axis in the x-y
+%          plane. Any positive integer can be used, though the compiled
+%          version of this function is fastest when numLon is a power of
+%          two.
+%        r The range of the points in each row. This can either be a
+%          scalar, if all of the rows have the same range, or a numLatX1
+%          or 1XnumLat vector, which allows, for example, each row to be
+%          on the surface of the reference ellipsoid. If this parameter is
+%          omitted or an empty matrix is passed, then r=1 and the
+%          coefficients are assumed to be for terrain heights, as when 2D
+%          points are passed to spherHarmonicEval.
+%     lon0 The azimuth of the first column of the grid in radians. The
+%          default if omitted or an empty matrix is passed is 0.
+%        a The real numerator in the (a/r)^n term in the spherical harmonic
+%          sum. The default if omitted or an empty matrix is passed is
+%          Constants.EGM2008SemiMajorAxis unless r is omitted, in which
+%          case a=1 is used.
+%        c The real constant value by which the spherical harmonic series
+%          is multiplied. The default if omitted or an empty matrix is
+%          passed is Constants.EGM2008GM unless r is omitted, in which case
+%          c=1 is used.
+% spherDerivs If true, the gradient is returned in spherical coordinates
+%          rather than Cartesian coordinates. The default if omitted or an
+%          empty matrix is passed is false.
+% scalFactor An optional real scale factor used in computing the normalized
+%          associated Legendre polynomials. The default if omitted or an
+%          empty matrix is passed is 10^(-280), as in spherHarmonicEval.
+% numThreads An optional parameter specifying the number of threads to use
+%          in the compiled version of this function. The rows of the grid
+%          are split evenly among the threads. Zero means that the number
+%          of hardware threads available is used. The default if omitted
+%          or an empty matrix is passed is 1. This parameter is ignored by
+%          the Matlab implementation.
+%
+%OUTPUTS: V The numLatXnumLon matrix of potentials on the grid. V(i,j) is
+%           the potential at elevations(i) and lambda(j).
+%     gradV The 3XnumLatXnumLon set of gradients of the potential.
+%           gradV(:,i,j) corresponds to V(i,j). The derivatives are in the
+%           order [dV/dx;dV/dy;dV/dz] for Cartesian values and in the
+%           order [dV/dr;dV/dAz;dV/dEl] for spherical values.
+%
+%The potential evaluated by Legendre's method, as in algorithm 1 of
+%spherHarmonicEval, can be written as
+%V=(c/r)*sum_{m=0}^M u^m*(A_m*cos(m*lambda)+B_m*sin(m*lambda))
+%where u=cos(elevation) and the sums A_m and B_m only depend on the range
+%and the elevation. Thus, for each row of the grid, the Legendre function
+%ratios and the A_m and B_m terms are computed once, taking O(M^2)
+%operations, and the resulting Fourier series in lambda is evaluated at
+%all numLon azimuths of the row with a single fast Fourier transform
+%(FFT), taking O(numLon*log(numLon)) operations. Orders m>=numLon are
+%folded onto the order mod(m,numLon), which is exact at the grid points,
+%so numLon is not required to exceed 2*M. The gradient is computed the
+%same way with one FFT each for the derivatives with respect to range,
+%azimuth and elevation. For a degree 2190 model, this reduces the cost of
+%a global grid from O(M^2) per point to O(M^2) per row.
+%
+%As with algorithm 1 of spherHarmonicEval, the gradient in Cartesian
+%coordinates is singular at the poles, so rows at elevations of +/-pi/2
+%should not be used when the Cartesian gradient is desired.
+%
+%The compiled version of this function uses a radix-2 FFT when numLon is
+%a power of two and Bluestein's algorithm, described in [1], otherwise.
+%
+%EXAMPLE:
+%Here, the geoid undulation from the EGM2008 model to degree 360 is
+%approximated on a 1-degree grid. The potential is evaluated on a sphere
+%of the size of the reference ellipsoid using spherHarmonicEval and this
+%function and the results are compared.
+% [C,S]=getEGMGravCoeffs(360);
+% lat=(-89.5:1:89.5)*(pi/180);
+% numLon=360;
+% r=Constants.EGM2008SemiMajorAxis;
+% tic
+% V=spherHarmonicGridEval(C,S,lat,numLon,r);
+% toc
+% [latGrid,lonGrid]=ndgrid(lat,(0:(numLon-1))*(2*pi/numLon));
+% points=[r*ones(1,numel(latGrid));lonGrid(:)';latGrid(:)'];
+% tic
+% V1=spherHarmonicEval(C,S,points);
+% toc
+% max(abs(V(:)-V1(:)))
+%The difference between the two is on the order of finite precision
+%errors, but the grid evaluation is much faster.
+%
+%REFERENCES:
+%[1] L. I. Bluestein, "A linear filtering approach to the computation of
+%    discrete Fourier transform," IEEE Transactions on Audio and
+%    Electroacoustics, vol. 18, no. 4, pp. 451-455, Dec. 1970.
+%[2] S. A. Holmes and W. E. Featherstone, "A unified approach to the
+%    Clenshaw summation and the recursive computation of very high degree
+%    and order normalised associated Legendre functions," Journal of
+%    Geodesy, vol. 76, no. 5, pp. 279-299, May 2002.
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+if(nargin<10||isempty(scalFactor))
+    scalFactor=10^(-280);
+end
+
+if(nargin<9||isempty(spherDerivs))
+    spherDerivs=false;
+end
+
+isTerrain=(nargin<5||isempty(r));
+
+if(nargin<8||isempty(c))
+    if(isTerrain)
+        c=1;
+    else
+        c=Constants.EGM2008GM;
+    end
+end
+
+if(nargin<7||isempty(a))
+    if(isTerrain)
+        a=1;
+    else
+        a=Constants.EGM2008SemiMajorAxis;
+    end
+end
+
+if(nargin<6||isempty(lon0))
+    lon0=0;
+end
+
+numLat=length(elevations);
+if(isTerrain)
+    r=ones(numLat,1);
+elseif(isscalar(r))
+    r=r*ones(numLat,1);
+elseif(length(r)~=numLat)
+    error('r must be a scalar or have one element per elevation.')
+end
+
+if(~isreal(C)||~isreal(S))
+    error('Only real coefficients are supported.')
+end
+
+M=(1/2)*(sqrt(1+8*length(C))-1)-1;
+
+%Using a CountingClusterSet simplifies the indexation of the coefficients.
+C=CountingClusterSet(C);
+S=CountingClusterSet(S);
+
+V=zeros(numLat,numLon);
+gradV=zeros(3,numLat,numLon);
+
+m=(0:M)';
+%The index of the Fourier coefficient into which each order is folded.
+foldIdx=mod(m,numLon)+1;
+%The shift so that the first azimuth is lon0.
+lonShift=exp(1i*m*lon0)/scalFactor;
+lambda=lon0+2*pi*(0:(numLon-1))/numLon;
+
+A=zeros(M+1,1);
+B=zeros(M+1,1);
+Ar=zeros(M+1,1);
+Br=zeros(M+1,1);
+ATheta=zeros(M+1,1);
+BTheta=zeros(M+1,1);
+for curLat=1:numLat
+    rCur=r(curLat);
+    elCur=elevations(curLat);
+    %The formulae for spherical harmonic synthesis with Legendre's method
+    %use colatitude.
+    theta=pi/2-elCur;
+    u=sin(theta);
+    crScal=c/rCur;
+    nCoeff=(a/rCur).^m;
+
+    if(nargout>1)
+        [PBarUVals,dPBarUValsdTheta]=NALegendreCosRat(theta,M,scalFactor);
+    else
+        PBarUVals=NALegendreCosRat(theta,M,scalFactor);
+    end
+
+    %Evaluate Equation 7 from the Holmes and Featherstone paper.
+    A(:)=0;
+    B(:)=0;
+    Ar(:)=0;
+    Br(:)=0;
+    ATheta(:)=0;
+    BTheta(:)=0;
+    for curM=0:M
+        for n=curM:M
+            CScal=nCoeff(n+1)*C(n+1,curM+1);
+            SScal=nCoeff(n+1)*S(n+1,curM+1);
+
+            A(curM+1)=A(curM+1)+CScal*PBarUVals(n+1,curM+1);
+            B(curM+1)=B(curM+1)+SScal*PBarUVals(n+1,curM+1);
+
+            if(nargout>1)
+                Ar(curM+1)=Ar(curM+1)+(n+1)*CScal*PBarUVals(n+1,curM+1);
+                Br(curM+1)=Br(curM+1)+(n+1)*SScal*PBarUVals(n+1,curM+1);
+                ATheta(curM+1)=ATheta(curM+1)+CScal*dPBarUValsdTheta(n+1,curM+1);
+                BTheta(curM+1)=BTheta(curM+1)+SScal*dPBarUValsdTheta(n+1,curM+1);
+            end
+        end
+    end
+
+    %The series sum_m P_m*cos(m*lambda)+Q_m*sin(m*lambda) is the real part
+    %of sum_m (P_m-1i*Q_m)*exp(1i*m*lambda), which is evaluated at all of
+    %the azimuths using an inverse FFT.
+    w=u.^m.*lonShift;
+    V(curLat,:)=crScal*real(numLon*ifft(accumarray(foldIdx,(A-1i*B).*w,[numLon,1])));
+
+    if(nargout>1)
+        dVdr=crScal*real(numLon*ifft(accumarray(foldIdx,(-Ar+1i*Br).*w,[numLon,1])))/rCur;
+        dVdLambda=crScal*real(numLon*ifft(accumarray(foldIdx,m.*(B+1i*A).*w,[numLon,1])));
+        %The minus sign adjusts for the coordinate system change.
+        dVdTheta=-crScal*real(numLon*ifft(accumarray(foldIdx,(ATheta-1i*BTheta).*w,[numLon,1])));
+
+        for curLon=1:numLon
+            gradCur=[dVdr(curLon);dVdLambda(curLon);dVdTheta(curLon)];
+
+            if(spherDerivs)
+                gradV(:,curLat,curLon)=gradCur;
+            else%Convert the derivatives to Cartesian coordinates.
+                J=calcSpherConvJacob([rCur;lambda(curLon);elCur]);
+                gradV(:,curLat,curLon)=J'*gradCur;
+            end
+        end
+    end
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
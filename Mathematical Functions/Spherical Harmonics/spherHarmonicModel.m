@@ -0,0 +1,253 @@
+classdef spherHarmonicModel < handle
+%%SPHERHARMONICMODEL A real spherical harmonic model, such as a
+%          gravitational or magnetic field model, that is evaluated
+%          repeatedly. If a C++ class interface for the model has been
+%          compiled, then the coefficients, the constants used in the
+%          recursion for the Legendre function ratios and the temporary
+%          memory used during the evaluation are kept in C++ between calls,
+%          so each call to evaluate only costs as much as the evaluation
+%          itself. Otherwise, the evaluate method just calls
+%          spherHarmonicEval.
+%
+%This class is useful when a model is evaluated many times with few points
+%per call, such as when computing the gravitational acceleration in the
+%dynamic model of a tracking filter. In that case, much of the time spent
+%in spherHarmonicEval can go to validating and copying the coefficients
+%and allocating memory rather than to the evaluation. For a single call
+%with many points, spherHarmonicEval is just as fast.
+%
+%Only real coefficients are supported. Note that if the C++ implementation
+%is used, the mex file is locked when a spherHarmonicModel object is
+%created and is not unlocked (and able to be recompiled) until all of the
+%spherHarmonicModel objects have been freed.
+%
+%Modification of the CPPData member of this class can potentially lead to
+%Matlab crashing as CPPData is a pointer to data in the C++
+%implementation.
+%
+%EXAMPLE:
+%Here, the gravitational acceleration from the EGM2008 model truncated to
+%degree 360 is evaluated at a point near the surface of the Earth, one at
+%a time, as might be done in a filter.
+% [C,S,a,c]=getEGMGravCoeffs(360);
+% model=spherHarmonicModel(C,S,a,c);
+% point=[Constants.EGM2008SemiMajorAxis+1000;0.2;0.7];
+% [V,gradV]=model.evaluate(point);
+%The results are the same as those of spherHarmonicEval(C,S,point,a,c).
+%
+%A model can also be made from a file written by saveSpherHarmonicCoeffs.
+%With the C++ implementation, the file is memory mapped and the
+%coefficients are used directly from the file, so creating the model does
+%not require reading or copying the coefficients and multiple Matlab
+%processes using the same file share the memory holding them.
+% [C,S,a,c]=getEGMGravCoeffs();
+% saveSpherHarmonicCoeffs('EGM2008.shcb',C,S,a,c);
+%Later, in any process,
+% model=spherHarmonicModel('EGM2008.shcb',360);
+%is the same as the model above.
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+properties(Access=private)
+   C%The coefficients. These are only used if there is no C++
+   S%implementation.
+   a
+   c
+   scalFactor
+
+   CPPData%Only used if an interface to a C++ implementation exists.
+end
+
+methods
+    function newModel=spherHarmonicModel(C,S,a,c,scalFactor)
+    %%SPHERHARMONICMODEL Construct a new spherical harmonic model.
+    %
+    %INPUTS: C, S Length (M+2)*(M+1)/2 real arrays holding the fully
+    %             normalized coefficients that are multiplied by cosines
+    %             and sines in the harmonic expansion. These are the same
+    %             as in spherHarmonicEval. If CountingClusterSet objects
+    %             are passed, their clusterEls are used.
+    %           a The numerator in the (a/r)^n term in the spherical
+    %             harmonic sum. If omitted or an empty matrix is passed,
+    %             Constants.EGM2008SemiMajorAxis is used. Use a=1 for
+    %             terrain models.
+    %           c The constant value by which the spherical harmonic series
+    %             is multiplied. If omitted or an empty matrix is passed,
+    %             Constants.EGM2008GM is used. Use c=1 for terrain models.
+    %  scalFactor The scale factor used in computing the normalized
+    %             associated Legendre polynomials. The default if omitted
+    %             or an empty matrix is passed is 10^(-280).
+    %
+    %OUTPUTS: newModel A new spherHarmonicModel instance.
+    %
+    %Alternatively, the model can be loaded from a file using the syntax
+    %spherHarmonicModel(fileName,M,scalFactor), where fileName is the name
+    %of a file written by saveSpherHarmonicCoeffs, M is the maximum degree
+    %to use, which is all of the degrees in the file if omitted or an empty
+    %matrix is passed, and scalFactor is the same as above. The values of a
+    %and c are those saved in the file.
+
+        if(ischar(C))
+            fileName=C;
+
+            M=Inf;
+            if(nargin>1&&~isempty(S))
+                M=S;
+            end
+
+            scalFactor=10^(-280);
+            if(nargin>2&&~isempty(a))
+                scalFactor=a;
+            end
+
+            if(exist('spherHarmonicModelCPPInt','file'))
+                newModel.CPPData=spherHarmonicModelCPPInt('load',fileName,M,scalFactor);
+            else
+                [newModel.C,newModel.S,newModel.a,newModel.c]=loadSpherHarmonicCoeffs(fileName,M);
+                newModel.scalFactor=scalFactor;
+            end
+            return;
+        end
+
+        if(nargin<5||isempty(scalFactor))
+            scalFactor=10^(-280);
+        end
+
+        if(nargin<4||isempty(c))
+            c=Constants.EGM2008GM;
+        end
+
+        if(nargin<3||isempty(a))
+            a=Constants.EGM2008SemiMajorAxis;
+        end
+
+        if(isa(C,'CountingClusterSet'))
+            C=C.clusterEls;
+        end
+
+        if(isa(S,'CountingClusterSet'))
+            S=S.clusterEls;
+        end
+
+        if(~isreal(C)||~isreal(S)||~isreal(a)||~isreal(c))
+            error('Only real spherical harmonic models are supported.')
+        end
+
+        if(exist('spherHarmonicModelCPPInt','file'))
+            newModel.CPPData=spherHarmonicModelCPPInt('spherHarmonicModelCPP',C(:),S(:),a,c,scalFactor);
+        else
+            newModel.C=C(:);
+            newModel.S=S(:);
+            newModel.a=a;
+            newModel.c=c;
+            newModel.scalFactor=scalFactor;
+        end
+    end
+
+    function M=getM(theModel)
+    %%GETM Get the maximum degree of the model.
+
+        if(exist('spherHarmonicModelCPPInt','file'))
+            M=spherHarmonicModelCPPInt('getM',theModel.CPPData);
+        else
+            M=(-3+sqrt(1+8*length(theModel.C)))/2;
+        end
+    end
+
+    function [V,gradV,HessianV,degreeUsed]=evaluate(theModel,point,systemType,spherDerivs,algorithm,numThreads,truncTol)
+    %%EVALUATE Evaluate the potential and optionally its gradient and
+    %          Hessian at a set of points.
+    %
+    %INPUTS: point The 3XN set of N points given in spherical coordinates
+    %              consisting of [r;azimuth;elevation] or a 2XN set of
+    %              [azimuth;elevation] points, for which r=1 is used, as
+    %              is done with terrain models. The inputs systemType,
+    %              spherDerivs, algorithm, numThreads and truncTol are
+    %              optional and are the same as in spherHarmonicEval,
+    %              including the defaults.
+    %
+    %OUTPUTS: V, gradV, HessianV, degreeUsed The potential, gradient,
+    %              Hessian and degrees used as returned by
+    %              spherHarmonicEval.
+    %
+    %The gradient and Hessian are only computed if they are requested.
+
+        if(nargin<7||isempty(truncTol))
+            truncTol=0;
+        end
+
+        if(nargin<6||isempty(numThreads))
+            numThreads=1;
+        end
+
+        if(nargin<5||isempty(algorithm))
+            algorithm=0;
+        end
+
+        if(nargin<4||isempty(spherDerivs))
+            spherDerivs=false;
+        end
+
+        if(nargin<3||isempty(systemType))
+            systemType=0;
+        end
+
+        if(exist('spherHarmonicModelCPPInt','file'))
+            switch(nargout)
+                case {0,1}
+                    V=spherHarmonicModelCPPInt('evaluate',theModel.CPPData,point,systemType,spherDerivs,algorithm,numThreads,truncTol);
+                case 2
+                    [V,gradV]=spherHarmonicModelCPPInt('evaluate',theModel.CPPData,point,systemType,spherDerivs,algorithm,numThreads,truncTol);
+                case 3
+                    [V,gradV,HessianV]=spherHarmonicModelCPPInt('evaluate',theModel.CPPData,point,systemType,spherDerivs,algorithm,numThreads,truncTol);
+                otherwise
+                    [V,gradV,HessianV,degreeUsed]=spherHarmonicModelCPPInt('evaluate',theModel.CPPData,point,systemType,spherDerivs,algorithm,numThreads,truncTol);
+            end
+        else
+            if(size(point,1)==2)
+                point=[ones(1,size(point,2));point];
+            end
+
+            switch(nargout)
+                case {0,1}
+                    V=spherHarmonicEval(theModel.C,theModel.S,point,theModel.a,theModel.c,systemType,spherDerivs,theModel.scalFactor,algorithm,numThreads,truncTol);
+                case 2
+                    [V,gradV]=spherHarmonicEval(theModel.C,theModel.S,point,theModel.a,theModel.c,systemType,spherDerivs,theModel.scalFactor,algorithm,numThreads,truncTol);
+                case 3
+                    [V,gradV,HessianV]=spherHarmonicEval(theModel.C,theModel.S,point,theModel.a,theModel.c,systemType,spherDerivs,theModel.scalFactor,algorithm,numThreads,truncTol);
+                otherwise
+                    [V,gradV,HessianV,degreeUsed]=spherHarmonicEval(theModel.C,theModel.S,point,theModel.a,theModel.c,systemType,spherDerivs,theModel.scalFactor,algorithm,numThreads,truncTol);
+            end
+        end
+    end
+
+    function delete(theModel)
+    %%DELETE The destructor method. This method is used when the model is
+    %        implemented as a C++ class. This method prevents a memory
+    %        leak.
+
+        if(exist('spherHarmonicModelCPPInt','file')&&~isempty(theModel.CPPData))
+            spherHarmonicModelCPPInt('~spherHarmonicModelCPP',theModel.CPPData);
+        end
+    end
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
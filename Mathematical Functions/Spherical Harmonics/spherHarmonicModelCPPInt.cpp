@@ -0,0 +1,236 @@
+/**SPHERHARMONICMODELCPPINT An interface between the Matlab
+ *              spherHarmonicModel class and the C++ spherHarmonicModelCPP
+ *              class. This function is meant to be called by the
+ *              spherHarmonicModel class in Matlab; not directly by the
+ *              user.
+ *
+ *As the data of the true C++ class is stored in the CPPData input that is
+ *passed to this function, passing garbage for the CPPData input can cause
+ *Matlab to crash.
+ *
+ *The function is called as
+ *newModel.CPPData=spherHarmonicModelCPPInt('spherHarmonicModelCPP',C,S,a,c,scalFactor);
+ *or
+ *newModel.CPPData=spherHarmonicModelCPPInt('load',fileName,M,scalFactor);
+ *where M=Inf uses all of the coefficients in the file, or
+ *M=spherHarmonicModelCPPInt('getM',CPPData);
+ *or
+ *[V,gradV,HessianV,degreeUsed]=spherHarmonicModelCPPInt('evaluate',CPPData,point,systemType,spherDerivs,algorithm,numThreads,truncTol);
+ *or
+ *spherHarmonicModelCPPInt('~spherHarmonicModelCPP',CPPData);
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For strcmp
+#include <cstring>
+//Needed for sqrt
+#include <cmath>
+#include "matrix.h"
+#include "mex.h"
+#include "MexValidation.h"
+#include "spherHarmonicModelCPP.hpp"
+
+void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
+    char cmd[64];
+    spherHarmonicModelCPP *theModel;
+
+    if(nrhs<2||nrhs>8) {
+        mexErrMsgTxt("Wrong number of inputs.");
+    }
+
+    //Get the command string that is passed.
+    mxGetString(prhs[0], cmd, sizeof(cmd));
+
+    if(!strcmp("spherHarmonicModelCPP", cmd)){
+        size_t M, totalNumEls;
+        double a, c, scalFactor;
+        mxArray *retPtr;
+
+        if(nrhs!=6) {
+            mexErrMsgTxt("Wrong number of inputs.");
+        }
+
+        checkRealDoubleArray(prhs[1]);
+        checkRealDoubleArray(prhs[2]);
+        if(mxIsEmpty(prhs[1])||mxIsEmpty(prhs[2])||mxGetM(prhs[1])!=mxGetM(prhs[2])||mxGetN(prhs[1])!=mxGetN(prhs[2])) {
+            mexErrMsgTxt("Invalid data passed.");
+        }
+
+        //Since the total number of points in a CountingClusterSetCPP
+        //is (M+1)*(M+2)/2, where M is the number of clusters -1, we can
+        //easily verify that a valid number of points was passed.
+        totalNumEls=mxGetM(prhs[1])*mxGetN(prhs[1]);
+        M=(-3+static_cast<size_t>(sqrt(static_cast<double>(1+8*totalNumEls))))/2;
+        if((M+1)*(M+2)/2!=totalNumEls) {
+            mexErrMsgTxt("S and C contain an inconsistent number of elements.");
+        }
+
+        a=getDoubleFromMatlab(prhs[3]);
+        c=getDoubleFromMatlab(prhs[4]);
+        scalFactor=getDoubleFromMatlab(prhs[5]);
+
+        theModel=new spherHarmonicModelCPP(mxGetPr(prhs[1]),mxGetPr(prhs[2]),M,a,c,scalFactor);
+
+        //Convert the pointer to a Matlab matrix to return.
+        retPtr=ptr2Matlab<spherHarmonicModelCPP*>(theModel);
+
+        //Lock this mex file so that it can not be cleared until the object
+        //has been deleted (This avoids a memory leak).
+        mexLock();
+        //Return the pointer to the model
+        plhs[0]=retPtr;
+    } else if(!strcmp("load",cmd)) {
+        char *fileName;
+        size_t MMax;
+        double scalFactor;
+
+        if(nrhs!=4||!mxIsChar(prhs[1])) {
+            mexErrMsgTxt("A file name must be given.");
+        }
+
+        if(mxIsInf(getDoubleFromMatlab(prhs[2]))) {
+            MMax=static_cast<size_t>(-1);
+        } else {
+            MMax=getSizeTFromMatlab(prhs[2]);
+        }
+        scalFactor=getDoubleFromMatlab(prhs[3]);
+
+        fileName=mxArrayToString(prhs[1]);
+        theModel=spherHarmonicModelCPP::fromFile(fileName,MMax,scalFactor);
+        mxFree(fileName);
+
+        if(theModel==NULL) {
+            mexErrMsgTxt("The file could not be opened or is not a valid coefficient file for this computer.");
+        }
+
+        plhs[0]=ptr2Matlab<spherHarmonicModelCPP*>(theModel);
+        mexLock();
+    } else if(!strcmp("evaluate",cmd)) {
+        size_t numPoints, pointDim, systemType, algorithm, numThreads;
+        double truncTol;
+        bool spherDerivs;
+        double *point, *pointCopy=NULL;
+        mxArray *VMATLAB;
+        mxArray *gradVMATLAB=NULL;
+        mxArray *HessianVMATLAB=NULL;
+        double *gradV=NULL;
+        double *HessianV=NULL;
+        size_t *degreeUsed=NULL;
+
+        if(nrhs!=8) {
+            mexErrMsgTxt("Wrong number of inputs.");
+        }
+
+        if(nlhs>4) {
+            mexErrMsgTxt("Invalid number of outputs.");
+        }
+
+        //Get the pointer back from Matlab.
+        theModel=Matlab2Ptr<spherHarmonicModelCPP*>(prhs[1]);
+
+        pointDim=mxGetM(prhs[2]);
+        if((pointDim!=3&&pointDim!=2)||mxIsEmpty(prhs[2])) {
+            mexErrMsgTxt("The points have an incorrect dimensionality.");
+        }
+
+        checkRealDoubleArray(prhs[2]);
+        numPoints=mxGetN(prhs[2]);
+        point=mxGetPr(prhs[2]);
+        if(pointDim==2) {
+            //Add a range component if one was not provided.
+            pointCopy=new double[3*numPoints];
+            for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+                pointCopy[3*curPoint]=1;
+                pointCopy[3*curPoint+1]=point[2*curPoint];
+                pointCopy[3*curPoint+2]=point[2*curPoint+1];
+            }
+            point=pointCopy;
+        }
+
+        systemType=getSizeTFromMatlab(prhs[3]);
+        if(systemType!=0&&systemType!=2) {
+            mexErrMsgTxt("An unsupported systemType was specified.");
+        }
+
+        spherDerivs=getBoolFromMatlab(prhs[4]);
+
+        algorithm=getSizeTFromMatlab(prhs[5]);
+        if(algorithm>2) {
+            mexErrMsgTxt("Unknown algorithm option specified.");
+        }
+
+        numThreads=getSizeTFromMatlab(prhs[6]);
+        truncTol=getDoubleFromMatlab(prhs[7]);
+
+        //Allocate space for the return values
+        VMATLAB=mxCreateDoubleMatrix(numPoints,1,mxREAL);
+        if(nlhs>1) {
+            gradVMATLAB=mxCreateDoubleMatrix(3,numPoints,mxREAL);
+            gradV=mxGetPr(gradVMATLAB);
+
+            if(nlhs>2) {
+                mwSize dims[3];
+
+                dims[0]=3;
+                dims[1]=3;
+                dims[2]=numPoints;
+
+                HessianVMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+                HessianV=mxGetPr(HessianVMATLAB);
+
+                if(nlhs>3) {
+                    degreeUsed=new size_t[numPoints];
+                }
+            }
+        }
+
+        theModel->evaluate(mxGetPr(VMATLAB),gradV,HessianV,degreeUsed,point,numPoints,systemType,spherDerivs,algorithm,numThreads,truncTol);
+
+        plhs[0]=VMATLAB;
+        if(nlhs>1) {
+            plhs[1]=gradVMATLAB;
+            if(nlhs>2) {
+                plhs[2]=HessianVMATLAB;
+                if(nlhs>3) {
+                    plhs[3]=sizeTMat2MatlabDoubles(degreeUsed,numPoints,1);
+                    delete[] degreeUsed;
+                }
+            }
+        }
+
+        if(pointCopy!=NULL) {
+            delete[] pointCopy;
+        }
+    } else if(!strcmp("~spherHarmonicModelCPP", cmd)){
+        theModel=Matlab2Ptr<spherHarmonicModelCPP*>(prhs[1]);
+
+        delete theModel;
+        //Unlock the mex file allowing it to be cleared.
+        mexUnlock();
+    } else if(!strcmp("getM", cmd)) {
+        theModel=Matlab2Ptr<spherHarmonicModelCPP*>(prhs[1]);
+        plhs[0]=unsignedSizeMat2Matlab(&(theModel->M),1,1);
+    } else {
+        mexErrMsgTxt("Invalid string passed to spherHarmonicModelCPPInt.");
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
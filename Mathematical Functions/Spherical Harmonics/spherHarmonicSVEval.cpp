@@ -0,0 +1,218 @@
+/**SPHERHARMONICSVEVAL A mex file implementation of the function
+ *                   spherHarmonicSVEval. See the comments to the Matlab
+ *                   implementation for more details.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The function is called in Matlab using the format:
+ *[V,gradV,HessianV]=spherHarmonicSVEval(C,S,CDot,SDot,deltaT,point,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+ *or using
+ *[V]=spherHarmonicSVEval(C,S,CDot,SDot,deltaT,point,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+ *if one only wants the potential. The function executes faster if only the
+ *potential and not the gradient and Hessian need be computed.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "matrix.h"
+#include "mex.h"
+/* This header validates inputs and includes a header needed to handle
+ * Matlab matrices.*/
+#include "MexValidation.h"
+#include "mathFuncs.hpp"
+//Needed for sqrt
+#include <cmath>
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    double a, c, scalFactor;
+    bool spherDerivs;
+    size_t algorithm, numThreads, systemType;
+    double *point, *pointCopy=NULL;
+    CountingClusterSetCPP<double> C, S, CDot, SDot;
+    size_t numPoints, pointDim, M, totalNumEls;
+    mxArray *VMATLAB;
+    mxArray *gradVMATLAB=NULL;
+    mxArray *HessianVMATLAB=NULL;
+    double *gradV=NULL;
+    double *HessianV=NULL;
+
+    if(nrhs<6||nrhs>13) {
+        mexErrMsgTxt("Wrong number of inputs.");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Invalid number of outputs.");
+    }
+
+    //Check the validity of the coefficients. All four sets must have the
+    //same number of elements.
+    totalNumEls=mxGetM(prhs[0])*mxGetN(prhs[0]);
+    for(size_t curIn=0;curIn<4;curIn++) {
+        checkRealDoubleArray(prhs[curIn]);
+        if(mxIsEmpty(prhs[curIn])||mxGetM(prhs[curIn])*mxGetN(prhs[curIn])!=totalNumEls) {
+            mexErrMsgTxt("Invalid data passed.");
+        }
+    }
+
+    //Since the total number of points in a CountingClusterSetCPP
+    //is (M+1)*(M+2)/2, where M is the number of clusters -1, we can easily
+    //verify that a valid number of points was passed.
+    M=(-3+static_cast<size_t>(sqrt(static_cast<double>(1+8*totalNumEls))))/2;
+    if((M+1)*(M+2)/2!=totalNumEls) {
+        mexErrMsgTxt("The coefficients contain an inconsistent number of elements.");
+    }
+
+    //The coefficients are used in place, so these do not own their
+    //memory.
+    C.numClust=M+1;
+    C.totalNumEl=totalNumEls;
+    C.clusterEls=mxGetPr(prhs[0]);
+    S.numClust=M+1;
+    S.totalNumEl=totalNumEls;
+    S.clusterEls=mxGetPr(prhs[1]);
+    CDot.numClust=M+1;
+    CDot.totalNumEl=totalNumEls;
+    CDot.clusterEls=mxGetPr(prhs[2]);
+    SDot.numClust=M+1;
+    SDot.totalNumEl=totalNumEls;
+    SDot.clusterEls=mxGetPr(prhs[3]);
+
+    //Get the points.
+    pointDim=mxGetM(prhs[5]);
+    if((pointDim!=3&&pointDim!=2)||mxIsEmpty(prhs[5])) {
+        mexErrMsgTxt("The points have an incorrect dimensionality.");
+    }
+
+    checkRealDoubleArray(prhs[5]);
+    numPoints=mxGetN(prhs[5]);
+    point=mxGetPr(prhs[5]);
+    if(pointDim==2) {
+        //Add a range component if one was not provided.
+        pointCopy=new double[3*numPoints];
+        for(size_t curPoint=0;curPoint<numPoints;curPoint++) {
+            pointCopy[3*curPoint]=1;
+            pointCopy[3*curPoint+1]=point[2*curPoint];
+            pointCopy[3*curPoint+2]=point[2*curPoint+1];
+        }
+        point=pointCopy;
+    }
+
+    //The times of the points.
+    checkRealDoubleArray(prhs[4]);
+    if(mxGetM(prhs[4])*mxGetN(prhs[4])!=numPoints) {
+        if(pointCopy!=NULL) {
+            delete[] pointCopy;
+        }
+        mexErrMsgTxt("deltaT must have one element for each point.");
+    }
+
+    if(nrhs<7||mxIsEmpty(prhs[6])) {
+        if(pointDim==2) {
+            a=1;
+        } else {
+            a=getScalarMatlabClassConst("Constants", "EGM2008SemiMajorAxis");
+        }
+    } else {
+        a=getDoubleFromMatlab(prhs[6]);
+    }
+
+    if(nrhs<8||mxIsEmpty(prhs[7])) {
+        if(pointDim==2) {
+            c=1;
+        } else {
+            c=getScalarMatlabClassConst("Constants", "EGM2008GM");
+        }
+    } else {
+        c=getDoubleFromMatlab(prhs[7]);
+    }
+
+    if(nrhs<9||mxIsEmpty(prhs[8])) {
+        systemType=0;
+    } else {
+        systemType=getSizeTFromMatlab(prhs[8]);
+    }
+
+    if(systemType!=0&&systemType!=2) {
+        mexErrMsgTxt("An unsupported systemType was specified.");
+    }
+
+    if(nrhs<10||mxIsEmpty(prhs[9])) {
+        spherDerivs=false;
+    } else {
+        spherDerivs=getBoolFromMatlab(prhs[9]);
+    }
+
+    if(nrhs<11||mxIsEmpty(prhs[10])) {
+        scalFactor=1e-280;
+    } else {
+        scalFactor=getDoubleFromMatlab(prhs[10]);
+    }
+
+    if(nrhs<12||mxIsEmpty(prhs[11])) {
+        algorithm=0;
+    } else {
+        algorithm=getSizeTFromMatlab(prhs[11]);
+    }
+
+    if(algorithm>2) {
+        mexErrMsgTxt("Unknown algorithm option specified.");
+    }
+
+    if(nrhs<13||mxIsEmpty(prhs[12])) {
+        numThreads=1;
+    } else {
+        numThreads=getSizeTFromMatlab(prhs[12]);
+    }
+
+    //Allocate space for the return values
+    VMATLAB=mxCreateDoubleMatrix(numPoints,1,mxREAL);
+    if(nlhs>1) {
+        gradVMATLAB=mxCreateDoubleMatrix(3,numPoints,mxREAL);
+        gradV=mxGetPr(gradVMATLAB);
+
+        if(nlhs>2) {
+            mwSize dims[3];
+
+            dims[0]=3;
+            dims[1]=3;
+            dims[2]=numPoints;
+
+            HessianVMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+            HessianV=mxGetPr(HessianVMATLAB);
+        }
+    }
+
+    spherHarmonicSVEvalCPPReal(mxGetPr(VMATLAB),gradV,HessianV,C,S,CDot,SDot,mxGetPr(prhs[4]),point,numPoints,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
+
+    plhs[0]=VMATLAB;
+    if(nlhs>1) {
+        plhs[1]=gradVMATLAB;
+        if(nlhs>2) {
+            plhs[2]=HessianVMATLAB;
+        }
+    }
+
+    if(pointCopy!=NULL) {
+        delete[] pointCopy;
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
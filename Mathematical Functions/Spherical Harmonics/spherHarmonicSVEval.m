@@ -0,0 +1,174 @@
+function [V,gradV,HessianV]=spherHarmonicSVEval(C,S,CDot,SDot,deltaT,point,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads)
+%%SPHERHARMONICSVEVAL Evaluate a real potential, its gradient and its
+%                   Hessian when the potential is expressed in terms of
+%                   spherical harmonic coefficients that change linearly
+%                   over time, as in magnetic field models with secular
+%                   variation, and each point has its own time. This is the
+%                   same as calling spherHarmonicEval separately for each
+%                   point with the coefficients C+deltaT*CDot and
+%                   S+deltaT*SDot, but it is much faster when the points
+%                   have many different times.
+%
+%INPUTS: C A length (M+2)*(M+1)/2 real array holding the fully normalized
+%          coefficients that are multiplied by cosines in the harmonic
+%          expansion at the reference time. The requirements on C are the
+%          same as in spherHarmonicEval. If a CountingClusterSet is passed,
+%          its clusterEls are used.
+%        S The coefficients that are multiplied by sines in the harmonic
+%          expansion at the reference time. The requirements on S are the
+%          same as those on C.
+%  CDot, SDot The rates of change of C and S per unit of deltaT. These
+%          must have the same number of elements as C and S. For example,
+%          the secular variation terms returned by getWMMCoeffs are per
+%          year.
+%   deltaT A length N array of the times of the points minus the reference
+%          time of C and S in the units of the rates, such as years.
+%    point The 3XN set of N real points at which the potential and/or
+%          gradient should be evaluated given in SPHERICAL coordinates
+%          consisting of [r;azimuth;elevation]. As in spherHarmonicEval,
+%          2XN points of the form [azimuth;elevation] can also be given.
+%        a The numerator in the (a/r)^n term in the spherical harmonic sum.
+%          If this parameter is omitted or an empty matrix is passed,
+%          a=Constants.EGM2008SemiMajorAxis is used unless point is 2D, in
+%          which case a=1 is used.
+%        c The constant value by which the spherical harmonic series is
+%          multiplied. If this parameter is omitted or an empty matrix is
+%          passed, c=Constants.EGM2008GM is used unless point is 2D, in
+%          which case c=1 is used.
+% systemType, spherDerivs, scalFactor, algorithm These optional parameters
+%          are the same as in spherHarmonicEval and have the same
+%          defaults.
+% numThreads An optional parameter specifying the number of threads to use
+%          when evaluating the points in the compiled version of this
+%          function. Zero means that the number of hardware threads
+%          available is used. The default if omitted or an empty matrix is
+%          passed is 1. This parameter is ignored by the Matlab
+%          implementation.
+%
+%OUTPUTS: V The NX1 vector of potentials at the points at their times.
+%     gradV The 3XN set of gradients of the potential. The ordering of the
+%           derivatives is the same as in spherHarmonicEval.
+%  HessianV The 3X3XN set of Hessian matrices of the potential. The
+%           ordering of the derivatives is the same as in
+%           spherHarmonicEval.
+%
+%The potential, gradient and Hessian are linear in the coefficients, so
+%their values at a point with time offset deltaT are those found using C
+%and S plus deltaT times those found using CDot and SDot. Both sets are
+%evaluated at once with spherHarmonicSetEval, so that the Legendre
+%functions and other terms that only depend on the location of a point
+%are only computed once. No coefficients for a particular time are formed.
+%
+%Models such as the IGRF are only linear between the epochs at which
+%coefficients are given. Points spanning several epochs can be evaluated
+%by grouping them by interval and calling this function once per group
+%with the coefficients and rates of that interval.
+%
+%EXAMPLE:
+%Here, the magnetic potential of the WMM is found at points spread over
+%five years and is compared to evaluating the coefficients for each time
+%separately.
+% [C,S,a,c,CDot,SDot]=getWMMCoeffs(2015);
+% N=100;
+% years=linspace(2015,2020,N);
+% point=[a+1e6*rand(1,N);2*pi*rand(1,N);pi*(rand(1,N)-1/2)];
+% V=spherHarmonicSVEval(C,S,CDot,SDot,years-2015,point,a,c);
+% VDirect=zeros(N,1);
+% for k=1:N
+%     [CCur,SCur]=getWMMCoeffs(years(k));
+%     VDirect(k)=spherHarmonicEval(CCur,SCur,point(:,k),a,c);
+% end
+% max(abs(V-VDirect)./abs(VDirect))
+%The relative difference is on the order of finite precision errors.
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+if(nargin<12||isempty(algorithm))
+    algorithm=0;
+end
+
+if(nargin<11||isempty(scalFactor))
+    scalFactor=10^(-280);
+end
+
+if(nargin<10||isempty(spherDerivs))
+    spherDerivs=false;
+end
+
+if(nargin<9||isempty(systemType))
+    systemType=0;
+end
+
+if(nargin<8)
+    c=[];
+end
+
+if(nargin<7)
+    a=[];
+end
+
+if(isa(C,'CountingClusterSet'))
+    C=C.clusterEls;
+end
+
+if(isa(S,'CountingClusterSet'))
+    S=S.clusterEls;
+end
+
+if(isa(CDot,'CountingClusterSet'))
+    CDot=CDot.clusterEls;
+end
+
+if(isa(SDot,'CountingClusterSet'))
+    SDot=SDot.clusterEls;
+end
+
+if(numel(CDot)~=numel(C)||numel(SDot)~=numel(C)||numel(S)~=numel(C))
+    error('C, S, CDot and SDot must have the same number of elements.')
+end
+
+numPoints=size(point,2);
+if(numel(deltaT)~=numPoints)
+    error('deltaT must have one element for each point.')
+end
+deltaT=deltaT(:).';
+
+%Set 1 holds the coefficients at the reference time and set 2 the rates.
+switch(nargout)
+    case {0,1}
+        VSet=spherHarmonicSetEval([C(:),CDot(:)],[S(:),SDot(:)],point,a,c,systemType,spherDerivs,scalFactor,algorithm);
+    case 2
+        [VSet,gradVSet]=spherHarmonicSetEval([C(:),CDot(:)],[S(:),SDot(:)],point,a,c,systemType,spherDerivs,scalFactor,algorithm);
+    otherwise
+        [VSet,gradVSet,HessianVSet]=spherHarmonicSetEval([C(:),CDot(:)],[S(:),SDot(:)],point,a,c,systemType,spherDerivs,scalFactor,algorithm);
+end
+
+V=(VSet(1,:)+deltaT.*VSet(2,:)).';
+
+if(nargout>1)
+    gradV=reshape(gradVSet(:,1,:)+bsxfun(@times,reshape(deltaT,[1,1,numPoints]),gradVSet(:,2,:)),[3,numPoints]);
+
+    if(nargout>2)
+        HessianV=reshape(HessianVSet(:,:,1,:)+bsxfun(@times,reshape(deltaT,[1,1,1,numPoints]),HessianVSet(:,:,2,:)),[3,3,numPoints]);
+    end
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -6,9 +6,9 @@
  *CompileCLibraries function.
  *
  *The function is called in Matlab using the format:
- *[V,gradV,HessianV]=spherHarmonicSetEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm);
+ *[V,gradV,HessianV]=spherHarmonicSetEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
  *or using 
- *[V]=spherHarmonicSetEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm);
+ *[V]=spherHarmonicSetEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads);
  *if one only wants the potential. The function executes faster if only the
  *potential and not the gradient and Hessian need be computed.
  *
@@ -32,7 +32,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     double scalFactor;
     std::complex <double> a,c;
     bool spherDerivs;
-    size_t algorithm;
+    size_t algorithm, numThreads;
     double *point, *pointCopy=NULL;
     CountingClusterSetVecCPP<double> CReal;
     CountingClusterSetVecCPP<double> SReal;
@@ -57,7 +57,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     //example, if S is real and C is complex.
     double *buffer=NULL;
     
-    if(nrhs<3||nrhs>9) {
+    if(nrhs<3||nrhs>10) {
         mexErrMsgTxt("Wrong number of inputs.");
     }
     
@@ -131,7 +131,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
 
         curCopyPoint=pointCopy;
         curOrigPoint=point;
-        for(curPoint=1;curPoint<numPoints;curPoint++) {
+        for(curPoint=0;curPoint<numPoints;curPoint++) {
             *(curCopyPoint)=1;
             *(curCopyPoint+1)=*(curOrigPoint);
             *(curCopyPoint+2)=*(curOrigPoint+1);
@@ -196,6 +196,12 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     if(algorithm>2) {
         mexErrMsgTxt("Unknown algorithm option specified.");
     }
+
+    if(nrhs<10||mxIsEmpty(prhs[9])) {
+        numThreads=1;
+    } else {
+        numThreads=getSizeTFromMatlab(prhs[9]);
+    }
     
     //Allocate space for the return values
     if(useComplexAlg) {
@@ -259,9 +265,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     }
 
     if(useComplexAlg) {
-        spherHarmonicSetEvalCPPComplex(VReal, VImag, gradVReal, gradVImag, HessianVReal, HessianVImag, CReal, CImag, SReal, SImag, point, numPoints, a, c, systemType, spherDerivs,scalFactor,algorithm);
+        spherHarmonicSetEvalCPPComplex(VReal, VImag, gradVReal, gradVImag, HessianVReal, HessianVImag, CReal, CImag, SReal, SImag, point, numPoints, a, c, systemType, spherDerivs,scalFactor,algorithm,numThreads);
     } else {
-        spherHarmonicSetEvalCPPReal(VReal,gradVReal,HessianVReal,CReal,SReal,point,numPoints,real(a),real(c),systemType, spherDerivs,scalFactor,algorithm);
+        spherHarmonicSetEvalCPPReal(VReal,gradVReal,HessianVReal,CReal,SReal,point,numPoints,real(a),real(c),systemType, spherDerivs,scalFactor,algorithm,numThreads);
     }
 
     plhs[0]=VMATLAB;
@@ -273,7 +279,7 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     }
     
     if(pointCopy!=NULL) {
-        mxFree(pointCopy);
+        delete[] pointCopy;
     }
     
     if(buffer!=NULL) {
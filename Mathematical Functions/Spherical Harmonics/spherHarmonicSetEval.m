@@ -1,4 +1,4 @@
-function [V,gradV,HessianV]=spherHarmonicSetEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm)
+function [V,gradV,HessianV]=spherHarmonicSetEval(C,S,point,a,c,systemType,spherDerivs,scalFactor,algorithm,numThreads)
 %%SPHERHARMONICSETEVAL Evaluate a set of real or complex potentials,
 %                   gradients and Hessians when the potentials are
 %                   expressed in terms of a set of real or complex
@@ -32,7 +32,10 @@ function [V,gradV,HessianV]=spherHarmonicSetEval(C,S,point,a,c,systemType,spherD
 %          consisting of [r;azimuth;elevation]; When evaluating points on a
 %          grid, the algorithm will be fastest if the points are provided
 %          presorted by range and then by azimuth. This reduces the amount
-%          of recomputation of certain values. Alternatively, if C and S
+%          of recomputation of certain values. The compiled version of this
+%          function internally evaluates the points sorted by elevation and
+%          range when that reduces the recomputation, so presorting mostly
+%          matters for the Matlab implementation. Alternatively, if C and S
 %          are for evaluating terrain heights, then points are 2XN having
 %          the format [azimuth;elevation] and it is best if the points are
 %          sorted by azimuth. Azimuth is measured counterclockwise from the
@@ -91,6 +94,14 @@ function [V,gradV,HessianV]=spherHarmonicSetEval(C,S,point,a,c,systemType,spherD
 %            the points. Note that the gradient is singular at the poles,
 %            so numerical problems will arise.
 %          2 Only use Pines' algorithm.
+% numThreads An optional parameter specifying the number of threads to use
+%          when evaluating the points in the compiled version of this
+%          function. Zero means that the number of hardware threads
+%          available is used. The default if omitted or an empty matrix is
+%          passed is 1. The points are split into contiguous chunks, one per
+%          thread, so that consecutive points with the same elevation are
+%          kept together as much as possible. This parameter is ignored by
+%          the Matlab implementation.
 %
 %OUTPUTS: V The numSetsXN scalar potentials as obtained from the spherical
 %           harmonic series for each set and point. This is real is all of
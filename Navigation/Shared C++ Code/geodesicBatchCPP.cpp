@@ -0,0 +1,254 @@
+/**GEODESICBATCHCPP Functions to solve many geodetic problems at once using
+ *            GeographicLib. The problems are split into contiguous chunks,
+ *            one per thread, and each thread constructs its own Geodesic
+ *            (or GeodesicExact) object. As in indirectGeodeticProb, the
+ *            Geodesic class is used when |f|<=0.01 and the GeodesicExact
+ *            class otherwise.
+ *
+ *All latitudes, longitudes and azimuths are in radians and distances are
+ *in meters. Sets of points are 2XN matrices of [latitude;longitude] stored
+ *by column as in Matlab. numThreads=0 means that the number of hardware
+ *threads is used.
+ *
+ *indirectGeodeticAllPairsCPP solves the problem between every starting
+ *point and every ending point, storing the results in numStartXnumEnd
+ *matrices by column. If maxDist is finite, then pairs whose straight-line
+ *(chord) distance through the Earth between the points on the reference
+ *ellipsoid exceeds maxDist are skipped, since the geodesic distance can be
+ *no shorter than the chord. Skipped pairs have dist=Inf and NaN azimuths.
+ *The chords are found from ECEF points computed once for each input point,
+ *so the test costs a few multiplications per pair.
+ *
+ *geodesicPathPointsCPP finds numPtsPerPath points equally spaced in
+ *distance along the geodesic between each pair of starting and ending
+ *points, including the endpoints. A GeodesicLine is constructed once per
+ *path and the points are then found from it, which avoids solving a new
+ *geodetic problem for each point. The points are stored as 2XnumPtsPerPathX
+ *numPaths matrices.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "geodesicFuncs.hpp"
+//For wrapRangeCPP and wrapRangeMirrorCPP.
+#include "mathFuncs.hpp"
+#include "runChunksCPP.hpp"
+//For fabs, sqrt, sin, cos and isfinite.
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <vector>
+
+#include <GeographicLib/Geodesic.hpp>
+#include <GeographicLib/GeodesicExact.hpp>
+#include <GeographicLib/GeodesicLine.hpp>
+#include <GeographicLib/GeodesicLineExact.hpp>
+
+using namespace GeographicLib;
+
+//Each geodetic problem takes on the order of a microsecond, so each
+//thread gets at least a few hundred of them.
+static const size_t minProbsPerThread=256;
+
+/*Solve one indirect problem. GeographicLib takes the values in degrees
+ *and requires the latitudes to be between -90 and 90 degrees.*/
+template<class GeodT>
+static void indirectGeodeticOne(const GeodT &geod, double &azStart, double &dist, double &azEnd, const double *latLon1, const double *latLon2) {
+    const double pi=3.1415926535897932384626433832795;
+    const double lat1=wrapRangeMirrorCPP(latLon1[0]*(180.0/pi),-90,90);
+    const double lon1=wrapRangeCPP(latLon1[1]*(180.0/pi),-180,180);
+    const double lat2=wrapRangeMirrorCPP(latLon2[0]*(180.0/pi),-90,90);
+    const double lon2=wrapRangeCPP(latLon2[1]*(180.0/pi),-180,180);
+    double s12,azi1,azi2;
+
+    geod.Inverse(lat1, lon1, lat2, lon2, s12, azi1, azi2);
+
+    azStart=azi1*(pi/180.0);
+    dist=s12;
+    azEnd=azi2*(pi/180.0);
+}
+
+template<class GeodT>
+static void indirectGeodeticBatch(double *azStart, double *dist, double *azEnd, const double *latLonStart, const double *latLonEnd, const size_t numPoints, const double a, const double f, const size_t numThreads) {
+    runChunksCPP(numPoints,numThreads,minProbsPerThread,[=](const size_t startIdx, const size_t endIdx) {
+        const GeodT geod(a,f);
+
+        for(size_t curPoint=startIdx;curPoint<endIdx;curPoint++) {
+            indirectGeodeticOne(geod,azStart[curPoint],dist[curPoint],azEnd[curPoint],latLonStart+2*curPoint,latLonEnd+2*curPoint);
+        }
+    });
+}
+
+void indirectGeodeticBatchCPP(double *azStart, double *dist, double *azEnd, const double *latLonStart, const double *latLonEnd, const size_t numPoints, const double a, const double f, const size_t numThreads) {
+    if(fabs(f)<=0.01) {
+        indirectGeodeticBatch<Geodesic>(azStart,dist,azEnd,latLonStart,latLonEnd,numPoints,a,f,numThreads);
+    } else {
+        indirectGeodeticBatch<GeodesicExact>(azStart,dist,azEnd,latLonStart,latLonEnd,numPoints,a,f,numThreads);
+    }
+}
+
+/*The ECEF locations of points on the surface of the reference ellipsoid,
+ *as in ellips2Cart with zero height.*/
+static void latLon2ECEF(std::vector<double> &xyz, const double *latLon, const size_t numPoints, const double a, const double f) {
+    const double e2=2*f-f*f;
+
+    xyz.resize(3*numPoints);
+    for(size_t i=0;i<numPoints;i++) {
+        const double sinP=sin(latLon[2*i]);
+        const double cosP=cos(latLon[2*i]);
+        const double Ne=a/sqrt(1-e2*sinP*sinP);
+
+        xyz[3*i]=Ne*cosP*cos(latLon[2*i+1]);
+        xyz[3*i+1]=Ne*cosP*sin(latLon[2*i+1]);
+        xyz[3*i+2]=Ne*(1-e2)*sinP;
+    }
+}
+
+template<class GeodT>
+static void indirectGeodeticAllPairs(double *azStart, double *dist, double *azEnd, const double *latLonStart, const size_t numStart, const double *latLonEnd, const size_t numEnd, const double maxDist, const double a, const double f, const size_t numThreads) {
+    const bool usePrefilter=std::isfinite(maxDist);
+    const double maxDist2=maxDist*maxDist;
+    std::vector<double> xyzStart, xyzEnd;
+
+    if(usePrefilter) {
+        latLon2ECEF(xyzStart,latLonStart,numStart,a,f);
+        latLon2ECEF(xyzEnd,latLonEnd,numEnd,a,f);
+    }
+    const double *xStart=xyzStart.data();
+    const double *xEnd=xyzEnd.data();
+
+    //The pairs are ordered by column: The index of the starting point
+    //changes fastest.
+    runChunksCPP(numStart*numEnd,numThreads,minProbsPerThread,[=](const size_t startIdx, const size_t endIdx) {
+        const double NaN=std::numeric_limits<double>::quiet_NaN();
+        const double inf=std::numeric_limits<double>::infinity();
+        const GeodT geod(a,f);
+
+        for(size_t curPair=startIdx;curPair<endIdx;curPair++) {
+            const size_t i=curPair%numStart;
+            const size_t j=curPair/numStart;
+
+            if(usePrefilter) {
+                const double d1=xStart[3*i]-xEnd[3*j];
+                const double d2=xStart[3*i+1]-xEnd[3*j+1];
+                const double d3=xStart[3*i+2]-xEnd[3*j+2];
+
+                if(d1*d1+d2*d2+d3*d3>maxDist2) {
+                    azStart[curPair]=NaN;
+                    dist[curPair]=inf;
+                    azEnd[curPair]=NaN;
+                    continue;
+                }
+            }
+
+            indirectGeodeticOne(geod,azStart[curPair],dist[curPair],azEnd[curPair],latLonStart+2*i,latLonEnd+2*j);
+        }
+    });
+}
+
+void indirectGeodeticAllPairsCPP(double *azStart, double *dist, double *azEnd, const double *latLonStart, const size_t numStart, const double *latLonEnd, const size_t numEnd, const double maxDist, const double a, const double f, const size_t numThreads) {
+    if(fabs(f)<=0.01) {
+        indirectGeodeticAllPairs<Geodesic>(azStart,dist,azEnd,latLonStart,numStart,latLonEnd,numEnd,maxDist,a,f,numThreads);
+    } else {
+        indirectGeodeticAllPairs<GeodesicExact>(azStart,dist,azEnd,latLonStart,numStart,latLonEnd,numEnd,maxDist,a,f,numThreads);
+    }
+}
+
+template<class GeodT>
+static void directGeodeticBatch(double *latLonEnd, double *azEnd, const double *latLonStart, const double *azStart, const double *dist, const size_t numPoints, const double a, const double f, const size_t numThreads) {
+    runChunksCPP(numPoints,numThreads,minProbsPerThread,[=](const size_t startIdx, const size_t endIdx) {
+        const double pi=3.1415926535897932384626433832795;
+        const GeodT geod(a,f);
+
+        for(size_t curPoint=startIdx;curPoint<endIdx;curPoint++) {
+            //GeographicLib takes the values in degrees.
+            const double lat1=wrapRangeMirrorCPP(latLonStart[2*curPoint]*(180.0/pi),-90,90);
+            const double lon1=wrapRangeCPP(latLonStart[2*curPoint+1]*(180.0/pi),-180,180);
+            const double azi1=azStart[curPoint]*(180.0/pi);
+            double lat2,lon2,azi2;
+
+            geod.Direct(lat1,lon1,azi1,dist[curPoint],lat2,lon2,azi2);
+
+            latLonEnd[2*curPoint]=lat2*(pi/180.0);
+            latLonEnd[2*curPoint+1]=lon2*(pi/180.0);
+            azEnd[curPoint]=azi2*(pi/180.0);
+        }
+    });
+}
+
+void directGeodeticBatchCPP(double *latLonEnd, double *azEnd, const double *latLonStart, const double *azStart, const double *dist, const size_t numPoints, const double a, const double f, const size_t numThreads) {
+    if(fabs(f)<=0.01) {
+        directGeodeticBatch<Geodesic>(latLonEnd,azEnd,latLonStart,azStart,dist,numPoints,a,f,numThreads);
+    } else {
+        directGeodeticBatch<GeodesicExact>(latLonEnd,azEnd,latLonStart,azStart,dist,numPoints,a,f,numThreads);
+    }
+}
+
+template<class GeodT>
+static void geodesicPathPoints(double *latLonPts, double *azPts, double *pathDist, const double *latLonStart, const double *latLonEnd, const size_t numPaths, const size_t numPtsPerPath, const double a, const double f, const size_t numThreads) {
+    //The chunks are over all of the points so that a few long paths are
+    //also split over the threads. Each thread constructs the lines of the
+    //paths that its points are on. pathDist is written by the thread that
+    //has the first point of the path.
+    runChunksCPP(numPaths*numPtsPerPath,numThreads,minProbsPerThread,[=](const size_t startIdx, const size_t endIdx) {
+        const double pi=3.1415926535897932384626433832795;
+        const unsigned caps=GeodT::LATITUDE|GeodT::LONGITUDE|GeodT::AZIMUTH|GeodT::DISTANCE_IN;
+        const GeodT geod(a,f);
+        size_t curIdx=startIdx;
+
+        while(curIdx<endIdx) {
+            const size_t curPath=curIdx/numPtsPerPath;
+            const size_t pathEndIdx=std::min(endIdx,(curPath+1)*numPtsPerPath);
+            const double lat1=wrapRangeMirrorCPP(latLonStart[2*curPath]*(180.0/pi),-90,90);
+            const double lon1=wrapRangeCPP(latLonStart[2*curPath+1]*(180.0/pi),-180,180);
+            const double lat2=wrapRangeMirrorCPP(latLonEnd[2*curPath]*(180.0/pi),-90,90);
+            const double lon2=wrapRangeCPP(latLonEnd[2*curPath+1]*(180.0/pi),-180,180);
+            const auto line=geod.InverseLine(lat1,lon1,lat2,lon2,caps);
+            const double s13=line.Distance();
+            //The spacing of the points. A single point is put at the start.
+            const double ds=(numPtsPerPath>1)?s13/static_cast<double>(numPtsPerPath-1):0.0;
+
+            if(curIdx==curPath*numPtsPerPath) {
+                pathDist[curPath]=s13;
+            }
+
+            for(;curIdx<pathEndIdx;curIdx++) {
+                const size_t k=curIdx-curPath*numPtsPerPath;
+                double lat,lon,azi;
+
+                line.Position(ds*static_cast<double>(k),lat,lon,azi);
+
+                latLonPts[2*curIdx]=lat*(pi/180.0);
+                latLonPts[2*curIdx+1]=lon*(pi/180.0);
+                azPts[curIdx]=azi*(pi/180.0);
+            }
+        }
+    });
+}
+
+void geodesicPathPointsCPP(double *latLonPts, double *azPts, double *pathDist, const double *latLonStart, const double *latLonEnd, const size_t numPaths, const size_t numPtsPerPath, const double a, const double f, const size_t numThreads) {
+    if(fabs(f)<=0.01) {
+        geodesicPathPoints<Geodesic>(latLonPts,azPts,pathDist,latLonStart,latLonEnd,numPaths,numPtsPerPath,a,f,numThreads);
+    } else {
+        geodesicPathPoints<GeodesicExact>(latLonPts,azPts,pathDist,latLonStart,latLonEnd,numPaths,numPtsPerPath,a,f,numThreads);
+    }
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
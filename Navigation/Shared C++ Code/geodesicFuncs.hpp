@@ -0,0 +1,35 @@
+/**GEODESICFUNCS A header file for C++ functions that solve many geodetic
+ *            problems at once using GeographicLib, splitting the work over
+ *            multiple threads. See geodesicBatchCPP.cpp for more details.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef GEODESICFUNCS
+#define GEODESICFUNCS
+#include <stddef.h>
+
+void indirectGeodeticBatchCPP(double *azStart, double *dist, double *azEnd, const double *latLonStart, const double *latLonEnd, const size_t numPoints, const double a, const double f, const size_t numThreads);
+void indirectGeodeticAllPairsCPP(double *azStart, double *dist, double *azEnd, const double *latLonStart, const size_t numStart, const double *latLonEnd, const size_t numEnd, const double maxDist, const double a, const double f, const size_t numThreads);
+void directGeodeticBatchCPP(double *latLonEnd, double *azEnd, const double *latLonStart, const double *azStart, const double *dist, const size_t numPoints, const double a, const double f, const size_t numThreads);
+void geodesicPathPointsCPP(double *latLonPts, double *azPts, double *pathDist, const double *latLonStart, const double *latLonEnd, const size_t numPaths, const size_t numPtsPerPath, const double a, const double f, const size_t numThreads);
+#endif
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,117 @@
+/**DIRECTGEODETICPROB Solve the direct geodetic problem. That is, given
+ *                    an initial point and an initial bearing on an
+ *                    ellipsoidal Earth, find the end point and final
+ *                    bearing if one were to travel one or more given
+ *                    distances along a geodesic curve (the shortest curve
+ *                    between two points on a curved surface). See the
+ *                    comments to the Matlab implementation for more
+ *                    details.
+ *
+ *This is a Matlab interface for the implementation in GeographicLib, which
+ *is documented in [1]. The problems are solved by directGeodeticBatchCPP
+ *in geodesicBatchCPP.cpp, which can split them over multiple threads.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[latLonEnd,azEnd]=directGeodeticProb(latLonStart,azStart,distVal,a,f,numThreads);
+ *
+ *REFERENCES:
+ *[1] C. F. F. Karney, "Algorithms for geodesics," Journal of Geodesy, vol.
+ *    87, no. 1, pp. 43-55, Jan. 2013.
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+/*This header is required by Matlab.*/
+#include "mex.h"
+#include "MexValidation.h"
+#include "geodesicFuncs.hpp"
+
+void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
+    size_t numPoints;
+    double *latLonStart, *azStart, *distVal;
+    double a,f;
+    size_t numThreads=1;
+    mxArray *latLonEndMATLAB, *azEndMATLAB;
+    
+    if(nrhs<3||nrhs>6){
+        mexErrMsgTxt("Wrong number of inputs");
+    }
+
+    if(nlhs>2) {
+        mexErrMsgTxt("Wrong number of outputs.");
+    }
+    
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+    checkRealDoubleArray(prhs[2]);
+    
+    numPoints=mxGetN(prhs[0]);
+    if(mxGetM(prhs[0])!=2) {
+        mexErrMsgTxt("The latLonStart vector has a bad dimensionality.");
+    }
+    
+    if(mxGetNumberOfElements(prhs[1])!=numPoints) {
+        mexErrMsgTxt("The azStart vector has a bad dimensionality.");
+    }
+    
+    if(mxGetNumberOfElements(prhs[2])!=numPoints) {
+        mexErrMsgTxt("The distVal vector has a bad dimensionality.");
+    }
+    
+    latLonStart=reinterpret_cast<double*>(mxGetData(prhs[0]));
+    azStart=reinterpret_cast<double*>(mxGetData(prhs[1]));
+    distVal=reinterpret_cast<double*>(mxGetData(prhs[2]));
+    
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        a=getDoubleFromMatlab(prhs[3]);
+    } else {
+        a=getScalarMatlabClassConst("Constants","WGS84SemiMajorAxis");
+    }
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        f=getDoubleFromMatlab(prhs[4]);
+    } else {
+        f=getScalarMatlabClassConst("Constants","WGS84Flattening");
+    }
+    
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        numThreads=getSizeTFromMatlab(prhs[5]);
+    }
+    
+    //Allocate space for the return variables.
+    latLonEndMATLAB=mxCreateDoubleMatrix(2,numPoints,mxREAL);
+    azEndMATLAB=mxCreateDoubleMatrix(numPoints,1,mxREAL);
+    
+    directGeodeticBatchCPP(reinterpret_cast<double*>(mxGetData(latLonEndMATLAB)),reinterpret_cast<double*>(mxGetData(azEndMATLAB)),latLonStart,azStart,distVal,numPoints,a,f,numThreads);
+    
+    //Set the return values.
+    plhs[0]=latLonEndMATLAB;
+    
+    if(nlhs>1) {
+        plhs[1]=azEndMATLAB;
+    } else {
+        mxDestroyArray(azEndMATLAB);
+    }
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
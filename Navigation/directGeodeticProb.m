@@ -1,4 +1,4 @@
-function [latLonEnd,azEnd]=directGeodeticProb(latLonStart,azStart,distVal,a,f)
+function [latLonEnd,azEnd]=directGeodeticProb(latLonStart,azStart,distVal,a,f,numThreads)
 %%DIRECTGEODETICPROB Solve the direct geodetic problem. That is, given
 %                     an initial point and an initial bearing an
 %                     ellipsoidal Earth, find the end point and final
@@ -24,6 +24,11 @@ function [latLonEnd,azEnd]=directGeodeticProb(latLonStart,azStart,distVal,a,f)
 %                 f The flattening factor of the reference ellipsoid. If
 %                   this argument is omitted, the value in
 %                   Constants.WGS84Flattening is used.
+%        numThreads The number of threads to use to solve the problems in
+%                   the C++ implementation. Zero means that the number of
+%                   hardware threads available is used. The default if
+%                   omitted or an empty matrix is passed is 1. This
+%                   parameter is ignored by the Matlab implementation.
 %
 %OUTPUTS: latLonEnd A2XN matrix of geodetic latitude and longitudes of the
 %                   final points of the geodesic trajectory given in
@@ -42,6 +47,13 @@ function [latLonEnd,azEnd]=directGeodeticProb(latLonStart,azStart,distVal,a,f)
 %with planets such as the Earth that are approximated with ellipsoids
 %having a low eccentricity.
 %
+%The algorithm can be compiled for use in Matlab using the
+%CompileCLibraries function. The C++ implementation uses GeographicLib,
+%which implements [1].
+%
+%The algorithm is run in Matlab using the command format
+%[latLonEnd,azEnd]=directGeodeticProb(latLonStart,azStart,distVal,a,f,numThreads);
+%
 %REFERENCES:
 %[1] C. F. F. Karney, "Algorithms for geodesics," Journal of Geodesy, vol.
 %    87, no. 1, pp. 43-55, Jan. 2013.
@@ -216,13 +228,8 @@ for curPoint=1:N
     %Equation 6
     phi2=atan(tan(beta2)/(1-f));
 
-    latLonEnd(:,curPoint)=[phi2;wrapRange(latLonStart(2)+lambda12,-pi,pi)];
-    
-    if(wrapRange(lambda12,-pi,pi)<0)
-        azEnd(curPoint)=wrapRange(alpha2+pi,-pi,pi);
-    else
-        azEnd(curPoint)=alpha2;
-    end
+    latLonEnd(:,curPoint)=[phi2;wrapRange(latLonStart(2,curPoint)+lambda12,-pi,pi)];
+    azEnd(curPoint)=alpha2;
 end
 
 end
@@ -0,0 +1,124 @@
+/**GEODESICPATHPOINTS Find points that are equally spaced in distance along
+ *                   the geodesic paths between pairs of points on an
+ *                   ellipsoidal Earth. See the comments to the Matlab
+ *                   implementation for more details.
+ *
+ *The geodesic of each path is found once as a GeographicLib GeodesicLine
+ *and all of the points on the path are then found from it. This is done
+ *by geodesicPathPointsCPP in geodesicBatchCPP.cpp, which can split the
+ *points over multiple threads.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[latLonPts,azPts,pathDist]=geodesicPathPoints(latLonStart,latLonEnd,numPtsPerPath,a,f,numThreads);
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+/*This header is required by Matlab.*/
+#include "mex.h"
+#include "MexValidation.h"
+#include "geodesicFuncs.hpp"
+
+void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
+    size_t numPaths, numPtsPerPath;
+    double *latLonStart, *latLonEnd;
+    double a,f;
+    size_t numThreads=1;
+    mxArray *latLonPtsMATLAB, *azPtsMATLAB, *pathDistMATLAB;
+    
+    if(nrhs<3||nrhs>6){
+        mexErrMsgTxt("Wrong number of inputs");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Wrong number of outputs.");
+    }
+    
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+    
+    numPaths=mxGetN(prhs[0]);
+    if(mxGetM(prhs[0])!=2) {
+        mexErrMsgTxt("The latLonStart vector has a bad dimensionality.");
+    }
+    
+    if(mxGetM(prhs[1])!=2||mxGetN(prhs[1])!=numPaths) {
+        mexErrMsgTxt("The latLonEnd vector has a bad dimensionality.");
+    }
+    
+    latLonStart=reinterpret_cast<double*>(mxGetData(prhs[0]));
+    latLonEnd=reinterpret_cast<double*>(mxGetData(prhs[1]));
+    
+    numPtsPerPath=getSizeTFromMatlab(prhs[2]);
+    if(numPtsPerPath<1) {
+        mexErrMsgTxt("At least one point per path is needed.");
+    }
+    
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        a=getDoubleFromMatlab(prhs[3]);
+    } else {
+        a=getScalarMatlabClassConst("Constants","WGS84SemiMajorAxis");
+    }
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        f=getDoubleFromMatlab(prhs[4]);
+    } else {
+        f=getScalarMatlabClassConst("Constants","WGS84Flattening");
+    }
+    
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        numThreads=getSizeTFromMatlab(prhs[5]);
+    }
+    
+    //Allocate space for the return variables.
+    {
+        mwSize dims[3];
+        dims[0]=2;
+        dims[1]=numPtsPerPath;
+        dims[2]=numPaths;
+        
+        latLonPtsMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+    }
+    azPtsMATLAB=mxCreateDoubleMatrix(numPtsPerPath,numPaths,mxREAL);
+    pathDistMATLAB=mxCreateDoubleMatrix(numPaths,1,mxREAL);
+    
+    geodesicPathPointsCPP(reinterpret_cast<double*>(mxGetData(latLonPtsMATLAB)),reinterpret_cast<double*>(mxGetData(azPtsMATLAB)),reinterpret_cast<double*>(mxGetData(pathDistMATLAB)),latLonStart,latLonEnd,numPaths,numPtsPerPath,a,f,numThreads);
+    
+    //Set the return values.
+    plhs[0]=latLonPtsMATLAB;
+    
+    if(nlhs>1) {
+        plhs[1]=azPtsMATLAB;
+        
+        if(nlhs>2) {
+            plhs[2]=pathDistMATLAB;
+        } else {
+            mxDestroyArray(pathDistMATLAB);  
+        }
+    } else {
+        mxDestroyArray(azPtsMATLAB);
+        mxDestroyArray(pathDistMATLAB);
+    }
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,96 @@
+function [latLonPts,azPts,pathDist]=geodesicPathPoints(latLonStart,latLonEnd,numPtsPerPath,a,f,numThreads)
+%%GEODESICPATHPOINTS Find points that are equally spaced in distance along
+%                   the geodesic paths (shortest paths on the reference
+%                   ellipsoid) between pairs of points. This is useful for
+%                   densifying sets of waypoints and for plotting.
+%
+%INPUTS: latLonStart A 2XN matrix of the starting points of the N paths
+%                  given in geodetic latitude and longitude in radians of
+%                  the format [latitude;longitude] for each column.
+%        latLonEnd A 2XN matrix of the ending points of the paths with
+%                  the same format as latLonStart.
+%    numPtsPerPath The number of points K>=1 to find on each path. The
+%                  first and last points are the starting and ending
+%                  points of the path. If K=1, then just the starting
+%                  point is returned.
+%                a The semi-major axis of the reference ellipsoid (in
+%                  meters). If this argument is omitted or an empty matrix
+%                  is passed, the value in Constants.WGS84SemiMajorAxis is
+%                  used.
+%                f The flattening factor of the reference ellipsoid. If
+%                  this argument is omitted or an empty matrix is passed,
+%                  the value in Constants.WGS84Flattening is used.
+%       numThreads The number of threads to use in the C++ implementation.
+%                  Zero means that the number of hardware threads
+%                  available is used. The default if omitted or an empty
+%                  matrix is passed is 1. This parameter is ignored by the
+%                  Matlab implementation.
+%
+%OUTPUTS: latLonPts A 2XKXN matrix of the [latitude;longitude] points in
+%                   radians along each of the paths. latLonPts(:,k,n) is
+%                   (k-1)/(K-1) of the distance along the nth path.
+%             azPts The KXN matrix of forward azimuths in radians East of
+%                   true North at the points.
+%          pathDist The NX1 vector of the lengths of the paths in meters.
+%
+%This gives the same results as solving the indirect geodetic problem with
+%indirectGeodeticProb for each path and then solving the direct geodetic
+%problem with directGeodeticProb at each distance along the path, which is
+%what the Matlab implementation does. The C++ implementation uses
+%GeographicLib and finds the geodesic of each path once, after which each
+%point only requires the evaluation of a few series, which is much faster
+%than solving a new geodetic problem for each point.
+%
+%The algorithm can be compiled for use in Matlab using the
+%CompileCLibraries function.
+%
+%The algorithm is run in Matlab using the command format
+%[latLonPts,azPts,pathDist]=geodesicPathPoints(latLonStart,latLonEnd,numPtsPerPath,a,f,numThreads);
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+if(nargin<5||isempty(f))
+    f=Constants.WGS84Flattening;
+end
+
+if(nargin<4||isempty(a))
+    a=Constants.WGS84SemiMajorAxis;
+end
+
+N=size(latLonStart,2);
+K=numPtsPerPath;
+
+[azStart,pathDist]=indirectGeodeticProb(latLonStart,latLonEnd,a,f);
+
+%The fractions of the path lengths at which the points are found.
+if(K>1)
+    fracVals=(0:(K-1))/(K-1);
+else
+    fracVals=0;
+end
+
+latLonPts=zeros(2,K,N);
+azPts=zeros(K,N);
+for curPath=1:N
+    [latLonPts(:,:,curPath),azPts(:,curPath)]=directGeodeticProb(repmat(latLonStart(:,curPath),[1,K]),repmat(azStart(curPath),[K,1]),fracVals*pathDist(curPath),a,f);
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
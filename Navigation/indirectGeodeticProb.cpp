@@ -18,6 +18,10 @@
  *                f The flattening factor of the reference ellipsoid. If
  *                  this argument is omitted, the value in
  *                  Constants.WGS84Flattening is used.
+ *       numThreads The number of threads to use to solve the problems.
+ *                  Zero means that the number of hardware threads
+ *                  available is used. If this parameter is omitted or an
+ *                  empty matrix is passed, then one thread is used.
  *
  *OUTPUTS: azStart The NX1 forward azimuth at the starting points in
  *                 radians East of true North on the reference ellipsoid.
@@ -35,7 +39,8 @@
  *http://geographiclib.sourceforge.net
  *Though a native Matlab version of the relevant function in GepgraphicLib
  *exists, it is rather slow. hence the need for this interface to the
- *compiled version.
+ *compiled version. The problems are solved by indirectGeodeticBatchCPP in
+ *geodesicBatchCPP.cpp, where each thread has its own Geodesic object.
  *
  *The algorithm can be compiled for use in Matlab using the 
  *CompileCLibraries function.
@@ -44,6 +49,8 @@
  *[azStart,dist,azEnd]=indirectGeodeticProb(latLonStart,latLonEnd);
  *or if something other than the WGS84 reference ellipsoid is used
  *[azStart,dist,azEnd]=indirectGeodeticProb(latLonStart,latLonEnd,a,f);
+ *or to split the problems over numThreads threads
+ *[azStart,dist,azEnd]=indirectGeodeticProb(latLonStart,latLonEnd,a,f,numThreads);
  *
  *REFERENCES:
  *[1] C. F. F. Karney, "Algorithms for geodesics," Journal of Geodesy, vol.
@@ -63,29 +70,17 @@
 /*This header is required by Matlab.*/
 #include "mex.h"
 #include "MexValidation.h"
-
-//For the wrapRange function so that there is no issue if latitudes and
-//longitudes are given outside of the valid range for the GeographicLib
-//functions.
-#include "mathFuncs.hpp"
-
-//For fabs
-#include <cmath>
-
-#include <GeographicLib/Geodesic.hpp>
-#include <GeographicLib/GeodesicExact.hpp>
-
-using namespace GeographicLib;
+#include "geodesicFuncs.hpp"
 
 void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
-    const double pi=3.1415926535897932384626433832795;
     size_t numPoints;
     double *latLonStart, *latLonEnd;
     double a,f;
+    size_t numThreads=1;
     double *azStart, *dist, *azEnd;
     mxArray *azStartMATLAB, *distMATLAB, *azEndMATLAB;
     
-    if(nrhs<2||nrhs>4){
+    if(nrhs<2||nrhs>5){
         mexErrMsgTxt("Wrong number of inputs");
     }
 
@@ -116,18 +111,22 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     latLonStart=reinterpret_cast<double*>(mxGetData(prhs[0]));
     latLonEnd=reinterpret_cast<double*>(mxGetData(prhs[1]));
     
-    if(nrhs>2) {
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
         a=getDoubleFromMatlab(prhs[2]);
     } else {
         a=getScalarMatlabClassConst("Constants","WGS84SemiMajorAxis");
     }
 
-    if(nrhs>3) {
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
         f=getDoubleFromMatlab(prhs[3]);
     } else {
         f=getScalarMatlabClassConst("Constants","WGS84Flattening");
     }
     
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        numThreads=getSizeTFromMatlab(prhs[4]);
+    }
+    
     //Allocate space for the return variables.
     azStartMATLAB=mxCreateDoubleMatrix(numPoints,1,mxREAL);
     distMATLAB=mxCreateDoubleMatrix(numPoints,1,mxREAL);
@@ -138,55 +137,7 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
     azEnd=reinterpret_cast<double*>(mxGetData(azEndMATLAB));
     
     //Solve the indirect geodetic problem for each of the point pairs.
-    //The class used to solve the problem is chosen based on the value of
-    //f. As per the documentation is GeographicLib, the Geodesic class is
-    //best suited for problems where |f|<=0.01. For other problems, the
-    //GeodesicExact class is the better choice.
-    
-    if(fabs(f)<=0.01) {
-        Geodesic geod(a, f);
-        size_t curPoint,curBaseIdx;
-        
-        curBaseIdx=0;
-        for(curPoint=0;curPoint<numPoints;curPoint++) {
-            //The function takes the values in degrees.
-            const double lat1=wrapRangeMirrorCPP(latLonStart[curBaseIdx]*(180.0/pi),-90,90);
-            const double lon1=wrapRangeCPP(latLonStart[curBaseIdx+1]*(180.0/pi),-180,180);
-            const double lat2=wrapRangeMirrorCPP(latLonEnd[curBaseIdx]*(180.0/pi),-90,90);
-            const double lon2=wrapRangeCPP(latLonEnd[curBaseIdx+1]*(180.0/pi),-180,180);
-            double s12,azi1,azi2;//Return values are put in here.
-            
-            geod.Inverse(lat1, lon1, lat2, lon2, s12, azi1, azi2);
-            
-            azStart[curPoint]=azi1*(pi/180.0);
-            dist[curPoint]=s12;
-            azEnd[curPoint]=azi2*(pi/180.0);
-            
-            curBaseIdx+=2;
-        }
-    } else {//For the case where |f|>0.01. All that changes is the class
-            //used.
-        GeodesicExact geod(a, f);
-        size_t curPoint,curBaseIdx;
-        
-        curBaseIdx=0;
-        for(curPoint=0;curPoint<numPoints;curPoint++) {
-            //The function takes the values in degrees.
-            const double lat1=latLonStart[curBaseIdx]*(180.0/pi);
-            const double lon1=latLonStart[curBaseIdx+1]*(180.0/pi);
-            const double lat2=latLonEnd[curBaseIdx]*(180.0/pi);
-            const double lon2=latLonEnd[curBaseIdx+1]*(180.0/pi);
-            double s12,azi1,azi2;//Return values are put in here.
-            
-            geod.Inverse(lat1, lon1, lat2, lon2, s12, azi1, azi2);
-            
-            azStart[curPoint]=azi1*(pi/180.0);
-            dist[curPoint]=s12;
-            azEnd[curPoint]=azi2*(pi/180.0);
-            
-            curBaseIdx+=2;
-        }
-    }
+    indirectGeodeticBatchCPP(azStart,dist,azEnd,latLonStart,latLonEnd,numPoints,a,f,numThreads);
     
     //Set the return values.
     plhs[0]=azStartMATLAB;
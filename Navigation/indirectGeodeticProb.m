@@ -1,4 +1,4 @@
-function [azStart,dist,azEnd]=indirectGeodeticProb(latLonStart,latLonEnd,a,f)
+function [azStart,dist,azEnd]=indirectGeodeticProb(latLonStart,latLonEnd,a,f,numThreads)
 %%INDIRECTGEODETICPROB Solve the indirect geodetic problem. That is, given
 %                      two points on an ellipsoidal Earth, find the
 %                      initial bearing and distance one must travel to
@@ -19,6 +19,10 @@ function [azStart,dist,azEnd]=indirectGeodeticProb(latLonStart,latLonEnd,a,f)
 %                f The flattening factor of the reference ellipsoid. If
 %                  this argument is omitted, the value in
 %                  Constants.WGS84Flattening is used.
+%       numThreads The number of threads to use to solve the problems.
+%                  Zero means that the number of hardware threads
+%                  available is used. If this parameter is omitted or an
+%                  empty matrix is passed, then one thread is used.
 %
 %OUTPUTS: azStart The NX1 forward azimuth at the starting points in
 %                 radians East of true North on the reference ellipsoid.
@@ -45,6 +49,11 @@ function [azStart,dist,azEnd]=indirectGeodeticProb(latLonStart,latLonEnd,a,f)
 %[azStart,dist,azEnd]=indirectGeodeticProb(latLonStart,latLonEnd);
 %or if something other than the WGS84 reference ellipsoid is used
 %[azStart,dist,azEnd]=indirectGeodeticProb(latLonStart,latLonEnd,a,f);
+%or to split the problems over numThreads threads
+%[azStart,dist,azEnd]=indirectGeodeticProb(latLonStart,latLonEnd,a,f,numThreads);
+%
+%To solve the problem between every pair of a set of starting and a set of
+%ending points, use indirectGeodeticProbAllPairs.
 %
 %REFERENCES:
 %[1] C. F. F. Karney, "Algorithms for geodesics," Journal of Geodesy, vol.
@@ -0,0 +1,117 @@
+/**INDIRECTGEODETICPROBALLPAIRS Solve the indirect geodetic problem between
+ *                   every one of a set of starting points and every one of
+ *                   a set of ending points, optionally skipping pairs that
+ *                   are farther apart than a given distance. See the
+ *                   comments to the Matlab implementation for more
+ *                   details.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[azStart,dist,azEnd]=indirectGeodeticProbAllPairs(latLonStart,latLonEnd,maxDist,a,f,numThreads);
+ *
+ *October 2026 Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+/*This header is required by Matlab.*/
+#include "mex.h"
+#include "MexValidation.h"
+#include "geodesicFuncs.hpp"
+#include <limits>
+
+void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
+    size_t numStart, numEnd;
+    double *latLonStart, *latLonEnd;
+    double maxDist, a, f;
+    size_t numThreads=1;
+    mxArray *azStartMATLAB, *distMATLAB, *azEndMATLAB;
+    
+    if(nrhs<2||nrhs>6){
+        mexErrMsgTxt("Wrong number of inputs");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Wrong number of outputs.");
+    }
+    
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+    
+    numStart=mxGetN(prhs[0]);
+    numEnd=mxGetN(prhs[1]);
+    if(mxGetM(prhs[0])!=2) {
+        mexErrMsgTxt("The latLonStart vector has a bad dimensionality.");
+    }
+    
+    if(mxGetM(prhs[1])!=2) {
+        mexErrMsgTxt("The latLonEnd vector has a bad dimensionality.");
+    }
+    
+    latLonStart=reinterpret_cast<double*>(mxGetData(prhs[0]));
+    latLonEnd=reinterpret_cast<double*>(mxGetData(prhs[1]));
+    
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        maxDist=getDoubleFromMatlab(prhs[2]);
+    } else {
+        maxDist=std::numeric_limits<double>::infinity();
+    }
+    
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        a=getDoubleFromMatlab(prhs[3]);
+    } else {
+        a=getScalarMatlabClassConst("Constants","WGS84SemiMajorAxis");
+    }
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        f=getDoubleFromMatlab(prhs[4]);
+    } else {
+        f=getScalarMatlabClassConst("Constants","WGS84Flattening");
+    }
+    
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        numThreads=getSizeTFromMatlab(prhs[5]);
+    }
+    
+    //Allocate space for the return variables.
+    azStartMATLAB=mxCreateDoubleMatrix(numStart,numEnd,mxREAL);
+    distMATLAB=mxCreateDoubleMatrix(numStart,numEnd,mxREAL);
+    azEndMATLAB=mxCreateDoubleMatrix(numStart,numEnd,mxREAL);
+    
+    indirectGeodeticAllPairsCPP(reinterpret_cast<double*>(mxGetData(azStartMATLAB)),reinterpret_cast<double*>(mxGetData(distMATLAB)),reinterpret_cast<double*>(mxGetData(azEndMATLAB)),latLonStart,numStart,latLonEnd,numEnd,maxDist,a,f,numThreads);
+    
+    //Set the return values.
+    plhs[0]=azStartMATLAB;
+    
+    if(nlhs>1) {
+        plhs[1]=distMATLAB;
+        
+        if(nlhs>2) {
+            plhs[2]=azEndMATLAB;
+        } else {
+            mxDestroyArray(azEndMATLAB);  
+        }
+    } else {
+        mxDestroyArray(distMATLAB);
+        mxDestroyArray(azEndMATLAB);
+    }
+}
+
+/*LICENSE:
+*
+*The source code is in the public domain and not licensed or under
+*copyright. The information and software may be used freely by the public.
+*As required by 17 U.S.C. 403, third parties producing copyrighted works
+*consisting predominantly of the material produced by U.S. government
+*agencies must provide notice with such work(s) identifying the U.S.
+*Government material incorporated and stating that such material is not
+*subject to copyright protection.
+*
+*Derived works shall not identify themselves in a manner that implies an
+*endorsement by or an affiliation with the Naval Research Laboratory.
+*
+*RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+*SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+*RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+*OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,120 @@
+function [azStart,dist,azEnd]=indirectGeodeticProbAllPairs(latLonStart,latLonEnd,maxDist,a,f,numThreads)
+%%INDIRECTGEODETICPROBALLPAIRS Solve the indirect geodetic problem between
+%                   every one of a set of starting points and every one of
+%                   a set of ending points. That is, find the initial
+%                   bearing and distance one must travel to take the
+%                   shortest (geodesic) path between each pair of points.
+%                   Optionally, pairs of points that are obviously farther
+%                   apart than a given distance can be skipped, as is
+%                   useful when screening many targets against many
+%                   sensors or ports.
+%
+%INPUTS: latLonStart A 2XN matrix of the N initial points given in geodetic
+%                  latitude and longitude in radians of the format
+%                  [latitude;longitude] for each column (point).
+%        latLonEnd A 2XM matrix of the M final points given in geodetic
+%                  latitude and longitude in radians with the same format
+%                  as latLonStart.
+%          maxDist If this is given and is finite, then pairs of points
+%                  whose straight-line (chord) distance through the Earth
+%                  exceeds maxDist are not solved. As the geodesic distance
+%                  between two points is never less than the chord between
+%                  them, all pairs that are skipped are more than maxDist
+%                  apart. If this parameter is omitted or an empty matrix
+%                  is passed, then Inf is used and no pairs are skipped.
+%                a The semi-major axis of the reference ellipsoid (in
+%                  meters). If this argument is omitted or an empty matrix
+%                  is passed, the value in Constants.WGS84SemiMajorAxis is
+%                  used.
+%                f The flattening factor of the reference ellipsoid. If
+%                  this argument is omitted or an empty matrix is passed,
+%                  the value in Constants.WGS84Flattening is used.
+%       numThreads The number of threads to use to solve the problems.
+%                  Zero means that the number of hardware threads
+%                  available is used. If this parameter is omitted or an
+%                  empty matrix is passed, then one thread is used.
+%
+%OUTPUTS: azStart The NXM matrix of forward azimuths in radians East of
+%                 true North at the starting points. azStart(i,j) is the
+%                 initial heading to go from latLonStart(:,i) to
+%                 latLonEnd(:,j).
+%            dist The NXM matrix of geodetic distances in meters between
+%                 the starting and ending points.
+%           azEnd The NXM matrix of forward azimuths in radians at the
+%                 ending points.
+%
+%Pairs of points that are skipped due to maxDist have a distance of Inf
+%and NaN azimuths.
+%
+%This gives the same results as calling indirectGeodeticProb with every
+%pair of points. The chord test only needs the Cartesian locations of the
+%N+M points on the reference ellipsoid, so it takes a few multiplications
+%per pair, whereas solving the geodetic problem takes on the order of a
+%microsecond.
+%
+%The algorithm can be compiled for use in Matlab using the
+%CompileCLibraries function.
+%
+%The algorithm is run in Matlab using the command format
+%[azStart,dist,azEnd]=indirectGeodeticProbAllPairs(latLonStart,latLonEnd,maxDist,a,f,numThreads);
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+if(nargin<6||isempty(numThreads))
+    numThreads=1;
+end
+
+if(nargin<5||isempty(f))
+    f=Constants.WGS84Flattening;
+end
+
+if(nargin<4||isempty(a))
+    a=Constants.WGS84SemiMajorAxis;
+end
+
+if(nargin<3||isempty(maxDist))
+    maxDist=Inf;
+end
+
+N=size(latLonStart,2);
+M=size(latLonEnd,2);
+
+[idxStart,idxEnd]=ndgrid(1:N,1:M);
+idxStart=idxStart(:);
+idxEnd=idxEnd(:);
+
+azStart=NaN(N,M);
+dist=Inf(N,M);
+azEnd=NaN(N,M);
+
+if(isfinite(maxDist))
+    xStart=ellips2Cart([latLonStart;zeros(1,N)],a,f);
+    xEnd=ellips2Cart([latLonEnd;zeros(1,M)],a,f);
+
+    chord2=sum((xStart(:,idxStart)-xEnd(:,idxEnd)).^2,1);
+    sel=(chord2<=maxDist^2);
+else
+    sel=true(N*M,1);
+end
+
+[azStart(sel),dist(sel),azEnd(sel)]=indirectGeodeticProb(latLonStart(:,idxStart(sel)),latLonEnd(:,idxEnd(sel)),a,f,numThreads);
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -0,0 +1,132 @@
+%%COMPAREELLIPSCONV Compare the compiled implementations of Cart2Ellipse
+%                  and ellips2Cart to the Matlab implementations on random
+%                  points and print the maximum differences and the
+%                  execution times. The compiled implementations split the
+%                  points over multiple threads and evaluate the algorithms
+%                  of Olson and Fukushima without branching on each point,
+%                  so this checks that they still agree with the scalar
+%                  Matlab code. The compiled implementations are run with
+%                  one thread and with all hardware threads and the results
+%                  of the two should be identical.
+%
+%This function requires that the CompileCLibraries function has been run so
+%that the necessary functions have been compiled.
+%
+%Points with a NaN latitude, longitude or height are also passed to
+%ellips2Cart. As in the iauGd2gce function in the International
+%Astronomical Union's Standards of Fundamental Astronomy library, these
+%should give NaN outputs rather than an error.
+%
+%October 2026 Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+numPoints=1e5;
+fprintf('%i random points shall be used\n',numPoints)
+
+%The search path and current working directories will be modified. Thus,
+%save the old search path and working directory so that they can be
+%restored when the script exits.
+oldPath=path();
+curDir=pwd;
+ScriptPath=mfilename('fullpath');
+ScriptFolder=fileparts(ScriptPath);
+%Set the current working directory to the folder in which this script is
+%located.
+cd(ScriptFolder)
+
+a=Constants.WGS84SemiMajorAxis;
+f=Constants.WGS84Flattening;
+
+%Random points between 10km below and 190km above the reference
+%ellipsoid.
+latLonAlt=[(pi/2)*(2*rand(1,numPoints)-1);
+           pi*(2*rand(1,numPoints)-1);
+           -10e3+200e3*rand(1,numPoints)];
+%Points that have a NaN in each component.
+latLonAltNaN=[NaN, 0.5, 0.5;
+              0.1, NaN, 0.1;
+              100, 100, NaN];
+algNames={'Olson','Sofair','Fukushima'};
+
+%%Run the Matlab implementations
+%Remove the compiled code directory from the search path, so that the
+%Matlab implementations are used and the C++ implementations are ignored.
+compiledCodeFolder=[fileparts(fileparts(ScriptFolder)),'/0_Compiled_Code'];
+rmpath(compiledCodeFolder)
+
+disp('Running the Matlab implementations')
+ticLoc=tic;
+cartPointsMatlab=ellips2Cart(latLonAlt,a,f);
+timeEllips2CartMatlab=toc(ticLoc);
+cartPointsNaNMatlab=ellips2Cart(latLonAltNaN,a,f);
+
+pointsMatlab=cell(3,1);
+timeCart2EllipseMatlab=zeros(3,1);
+for curAlg=0:2
+    ticLoc=tic;
+    pointsMatlab{curAlg+1}=Cart2Ellipse(cartPointsMatlab,curAlg,a,f);
+    timeCart2EllipseMatlab(curAlg+1)=toc(ticLoc);
+end
+
+%%Run the compiled implementations
+%Add the compiled code directory to the search path so that the Matlab
+%versions of the algorithms will no longer be used.
+addpath(compiledCodeFolder)
+
+disp('Running the compiled implementations')
+ticLoc=tic;
+cartPointsCPP=ellips2Cart(latLonAlt,a,f,1);
+timeEllips2CartCPP=toc(ticLoc);
+cartPointsCPPThreads=ellips2Cart(latLonAlt,a,f,0);
+cartPointsNaNCPP=ellips2Cart(latLonAltNaN,a,f);
+
+pointsCPP=cell(3,1);
+pointsCPPThreads=cell(3,1);
+timeCart2EllipseCPP=zeros(3,1);
+for curAlg=0:2
+    ticLoc=tic;
+    pointsCPP{curAlg+1}=Cart2Ellipse(cartPointsMatlab,curAlg,a,f,1);
+    timeCart2EllipseCPP(curAlg+1)=toc(ticLoc);
+    pointsCPPThreads{curAlg+1}=Cart2Ellipse(cartPointsMatlab,curAlg,a,f,0);
+end
+
+%%Display the results
+disp('Maximum differences between the compiled and Matlab implementations')
+fprintf('ellips2Cart: %g m, threads identical: %i\n',max(max(abs(cartPointsCPP-cartPointsMatlab))),isequal(cartPointsCPP,cartPointsCPPThreads))
+fprintf('ellips2Cart NaN points: NaN outputs match: %i\n',isequal(isnan(cartPointsNaNCPP),isnan(cartPointsNaNMatlab)))
+for curAlg=1:3
+    diffVal=pointsCPP{curAlg}-pointsMatlab{curAlg};
+    maxLatErr=max(abs(diffVal(1,:)));
+    maxLonErr=max(abs(wrapRange(diffVal(2,:),-pi,pi)));
+    maxAltErr=max(abs(diffVal(3,:)));
+    fprintf('Cart2Ellipse %s: %g rad latitude, %g rad longitude, %g m height, threads identical: %i\n',algNames{curAlg},maxLatErr,maxLonErr,maxAltErr,isequal(pointsCPP{curAlg},pointsCPPThreads{curAlg}))
+end
+
+disp('Execution times in seconds, Matlab/compiled with one thread')
+fprintf('ellips2Cart: %f/%f\n',timeEllips2CartMatlab,timeEllips2CartCPP)
+for curAlg=1:3
+    fprintf('Cart2Ellipse %s: %f/%f\n',algNames{curAlg},timeCart2EllipseMatlab(curAlg),timeCart2EllipseCPP(curAlg))
+end
+
+%Restore the old working directory.
+cd(curDir);
+%Restore the old path
+path(oldPath);
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -35,8 +35,13 @@ M=500;%M is the maximum degree and order of the terrain model. M<=2160.
 [C,S]=getEarth2014TerrainCoeffs(M);
 
 %Get the offsets from the ellipsoidal radius of the terrain at each
-%spherical azimuth and elevation point.
-terHeight=spherHarmonicEval(C,S,azel);
+%spherical azimuth and elevation point. The points form a regular grid, so
+%spherHarmonicGridEval is used. The azimuths from -180 to 180 degrees are
+%numPoints-1 evenly spaced values around the circle with the first one
+%repeated at the end, so the first column of the grid is appended.
+terHeight=spherHarmonicGridEval(C,S,el(1,:),numPoints-1,[],-pi);
+terHeight=[terHeight,terHeight(:,1)]';
+terHeight=terHeight(:);
 
 %The ellipsoidal height is with respect to the GRS80 ellipsoid.
 a=Constants.GRS80SemiMajorAxis;
@@ -77,13 +82,15 @@ el=linspace(-90,90,numPoints)*pi/180;
 az=linspace(-180,180,numPoints)*pi/180;
 %The points from the meshgrid function are sorted by elevation.
 [el,az]=meshgrid(el,az);
-azel=[az(:)';el(:)'];
 
 M=600;%M is the maximum degree and order of the terrain model. M<=2160.
 [C,S]=getEGM2008TerrainCoeffs(M);
 
-%Get the orthometric heights at each spherical azimuth and elevation point.
-theHeight=spherHarmonicEval(C,S,azel);
+%Get the orthometric heights at each spherical azimuth and elevation point
+%using a grid evaluation, as above.
+theHeight=spherHarmonicGridEval(C,S,el(1,:),numPoints-1,[],-pi);
+theHeight=[theHeight,theHeight(:,1)]';
+theHeight=theHeight(:);
 
 lat=spherLat2EllipsLat(el(:)');
 latLon=[lat;az(:)'];
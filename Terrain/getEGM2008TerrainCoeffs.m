@@ -42,7 +42,12 @@ function [C,S]=getEGM2008TerrainCoeffs(M)
 %such a file does not exist, then the coefficients are read in from the
 %appropriate .dat file and if all 2190 coefficients are requested, then a
 %.mat file is created so that the text in the .dat file need not be read
-%again, because reading the text file is extremely slow.
+%again, because reading the text file is extremely slow. At the same time,
+%the coefficients are saved in the binary format of
+%saveSpherHarmonicCoeffs (with a=1 and c=1) in a file with the extension
+%.shcb, which is used before the .mat file if it exists, because only the
+%coefficients up to degree M are read from it. That file can also be
+%passed to the spherHarmonicModel class to memory map the coefficients.
 %
 %EXAMPLE:
 %The fact that this stores elevations above the geoid can make it confusing
@@ -92,8 +97,13 @@ totalNumCoeffs=(M+1)*(M+2)/2;
 ScriptPath=mfilename('fullpath');
 ScriptFolder = fileparts(ScriptPath);
 
-%First, see if a .mat file with all of the data exists. If so, then use
-%that and ignore everything else.
+%First, see if a binary or .mat file with all of the data exists. If so,
+%then use that and ignore everything else.
+if(exist([ScriptFolder,'/data/Coeff_Height_and_Depth_to2190_DTM2006.0.shcb'],'file'))
+    [C,S]=loadSpherHarmonicCoeffs([ScriptFolder,'/data/Coeff_Height_and_Depth_to2190_DTM2006.0.shcb'],M);
+    return
+end
+
 if(exist([ScriptFolder,'/data/Coeff_Height_and_Depth_to2190_DTM2006.0.mat'],'file'))
     load([ScriptFolder,'/data/Coeff_Height_and_Depth_to2190_DTM2006.0.mat'],'C','S');
 
@@ -131,6 +141,7 @@ S=S.clusterEls;
 %quickly next time.
 if(M==2190)
     save([ScriptFolder,'/data/Coeff_Height_and_Depth_to2190_DTM2006.0.mat'],'C','S')
+    saveSpherHarmonicCoeffs([ScriptFolder,'/data/Coeff_Height_and_Depth_to2190_DTM2006.0.shcb'],C,S,1,1);
 end
 end
 
@@ -101,13 +101,11 @@ switch(coeffType)
         error('Unknown coefficient type specified.')
 end
 
-data = fread(fileID,Inf,'double');
-fclose(fileID); 
-
-%Note that data(1) should be zero. data(1) is the degree of the lowest
-%degree coefficient. data(2) is the degree of the maximum degree
+%Note that header(1) should be zero. header(1) is the degree of the lowest
+%degree coefficient. header(2) is the degree of the maximum degree
 %coefficient.
-maxDeg = data(2);
+header=fread(fileID,2,'double');
+maxDeg=header(2);
 maxNumCoeffs=(maxDeg+1)*(maxDeg+2)/2;
 
 if(nargin<1||isempty(M))
@@ -116,10 +114,12 @@ end
 
 totalNumCoeffs=(M+1)*(M+2)/2;
 
-%Extract the data. The additive 2 skips the first two entries, which
-%indicate the lowest and highest coefficient degrees.
-C=data((2+1):(2+totalNumCoeffs));
-S=data((2+maxNumCoeffs+1):(2+maxNumCoeffs+totalNumCoeffs));
+%Only read the coefficients up to degree M. The additive 2 skips the first
+%two entries, which indicate the lowest and highest coefficient degrees.
+C=fread(fileID,totalNumCoeffs,'double');
+fseek(fileID,8*(2+maxNumCoeffs),'bof');
+S=fread(fileID,totalNumCoeffs,'double');
+fclose(fileID);
 end
 
 %LICENSE: